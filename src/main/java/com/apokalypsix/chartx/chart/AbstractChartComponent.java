@@ -22,6 +22,8 @@ import java.util.List;
 import java.util.Map;
 import java.util.UUID;
 import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.locks.Lock;
+import java.util.concurrent.locks.ReentrantLock;
 
 import javax.swing.JComponent;
 import javax.swing.JLayeredPane;
@@ -152,6 +154,10 @@ public abstract class AbstractChartComponent extends JPanel implements ModifierS
 	protected transient Point lastMousePoint;
 	protected transient boolean isPanning = false;
 
+	// Guards chart state against a frame rendering on the render thread
+	protected final transient ReentrantLock stateLock = new ReentrantLock();
+	protected transient boolean renderThreadEnabled = false;
+
 	// UI components (transient - UI state)
 	protected transient ChartUIConfig uiConfig;
 	protected transient ChartSidebar sidebar;
@@ -487,7 +493,12 @@ public abstract class AbstractChartComponent extends JPanel implements ModifierS
 		ModifierMouseEventArgs args = ModifierEventPool.acquireMouseArgs();
 		try {
 			args.populate(e, scaleForHiDPI(e.getX()), scaleForHiDPI(e.getY()), this);
-			handler.apply(args);
+			stateLock.lock();
+			try {
+				handler.apply(args);
+			} finally {
+				stateLock.unlock();
+			}
 			if (args.isHandled()) {
 				repaint();
 			}
@@ -514,7 +525,12 @@ public abstract class AbstractChartComponent extends JPanel implements ModifierS
 			}
 			lastMousePoint = e.getPoint();
 
-			modifierGroup.onMouseDragged(args);
+			stateLock.lock();
+			try {
+				modifierGroup.onMouseDragged(args);
+			} finally {
+				stateLock.unlock();
+			}
 			repaint();
 		} finally {
 			ModifierEventPool.release(args);
@@ -528,9 +544,16 @@ public abstract class AbstractChartComponent extends JPanel implements ModifierS
 		ModifierMouseEventArgs args = ModifierEventPool.acquireMouseArgs();
 		try {
 			args.populateWheel(e, scaleForHiDPI(e.getX()), scaleForHiDPI(e.getY()), this);
-			modifierGroup.onMouseWheel(args);
+			stateLock.lock();
+			try {
+				modifierGroup.onMouseWheel(args);
+				if (args.isHandled()) {
+					onViewportChanged();
+				}
+			} finally {
+				stateLock.unlock();
+			}
 			if (args.isHandled()) {
-				onViewportChanged();
 				repaint();
 			}
 		} finally {
@@ -545,7 +568,12 @@ public abstract class AbstractChartComponent extends JPanel implements ModifierS
 		ModifierKeyEventArgs args = ModifierEventPool.acquireKeyArgs();
 		try {
 			args.populate(e, this);
-			handler.apply(args);
+			stateLock.lock();
+			try {
+				handler.apply(args);
+			} finally {
+				stateLock.unlock();
+			}
 			if (args.isHandled()) {
 				repaint();
 			}
@@ -1131,6 +1159,41 @@ public abstract class AbstractChartComponent extends JPanel implements ModifierS
 		return renderStrategy;
 	}
 
+	@Override
+	public Lock getStateLock() {
+		return stateLock;
+	}
+
+	/**
+	 * Enables rendering on a dedicated thread instead of the Swing EDT.
+	 *
+	 * <p>While enabled, mouse and key handling on the EDT only updates chart
+	 * state under {@link #getStateLock()} and requests a frame; vertex building
+	 * and drawing happen on the render thread, which presents finished frames
+	 * back to Swing. Application code that changes layers or the viewport from
+	 * outside event dispatch should hold the state lock. Has no effect for
+	 * backends whose rendering is bound to the EDT (OpenGL via GLJPanel).
+	 *
+	 * @param enabled true to render on a dedicated thread
+	 */
+	public void setRenderThreadEnabled(boolean enabled) {
+		if (!renderStrategy.supportsRenderThread()) {
+			log.debug("{} backend renders on the EDT; render thread not enabled",
+					renderStrategy.getBackendName());
+			return;
+		}
+		renderThreadEnabled = enabled;
+		renderStrategy.setRenderThreadEnabled(enabled, stateLock);
+		repaint();
+	}
+
+	/**
+	 * Returns true if frames are rendered on a dedicated thread.
+	 */
+	public boolean isRenderThreadEnabled() {
+		return renderThreadEnabled;
+	}
+
 	public YAxisManager getAxisManager() {
 		return axisManager;
 	}
@@ -1397,19 +1460,34 @@ public abstract class AbstractChartComponent extends JPanel implements ModifierS
 
 	@Override
 	public void dispatchMouseMoved(ModifierMouseEventArgs args) {
-		modifierGroup.onMouseMoved(args);
+		stateLock.lock();
+		try {
+			modifierGroup.onMouseMoved(args);
+		} finally {
+			stateLock.unlock();
+		}
 		repaint();
 	}
 
 	@Override
 	public void dispatchMouseEntered(ModifierMouseEventArgs args) {
-		modifierGroup.onMouseEntered(args);
+		stateLock.lock();
+		try {
+			modifierGroup.onMouseEntered(args);
+		} finally {
+			stateLock.unlock();
+		}
 		repaint();
 	}
 
 	@Override
 	public void dispatchMouseExited(ModifierMouseEventArgs args) {
-		modifierGroup.onMouseExited(args);
+		stateLock.lock();
+		try {
+			modifierGroup.onMouseExited(args);
+		} finally {
+			stateLock.unlock();
+		}
 		repaint();
 	}
 
@@ -907,8 +907,8 @@ public class Chart extends AbstractChartComponent {
         }
 
         // Get min/max values from all series
-        double min = multiSeriesLayer.getMinValue(startIdx, endIdx);
-        double max = multiSeriesLayer.getMaxValue(startIdx, endIdx);
+        double min = multiSeriesLayer.getMinValue(startIdx, endIdx, viewport.getStartTime());
+        double max = multiSeriesLayer.getMaxValue(startIdx, endIdx, viewport.getStartTime());
 
         if (Double.isNaN(min) || Double.isNaN(max) || min >= max) {
             return;
@@ -89,6 +89,7 @@ public class ChartLayout extends JPanel implements Chart.RangeChangeListener, Ab
     private final MouseEventGroup mouseEventGroup = new MouseEventGroup("chartLayout");
     private boolean syncTimeAxis = true;
     private boolean syncCrosshair = true;
+    private boolean shareIndicatorOutputs = false;
 
     // ========== Dividers ==========
 
@@ -236,6 +237,9 @@ public class ChartLayout extends JPanel implements Chart.RangeChangeListener, Ab
             mouseEventGroup.add(chart);
         }
 
+        // When enabled, charts on the same source data compute each indicator once
+        chart.getIndicatorManager().setShareOutputs(shareIndicatorOutputs);
+
         // Sync visible range from existing charts
         syncRangeFromExistingCharts();
         chart.setVisibleRange(rangeStart, rangeEnd);
@@ -265,6 +269,7 @@ public class ChartLayout extends JPanel implements Chart.RangeChangeListener, Ab
         ChartSlot slot = charts.remove(id);
         if (slot != null) {
             slot.chart.setRangeChangeListener(null);
+            slot.chart.getIndicatorManager().setShareOutputs(false);
             mouseEventGroup.remove(slot.chart);
             remove(slot.chart);
             layoutCharts();
@@ -383,6 +388,29 @@ public class ChartLayout extends JPanel implements Chart.RangeChangeListener, Ab
         return syncCrosshair;
     }
 
+    /**
+     * Returns whether charts share indicator outputs.
+     */
+    public boolean isShareIndicatorOutputs() {
+        return shareIndicatorOutputs;
+    }
+
+    /**
+     * Sets whether charts in this layout share indicator outputs.
+     *
+     * <p>When enabled, charts displaying the same source data take indicator
+     * outputs from the process-wide
+     * {@link com.apokalypsix.chartx.core.data.SharedDataCache} instead of each
+     * computing their own. Disabled by default. Takes effect on the next
+     * indicator calculation.
+     */
+    public void setShareIndicatorOutputs(boolean share) {
+        this.shareIndicatorOutputs = share;
+        for (ChartSlot slot : charts.values()) {
+            slot.chart.getIndicatorManager().setShareOutputs(share);
+        }
+    }
+
     /**
      * Sets whether crosshair synchronization is enabled.
      */
@@ -54,6 +54,44 @@ public interface AxisScale {
      */
     double interpolate(double normalized, double min, double max);
 
+    /**
+     * Returns true if this scale is linear in {@link #toLinearSpace(double)},
+     * i.e. {@code normalize(v, min, max)} equals
+     * {@code (t(v) - t(min)) / (t(max) - t(min))} for valid ranges.
+     *
+     * <p>Coordinate systems use this to precompute per-axis affine constants
+     * once per frame and transform whole columns without calling
+     * {@link #normalize(double, double, double)} for every point.
+     *
+     * @return true if {@link #toLinearSpace(double)} linearizes this scale
+     */
+    default boolean isLinearizable() {
+        return false;
+    }
+
+    /**
+     * Maps a value into the space in which this scale is linear.
+     *
+     * <p>Identity for linear scales, the natural logarithm for logarithmic
+     * scales. Only meaningful if {@link #isLinearizable()} returns true.
+     *
+     * @param value the value
+     * @return the value in linear space, or NaN if it cannot be represented
+     */
+    default double toLinearSpace(double value) {
+        return value;
+    }
+
+    /**
+     * Inverse of {@link #toLinearSpace(double)}.
+     *
+     * @param linearValue a value in linear space
+     * @return the corresponding axis value
+     */
+    default double fromLinearSpace(double linearValue) {
+        return linearValue;
+    }
+
     /**
      * Calculates grid/label levels for the given range.
      *
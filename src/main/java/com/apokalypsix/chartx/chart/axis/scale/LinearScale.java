@@ -37,6 +37,11 @@ public final class LinearScale implements AxisScale {
         return min + normalized * (max - min);
     }
 
+    @Override
+    public boolean isLinearizable() {
+        return true;
+    }
+
     @Override
     public double[] calculateGridLevels(double min, double max, int targetCount) {
         double range = max - min;
@@ -48,6 +48,10 @@ public final class LogarithmicScale implements AxisScale {
     private final double logBase;  // Cached log(base) for efficiency
     private final boolean useScientificNotation;
 
+    // Logs of the last normalized range; the range is the same for every
+    // point of a frame, so normalize only needs one log per value
+    private volatile LogRange lastRange = new LogRange(1, 10);
+
     /**
      * Creates a logarithmic scale with the given base.
      *
@@ -93,16 +97,13 @@ public final class LogarithmicScale implements AxisScale {
             return 0.5;
         }
 
-        double logMin = Math.log(min) / logBase;
-        double logMax = Math.log(max) / logBase;
-        double logValue = Math.log(value) / logBase;
-
-        double logSpan = logMax - logMin;
-        if (logSpan == 0) {
+        // The base cancels out of the ratio, so natural logs are used throughout
+        LogRange range = logRange(min, max);
+        if (range.lnSpan == 0) {
             return 0.5;
         }
 
-        return (logValue - logMin) / logSpan;
+        return (Math.log(value) - range.lnMin) / range.lnSpan;
     }
 
     @Override
@@ -112,11 +113,53 @@ public final class LogarithmicScale implements AxisScale {
             return min;
         }
 
-        double logMin = Math.log(min) / logBase;
-        double logMax = Math.log(max) / logBase;
+        LogRange range = logRange(min, max);
+        return Math.exp(range.lnMin + normalized * range.lnSpan);
+    }
+
+    @Override
+    public boolean isLinearizable() {
+        return true;
+    }
+
+    /**
+     * Returns the natural logarithm of the value, or NaN for values that
+     * cannot be shown on a logarithmic axis.
+     */
+    @Override
+    public double toLinearSpace(double value) {
+        return value > 0 ? Math.log(value) : Double.NaN;
+    }
+
+    @Override
+    public double fromLinearSpace(double linearValue) {
+        return Math.exp(linearValue);
+    }
 
-        double logValue = logMin + normalized * (logMax - logMin);
-        return Math.pow(base, logValue);
+    private LogRange logRange(double min, double max) {
+        LogRange range = lastRange;
+        if (range.min != min || range.max != max) {
+            range = new LogRange(min, max);
+            lastRange = range;
+        }
+        return range;
+    }
+
+    /**
+     * Immutable cache of a range's natural logs, safe to share across threads.
+     */
+    private static final class LogRange {
+        final double min;
+        final double max;
+        final double lnMin;
+        final double lnSpan;
+
+        LogRange(double min, double max) {
+            this.min = min;
+            this.max = max;
+            this.lnMin = Math.log(min);
+            this.lnSpan = Math.log(max) - lnMin;
+        }
     }
 
     @Override
@@ -87,6 +87,12 @@ public final class PercentageScale implements AxisScale {
         return min + normalized * (max - min);
     }
 
+    @Override
+    public boolean isLinearizable() {
+        // Only the labels are in percent; positions are linear in the value
+        return true;
+    }
+
     @Override
     public double[] calculateGridLevels(double min, double max, int targetCount) {
         // Calculate percentage range
@@ -39,6 +39,9 @@ public abstract class AbstractData<T> implements Data<T> {
     // Listener support for real-time updates
     protected final DataListenerSupport listenerSupport = new DataListenerSupport();
 
+    // Incremented by bulk loads, which do not notify listeners
+    private volatile int loadCount;
+
     /**
      * Creates data with the specified ID and name.
      */
@@ -222,6 +225,21 @@ public abstract class AbstractData<T> implements Data<T> {
         listenerSupport.fireDataCleared(this);
     }
 
+    // ========== Bulk loads ==========
+
+    @Override
+    public int getLoadCount() {
+        return loadCount;
+    }
+
+    /**
+     * Records a bulk load. Subclasses call this from their bulk loading
+     * methods after the arrays have been replaced.
+     */
+    protected void markBulkLoaded() {
+        loadCount++;
+    }
+
     // ========== Raw array access ==========
 
     /**
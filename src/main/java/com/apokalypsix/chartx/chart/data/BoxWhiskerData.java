@@ -295,6 +295,7 @@ public class BoxWhiskerData extends AbstractData<float[]> {
             System.arraycopy(labels, 0, this.labels, 0, length);
         }
         this.size = length;
+        markBulkLoaded();
     }
 
     private void validateOrder(float min, float q1, float median, float q3, float max) {
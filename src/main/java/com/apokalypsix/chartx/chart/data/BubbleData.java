@@ -176,6 +176,7 @@ public class BubbleData extends AbstractData<float[]> {
         System.arraycopy(values, 0, this.values, 0, length);
         System.arraycopy(sizes, 0, this.sizes, 0, length);
         this.size = length;
+        markBulkLoaded();
     }
 
     // ========== Raw array access ==========
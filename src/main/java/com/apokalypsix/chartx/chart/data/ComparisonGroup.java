@@ -0,0 +1,219 @@
+package com.apokalypsix.chartx.chart.data;
+
+import com.apokalypsix.chartx.core.data.ComparisonIndex;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * A group of XyData series compared on one chart, each rebased to the first
+ * visible bar.
+ *
+ * <p>The series are aligned on a unified timeline (see
+ * {@link ComparisonIndex}). At every frame, each series is rebased so that
+ * its value as of the first visible timeline row equals the base value
+ * (100 by default). Rebasing is a single factor per series, recomputed only
+ * when the anchor row or the data changes, and applied by the renderer in
+ * the coordinate transform. The data itself is never rewritten, so panning
+ * costs O(log n) per series instead of a pass over every point.
+ *
+ * <p>Usage:
+ * <pre>{@code
+ * ComparisonGroup group = new ComparisonGroup("cmp", "Comparison");
+ * for (XyData closes : symbols) {
+ *     group.addSeries(closes);
+ *     LineSeries line = new LineSeries(closes);
+ *     line.setComparison(group);
+ *     chart.addSeries(line);
+ * }
+ * // Labels show the change from the first visible bar
+ * chart.getYAxis().setScale(new PercentageScale(group.getBaseValue()));
+ * }</pre>
+ */
+public class ComparisonGroup {
+
+    /** Default value every series is rebased to */
+    public static final double DEFAULT_BASE_VALUE = 100.0;
+
+    private final String id;
+    private final String name;
+    private final List<XyData> seriesList = new ArrayList<>();
+
+    private double baseValue = DEFAULT_BASE_VALUE;
+
+    // Created on demand, rebuilt when the series list changes
+    private ComparisonIndex index;
+
+    // Rebase factors per series for the cached anchor
+    private float[] scales = new float[0];
+    private long anchorTime = Long.MIN_VALUE;
+    private int anchorRow = -1;
+    private int scalesModCount;
+    private boolean scalesValid;
+
+    /**
+     * Creates a new comparison group.
+     *
+     * @param id unique identifier for this group
+     * @param name display name for the group
+     */
+    public ComparisonGroup(String id, String name) {
+        this.id = id;
+        this.name = name;
+    }
+
+    /**
+     * Returns the group ID.
+     */
+    public String getId() {
+        return id;
+    }
+
+    /**
+     * Returns the group name.
+     */
+    public String getName() {
+        return name;
+    }
+
+    /**
+     * Returns the number of series in the group.
+     */
+    public int size() {
+        return seriesList.size();
+    }
+
+    /**
+     * Adds a series to the group.
+     *
+     * @param series the series to add
+     * @return this for chaining
+     */
+    public synchronized ComparisonGroup addSeries(XyData series) {
+        if (series == null) {
+            throw new IllegalArgumentException("Series cannot be null");
+        }
+        if (!seriesList.contains(series)) {
+            seriesList.add(series);
+            resetIndex();
+        }
+        return this;
+    }
+
+    /**
+     * Removes a series from the group.
+     *
+     * @param series the series to remove
+     * @return true if the series was found and removed
+     */
+    public synchronized boolean removeSeries(XyData series) {
+        if (seriesList.remove(series)) {
+            resetIndex();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Returns an unmodifiable view of the series list.
+     */
+    public List<XyData> getSeriesList() {
+        return Collections.unmodifiableList(seriesList);
+    }
+
+    /**
+     * Sets the value every series takes at the anchor row.
+     *
+     * @param baseValue the base value, e.g. 100 or 1
+     */
+    public synchronized void setBaseValue(double baseValue) {
+        if (baseValue == 0 || Double.isNaN(baseValue)) {
+            throw new IllegalArgumentException("Base value must be non-zero");
+        }
+        this.baseValue = baseValue;
+        scalesValid = false;
+    }
+
+    public double getBaseValue() {
+        return baseValue;
+    }
+
+    /**
+     * Returns the unified timeline of the series, creating it on first use.
+     */
+    public synchronized ComparisonIndex getIndex() {
+        if (index == null) {
+            index = new ComparisonIndex(seriesList.toArray(new XyData[0]));
+        }
+        return index;
+    }
+
+    /**
+     * Returns the factor that rebases a series, anchored at the first
+     * timeline row at or after the given time.
+     *
+     * <p>The factors of all series are computed together and cached until
+     * the anchor row or the data changes, so calling this from every series'
+     * render pass with the viewport start time is cheap.
+     *
+     * @param series a series of this group
+     * @param time the anchor time, typically the viewport start
+     * @return the factor, or NaN if the series is not in the group or has no
+     *         valid value to rebase on
+     */
+    public synchronized double getRebaseScale(XyData series, long time) {
+        ComparisonIndex idx = getIndex();
+        int s = idx.indexOf(series);
+        if (s < 0) {
+            return Double.NaN;
+        }
+
+        int modCount = idx.getModCount();
+        if (!scalesValid || time != anchorTime || modCount != scalesModCount) {
+            int row = idx.findRow(time);
+            if (!scalesValid || row != anchorRow || modCount != scalesModCount) {
+                rebase(idx, row);
+                anchorRow = row;
+            }
+            anchorTime = time;
+            scalesModCount = modCount;
+            scalesValid = true;
+        }
+        return scales[s];
+    }
+
+    /**
+     * Returns the time of the last anchor passed to {@link #getRebaseScale},
+     * or {@code Long.MIN_VALUE} if none.
+     */
+    public synchronized long getAnchorTime() {
+        return anchorTime;
+    }
+
+    /**
+     * Stops tracking the series.
+     */
+    public synchronized void dispose() {
+        resetIndex();
+    }
+
+    private void rebase(ComparisonIndex idx, int row) {
+        int count = idx.getSourceCount();
+        if (scales.length != count) {
+            scales = new float[count];
+        }
+        for (int s = 0; s < count; s++) {
+            float anchor = idx.getValueAsOf(s, row);
+            scales[s] = anchor != 0 ? (float) (baseValue / anchor) : Float.NaN;
+        }
+    }
+
+    private void resetIndex() {
+        if (index != null) {
+            index.dispose();
+            index = null;
+        }
+        scalesValid = false;
+    }
+}
@@ -126,4 +126,15 @@ public interface Data<T> {
      * @param listener the listener to remove
      */
     void removeListener(DataListener listener);
+
+    /**
+     * Returns a counter that changes whenever the data is replaced by a bulk
+     * load, which does not notify listeners.
+     *
+     * <p>Caches kept current through listener events compare this counter
+     * to detect replaced data. Data without bulk loads returns 0.
+     */
+    default int getLoadCount() {
+        return 0;
+    }
 }
@@ -5,13 +5,25 @@ import com.apokalypsix.chartx.core.data.DataListenerSupport;
 
 import java.awt.Color;
 import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 
 /**
  * Data for Gantt chart series.
  *
  * <p>Stores tasks with start/end times, dependencies, progress,
  * and optional milestones.
+ *
+ * <p>Tasks are indexed per row, sorted by start time with a running maximum
+ * of end times, so window queries ({@link #getTasksInWindow}) and hit tests
+ * binary search into only the rows they cover. The index is extended in
+ * place when tasks are added and rebuilt lazily after tasks are moved or
+ * removed. Once {@link #autoAssignRows()} has run, newly added unassigned
+ * tasks are packed incrementally into the first free row.
  */
 public class GanttData {
 
@@ -27,6 +39,8 @@ public class GanttData {
         private Color color;
         private int row; // vertical position
         private String group; // optional grouping
+        private GanttData owner; // set when added, for index invalidation
+        private long sequence; // insertion order, for query results
 
         public Task(String id, String name, long startTime, long endTime) {
             this.id = id;
@@ -56,6 +70,7 @@ public class GanttData {
 
         public void setStartTime(long startTime) {
             this.startTime = startTime;
+            notifyOwner();
         }
 
         public long getEndTime() {
@@ -64,6 +79,7 @@ public class GanttData {
 
         public void setEndTime(long endTime) {
             this.endTime = endTime;
+            notifyOwner();
         }
 
         public long getDuration() {
@@ -92,6 +108,7 @@ public class GanttData {
 
         public void setRow(int row) {
             this.row = row;
+            notifyOwner();
         }
 
         public String getGroup() {
@@ -105,6 +122,12 @@ public class GanttData {
         public boolean contains(long time) {
             return time >= startTime && time <= endTime;
         }
+
+        private void notifyOwner() {
+            if (owner != null) {
+                owner.onTaskGeometryChanged();
+            }
+        }
     }
 
     /**
@@ -200,6 +223,154 @@ public class GanttData {
         START_TO_FINISH
     }
 
+    /**
+     * Tasks of one row sorted by start time, with a running maximum of end
+     * times. The running maximum is monotonic, so the first task that can
+     * reach a given time is found by binary search even when tasks overlap.
+     */
+    private static final class RowIndex {
+        private Task[] tasks = new Task[4];
+        private long[] maxEnd = new long[4];
+        private int size;
+
+        void add(Task task) {
+            if (size == tasks.length) {
+                int newCapacity = size + (size >> 1) + 1;
+                tasks = Arrays.copyOf(tasks, newCapacity);
+                maxEnd = Arrays.copyOf(maxEnd, newCapacity);
+            }
+            tasks[size++] = task;
+        }
+
+        void insertSorted(Task task) {
+            add(task);
+            int pos = size - 1;
+            while (pos > 0 && tasks[pos - 1].getStartTime() > task.getStartTime()) {
+                tasks[pos] = tasks[pos - 1];
+                pos--;
+            }
+            tasks[pos] = task;
+            updateMaxEnd(pos);
+        }
+
+        void clear() {
+            Arrays.fill(tasks, 0, size, null);
+            size = 0;
+        }
+
+        void sort() {
+            Arrays.sort(tasks, 0, size, (a, b) -> Long.compare(a.getStartTime(), b.getStartTime()));
+            updateMaxEnd(0);
+        }
+
+        private void updateMaxEnd(int from) {
+            long running = from > 0 ? maxEnd[from - 1] : Long.MIN_VALUE;
+            for (int i = from; i < size; i++) {
+                running = Math.max(running, tasks[i].getEndTime());
+                maxEnd[i] = running;
+            }
+        }
+
+        /** First index whose task could end at or after the given time. */
+        int firstEndingAtOrAfter(long time) {
+            int low = 0;
+            int high = size;
+            while (low < high) {
+                int mid = (low + high) >>> 1;
+                if (maxEnd[mid] >= time) {
+                    high = mid;
+                } else {
+                    low = mid + 1;
+                }
+            }
+            return low;
+        }
+
+        /** Index one past the last task starting at or before the given time. */
+        int endStartingAtOrBefore(long time) {
+            int low = 0;
+            int high = size;
+            while (low < high) {
+                int mid = (low + high) >>> 1;
+                if (tasks[mid].getStartTime() <= time) {
+                    low = mid + 1;
+                } else {
+                    high = mid;
+                }
+            }
+            return low;
+        }
+
+        void collect(long startTime, long endTime, List<Task> result) {
+            int from = firstEndingAtOrAfter(startTime);
+            int to = endStartingAtOrBefore(endTime);
+            for (int i = from; i < to; i++) {
+                if (tasks[i].getEndTime() >= startTime) {
+                    result.add(tasks[i]);
+                }
+            }
+        }
+    }
+
+    /**
+     * Greedy row packer backed by a min-tree over row end times, so the
+     * first row free at a given start time is found in O(log rows).
+     */
+    private static final class RowPacker {
+        private long[] tree = {Long.MAX_VALUE, Long.MAX_VALUE};
+        private int leafBase = 1;
+        private int rowCount;
+
+        int getRowCount() {
+            return rowCount;
+        }
+
+        long getEndTime(int row) {
+            return tree[leafBase + row];
+        }
+
+        void ensureRow(int row) {
+            while (row >= leafBase) {
+                grow();
+            }
+            while (rowCount <= row) {
+                set(rowCount++, Long.MIN_VALUE);
+            }
+        }
+
+        void set(int row, long endTime) {
+            int node = leafBase + row;
+            tree[node] = endTime;
+            for (node >>= 1; node > 0; node >>= 1) {
+                tree[node] = Math.min(tree[2 * node], tree[2 * node + 1]);
+            }
+        }
+
+        /** Returns the first row whose last task ends at or before the time, or -1. */
+        int findFirstFreeRow(long time) {
+            if (tree[1] > time) {
+                return -1;
+            }
+            int node = 1;
+            while (node < leafBase) {
+                node = tree[2 * node] <= time ? 2 * node : 2 * node + 1;
+            }
+            return node - leafBase;
+        }
+
+        private void grow() {
+            int newBase = leafBase * 2;
+            long[] newTree = new long[2 * newBase];
+            Arrays.fill(newTree, Long.MAX_VALUE);
+            System.arraycopy(tree, leafBase, newTree, newBase, leafBase);
+            for (int node = newBase - 1; node > 0; node--) {
+                newTree[node] = Math.min(newTree[2 * node], newTree[2 * node + 1]);
+            }
+            tree = newTree;
+            leafBase = newBase;
+        }
+    }
+
     private final String id;
     private final String name;
 
@@ -213,6 +384,24 @@ public class GanttData {
     private int maxRow = -1;
     private boolean boundsValid = false;
 
+    // Lookup and spatial indexes
+    private final Map<String, Task> tasksById = new HashMap<>();
+    private final Map<String, List<Dependency>> dependenciesFrom = new HashMap<>();
+    private final Map<String, List<Dependency>> dependenciesTo = new HashMap<>();
+    private final List<RowIndex> rowIndex = new ArrayList<>();
+    private final RowIndex unassignedIndex = new RowIndex();
+    private boolean indexValid = false;
+
+    // Query results keep the order in which tasks were added
+    private static final Comparator<Task> INSERTION_ORDER = Comparator.comparingLong(task -> task.sequence);
+    private long nextSequence;
+
+    // Incremental packing state, active after autoAssignRows(); rebuilt
+    // from the tasks' rows after tasks are moved or removed
+    private RowPacker packer;
+    private boolean packerValid;
+    private int milestoneRow = -1;
+
     private final DataListenerSupport listenerSupport = new DataListenerSupport();
 
     /**
@@ -241,18 +430,38 @@ public class GanttData {
      */
     public Task addTask(String taskId, String taskName, long startTime, long endTime) {
         Task task = new Task(taskId, taskName, startTime, endTime);
-        tasks.add(task);
-        boundsValid = false;
-        listenerSupport.fireDataAppended(null, tasks.size() - 1);
+        addTask(task);
         return task;
     }
 
     /**
      * Adds an existing task to the chart.
+     *
+     * <p>If rows have been auto-assigned before, an unassigned task is
+     * packed into the first row that is free at its start time.
      */
     public void addTask(Task task) {
+        if (packer != null) {
+            ensurePacker();
+            packTask(task);
+        }
+        task.owner = this;
+        task.sequence = nextSequence++;
         tasks.add(task);
-        boundsValid = false;
+        tasksById.putIfAbsent(task.getId(), task);
+
+        if (indexValid) {
+            if (task.getRow() >= 0) {
+                ensureRowIndex(task.getRow()).insertSorted(task);
+            } else {
+                unassignedIndex.insertSorted(task);
+            }
+        }
+        if (boundsValid) {
+            minTime = Math.min(minTime, task.getStartTime());
+            maxTime = Math.max(maxTime, task.getEndTime());
+            maxRow = Math.max(maxRow, task.getRow());
+        }
         listenerSupport.fireDataAppended(null, tasks.size() - 1);
     }
 
@@ -267,12 +476,7 @@ public class GanttData {
      * Returns a task by ID.
      */
     public Task getTask(String taskId) {
-        for (Task task : tasks) {
-            if (task.getId().equals(taskId)) {
-                return task;
-            }
-        }
-        return null;
+        return tasksById.get(taskId);
     }
 
     /**
@@ -288,8 +492,18 @@ public class GanttData {
     public boolean removeTask(String taskId) {
         for (int i = 0; i < tasks.size(); i++) {
             if (tasks.get(i).getId().equals(taskId)) {
-                tasks.remove(i);
+                Task removed = tasks.remove(i);
+                removed.owner = null;
+                tasksById.remove(taskId);
+                for (Task task : tasks) {
+                    if (task.getId().equals(taskId)) {
+                        tasksById.put(taskId, task);
+                        break;
+                    }
+                }
                 boundsValid = false;
+                indexValid = false;
+                packerValid = false;
                 listenerSupport.fireDataUpdated(null, i);
                 return true;
             }
@@ -322,14 +536,17 @@ public class GanttData {
      * Adds a dependency between tasks.
      */
     public void addDependency(String fromTaskId, String toTaskId) {
-        dependencies.add(new Dependency(fromTaskId, toTaskId));
+        addDependency(fromTaskId, toTaskId, DependencyType.FINISH_TO_START);
     }
 
     /**
      * Adds a typed dependency between tasks.
      */
     public void addDependency(String fromTaskId, String toTaskId, DependencyType type) {
-        dependencies.add(new Dependency(fromTaskId, toTaskId, type));
+        Dependency dep = new Dependency(fromTaskId, toTaskId, type);
+        dependencies.add(dep);
+        dependenciesFrom.computeIfAbsent(fromTaskId, k -> new ArrayList<>()).add(dep);
+        dependenciesTo.computeIfAbsent(toTaskId, k -> new ArrayList<>()).add(dep);
     }
 
     /**
@@ -343,13 +560,16 @@ public class GanttData {
      * Returns dependencies originating from a task.
      */
     public List<Dependency> getDependenciesFrom(String taskId) {
-        List<Dependency> result = new ArrayList<>();
-        for (Dependency dep : dependencies) {
-            if (dep.getFromTaskId().equals(taskId)) {
-                result.add(dep);
-            }
-        }
-        return result;
+        List<Dependency> deps = dependenciesFrom.get(taskId);
+        return deps != null ? Collections.unmodifiableList(deps) : Collections.emptyList();
+    }
+
+    /**
+     * Returns dependencies ending at a task.
+     */
+    public List<Dependency> getDependenciesTo(String taskId) {
+        List<Dependency> deps = dependenciesTo.get(taskId);
+        return deps != null ? Collections.unmodifiableList(deps) : Collections.emptyList();
     }
 
     // ========== Bounds ==========
@@ -440,93 +660,200 @@ public class GanttData {
     /**
      * Auto-assigns rows to tasks that don't have explicit row assignments.
      * Uses a simple greedy algorithm to minimize overlaps.
+     *
+     * <p>After this call, tasks added without a row are packed incrementally
+     * using the same greedy rule.
      */
     public void autoAssignRows() {
         // Sort tasks by start time
         List<Task> sortedTasks = new ArrayList<>(tasks);
         sortedTasks.sort((a, b) -> Long.compare(a.getStartTime(), b.getStartTime()));
 
-        // Track row end times
-        List<Long> rowEndTimes = new ArrayList<>();
-
+        packer = new RowPacker();
         for (Task task : sortedTasks) {
-            if (task.getRow() >= 0) {
-                // Already assigned, ensure row exists
-                while (rowEndTimes.size() <= task.getRow()) {
-                    rowEndTimes.add(Long.MIN_VALUE);
-                }
-                rowEndTimes.set(task.getRow(), Math.max(rowEndTimes.get(task.getRow()), task.getEndTime()));
-                continue;
-            }
+            packTask(task);
+        }
 
-            // Find first available row
-            int assignedRow = -1;
-            for (int r = 0; r < rowEndTimes.size(); r++) {
-                if (rowEndTimes.get(r) <= task.getStartTime()) {
-                    assignedRow = r;
-                    break;
-                }
+        // Assign milestones to their own rows or same as related tasks
+        int row = packer.getRowCount();
+        milestoneRow = -1;
+        for (Milestone milestone : milestones) {
+            if (milestone.getRow() < 0) {
+                milestone.setRow(row);
+                milestoneRow = row;
             }
+        }
+        reserveMilestoneRow();
 
-            if (assignedRow < 0) {
-                // Need new row
-                assignedRow = rowEndTimes.size();
-                rowEndTimes.add(Long.MIN_VALUE);
+        packerValid = true;
+        boundsValid = false;
+        indexValid = false;
+    }
+
+    /**
+     * Rebuilds the packer from the current task rows after tasks were moved
+     * or removed, so rows are not packed against stale end times.
+     */
+    private void ensurePacker() {
+        if (packerValid) {
+            return;
+        }
+        packer = new RowPacker();
+        for (Task task : tasks) {
+            if (task.getRow() >= 0) {
+                packTask(task);
             }
+        }
+        reserveMilestoneRow();
+        packerValid = true;
+    }
 
-            task.setRow(assignedRow);
-            rowEndTimes.set(assignedRow, task.getEndTime());
+    private void reserveMilestoneRow() {
+        if (milestoneRow >= 0) {
+            // Never free, so tasks added later are not packed into it
+            packer.ensureRow(milestoneRow);
+            packer.set(milestoneRow, Long.MAX_VALUE);
         }
+    }
 
-        // Assign milestones to their own rows or same as related tasks
-        int milestoneRow = rowEndTimes.size();
-        for (Milestone milestone : milestones) {
-            if (milestone.getRow() < 0) {
-                milestone.setRow(milestoneRow);
+    /**
+     * Places a task into the packer, assigning the first free row if the
+     * task has none.
+     */
+    private void packTask(Task task) {
+        int row = task.getRow();
+        if (row < 0) {
+            row = packer.findFirstFreeRow(task.getStartTime());
+            if (row < 0) {
+                row = packer.getRowCount();
             }
+            task.row = row;
         }
+        packer.ensureRow(row);
+        packer.set(row, Math.max(packer.getEndTime(row), task.getEndTime()));
+    }
 
+    /**
+     * Called when a task's start, end or row changes after it was added.
+     */
+    private void onTaskGeometryChanged() {
         boundsValid = false;
+        indexValid = false;
+        packerValid = false;
+    }
+
+    // ========== Index ==========
+
+    private void ensureIndex() {
+        if (indexValid) {
+            return;
+        }
+        rowIndex.clear();
+        unassignedIndex.clear();
+        for (Task task : tasks) {
+            if (task.getRow() >= 0) {
+                ensureRowIndex(task.getRow()).add(task);
+            } else {
+                unassignedIndex.add(task);
+            }
+        }
+        for (RowIndex row : rowIndex) {
+            row.sort();
+        }
+        unassignedIndex.sort();
+        indexValid = true;
+    }
+
+    /**
+     * Returns the index of a row, the unassigned tasks for row -1, or null.
+     */
+    private RowIndex getRowIndex(int row) {
+        if (row == -1) {
+            return unassignedIndex;
+        }
+        return row >= 0 && row < rowIndex.size() ? rowIndex.get(row) : null;
+    }
+
+    private RowIndex ensureRowIndex(int row) {
+        while (rowIndex.size() <= row) {
+            rowIndex.add(new RowIndex());
+        }
+        return rowIndex.get(row);
     }
 
     // ========== Queries ==========
 
     /**
-     * Returns tasks visible in the given time range.
+     * Returns tasks visible in the given time range, including tasks without
+     * an assigned row, in the order they were added.
      */
     public List<Task> getTasksInRange(long startTime, long endTime) {
         List<Task> result = new ArrayList<>();
-        for (Task task : tasks) {
-            if (task.getEndTime() >= startTime && task.getStartTime() <= endTime) {
-                result.add(task);
-            }
-        }
+        getTasksInWindow(startTime, endTime, -1, Integer.MAX_VALUE, result);
+        result.sort(INSERTION_ORDER);
         return result;
     }
 
     /**
-     * Returns tasks at a specific row.
+     * Collects tasks intersecting the given time range within a row range.
+     *
+     * <p>Only the rows in range are visited, each with a binary search, so
+     * the cost is proportional to the visible window rather than the
+     * schedule size. Tasks without an assigned row are included when
+     * {@code firstRow} is -1.
+     *
+     * @param startTime start of the time window
+     * @param endTime end of the time window
+     * @param firstRow first row (inclusive), or -1 to include unassigned tasks
+     * @param lastRow last row (inclusive)
+     * @param result list to append matching tasks to, ordered by row then start
+     */
+    public void getTasksInWindow(long startTime, long endTime, int firstRow, int lastRow,
+                                 List<Task> result) {
+        ensureIndex();
+        if (firstRow < 0) {
+            unassignedIndex.collect(startTime, endTime, result);
+        }
+        int last = Math.min(lastRow, rowIndex.size() - 1);
+        for (int row = Math.max(0, firstRow); row <= last; row++) {
+            rowIndex.get(row).collect(startTime, endTime, result);
+        }
+    }
+
+    /**
+     * Returns tasks at a specific row (-1 for unassigned tasks), in the order
+     * they were added.
      */
     public List<Task> getTasksAtRow(int row) {
+        ensureIndex();
         List<Task> result = new ArrayList<>();
-        for (Task task : tasks) {
-            if (task.getRow() == row) {
-                result.add(task);
-            }
+        RowIndex index = getRowIndex(row);
+        if (index != null) {
+            result.addAll(Arrays.asList(index.tasks).subList(0, index.size));
+            result.sort(INSERTION_ORDER);
         }
         return result;
     }
 
     /**
-     * Finds the task at a given time and row.
+     * Finds the task at a given time and row. If tasks overlap, the one
+     * added first is returned.
      */
     public Task findTaskAt(long time, int row) {
-        for (Task task : tasks) {
-            if (task.getRow() == row && task.contains(time)) {
-                return task;
+        ensureIndex();
+        RowIndex index = getRowIndex(row);
+        if (index == null) {
+            return null;
+        }
+        Task found = null;
+        int to = index.endStartingAtOrBefore(time);
+        for (int i = index.firstEndingAtOrAfter(time); i < to; i++) {
+            Task task = index.tasks[i];
+            if (task.contains(time) && (found == null || task.sequence < found.sequence)) {
+                found = task;
             }
         }
-        return null;
+        return found;
     }
 
     // ========== Listener Management ==========
@@ -137,20 +137,28 @@ public class GroupedColumnData extends AbstractData<float[]> {
 
     /**
      * Returns the first index visible in the given X range.
-     * For category data, this always returns 0 if data exists.
+     * For category data the X range is in index units; one extra category is
+     * included so a partially visible bar at the left edge is still drawn.
      */
     @Override
     public int getFirstVisibleIndex(long minX) {
-        return size > 0 ? 0 : -1;
+        if (size == 0 || minX > size) {
+            return -1;
+        }
+        return (int) Math.max(0, Math.min(minX - 1, size - 1));
     }
 
     /**
      * Returns the last index visible in the given X range.
-     * For category data, this always returns size - 1 if data exists.
+     * For category data the X range is in index units; one extra category is
+     * included so a partially visible bar at the right edge is still drawn.
      */
     @Override
     public int getLastVisibleIndex(long maxX) {
-        return size > 0 ? size - 1 : -1;
+        if (size == 0 || maxX < -1) {
+            return -1;
+        }
+        return (int) Math.min(size - 1, Math.max(maxX + 1, 0));
     }
 
     // ========== Group accessors ==========
@@ -345,6 +353,25 @@ public class GroupedColumnData extends AbstractData<float[]> {
         listenerSupport.fireDataUpdated(this, size - 1);
     }
 
+    /**
+     * Replaces a single group value at the given data index.
+     *
+     * <p>Listeners are notified for that category only, so renderers can
+     * refresh one bar without touching the rest of the data.
+     *
+     * @param index the data index
+     * @param groupIndex the group index
+     * @param value the new value
+     */
+    public void setValue(int index, int groupIndex, float value) {
+        checkIndex(index);
+        if (groupIndex < 0 || groupIndex >= groupCount) {
+            throw new IndexOutOfBoundsException("Group index: " + groupIndex);
+        }
+        groupValues[groupIndex][index] = value;
+        listenerSupport.fireDataUpdated(this, index);
+    }
+
     /**
      * Loads data from arrays. Replaces any existing data.
      *
@@ -386,5 +413,6 @@ public class GroupedColumnData extends AbstractData<float[]> {
             System.arraycopy(labels, 0, this.labels, 0, length);
         }
         this.size = length;
+        markBulkLoaded();
     }
 }
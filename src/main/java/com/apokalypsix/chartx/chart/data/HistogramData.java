@@ -157,6 +157,7 @@ public class HistogramData extends AbstractData<Float> {
         System.arraycopy(timestamps, 0, this.xValues, 0, length);
         System.arraycopy(values, 0, this.values, 0, length);
         this.size = length;
+        markBulkLoaded();
     }
 
     // ========== Raw array access ==========
@@ -1,8 +1,16 @@
 package com.apokalypsix.chartx.chart.data;
 
+import com.apokalypsix.chartx.chart.axis.scale.AxisScale;
 import com.apokalypsix.chartx.chart.data.OHLCBar;
+import com.apokalypsix.chartx.core.data.CandlePatternIndex;
+import com.apokalypsix.chartx.core.data.OhlcPyramid;
+import com.apokalypsix.chartx.core.data.PrefixSums;
+import com.apokalypsix.chartx.core.data.ScaledColumns;
+import com.apokalypsix.chartx.core.data.VwapSums;
 
 import java.util.Arrays;
+import java.util.HashMap;
+import java.util.Map;
 
 /**
  * High-performance OHLC (candlestick) data storage using primitive arrays.
@@ -23,6 +31,24 @@ public class OhlcData extends AbstractData<OHLCBar> {
     private float[] close;
     private float[] volume;
 
+    // Guards creation of the companion columns below
+    private final Object columnsLock = new Object();
+
+    // Price columns mapped into non-linear axis scales, created on demand
+    private final Map<AxisScale, ScaledColumns> scaledColumns = new HashMap<>(2);
+
+    // High/low pyramid for pixel-column aggregation, created on demand
+    private OhlcPyramid pyramid;
+
+    // Candlestick pattern bitsets, created on demand
+    private CandlePatternIndex patterns;
+
+    // Prefix sums over closes for O(1) range regression, created on demand
+    private PrefixSums prefixSums;
+
+    // Volume-weighted prefix sums for O(1) anchored VWAP, created on demand
+    private VwapSums vwapSums;
+
     /**
      * Creates empty OHLC data with the specified ID and name.
      */
@@ -202,6 +228,109 @@ public class OhlcData extends AbstractData<OHLCBar> {
         System.arraycopy(close, 0, this.close, 0, length);
         System.arraycopy(volume, 0, this.volume, 0, length);
         this.size = length;
+        // Companion columns detect the load through getLoadCount()
+        markBulkLoaded();
+    }
+
+    // ========== Scaled columns ==========
+
+    /**
+     * Returns the price columns mapped into the given scale's linear space,
+     * creating them on first use.
+     *
+     * <p>Used by renderers on logarithmic axes so each price is transformed
+     * once rather than once per frame.
+     *
+     * @param scale a scale whose {@link AxisScale#isLinearizable()} is true
+     * @return the shared scaled columns for this data and scale
+     */
+    public ScaledColumns getScaledColumns(AxisScale scale) {
+        synchronized (columnsLock) {
+            return scaledColumns.computeIfAbsent(scale, s -> new ScaledColumns(this, s));
+        }
+    }
+
+    /**
+     * Drops the scaled columns of a scale that is no longer displayed, e.g.
+     * after an axis scale was replaced. If another renderer still uses the
+     * scale, its columns are rebuilt on the next {@link #getScaledColumns}.
+     *
+     * @param scale the replaced scale
+     */
+    public void releaseScaledColumns(AxisScale scale) {
+        ScaledColumns columns;
+        synchronized (columnsLock) {
+            columns = scaledColumns.remove(scale);
+        }
+        if (columns != null) {
+            columns.dispose();
+        }
+    }
+
+    /**
+     * Returns the high/low pyramid of this data, creating it on first use.
+     *
+     * <p>Used by renderers to aggregate many bars per pixel column when
+     * zoomed far out.
+     *
+     * @return the shared pyramid for this data
+     */
+    public OhlcPyramid getPyramid() {
+        synchronized (columnsLock) {
+            if (pyramid == null) {
+                pyramid = new OhlcPyramid(this);
+            }
+            return pyramid;
+        }
+    }
+
+    /**
+     * Returns the candlestick pattern index of this data, creating it on
+     * first use.
+     *
+     * @return the shared pattern index for this data
+     */
+    public CandlePatternIndex getPatterns() {
+        synchronized (columnsLock) {
+            if (patterns == null) {
+                patterns = new CandlePatternIndex(this);
+            }
+            return patterns;
+        }
+    }
+
+    /**
+     * Returns the prefix sums over close prices, creating them on first use.
+     *
+     * <p>Used by regression channels, linear regression and measure
+     * statistics to fit any bar range in constant time.
+     *
+     * @return the shared prefix sums for this data
+     */
+    public PrefixSums getPrefixSums() {
+        synchronized (columnsLock) {
+            if (prefixSums == null) {
+                prefixSums = new PrefixSums(this, this::getCloseArray);
+            }
+            return prefixSums;
+        }
+    }
+
+    /**
+     * Returns the volume-weighted prefix sums, creating them on first use.
+     *
+     * <p>Used by anchored VWAP to evaluate any anchor at any bar in constant
+     * time.
+     *
+     * @return the shared VWAP sums for this data
+     */
+    public VwapSums getVwapSums() {
+        synchronized (columnsLock) {
+            if (vwapSums == null) {
+                vwapSums = new VwapSums(this);
+            }
+            return vwapSums;
+        }
     }
 
     // ========== View creation ==========
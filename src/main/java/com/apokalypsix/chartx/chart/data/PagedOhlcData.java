@@ -0,0 +1,466 @@
+package com.apokalypsix.chartx.chart.data;
+
+import com.apokalypsix.chartx.core.data.paged.OhlcPage;
+import com.apokalypsix.chartx.core.data.paged.PageLoader;
+
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import javax.swing.SwingUtilities;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.Executor;
+
+/**
+ * OHLC data backed by a {@link PageLoader}, holding only a bounded number of
+ * pages in memory.
+ *
+ * <p>The full history is split into fixed-size pages that are loaded
+ * asynchronously and kept in an LRU cache of at most {@code maxPages} pages.
+ * As a regular {@link OhlcData}, this object contains only the bars of the
+ * pages covering the visible range. Renderers, autoscale and indicators
+ * therefore work unchanged and only ever touch resident bars. Each call to
+ * {@link #setVisibleRange} requests missing visible pages and prefetches
+ * pages ahead in the direction the viewport is moving plus one page behind.
+ * The window is only rebuilt from the cache when the set of visible pages or
+ * the residency of one of them changes, so panning within the same pages
+ * costs no copying.
+ *
+ * <p>A visible page that is not resident yet is shown as a single coarse bar
+ * summarizing the page. The summary comes from the loader's overview or from
+ * an earlier visit, and the page is replaced by its bars once loaded. When
+ * more pages are visible than fit in the cache, no pages are loaded and the
+ * chart shows only the coarse bars.
+ *
+ * <h2>Usage</h2>
+ * <pre>{@code
+ * PagedOhlcData data = new PagedOhlcData("hist", "History", new FilePageLoader(path), 32);
+ * data.start();
+ * chart.setRangeChangeListener(data::setVisibleRange);
+ * }</pre>
+ *
+ * <p>Windows rebuilt after an asynchronous load are swapped in on the event
+ * dispatch thread unless {@link #setUpdateExecutor} says otherwise.
+ *
+ * <p>The data is read-only: {@link #append}, {@link #updateLast} and
+ * {@link #loadFromArrays} throw {@link UnsupportedOperationException}, as the
+ * next window rebuild would replace the bars.
+ */
+public class PagedOhlcData extends OhlcData {
+
+    private static final Logger log = LoggerFactory.getLogger(PagedOhlcData.class);
+
+    /** Default number of pages to prefetch ahead of the viewport */
+    public static final int DEFAULT_PREFETCH_PAGES = 2;
+
+    private static final int SUMMARY_FIELDS = 5;
+
+    private final PageLoader loader;
+    private final int pageCount;
+    private final long[] pageStartTimes;
+    private final int maxPages;
+
+    // Resident pages in access order (eldest first)
+    private final LinkedHashMap<Integer, OhlcPage> cache = new LinkedHashMap<>(16, 0.75f, true);
+    private final Map<Integer, CompletableFuture<OhlcPage>> pending = new HashMap<>();
+
+    // Coarse bar per page: open, high, low, close, volume
+    private final float[] summaries;
+    private final boolean[] summarized;
+
+    private int prefetchPages = DEFAULT_PREFETCH_PAGES;
+    private Executor updateExecutor = SwingUtilities::invokeLater;
+
+    // Pages covering the visible range
+    private int visibleFirst;
+    private int visibleLast = -1;
+    private long lastStartTime = Long.MIN_VALUE;
+    private int direction = 1;
+
+    // Pages the current window was built from, and whether one of them changed since
+    private int builtFirst;
+    private int builtLast = -1;
+    private boolean windowStale;
+
+    private boolean started;
+    private boolean disposed;
+
+    /**
+     * Creates paged data. Call {@link #start()} to load the page overview.
+     *
+     * @param id the data ID
+     * @param name the display name
+     * @param loader the page source
+     * @param maxPages maximum number of resident pages (at least 1)
+     */
+    public PagedOhlcData(String id, String name, PageLoader loader, int maxPages) {
+        super(id, name);
+        if (maxPages < 1) {
+            throw new IllegalArgumentException("maxPages must be at least 1");
+        }
+        this.loader = loader;
+        this.maxPages = maxPages;
+        this.pageCount = loader.getPageCount();
+        this.pageStartTimes = new long[pageCount];
+        for (int p = 0; p < pageCount; p++) {
+            pageStartTimes[p] = loader.getPageStartTime(p);
+        }
+        this.summaries = new float[pageCount * SUMMARY_FIELDS];
+        this.summarized = new boolean[pageCount];
+    }
+
+    /**
+     * Starts loading the page overview, whose coarse bars stand in for
+     * visible pages that are not loaded yet. Call once, after
+     * {@link #setUpdateExecutor}; later calls do nothing.
+     */
+    public void start() {
+        synchronized (this) {
+            if (started || disposed) {
+                return;
+            }
+            started = true;
+        }
+        loader.loadOverview().whenComplete((overview, error) -> {
+            if (error != null) {
+                log.warn("Failed to load page overview", error);
+            } else if (overview != null) {
+                applyOverview(overview);
+            }
+        });
+    }
+
+    /**
+     * Sets the number of pages prefetched ahead of the viewport.
+     */
+    public void setPrefetchPages(int prefetchPages) {
+        this.prefetchPages = Math.max(0, prefetchPages);
+    }
+
+    public int getPrefetchPages() {
+        return prefetchPages;
+    }
+
+    /**
+     * Sets the executor on which the window is rebuilt after a page arrives.
+     * It must run the rebuild on the thread that renders or otherwise reads
+     * the data. Defaults to the event dispatch thread.
+     */
+    public synchronized void setUpdateExecutor(Executor executor) {
+        this.updateExecutor = executor != null ? executor : SwingUtilities::invokeLater;
+    }
+
+    /**
+     * Moves the window to the given time range, loading and prefetching
+     * pages as needed. Compatible with {@code Chart.RangeChangeListener}.
+     *
+     * @param startTime start of the visible range
+     * @param endTime end of the visible range
+     */
+    public synchronized void setVisibleRange(long startTime, long endTime) {
+        if (disposed || pageCount == 0) {
+            return;
+        }
+        if (lastStartTime != Long.MIN_VALUE && startTime != lastStartTime) {
+            direction = startTime > lastStartTime ? 1 : -1;
+        }
+        lastStartTime = startTime;
+
+        visibleFirst = pageAt(startTime);
+        visibleLast = Math.max(visibleFirst, pageAt(endTime));
+
+        int visiblePages = visibleLast - visibleFirst + 1;
+        if (visiblePages <= maxPages) {
+            for (int p = visibleFirst; p <= visibleLast; p++) {
+                request(p);
+            }
+
+            // Prefetch while the cache has room beyond the visible pages
+            int budget = maxPages - visiblePages;
+            int ahead = direction > 0 ? visibleLast : visibleFirst;
+            for (int i = 1; i <= prefetchPages && budget > 0; i++, budget--) {
+                request(ahead + direction * i);
+            }
+            if (budget > 0) {
+                request(direction > 0 ? visibleFirst - 1 : visibleLast + 1);
+            }
+        }
+
+        if (visibleFirst != builtFirst || visibleLast != builtLast || windowStale) {
+            rebuildWindow();
+        }
+    }
+
+    /**
+     * Returns true if the page is in the cache.
+     */
+    public synchronized boolean isPageResident(int page) {
+        return cache.containsKey(page);
+    }
+
+    /**
+     * Returns the number of resident pages.
+     */
+    public synchronized int getResidentPageCount() {
+        return cache.size();
+    }
+
+    /**
+     * Returns the approximate heap footprint of the resident pages in bytes.
+     */
+    public synchronized long getResidentBytes() {
+        long bytes = 0;
+        for (OhlcPage page : cache.values()) {
+            bytes += page.byteSize();
+        }
+        return bytes;
+    }
+
+    /**
+     * Returns the number of pages in the full history.
+     */
+    public int getPageCount() {
+        return pageCount;
+    }
+
+    /**
+     * Returns the number of bars in the full history, resident or not.
+     */
+    public int getTotalBarCount() {
+        return loader.getBarCount();
+    }
+
+    /**
+     * Returns the timestamp of the first bar of the full history, or -1 if empty.
+     */
+    public long getHistoryStartTime() {
+        return pageCount == 0 ? -1 : pageStartTimes[0];
+    }
+
+    /**
+     * Drops all pages and ignores loads still in flight.
+     */
+    public synchronized void dispose() {
+        disposed = true;
+        for (CompletableFuture<OhlcPage> future : pending.values()) {
+            future.cancel(false);
+        }
+        pending.clear();
+        cache.clear();
+    }
+
+    // ========== Loading ==========
+
+    private void request(int page) {
+        if (page < 0 || page >= pageCount || cache.containsKey(page) || pending.containsKey(page)) {
+            return;
+        }
+        CompletableFuture<OhlcPage> future = loader.loadPage(page);
+        pending.put(page, future);
+        future.whenComplete((result, error) -> onPageLoaded(page, result, error));
+    }
+
+    private void onPageLoaded(int page, OhlcPage result, Throwable error) {
+        boolean visible;
+        Executor executor;
+        synchronized (this) {
+            pending.remove(page);
+            if (disposed) {
+                return;
+            }
+            if (error != null || result == null) {
+                log.warn("Failed to load page {}", page, error);
+                return;
+            }
+            cache.put(page, result);
+            summarize(result);
+            evict();
+            visible = page >= builtFirst && page <= builtLast;
+            windowStale |= visible;
+            executor = updateExecutor;
+        }
+        if (visible) {
+            executor.execute(this::refreshWindow);
+        }
+    }
+
+    /**
+     * Evicts least recently used pages until the cache fits, never evicting
+     * a visible page.
+     */
+    private void evict() {
+        Iterator<Map.Entry<Integer, OhlcPage>> it = cache.entrySet().iterator();
+        while (cache.size() > maxPages && it.hasNext()) {
+            int page = it.next().getKey();
+            if (page < visibleFirst || page > visibleLast) {
+                it.remove();
+            }
+        }
+    }
+
+    private void summarize(OhlcPage page) {
+        int n = page.size();
+        if (n == 0) {
+            return;
+        }
+        float high = Float.NEGATIVE_INFINITY;
+        float low = Float.POSITIVE_INFINITY;
+        float volume = 0;
+        for (int i = 0; i < n; i++) {
+            high = Math.max(high, page.high()[i]);
+            low = Math.min(low, page.low()[i]);
+            volume += page.volume()[i];
+        }
+        setSummary(page.page(), page.open()[0], high, low, page.close()[n - 1], volume);
+    }
+
+    private void applyOverview(OhlcPage overview) {
+        boolean changed = false;
+        Executor executor;
+        synchronized (this) {
+            int n = Math.min(overview.size(), pageCount);
+            for (int p = 0; p < n; p++) {
+                if (!summarized[p]) {
+                    setSummary(p, overview.open()[p], overview.high()[p], overview.low()[p],
+                            overview.close()[p], overview.volume()[p]);
+                    changed |= p >= builtFirst && p <= builtLast && !cache.containsKey(p);
+                }
+            }
+            windowStale |= changed;
+            executor = updateExecutor;
+        }
+        if (changed) {
+            executor.execute(this::refreshWindow);
+        }
+    }
+
+    private void setSummary(int page, float open, float high, float low, float close, float volume) {
+        int base = page * SUMMARY_FIELDS;
+        summaries[base] = open;
+        summaries[base + 1] = high;
+        summaries[base + 2] = low;
+        summaries[base + 3] = close;
+        summaries[base + 4] = volume;
+        summarized[page] = true;
+    }
+
+    // ========== Window ==========
+
+    /**
+     * Rebuilds the window if a page in it changed since it was built.
+     * Several arrivals before the executor runs share one rebuild.
+     */
+    private synchronized void refreshWindow() {
+        if (windowStale) {
+            rebuildWindow();
+        }
+    }
+
+    /**
+     * Replaces the contents with the bars of the visible pages: all bars of
+     * resident pages and one coarse bar for the others.
+     */
+    private synchronized void rebuildWindow() {
+        if (disposed) {
+            return;
+        }
+        builtFirst = visibleFirst;
+        builtLast = visibleLast;
+        windowStale = false;
+
+        int total = 0;
+        for (int p = visibleFirst; p <= visibleLast; p++) {
+            OhlcPage page = cache.get(p);
+            total += page != null ? page.size() : (summarized[p] ? 1 : 0);
+        }
+
+        long[] timestamps = new long[total];
+        float[] open = new float[total];
+        float[] high = new float[total];
+        float[] low = new float[total];
+        float[] close = new float[total];
+        float[] volume = new float[total];
+
+        int offset = 0;
+        for (int p = visibleFirst; p <= visibleLast; p++) {
+            OhlcPage page = cache.get(p);
+            if (page != null) {
+                int n = page.size();
+                System.arraycopy(page.timestamps(), 0, timestamps, offset, n);
+                System.arraycopy(page.open(), 0, open, offset, n);
+                System.arraycopy(page.high(), 0, high, offset, n);
+                System.arraycopy(page.low(), 0, low, offset, n);
+                System.arraycopy(page.close(), 0, close, offset, n);
+                System.arraycopy(page.volume(), 0, volume, offset, n);
+                offset += n;
+            } else if (summarized[p]) {
+                int base = p * SUMMARY_FIELDS;
+                timestamps[offset] = pageStartTimes[p];
+                open[offset] = summaries[base];
+                high[offset] = summaries[base + 1];
+                low[offset] = summaries[base + 2];
+                close[offset] = summaries[base + 3];
+                volume[offset] = summaries[base + 4];
+                offset++;
+            }
+        }
+
+        super.loadFromArrays(timestamps, open, high, low, close, volume);
+        listenerSupport.fireDataUpdated(this, 0);
+    }
+
+    // ========== Read-only ==========
+
+    /**
+     * Not supported; the bars come from the page loader.
+     *
+     * @throws UnsupportedOperationException always
+     */
+    @Override
+    public void append(long timestamp, float open, float high, float low, float close, float volume) {
+        throw new UnsupportedOperationException("PagedOhlcData is read-only");
+    }
+
+    /**
+     * Not supported; the bars come from the page loader.
+     *
+     * @throws UnsupportedOperationException always
+     */
+    @Override
+    public void updateLast(float open, float high, float low, float close, float volume) {
+        throw new UnsupportedOperationException("PagedOhlcData is read-only");
+    }
+
+    /**
+     * Not supported; the bars come from the page loader.
+     *
+     * @throws UnsupportedOperationException always
+     */
+    @Override
+    public void loadFromArrays(long[] timestamps, float[] open, float[] high,
+                               float[] low, float[] close, float[] volume) {
+        throw new UnsupportedOperationException("PagedOhlcData is read-only");
+    }
+
+    /**
+     * Returns the last page starting at or before the given time, or 0.
+     */
+    private int pageAt(long time) {
+        int lo = 0;
+        int hi = pageCount - 1;
+        int result = 0;
+        while (lo <= hi) {
+            int mid = (lo + hi) >>> 1;
+            if (pageStartTimes[mid] <= time) {
+                result = mid;
+                lo = mid + 1;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        return result;
+    }
+}
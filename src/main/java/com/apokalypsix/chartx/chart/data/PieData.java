@@ -474,6 +474,7 @@ public class PieData extends AbstractData<float[]> {
         }
 
         this.size = length;
+        markBulkLoaded();
         invalidateCache();
     }
 
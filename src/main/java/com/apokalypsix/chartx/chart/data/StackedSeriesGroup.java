@@ -14,7 +14,7 @@ import java.util.List;
  *
  * <p>This class manages the series list and per-series colors, but
  * does not compute the stacked values itself. Use
- * {@link com.apokalypsix.chartx.data.service.StackingCalculator} for
+ * {@link com.apokalypsix.chartx.core.data.StackingCalculator} for
  * the actual stacking computation.
  */
 public class StackedSeriesGroup {
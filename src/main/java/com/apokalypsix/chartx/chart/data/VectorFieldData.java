@@ -35,6 +35,9 @@ public class VectorFieldData {
     private float maxMagnitude = Float.MIN_VALUE;
     private boolean magnitudesValid = false;
 
+    /** Incremented on every vector mutation, for render caches */
+    private long version;
+
     /**
      * Creates a uniform vector field grid.
      *
@@ -126,6 +129,24 @@ public class VectorFieldData {
         return dy;
     }
 
+    /**
+     * Returns the modification version, incremented whenever vectors change.
+     *
+     * <p>Callers that write directly into {@link #getDxArray()} or
+     * {@link #getDyArray()} must call {@link #markModified()} afterwards.
+     */
+    public long getVersion() {
+        return version;
+    }
+
+    /**
+     * Marks the field as modified after direct array writes.
+     */
+    public void markModified() {
+        magnitudesValid = false;
+        version++;
+    }
+
     // ========== Vector Access ==========
 
     /**
@@ -143,6 +164,7 @@ public class VectorFieldData {
         dx[idx] = dxValue;
         dy[idx] = dyValue;
         magnitudesValid = false;
+        version++;
     }
 
     /**
@@ -221,6 +243,15 @@ public class VectorFieldData {
         return magnitudes[index(row, col)];
     }
 
+    /**
+     * Returns the magnitude array (row-major). For rendering use only.
+     * Do not modify the returned array.
+     */
+    public float[] getMagnitudesArray() {
+        updateMagnitudes();
+        return magnitudes;
+    }
+
     /**
      * Gets the minimum magnitude in the field.
      */
@@ -255,6 +286,7 @@ public class VectorFieldData {
         System.arraycopy(dxValues, 0, dx, 0, size);
         System.arraycopy(dyValues, 0, dy, 0, size);
         magnitudesValid = false;
+        version++;
     }
 
     /**
@@ -272,6 +304,7 @@ public class VectorFieldData {
             }
         }
         magnitudesValid = false;
+        version++;
     }
 
     /**
@@ -286,6 +319,7 @@ public class VectorFieldData {
             }
         }
         magnitudesValid = false;
+        version++;
     }
 
     /**
@@ -297,6 +331,7 @@ public class VectorFieldData {
             dy[i] *= factor;
         }
         magnitudesValid = false;
+        version++;
     }
 
     // ========== Range Queries ==========
@@ -309,22 +344,7 @@ public class VectorFieldData {
      * @return array of [startCol, endCol] (inclusive)
      */
     public int[] getVisibleColumnRange(double xMin, double xMax) {
-        int startCol = 0;
-        int endCol = cols - 1;
-
-        // Binary search for start
-        while (startCol < cols && xCoords[startCol] < xMin) {
-            startCol++;
-        }
-        if (startCol > 0) startCol--;
-
-        // Binary search for end
-        while (endCol > 0 && xCoords[endCol] > xMax) {
-            endCol--;
-        }
-        if (endCol < cols - 1) endCol++;
-
-        return new int[]{Math.max(0, startCol), Math.min(cols - 1, endCol)};
+        return visibleRange(xCoords, xMin, xMax);
     }
 
     /**
@@ -335,20 +355,45 @@ public class VectorFieldData {
      * @return array of [startRow, endRow] (inclusive)
      */
     public int[] getVisibleRowRange(double yMin, double yMax) {
-        int startRow = 0;
-        int endRow = rows - 1;
+        return visibleRange(yCoords, yMin, yMax);
+    }
 
-        while (startRow < rows && yCoords[startRow] < yMin) {
-            startRow++;
+    /**
+     * Binary searches ascending grid coordinates for the index range covering
+     * [min, max], padded by one cell on each side.
+     */
+    private static int[] visibleRange(double[] coords, double min, double max) {
+        int n = coords.length;
+
+        // First index with coord >= min
+        int low = 0;
+        int high = n;
+        while (low < high) {
+            int mid = (low + high) >>> 1;
+            if (coords[mid] < min) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
         }
-        if (startRow > 0) startRow--;
-
-        while (endRow > 0 && yCoords[endRow] > yMax) {
-            endRow--;
+        int start = low;
+        if (start > 0) start--;
+
+        // Last index with coord <= max
+        low = 0;
+        high = n;
+        while (low < high) {
+            int mid = (low + high) >>> 1;
+            if (coords[mid] <= max) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
         }
-        if (endRow < rows - 1) endRow++;
+        int end = Math.max(0, low - 1);
+        if (end < n - 1) end++;
 
-        return new int[]{Math.max(0, startRow), Math.min(rows - 1, endRow)};
+        return new int[]{Math.max(0, start), Math.min(n - 1, end)};
     }
 
     /**
@@ -14,6 +14,10 @@ import java.util.Arrays;
  *
  * <p>Waterfall charts display a sequence of positive and negative values
  * showing how an initial value is affected by intermediate changes.
+ *
+ * <p>Running totals are a stored prefix-sum column: appends extend it in O(1),
+ * and edits or removals only recompute the totals from the affected index
+ * onwards, so renderers never accumulate values per frame.
  */
 public class WaterfallData extends AbstractData<float[]> {
 
@@ -57,8 +61,9 @@ public class WaterfallData extends AbstractData<float[]> {
     @Override
     protected void shiftValueArrays(int index, int count) {
         System.arraycopy(values, index + 1, values, index, count);
-        System.arraycopy(runningTotals, index + 1, runningTotals, index, count);
         System.arraycopy(isTotalBar, index + 1, isTotalBar, index, count);
+        // Every bar after the removed one loses its contribution
+        recomputeRunningTotals(index, index + count);
     }
 
     // ========== X-value override for category data ==========
@@ -115,20 +120,28 @@ public class WaterfallData extends AbstractData<float[]> {
 
     /**
      * Returns the first index visible in the given X range.
-     * For category data, this always returns 0 if data exists.
+     * For category data the X range is in index units; one extra category is
+     * included so a partially visible bar at the left edge is still drawn.
      */
     @Override
     public int getFirstVisibleIndex(long minX) {
-        return size > 0 ? 0 : -1;
+        if (size == 0 || minX > size) {
+            return -1;
+        }
+        return (int) Math.max(0, Math.min(minX - 1, size - 1));
     }
 
     /**
      * Returns the last index visible in the given X range.
-     * For category data, this always returns size - 1 if data exists.
+     * For category data the X range is in index units; one extra category is
+     * included so a partially visible bar at the right edge is still drawn.
      */
     @Override
     public int getLastVisibleIndex(long maxX) {
-        return size > 0 ? size - 1 : -1;
+        if (size == 0 || maxX < -1) {
+            return -1;
+        }
+        return (int) Math.min(size - 1, Math.max(maxX + 1, 0));
     }
 
     // ========== Value accessors ==========
@@ -304,6 +317,26 @@ public class WaterfallData extends AbstractData<float[]> {
         listenerSupport.fireDataUpdated(this, size - 1);
     }
 
+    /**
+     * Replaces the value at the specified index.
+     *
+     * <p>Running totals are recomputed from {@code index} onwards only.
+     * Total bars ignore the value and keep showing the cumulative sum.
+     *
+     * @param index the bar index
+     * @param value the new value
+     */
+    public void setValue(int index, float value) {
+        checkIndex(index);
+        if (isTotalBar[index]) {
+            return;
+        }
+        values[index] = value;
+        recomputeRunningTotals(index, size);
+
+        listenerSupport.fireDataUpdated(this, index);
+    }
+
     /**
      * Loads data from arrays. Replaces any existing data.
      * Running totals are computed automatically.
@@ -338,19 +371,25 @@ public class WaterfallData extends AbstractData<float[]> {
             Arrays.fill(this.labels, 0, length, null);
         }
 
-        // Compute running totals
-        float runningTotal = 0;
-        for (int i = 0; i < length; i++) {
-            if (isTotalBar[i]) {
-                // Total bar shows current cumulative
-                this.runningTotals[i] = runningTotal;
-            } else {
+        recomputeRunningTotals(0, length);
+
+        this.size = length;
+        markBulkLoaded();
+    }
+
+    /**
+     * Recomputes running totals for indices [fromIndex, toIndex), continuing
+     * from the total stored at {@code fromIndex - 1}.
+     */
+    private void recomputeRunningTotals(int fromIndex, int toIndex) {
+        float runningTotal = fromIndex > 0 ? runningTotals[fromIndex - 1] : 0;
+        for (int i = fromIndex; i < toIndex; i++) {
+            if (!isTotalBar[i]) {
+                // Total bars show the current cumulative without adding to it
                 runningTotal += values[i];
-                this.runningTotals[i] = runningTotal;
             }
+            runningTotals[i] = runningTotal;
         }
-
-        this.size = length;
     }
 
     // ========== Raw array access ==========
@@ -1,5 +1,7 @@
 package com.apokalypsix.chartx.chart.data;
 
+import com.apokalypsix.chartx.core.data.PrefixSums;
+
 import java.util.Arrays;
 
 /**
@@ -13,6 +15,10 @@ public class XyData extends AbstractData<Float> {
     // Value array
     private float[] values;
 
+    // Prefix sums for O(1) range regression, created on demand
+    private PrefixSums prefixSums;
+    private final Object prefixSumsLock = new Object();
+
     /**
      * Creates empty XyData with the specified ID and name.
      */
@@ -133,6 +139,25 @@ public class XyData extends AbstractData<Float> {
         System.arraycopy(timestamps, 0, this.xValues, 0, length);
         System.arraycopy(values, 0, this.values, 0, length);
         this.size = length;
+        // Prefix sums detect the load through getLoadCount()
+        markBulkLoaded();
+    }
+
+    // ========== Prefix sums ==========
+
+    /**
+     * Returns the prefix sums over the values, creating them on first use.
+     * NaN gaps are skipped.
+     *
+     * @return the shared prefix sums for this data
+     */
+    public PrefixSums getPrefixSums() {
+        synchronized (prefixSumsLock) {
+            if (prefixSums == null) {
+                prefixSums = new PrefixSums(this, this::getValuesArray);
+            }
+            return prefixSums;
+        }
     }
 
     // ========== Raw array access ==========
@@ -172,6 +172,7 @@ public class XyyData extends AbstractData<float[]> {
         System.arraycopy(middle, 0, this.middle, 0, length);
         System.arraycopy(lower, 0, this.lower, 0, length);
         this.size = length;
+        markBulkLoaded();
     }
 
     // ========== View creation ==========
@@ -0,0 +1,76 @@
+package com.apokalypsix.chartx.chart.finance.alert;
+
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ExpressionParser;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.ExpressionNode;
+
+/**
+ * A boolean DSL condition registered with an {@link AlertEngine}.
+ *
+ * <p>Conditions are parsed with {@link ExpressionParser#parseCondition}, e.g.
+ * {@code close > SMA(close, 200)} or
+ * {@code crossAbove(close, SMA(close, 20) + 2 * STDEV(close, 20))}.
+ */
+public final class AlertCondition {
+
+    /**
+     * When a condition raises an alert.
+     */
+    public enum Trigger {
+        /** On the bar where the condition changes from false to true */
+        ON_CHANGE_TO_TRUE,
+        /** On every bar where the condition is true */
+        EVERY_BAR
+    }
+
+    private final String id;
+    private final String expression;
+    private final ExpressionNode ast;
+    private final Trigger trigger;
+
+    /**
+     * Creates a condition that triggers when it becomes true.
+     *
+     * @param id unique condition id
+     * @param expression the boolean DSL expression
+     * @throws IllegalArgumentException if the expression is invalid
+     */
+    public AlertCondition(String id, String expression) {
+        this(id, expression, Trigger.ON_CHANGE_TO_TRUE);
+    }
+
+    /**
+     * Creates a condition.
+     *
+     * @param id unique condition id
+     * @param expression the boolean DSL expression
+     * @param trigger when to raise alerts
+     * @throws IllegalArgumentException if the expression is invalid
+     */
+    public AlertCondition(String id, String expression, Trigger trigger) {
+        this.id = id;
+        this.expression = expression;
+        this.ast = ExpressionParser.parseCondition(expression);
+        this.trigger = trigger;
+    }
+
+    public String getId() {
+        return id;
+    }
+
+    public String getExpression() {
+        return expression;
+    }
+
+    public ExpressionNode getAst() {
+        return ast;
+    }
+
+    public Trigger getTrigger() {
+        return trigger;
+    }
+
+    @Override
+    public String toString() {
+        return "AlertCondition[" + id + ": " + expression + "]";
+    }
+}
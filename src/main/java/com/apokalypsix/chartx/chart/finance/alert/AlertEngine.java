@@ -0,0 +1,424 @@
+package com.apokalypsix.chartx.chart.finance.alert;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.Collections;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.ForkJoinTask;
+import java.util.concurrent.RecursiveAction;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.chart.data.DataListener;
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.EvaluationContext;
+
+/**
+ * Evaluates boolean DSL conditions on live OHLC data for many symbols.
+ *
+ * <p>All registered conditions are compiled into one {@link ConditionGraph}
+ * in which shared sub-expressions (e.g. the same SMA used by many
+ * conditions) are computed once per bar and symbol. Each symbol keeps
+ * ring-buffered node values, so an appended or updated bar costs one
+ * evaluation of the graph, independent of history.
+ *
+ * <p>Data listeners only record the first changed bar and queue the symbol;
+ * they never evaluate. Queued symbols are evaluated in batches on a
+ * {@link ForkJoinPool}, one task per symbol. A symbol is owned by exactly one
+ * task at a time, so evaluation needs no locks; hand-off between the feed
+ * thread and the workers uses atomics and a concurrent queue.
+ *
+ * <p>Alerts are edge-triggered by default ({@link AlertCondition.Trigger}):
+ * a condition fires on the bar where it becomes true and at most once per
+ * bar, even while the forming bar updates. Adding a symbol evaluates its
+ * history silently; only later bars raise alerts. Changing the set of
+ * conditions recompiles the graph, after which each symbol replays its
+ * history once, also silently. So does bulk loading a symbol's data, which
+ * is detected through {@link Data#getLoadCount()}.
+ */
+public class AlertEngine {
+
+    private static final Logger log = LoggerFactory.getLogger(AlertEngine.class);
+
+    private final ForkJoinPool pool;
+
+    // Conditions by id; changed under the engine monitor, read via the graph
+    private final Map<String, AlertCondition> conditions = new LinkedHashMap<>();
+    private volatile ConditionGraph graph = ConditionGraph.compile(List.of());
+
+    private final Map<String, SymbolEntry> symbols = new ConcurrentHashMap<>();
+    private final ConcurrentLinkedQueue<SymbolEntry> pending = new ConcurrentLinkedQueue<>();
+    private final AtomicBoolean batchRunning = new AtomicBoolean(false);
+    private final List<AlertListener> listeners = new CopyOnWriteArrayList<>();
+
+    private volatile boolean autoEvaluate = true;
+
+    /**
+     * Creates an engine that evaluates on the common fork/join pool.
+     */
+    public AlertEngine() {
+        this(ForkJoinPool.commonPool());
+    }
+
+    /**
+     * Creates an engine that evaluates on the given pool.
+     *
+     * @param pool the worker pool
+     */
+    public AlertEngine(ForkJoinPool pool) {
+        this.pool = pool;
+    }
+
+    // ========== Conditions ==========
+
+    /**
+     * Adds a condition, replacing any condition with the same id.
+     *
+     * @param id unique condition id
+     * @param expression the boolean DSL expression
+     * @return the registered condition
+     * @throws IllegalArgumentException if the expression is invalid
+     */
+    public AlertCondition addCondition(String id, String expression) {
+        return addCondition(new AlertCondition(id, expression));
+    }
+
+    /**
+     * Adds a condition, replacing any condition with the same id.
+     *
+     * @param condition the condition
+     * @return the registered condition
+     */
+    public synchronized AlertCondition addCondition(AlertCondition condition) {
+        Map<String, AlertCondition> updated = new LinkedHashMap<>(conditions);
+        updated.put(condition.getId(), condition);
+        // Compile before committing so an unsupported expression leaves the engine unchanged
+        ConditionGraph compiled = ConditionGraph.compile(new ArrayList<>(updated.values()));
+        conditions.put(condition.getId(), condition);
+        setGraph(compiled);
+        return condition;
+    }
+
+    /**
+     * Removes a condition.
+     *
+     * @param id the condition id
+     */
+    public synchronized void removeCondition(String id) {
+        if (conditions.remove(id) != null) {
+            setGraph(ConditionGraph.compile(new ArrayList<>(conditions.values())));
+        }
+    }
+
+    /**
+     * Returns the registered conditions.
+     */
+    public synchronized Collection<AlertCondition> getConditions() {
+        return Collections.unmodifiableList(new ArrayList<>(conditions.values()));
+    }
+
+    /**
+     * Returns the number of distinct nodes all conditions compile to.
+     */
+    public int getNodeCount() {
+        return graph.getNodeCount();
+    }
+
+    private void setGraph(ConditionGraph compiled) {
+        graph = compiled;
+        // Every symbol has to be rebuilt against the new graph
+        for (SymbolEntry entry : symbols.values()) {
+            schedule(entry);
+        }
+    }
+
+    // ========== Symbols ==========
+
+    /**
+     * Starts evaluating conditions on a symbol's data, replacing any data
+     * previously registered under the symbol.
+     *
+     * @param symbol the symbol name reported in alerts
+     * @param data the symbol's OHLC data
+     */
+    public void addSymbol(String symbol, OhlcData data) {
+        SymbolEntry entry = new SymbolEntry(symbol, data);
+        SymbolEntry previous = symbols.put(symbol, entry);
+        if (previous != null) {
+            previous.detach();
+        }
+        data.addListener(entry.listener);
+        schedule(entry);
+    }
+
+    /**
+     * Stops evaluating a symbol.
+     *
+     * @param symbol the symbol name
+     */
+    public void removeSymbol(String symbol) {
+        SymbolEntry entry = symbols.remove(symbol);
+        if (entry != null) {
+            entry.detach();
+        }
+    }
+
+    // ========== Listeners ==========
+
+    public void addListener(AlertListener listener) {
+        listeners.add(listener);
+    }
+
+    public void removeListener(AlertListener listener) {
+        listeners.remove(listener);
+    }
+
+    // ========== Evaluation ==========
+
+    /**
+     * Sets whether data changes automatically schedule a batch on the pool.
+     * When disabled, call {@link #evaluatePending()} to evaluate, e.g. from
+     * a timer that batches many ticks.
+     */
+    public void setAutoEvaluate(boolean autoEvaluate) {
+        this.autoEvaluate = autoEvaluate;
+        if (autoEvaluate && !pending.isEmpty()) {
+            submitBatch();
+        }
+    }
+
+    public boolean isAutoEvaluate() {
+        return autoEvaluate;
+    }
+
+    /**
+     * Evaluates all symbols with pending changes, in parallel on the pool,
+     * and returns when done. Returns immediately if another batch is
+     * running; that batch picks up the pending symbols.
+     */
+    public void evaluatePending() {
+        if (batchRunning.compareAndSet(false, true)) {
+            runBatches();
+        }
+    }
+
+    /**
+     * Stops evaluating all symbols and detaches from their data.
+     */
+    public void dispose() {
+        for (SymbolEntry entry : symbols.values()) {
+            entry.detach();
+        }
+        symbols.clear();
+        pending.clear();
+    }
+
+    private void schedule(SymbolEntry entry) {
+        if (entry.queued.compareAndSet(false, true)) {
+            pending.add(entry);
+            if (autoEvaluate) {
+                submitBatch();
+            }
+        }
+    }
+
+    private void submitBatch() {
+        if (batchRunning.compareAndSet(false, true)) {
+            pool.execute(this::runBatches);
+        }
+    }
+
+    /**
+     * Drains the queue until it stays empty. Runs with batchRunning set.
+     */
+    private void runBatches() {
+        do {
+            try {
+                List<SymbolEntry> batch = new ArrayList<>();
+                SymbolEntry entry;
+                while ((entry = pending.poll()) != null) {
+                    // Cleared first, so changes arriving during evaluation queue it again
+                    entry.queued.set(false);
+                    if (!entry.detached) {
+                        batch.add(entry);
+                    }
+                }
+                evaluateBatch(batch);
+            } finally {
+                batchRunning.set(false);
+            }
+            // Re-check for symbols queued after the drain but before the flag was cleared
+        } while (!pending.isEmpty() && batchRunning.compareAndSet(false, true));
+    }
+
+    private void evaluateBatch(List<SymbolEntry> batch) {
+        if (batch.isEmpty()) {
+            return;
+        }
+        if (batch.size() == 1) {
+            evaluateSymbol(batch.get(0));
+            return;
+        }
+
+        List<ForkJoinTask<?>> tasks = new ArrayList<>(batch.size());
+        for (SymbolEntry entry : batch) {
+            tasks.add(ForkJoinTask.adapt(() -> evaluateSymbol(entry)));
+        }
+        if (ForkJoinTask.inForkJoinPool()) {
+            ForkJoinTask.invokeAll(tasks);
+        } else {
+            pool.invoke(new RecursiveAction() {
+                @Override
+                protected void compute() {
+                    invokeAll(tasks);
+                }
+            });
+        }
+    }
+
+    /**
+     * Brings one symbol up to date. Only ever runs in one task per symbol.
+     */
+    private void evaluateSymbol(SymbolEntry entry) {
+        try {
+            ConditionGraph current = graph;
+            // Read before the data so a bulk load during evaluation is seen next time
+            int loadCount = entry.data.getLoadCount();
+            boolean reloaded = loadCount != entry.loadCount;
+            entry.loadCount = loadCount;
+            EvaluationContext context = new EvaluationContext(entry.data);
+            int size = context.getSize();
+            int dirtyFrom = entry.dirtyFromIndex.getAndSet(Integer.MAX_VALUE);
+
+            int from = Math.min(dirtyFrom, entry.evaluatedCount);
+            int firstAlertBar = Math.max(0, entry.evaluatedCount - 1);
+
+            // Rings only hold the forming bar's predecessors, so anything
+            // older than that (or a new graph, a clear or a bulk load) replays
+            // from scratch
+            if (entry.values == null || entry.graph != current || reloaded
+                    || from < entry.evaluatedCount - 1 || size < entry.evaluatedCount) {
+                // Bulk loads replace the history, so they start over like a new symbol
+                boolean primed = entry.values != null && entry.graph == current && !reloaded;
+                if (!primed) {
+                    entry.graph = current;
+                    entry.lastFired = new int[current.getConditions().size()];
+                    Arrays.fill(entry.lastFired, -1);
+                }
+                entry.values = current.createValues();
+                from = 0;
+                // History is replayed silently, except a corrected last bar
+                firstAlertBar = primed ? Math.max(0, size - 1) : size;
+            }
+
+            for (int i = from; i < size; i++) {
+                current.evaluate(entry.values, context, i);
+                if (i >= firstAlertBar) {
+                    checkConditions(entry, current, context, i);
+                }
+            }
+            entry.evaluatedCount = size;
+        } catch (Exception e) {
+            log.error("Error evaluating alert conditions for {}", entry.symbol, e);
+        }
+    }
+
+    private void checkConditions(SymbolEntry entry, ConditionGraph current,
+                                 EvaluationContext context, int index) {
+        List<AlertCondition> list = current.getConditions();
+        for (int c = 0; c < list.size(); c++) {
+            if (entry.lastFired[c] == index) {
+                continue;
+            }
+            int root = current.getRoot(c);
+            if (!isTrue(entry.values.get(root, index))) {
+                continue;
+            }
+            AlertCondition condition = list.get(c);
+            if (condition.getTrigger() == AlertCondition.Trigger.ON_CHANGE_TO_TRUE
+                    && isTrue(entry.values.get(root, index - 1))) {
+                continue;
+            }
+            entry.lastFired[c] = index;
+            fire(new AlertEvent(condition, entry.symbol, index, context.getTimestamp(index)));
+        }
+    }
+
+    private static boolean isTrue(float value) {
+        return !Float.isNaN(value) && value != 0;
+    }
+
+    private void fire(AlertEvent event) {
+        for (AlertListener listener : listeners) {
+            try {
+                listener.onAlert(event);
+            } catch (Exception e) {
+                log.error("Error in alert listener", e);
+            }
+        }
+    }
+
+    /**
+     * A symbol's data and its evaluation state.
+     */
+    private final class SymbolEntry {
+        final String symbol;
+        final OhlcData data;
+
+        // Written by data listeners, consumed by the evaluating task
+        final AtomicInteger dirtyFromIndex = new AtomicInteger(Integer.MAX_VALUE);
+        final AtomicBoolean queued = new AtomicBoolean(false);
+        volatile boolean detached;
+
+        // Owned by the task evaluating this symbol
+        ConditionGraph graph;
+        ConditionGraph.Values values;
+        int[] lastFired;
+        int evaluatedCount;
+        int loadCount;
+
+        final DataListener listener = new DataListener() {
+            @Override
+            public void onDataAppended(Data<?> data, int newIndex) {
+                markDirty(newIndex);
+            }
+
+            @Override
+            public void onDataUpdated(Data<?> data, int index) {
+                markDirty(Math.max(0, index));
+            }
+
+            @Override
+            public void onDataCleared(Data<?> data) {
+                markDirty(0);
+            }
+        };
+
+        SymbolEntry(String symbol, OhlcData data) {
+            this.symbol = symbol;
+            this.data = data;
+            this.loadCount = data.getLoadCount();
+        }
+
+        void markDirty(int index) {
+            dirtyFromIndex.accumulateAndGet(index, Math::min);
+            schedule(this);
+        }
+
+        void detach() {
+            detached = true;
+            data.removeListener(listener);
+        }
+    }
+}
@@ -0,0 +1,12 @@
+package com.apokalypsix.chartx.chart.finance.alert;
+
+/**
+ * An alert raised by an {@link AlertEngine}.
+ *
+ * @param condition the condition that triggered
+ * @param symbol the symbol whose data triggered it
+ * @param barIndex the bar the condition became true on
+ * @param timestamp the timestamp of that bar
+ */
+public record AlertEvent(AlertCondition condition, String symbol, int barIndex, long timestamp) {
+}
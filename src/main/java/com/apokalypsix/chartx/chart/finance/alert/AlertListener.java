@@ -0,0 +1,18 @@
+package com.apokalypsix.chartx.chart.finance.alert;
+
+/**
+ * Receives alerts from an {@link AlertEngine}.
+ *
+ * <p>Called on the engine's worker threads; implementations must be
+ * thread-safe and should hand off any slow work.
+ */
+@FunctionalInterface
+public interface AlertListener {
+
+    /**
+     * Called when a condition triggers.
+     *
+     * @param event the alert
+     */
+    void onAlert(AlertEvent event);
+}
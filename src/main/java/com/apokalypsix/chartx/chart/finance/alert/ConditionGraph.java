@@ -0,0 +1,443 @@
+package com.apokalypsix.chartx.chart.finance.alert;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.EvaluationContext;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.BinaryOpNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.ComparisonNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.CrossNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.ExpressionNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.FieldNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.FunctionNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.IndicatorNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.LogicalNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.NumberNode;
+
+/**
+ * Dependency graph compiled from the ASTs of all alert conditions.
+ *
+ * <p>Sub-expressions are merged by their expression string, so an
+ * {@code SMA(close, 200)} used by a thousand conditions is one node computed
+ * once per bar. Nodes are stored in topological order (inputs first) and are
+ * evaluated bar by bar: each node computes its value at bar {@code i} from
+ * its inputs' values at {@code i} and a bounded number of earlier bars, plus
+ * its own state at {@code i - 1}.
+ *
+ * <p>Values and state live in per-symbol ring buffers ({@link Values}) sized
+ * to the longest lookback any consumer needs, so memory does not grow with
+ * history. Because state for bar {@code i - 1} is kept, the forming bar can
+ * be re-evaluated any number of times.
+ *
+ * <p>The graph itself is immutable and shared by all worker threads.
+ * Indicators use the per-bar kernels of {@link IndicatorNode}, so conditions
+ * agree with plotted expressions.
+ */
+final class ConditionGraph {
+
+    private final List<AlertCondition> conditions;
+    private final Node[] nodes;
+    private final int[] roots;
+    private final int maxArgs;
+
+    private ConditionGraph(List<AlertCondition> conditions, Node[] nodes, int[] roots) {
+        this.conditions = conditions;
+        this.nodes = nodes;
+        this.roots = roots;
+        int args = 0;
+        for (Node node : nodes) {
+            args = Math.max(args, node.inputs.length);
+        }
+        this.maxArgs = args;
+    }
+
+    /**
+     * Compiles the given conditions into one graph.
+     *
+     * @throws IllegalArgumentException if a condition uses an unsupported node type
+     */
+    static ConditionGraph compile(List<AlertCondition> conditions) {
+        Builder builder = new Builder();
+        int[] roots = new int[conditions.size()];
+        for (int c = 0; c < roots.length; c++) {
+            roots[c] = builder.add(conditions.get(c).getAst());
+            // Edge detection reads the previous bar of each condition
+            builder.require(roots[c], 1);
+        }
+        return new ConditionGraph(List.copyOf(conditions),
+                builder.nodes.toArray(new Node[0]), roots);
+    }
+
+    List<AlertCondition> getConditions() {
+        return conditions;
+    }
+
+    int getNodeCount() {
+        return nodes.length;
+    }
+
+    /**
+     * Returns the node holding the value of a condition.
+     */
+    int getRoot(int conditionIndex) {
+        return roots[conditionIndex];
+    }
+
+    /**
+     * Creates empty per-symbol storage for this graph.
+     */
+    Values createValues() {
+        return new Values(this);
+    }
+
+    /**
+     * Evaluates every node at one bar. Bars must be evaluated in order; the
+     * last evaluated bar may be evaluated again.
+     */
+    void evaluate(Values values, EvaluationContext context, int index) {
+        for (Node node : nodes) {
+            values.set(node.id, index, node.compute(values, context, index));
+        }
+    }
+
+    // ========== Per-symbol storage ==========
+
+    /**
+     * Ring-buffered node values and state for one symbol.
+     */
+    static final class Values {
+
+        private final float[][] rings;
+        private final int[] masks;
+        private final double[][] states;
+        private final float[] scratch;
+        private final InputView inputView = new InputView();
+
+        private Values(ConditionGraph graph) {
+            int count = graph.nodes.length;
+            rings = new float[count][];
+            masks = new int[count];
+            states = new double[count][];
+            for (Node node : graph.nodes) {
+                int capacity = Integer.highestOneBit(node.history + 1) << 1;
+                rings[node.id] = new float[capacity];
+                masks[node.id] = capacity - 1;
+                // Two bars of state: the previous one and the one being computed
+                states[node.id] = new double[node.stateSlots * 2];
+            }
+            scratch = new float[Math.max(1, graph.maxArgs)];
+        }
+
+        /**
+         * Returns a node value, or NaN before the first bar.
+         */
+        float get(int node, int index) {
+            return index < 0 ? Float.NaN : rings[node][index & masks[node]];
+        }
+
+        private void set(int node, int index, float value) {
+            rings[node][index & masks[node]] = value;
+        }
+
+        /**
+         * Returns a node's ring as an indicator input. The view is reused, so
+         * only one input can be read at a time.
+         */
+        private IndicatorNode.Series input(int node) {
+            inputView.ring = rings[node];
+            inputView.mask = masks[node];
+            return inputView;
+        }
+
+        private double state(int node, int slot, int index) {
+            return index < 0 ? 0 : states[node][slot * 2 + (index & 1)];
+        }
+
+        private void setState(int node, int slot, int index, double value) {
+            states[node][slot * 2 + (index & 1)] = value;
+        }
+    }
+
+    /**
+     * Node ring read through the indicator kernels.
+     */
+    private static final class InputView implements IndicatorNode.Series {
+        float[] ring;
+        int mask;
+
+        @Override
+        public float get(int index) {
+            return index < 0 ? Float.NaN : ring[index & mask];
+        }
+    }
+
+    // ========== Nodes ==========
+
+    private abstract static class Node {
+        final int id;
+        final int[] inputs;
+        // Earlier bars of this node that consumers read
+        int history;
+        int stateSlots;
+
+        Node(int id, int[] inputs) {
+            this.id = id;
+            this.inputs = inputs;
+        }
+
+        /**
+         * Earlier bars of the inputs this node reads.
+         */
+        int lookback() {
+            return 0;
+        }
+
+        abstract float compute(Values values, EvaluationContext context, int index);
+    }
+
+    /** Fields and constants, evaluated through their AST node */
+    private static final class LeafNode extends Node {
+        private final ExpressionNode ast;
+
+        LeafNode(int id, ExpressionNode ast) {
+            super(id, new int[0]);
+            this.ast = ast;
+        }
+
+        @Override
+        float compute(Values values, EvaluationContext context, int index) {
+            return ast.evaluate(context, index);
+        }
+    }
+
+    private static final class BinaryNode extends Node {
+        private final BinaryOpNode.Operator operator;
+
+        BinaryNode(int id, int[] inputs, BinaryOpNode.Operator operator) {
+            super(id, inputs);
+            this.operator = operator;
+        }
+
+        @Override
+        float compute(Values values, EvaluationContext context, int index) {
+            return BinaryOpNode.apply(operator,
+                    values.get(inputs[0], index), values.get(inputs[1], index));
+        }
+    }
+
+    private static final class CompareNode extends Node {
+        private final ComparisonNode.Operator operator;
+
+        CompareNode(int id, int[] inputs, ComparisonNode.Operator operator) {
+            super(id, inputs);
+            this.operator = operator;
+        }
+
+        @Override
+        float compute(Values values, EvaluationContext context, int index) {
+            return ComparisonNode.apply(operator,
+                    values.get(inputs[0], index), values.get(inputs[1], index));
+        }
+    }
+
+    private static final class LogicNode extends Node {
+        private final LogicalNode.Operator operator;
+
+        LogicNode(int id, int[] inputs, LogicalNode.Operator operator) {
+            super(id, inputs);
+            this.operator = operator;
+        }
+
+        @Override
+        float compute(Values values, EvaluationContext context, int index) {
+            float right = inputs.length > 1 ? values.get(inputs[1], index) : Float.NaN;
+            return LogicalNode.apply(operator, values.get(inputs[0], index), right);
+        }
+    }
+
+    private static final class CrossingNode extends Node {
+        private final CrossNode.Direction direction;
+
+        CrossingNode(int id, int[] inputs, CrossNode.Direction direction) {
+            super(id, inputs);
+            this.direction = direction;
+        }
+
+        @Override
+        int lookback() {
+            return 1;
+        }
+
+        @Override
+        float compute(Values values, EvaluationContext context, int index) {
+            if (index < 1) {
+                return Float.NaN;
+            }
+            return CrossNode.apply(direction,
+                    values.get(inputs[0], index - 1), values.get(inputs[1], index - 1),
+                    values.get(inputs[0], index), values.get(inputs[1], index));
+        }
+    }
+
+    private static final class CallNode extends Node {
+        private final String name;
+
+        CallNode(int id, int[] inputs, String name) {
+            super(id, inputs);
+            this.name = name;
+        }
+
+        @Override
+        float compute(Values values, EvaluationContext context, int index) {
+            float[] args = values.scratch;
+            for (int i = 0; i < inputs.length; i++) {
+                args[i] = values.get(inputs[i], index);
+            }
+            return FunctionNode.apply(name, args, inputs.length);
+        }
+    }
+
+    /**
+     * Windowed and recursive indicators. Recursive ones (SMA, EMA, ATR, RSI)
+     * carry their running sums in state slots; windowed ones (WMA, STDEV,
+     * HIGHEST, LOWEST) rescan the window from the source ring.
+     */
+    private static final class WindowNode extends Node {
+        private final String name;
+        private final int period;
+
+        WindowNode(int id, int[] inputs, String name, int period) {
+            super(id, inputs);
+            this.name = name;
+            this.period = period;
+            stateSlots = switch (name) {
+                case "SMA", "EMA", "ATR" -> 1;
+                case "RSI" -> 2;
+                default -> 0;
+            };
+        }
+
+        @Override
+        int lookback() {
+            return switch (name) {
+                case "SMA" -> period;
+                case "WMA", "STDEV", "HIGHEST", "LOWEST" -> Math.max(0, period - 1);
+                case "RSI" -> 1;
+                default -> 0;
+            };
+        }
+
+        @Override
+        float compute(Values v, EvaluationContext context, int i) {
+            switch (name) {
+                case "SMA": {
+                    double sum = IndicatorNode.smaStep(v.input(inputs[0]), i, period, v.state(id, 0, i - 1));
+                    v.setState(id, 0, i, sum);
+                    return i < period - 1 ? Float.NaN : (float) (sum / period);
+                }
+                case "EMA": {
+                    double ema = IndicatorNode.emaStep(v.get(inputs[0], i), i, period, v.state(id, 0, i - 1));
+                    v.setState(id, 0, i, ema);
+                    return i < period - 1 ? Float.NaN : (float) ema;
+                }
+                case "WMA":
+                    return IndicatorNode.wma(v.input(inputs[0]), i, period);
+                case "STDEV":
+                    return IndicatorNode.stdDev(v.input(inputs[0]), i, period);
+                case "HIGHEST":
+                    return IndicatorNode.highest(v.input(inputs[0]), i, period);
+                case "LOWEST":
+                    return IndicatorNode.lowest(v.input(inputs[0]), i, period);
+                case "ATR": {
+                    double atr = IndicatorNode.wilderStep(IndicatorNode.trueRange(context, i), i, period,
+                            v.state(id, 0, i - 1));
+                    v.setState(id, 0, i, atr);
+                    return i < period ? Float.NaN : (float) atr;
+                }
+                case "RSI": {
+                    double avgGain = v.state(id, 0, i - 1);
+                    double avgLoss = v.state(id, 1, i - 1);
+                    // Carry state through bars that produce no value
+                    v.setState(id, 0, i, avgGain);
+                    v.setState(id, 1, i, avgLoss);
+                    if (i == 0) return Float.NaN;
+
+                    float curr = v.get(inputs[0], i);
+                    float prev = v.get(inputs[0], i - 1);
+                    if (Float.isNaN(curr) || Float.isNaN(prev)) return Float.NaN;
+
+                    float change = curr - prev;
+                    avgGain = IndicatorNode.wilderStep(Math.max(0, change), i, period, avgGain);
+                    avgLoss = IndicatorNode.wilderStep(Math.max(0, -change), i, period, avgLoss);
+                    v.setState(id, 0, i, avgGain);
+                    v.setState(id, 1, i, avgLoss);
+                    return i < period ? Float.NaN : IndicatorNode.rsi(avgGain, avgLoss);
+                }
+                default:
+                    return Float.NaN;
+            }
+        }
+    }
+
+    // ========== Compilation ==========
+
+    private static final class Builder {
+        final List<Node> nodes = new ArrayList<>();
+        final Map<String, Integer> byKey = new HashMap<>();
+
+        int add(ExpressionNode ast) {
+            String key = ast.toExpressionString();
+            Integer existing = byKey.get(key);
+            if (existing != null) {
+                return existing;
+            }
+
+            int id;
+            Node node;
+            if (ast instanceof NumberNode || ast instanceof FieldNode) {
+                node = new LeafNode(nodes.size(), ast);
+            } else if (ast instanceof BinaryOpNode op) {
+                int[] in = {add(op.getLeft()), add(op.getRight())};
+                node = new BinaryNode(nodes.size(), in, op.getOperator());
+            } else if (ast instanceof ComparisonNode cmp) {
+                int[] in = {add(cmp.getLeft()), add(cmp.getRight())};
+                node = new CompareNode(nodes.size(), in, cmp.getOperator());
+            } else if (ast instanceof LogicalNode logic) {
+                int[] in = logic.getRight() != null
+                        ? new int[] {add(logic.getLeft()), add(logic.getRight())}
+                        : new int[] {add(logic.getLeft())};
+                node = new LogicNode(nodes.size(), in, logic.getOperator());
+            } else if (ast instanceof CrossNode cross) {
+                int[] in = {add(cross.getLeft()), add(cross.getRight())};
+                node = new CrossingNode(nodes.size(), in, cross.getDirection());
+            } else if (ast instanceof FunctionNode fn) {
+                int[] in = new int[fn.getArguments().size()];
+                for (int i = 0; i < in.length; i++) {
+                    in[i] = add(fn.getArguments().get(i));
+                }
+                node = new CallNode(nodes.size(), in, fn.getName());
+            } else if (ast instanceof IndicatorNode ind) {
+                int[] in = {add(ind.getSource())};
+                node = new WindowNode(nodes.size(), in, ind.getName(), ind.getPeriod());
+            } else {
+                throw new IllegalArgumentException(
+                        "Unsupported expression in condition: " + ast.toExpressionString());
+            }
+
+            for (int input : node.inputs) {
+                require(input, node.lookback());
+            }
+            id = node.id;
+            nodes.add(node);
+            byKey.put(key, id);
+            return id;
+        }
+
+        void require(int node, int history) {
+            Node target = nodes.get(node);
+            target.history = Math.max(target.history, history);
+        }
+    }
+}
@@ -0,0 +1,238 @@
+package com.apokalypsix.chartx.chart.finance.indicator;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.core.data.VwapSums;
+
+import java.awt.Color;
+import java.time.DayOfWeek;
+import java.time.Instant;
+import java.time.LocalDate;
+import java.time.ZoneId;
+import java.time.temporal.TemporalAdjusters;
+import java.util.Arrays;
+
+/**
+ * An anchored VWAP with optional standard-deviation bands.
+ *
+ * <p>The VWAP either starts at a fixed anchor time (e.g. an event picked on
+ * the chart) or resets at the start of every session, week or month. Values
+ * are evaluated on demand from the data's {@link VwapSums}, in O(1) per bar
+ * regardless of the distance to the anchor. Any number of anchors can share
+ * one data set, and moving an anchor with {@link #setAnchorTime} takes
+ * effect on the next frame without recomputing anything.
+ *
+ * <p>Usage:
+ * <pre>{@code
+ * AnchoredVwap session = AnchoredVwap.resetting("vwap.session", AnchoredVwap.Reset.SESSION, zone)
+ *         .bands(1, 2);
+ * AnchoredVwap event = AnchoredVwap.anchoredAt("vwap.earnings", earningsTime)
+ *         .color(Color.ORANGE);
+ * layer.addAnchor(session);
+ * layer.addAnchor(event);
+ * }</pre>
+ *
+ * @see VWAP
+ */
+public class AnchoredVwap {
+
+    /**
+     * When the VWAP restarts.
+     */
+    public enum Reset {
+        /** Never; accumulates from the anchor time */
+        NONE,
+        /** At the start of every calendar day */
+        SESSION,
+        /** At the start of every week (Monday) */
+        WEEK,
+        /** At the start of every month */
+        MONTH
+    }
+
+    private final String id;
+    private final Reset reset;
+    private final ZoneId zone;
+
+    private volatile long anchorTime;
+    private Color color = VWAP.DEFAULT_COLOR;
+    private double[] bandMultipliers = new double[0];
+    private boolean visible = true;
+
+    private AnchoredVwap(String id, Reset reset, long anchorTime, ZoneId zone) {
+        this.id = id;
+        this.reset = reset;
+        this.anchorTime = anchorTime;
+        this.zone = zone;
+    }
+
+    /**
+     * Creates a VWAP anchored at a fixed time.
+     *
+     * @param id unique identifier
+     * @param anchorTime time of the anchor; the first bar at or after it starts the VWAP
+     */
+    public static AnchoredVwap anchoredAt(String id, long anchorTime) {
+        return new AnchoredVwap(id, Reset.NONE, anchorTime, ZoneId.systemDefault());
+    }
+
+    /**
+     * Creates a VWAP that restarts every period.
+     *
+     * @param id unique identifier
+     * @param reset the period
+     * @param zone time zone of the period boundaries
+     */
+    public static AnchoredVwap resetting(String id, Reset reset, ZoneId zone) {
+        if (reset == Reset.NONE) {
+            throw new IllegalArgumentException("Use anchoredAt for a fixed anchor");
+        }
+        return new AnchoredVwap(id, reset, Long.MIN_VALUE, zone);
+    }
+
+    public String getId() {
+        return id;
+    }
+
+    public Reset getReset() {
+        return reset;
+    }
+
+    /**
+     * Moves a fixed anchor, e.g. while it is dragged.
+     */
+    public void setAnchorTime(long anchorTime) {
+        this.anchorTime = anchorTime;
+    }
+
+    public long getAnchorTime() {
+        return anchorTime;
+    }
+
+    /**
+     * Sets the line color.
+     *
+     * @return this for chaining
+     */
+    public AnchoredVwap color(Color color) {
+        this.color = color;
+        return this;
+    }
+
+    public Color getColor() {
+        return color;
+    }
+
+    /**
+     * Sets the band distances in standard deviations; each multiplier adds a
+     * band above and below the VWAP.
+     *
+     * @return this for chaining
+     */
+    public AnchoredVwap bands(double... multipliers) {
+        this.bandMultipliers = multipliers.clone();
+        return this;
+    }
+
+    /**
+     * Returns the number of bands on each side.
+     */
+    public int getBandCount() {
+        return bandMultipliers.length;
+    }
+
+    /**
+     * Returns the band multiplier at the given position.
+     */
+    public double getBandMultiplier(int band) {
+        return bandMultipliers[band];
+    }
+
+    /**
+     * Shows or hides this VWAP.
+     *
+     * @return this for chaining
+     */
+    public AnchoredVwap visible(boolean visible) {
+        this.visible = visible;
+        return this;
+    }
+
+    public boolean isVisible() {
+        return visible;
+    }
+
+    /**
+     * Evaluates bars [from, to] into the output arrays, bar {@code from}
+     * going to index 0.
+     *
+     * <p>Costs O(1) per bar plus O(log n) per period that starts in the
+     * range. Bars before the anchor or without volume get NaN.
+     *
+     * @param data the OHLC data
+     * @param from first bar (inclusive)
+     * @param to last bar (inclusive)
+     * @param vwapOut receives the VWAP per bar
+     * @param stdDevOut receives the standard deviation per bar, or null
+     * @param anchorOut receives the anchor bar per bar (-1 before the anchor), or null
+     */
+    public void evaluate(OhlcData data, int from, int to, float[] vwapOut, float[] stdDevOut, int[] anchorOut) {
+        if (from > to) {
+            return;
+        }
+        VwapSums sums = data.getVwapSums();
+
+        if (reset == Reset.NONE) {
+            int anchor = data.indexAtOrAfter(anchorTime);
+            if (anchor < 0) {
+                anchor = Integer.MAX_VALUE;
+            }
+            sums.fill(anchor, from, to, vwapOut, stdDevOut, 0);
+            if (anchorOut != null) {
+                for (int i = from; i <= to; i++) {
+                    anchorOut[i - from] = i >= anchor ? anchor : -1;
+                }
+            }
+            return;
+        }
+
+        // One fill per period overlapping the range
+        long[] timestamps = data.getTimestampsArray();
+        int i = from;
+        while (i <= to) {
+            long periodStart = periodStart(timestamps[i]);
+            long nextStart = nextPeriodStart(periodStart);
+            int anchor = data.indexAtOrAfter(periodStart);
+            int periodEnd = data.indexAtOrBefore(nextStart - 1);
+            int end = Math.min(to, Math.max(i, periodEnd));
+
+            sums.fill(anchor, i, end, vwapOut, stdDevOut, i - from);
+            if (anchorOut != null) {
+                Arrays.fill(anchorOut, i - from, end - from + 1, anchor);
+            }
+            i = end + 1;
+        }
+    }
+
+    /**
+     * Returns the start of the period containing the given time.
+     */
+    private long periodStart(long time) {
+        LocalDate date = Instant.ofEpochMilli(time).atZone(zone).toLocalDate();
+        LocalDate start = switch (reset) {
+            case WEEK -> date.with(TemporalAdjusters.previousOrSame(DayOfWeek.MONDAY));
+            case MONTH -> date.withDayOfMonth(1);
+            default -> date;
+        };
+        return start.atStartOfDay(zone).toInstant().toEpochMilli();
+    }
+
+    private long nextPeriodStart(long periodStart) {
+        LocalDate start = Instant.ofEpochMilli(periodStart).atZone(zone).toLocalDate();
+        LocalDate next = switch (reset) {
+            case WEEK -> start.plusWeeks(1);
+            case MONTH -> start.plusMonths(1);
+            default -> start.plusDays(1);
+        };
+        return next.atStartOfDay(zone).toInstant().toEpochMilli();
+    }
+}
@@ -7,6 +7,7 @@ import java.util.LinkedHashMap;
 import java.util.Map;
 import java.util.Objects;
 import java.util.UUID;
+import java.util.function.Supplier;
 
 /**
  * Represents an active indicator instance on a chart.
@@ -26,6 +27,7 @@ public class IndicatorInstance<S extends Data<?>, R extends Data<?>> {
     private final Map<String, Object> parameterValues;
     private final Map<String, Object> pendingParameters;
     private R outputData;
+    private volatile Supplier<? extends R> outputSource;
     private boolean enabled = true;
     private boolean needsRecalculation = true;
     private boolean hasPendingChanges = false;
@@ -85,16 +87,28 @@ public class IndicatorInstance<S extends Data<?>, R extends Data<?>> {
      * Returns the output data, or null if not yet calculated.
      */
     public R getOutputData() {
-        return outputData;
+        Supplier<? extends R> source = outputSource;
+        return source != null ? source.get() : outputData;
     }
 
     /**
      * Sets the output data.
      */
     public void setOutputData(R outputData) {
+        this.outputSource = null;
         this.outputData = outputData;
     }
 
+    /**
+     * Sets a supplier the output data is read through, e.g. a lease on a
+     * shared output that may be replaced by a new object when recomputed.
+     * Replaces any output set with {@link #setOutputData}.
+     */
+    public void setOutputSource(Supplier<? extends R> outputSource) {
+        this.outputData = null;
+        this.outputSource = outputSource;
+    }
+
     /**
      * Returns true if this indicator is enabled.
      */
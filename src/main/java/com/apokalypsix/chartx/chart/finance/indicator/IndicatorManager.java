@@ -5,6 +5,7 @@ import com.apokalypsix.chartx.chart.data.DataListener;
 import com.apokalypsix.chartx.chart.data.Data;
 import com.apokalypsix.chartx.chart.data.OhlcData;
 import com.apokalypsix.chartx.chart.data.XyData;
+import com.apokalypsix.chartx.core.data.SharedDataCache;
 
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
@@ -25,6 +26,11 @@ import java.util.concurrent.CopyOnWriteArrayList;
  *
  * <p>Indicators are calculated lazily when needed and are updated incrementally
  * when new data arrives.
+ *
+ * <p>With {@link #setShareOutputs(boolean) shared outputs} enabled, outputs
+ * are taken from the process-wide {@link SharedDataCache}, so managers of
+ * several charts on the same source data compute each indicator/parameter
+ * combination only once.
  */
 public class IndicatorManager {
 
@@ -73,6 +79,10 @@ public class IndicatorManager {
     private OhlcData sourceData;
     private final DataListener sourceListener;
 
+    // Leases on shared outputs, by instance ID (only when sharing is enabled)
+    private boolean shareOutputs;
+    private final Map<String, SharedDataCache.Lease<Data<?>>> outputLeases = new HashMap<>();
+
     /**
      * Creates an indicator manager.
      */
@@ -114,6 +124,7 @@ public class IndicatorManager {
             this.sourceData.removeListener(sourceListener);
         }
 
+        releaseAllOutputLeases();
         this.sourceData = data;
 
         if (data != null) {
@@ -134,6 +145,34 @@ public class IndicatorManager {
         return sourceData;
     }
 
+    /**
+     * Sets whether indicator outputs are shared with other managers through
+     * the process-wide {@link SharedDataCache}.
+     *
+     * <p>Shared outputs are kept up to date by the cache, and the same output
+     * instance may be displayed by several charts. Takes effect on the next
+     * calculation of each indicator.
+     *
+     * @param share true to share outputs
+     */
+    public void setShareOutputs(boolean share) {
+        this.shareOutputs = share;
+        if (!share) {
+            // Instances keep showing values, now from outputs of their own
+            for (Map.Entry<String, SharedDataCache.Lease<Data<?>>> entry : outputLeases.entrySet()) {
+                detachOutput(activeIndicators.get(entry.getKey()), entry.getValue(), true);
+            }
+            outputLeases.clear();
+        }
+    }
+
+    /**
+     * Returns whether indicator outputs are shared with other managers.
+     */
+    public boolean isShareOutputs() {
+        return shareOutputs;
+    }
+
     // ========== Indicator Registration ==========
 
     /**
@@ -248,6 +287,7 @@ public class IndicatorManager {
         if (instance == null) {
             return false;
         }
+        releaseOutputLease(instanceId, instance);
 
         // Notify listeners
         for (IndicatorListener listener : listeners) {
@@ -544,10 +584,22 @@ public class IndicatorManager {
         Indicator<OhlcData, ?> indicator =
                 (Indicator<OhlcData, ?>) instance.getIndicator();
 
-        Data<?> output = indicator.calculate(sourceData);
+        IndicatorInstance<OhlcData, Data<?>> typed = (IndicatorInstance<OhlcData, Data<?>>) instance;
+        if (shareOutputs) {
+            // Acquire before releasing, so a sole holder keeps the cached entry
+            SharedDataCache.Lease<Data<?>> lease = acquireSharedOutput(instance);
+            SharedDataCache.Lease<Data<?>> previous = outputLeases.put(instance.getId(), lease);
+            if (previous != null) {
+                previous.release();
+            }
+            lease.setReplacementListener(() -> onSharedOutputReplaced(instance));
+            typed.setOutputSource(lease::get);
+        } else {
+            dropOutputLease(instance.getId());
+            typed.setOutputData(indicator.calculate(sourceData));
+        }
         log.debug("calculateIndicator: {} output={}", instance.getDescriptor().getId(),
-                output != null ? output.size() : "null");
-        ((IndicatorInstance<OhlcData, Data<?>>) instance).setOutputData(output);
+                instance.getOutputData() != null ? instance.getOutputData().size() : "null");
         instance.markRecalculated();
     }
 
@@ -558,6 +610,10 @@ public class IndicatorManager {
         }
 
         for (IndicatorInstance<?, ?> instance : activeIndicators.values()) {
+            if (outputLeases.containsKey(instance.getId())) {
+                // Shared outputs are updated once by the cache
+                continue;
+            }
             if (instance.isEnabled() && instance.getOutputData() != null) {
                 Indicator<OhlcData, Data<?>> indicator =
                         (Indicator<OhlcData, Data<?>>) instance.getIndicator();
@@ -567,6 +623,7 @@ public class IndicatorManager {
     }
 
     private void clearAllIndicatorOutputs() {
+        releaseAllOutputLeases();
         for (IndicatorInstance<?, ?> instance : activeIndicators.values()) {
             instance.setOutputData(null);
             instance.markNeedsRecalculation();
@@ -587,6 +644,7 @@ public class IndicatorManager {
                     Indicator<OhlcData, ?> indicator =
                             (Indicator<OhlcData, ?>) instance.getIndicator();
                     Data<?> output = indicator.calculate(ohlcData);
+                    dropOutputLease(instance.getId());
                     ((IndicatorInstance<OhlcData, Data<?>>) instance).setOutputData(output);
                     instance.markRecalculated();
 
@@ -599,6 +657,89 @@ public class IndicatorManager {
         }
     }
 
+    /**
+     * Acquires the shared output for an instance, keyed by source data,
+     * indicator ID and parameter values.
+     */
+    @SuppressWarnings("unchecked")
+    private SharedDataCache.Lease<Data<?>> acquireSharedOutput(IndicatorInstance<?, ?> instance) {
+        Indicator<OhlcData, Data<?>> indicator =
+                (Indicator<OhlcData, Data<?>>) instance.getIndicator();
+        OhlcData source = sourceData;
+        Map<String, Object> params =
+                Collections.unmodifiableMap(new HashMap<>(instance.getParameterValues()));
+
+        return SharedDataCache.getInstance().acquire(
+                source, instance.getDescriptor().getId(), params,
+                () -> indicator.calculate(source),
+                (output, fromIndex) -> indicator.update(output, source, fromIndex));
+    }
+
+    /**
+     * Tells listeners that a shared output was recomputed into a new object,
+     * so views bound to the previous object rebind.
+     */
+    private void onSharedOutputReplaced(IndicatorInstance<?, ?> instance) {
+        for (IndicatorListener listener : listeners) {
+            listener.onIndicatorRecalculated(instance);
+        }
+    }
+
+    private void releaseOutputLease(String instanceId, IndicatorInstance<?, ?> instance) {
+        SharedDataCache.Lease<Data<?>> lease = outputLeases.remove(instanceId);
+        if (lease != null) {
+            detachOutput(instance, lease, false);
+        }
+    }
+
+    /**
+     * Releases a lease whose value is about to be replaced by the caller.
+     */
+    private void dropOutputLease(String instanceId) {
+        SharedDataCache.Lease<Data<?>> lease = outputLeases.remove(instanceId);
+        if (lease != null) {
+            lease.setReplacementListener(null);
+            lease.release();
+        }
+    }
+
+    private void releaseAllOutputLeases() {
+        for (Map.Entry<String, SharedDataCache.Lease<Data<?>>> entry : outputLeases.entrySet()) {
+            detachOutput(activeIndicators.get(entry.getKey()), entry.getValue(), false);
+        }
+        outputLeases.clear();
+    }
+
+    /**
+     * Unbinds an instance from a shared output and releases the lease. The
+     * instance never keeps the shared object, which the cache goes on
+     * updating for its other holders.
+     *
+     * @param recalculate true to give the instance a private output right
+     *                    away, false to clear it until its next calculation
+     */
+    @SuppressWarnings("unchecked")
+    private void detachOutput(IndicatorInstance<?, ?> instance, SharedDataCache.Lease<Data<?>> lease,
+                              boolean recalculate) {
+        lease.setReplacementListener(null);
+        if (instance != null) {
+            IndicatorInstance<OhlcData, Data<?>> typed = (IndicatorInstance<OhlcData, Data<?>>) instance;
+            if (recalculate && sourceData != null && !sourceData.isEmpty()) {
+                Indicator<OhlcData, Data<?>> indicator = (Indicator<OhlcData, Data<?>>) instance.getIndicator();
+                typed.setOutputData(indicator.calculate(sourceData));
+                instance.markRecalculated();
+                // Views bound to the shared object rebind
+                for (IndicatorListener listener : listeners) {
+                    listener.onIndicatorRecalculated(instance);
+                }
+            } else {
+                typed.setOutputData(null);
+                instance.markNeedsRecalculation();
+            }
+        }
+        lease.release();
+    }
+
     // ========== Accessors ==========
 
     /**
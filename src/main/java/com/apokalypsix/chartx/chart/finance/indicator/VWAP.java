@@ -18,6 +18,8 @@ import java.util.TimeZone;
  * where Typical Price = (High + Low + Close) / 3
  *
  * <p>VWAP resets at the start of each trading session.
+ *
+ * @see AnchoredVwap for many anchors and bands evaluated in O(1) per bar
  */
 public class VWAP {
 
@@ -29,6 +29,18 @@ import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.*;
  * indicator  := INDICATOR '(' field ',' number ')' | INDICATOR '(' number ')'
  * field      := 'open' | 'high' | 'low' | 'close' | 'volume' | 'hl2' | 'hlc3' | 'ohlc4'
  * </pre>
+ *
+ * <p>{@link #parseCondition} additionally accepts boolean conditions such as
+ * {@code close > SMA(close, 200) and RSI(14) < 30} or
+ * {@code crossAbove(EMA(close, 12), EMA(close, 26))}:
+ * <pre>
+ * condition  := and (('or' | '||') and)*
+ * and        := not (('and' | '&amp;&amp;') not)*
+ * not        := ('not' | '!') not | comparison
+ * comparison := expression (('&gt;' | '&gt;=' | '&lt;' | '&lt;=' | '==' | '!=') expression)?
+ * cross      := ('crossAbove' | 'crossBelow') '(' expression ',' expression ')'
+ * </pre>
+ * Conditions evaluate to 1 (true), 0 (false) or NaN (not yet known).
  */
 public class ExpressionParser {
 
@@ -47,10 +59,15 @@ public class ExpressionParser {
             "sign", "floor", "ceil", "round", "pow"
     );
 
+    private static final Set<String> CROSSES = Set.of(
+            "crossabove", "crossbelow", "crossover", "crossunder"
+    );
+
     private static final Pattern TOKEN_PATTERN = Pattern.compile(
             "\\s*(" +
                     "[0-9]+\\.?[0-9]*|" +  // Numbers
                     "[a-zA-Z_][a-zA-Z0-9_]*|" +  // Identifiers
+                    ">=|<=|==|!=|&&|\\|\\||[<>!]|" +  // Comparison and logical operators
                     "[+\\-*/^%()]|" +  // Operators
                     ",|" +  // Comma
                     "\\[|\\]" +  // Brackets for offset
@@ -59,6 +76,7 @@ public class ExpressionParser {
 
     private final String expression;
     private final List<String> tokens;
+    private final boolean conditions;
     private int pos;
 
     /**
@@ -69,12 +87,29 @@ public class ExpressionParser {
      * @throws IllegalArgumentException if the expression is invalid
      */
     public static ExpressionNode parse(String expression) {
-        return new ExpressionParser(expression).parseExpression();
+        return new ExpressionParser(expression, false).parseExpression();
+    }
+
+    /**
+     * Parses a boolean condition into an AST.
+     *
+     * @param expression the condition to parse
+     * @return the root node of the AST
+     * @throws IllegalArgumentException if the condition is invalid
+     */
+    public static ExpressionNode parseCondition(String expression) {
+        ExpressionParser parser = new ExpressionParser(expression, true);
+        ExpressionNode root = parser.parseOr();
+        if (parser.peek() != null) {
+            throw new IllegalArgumentException("Unexpected token: " + parser.peek());
+        }
+        return root;
     }
 
-    private ExpressionParser(String expression) {
+    private ExpressionParser(String expression, boolean conditions) {
         this.expression = expression;
         this.tokens = tokenize(expression);
+        this.conditions = conditions;
         this.pos = 0;
     }
 
@@ -127,6 +162,49 @@ public class ExpressionParser {
         }
     }
 
+    private ExpressionNode parseOr() {
+        ExpressionNode left = parseAnd();
+        while (matchKeyword("or") || match("||")) {
+            left = new LogicalNode(LogicalNode.Operator.OR, left, parseAnd());
+        }
+        return left;
+    }
+
+    private ExpressionNode parseAnd() {
+        ExpressionNode left = parseNot();
+        while (matchKeyword("and") || match("&&")) {
+            left = new LogicalNode(LogicalNode.Operator.AND, left, parseNot());
+        }
+        return left;
+    }
+
+    private ExpressionNode parseNot() {
+        if (matchKeyword("not") || match("!")) {
+            return LogicalNode.not(parseNot());
+        }
+        return parseComparison();
+    }
+
+    private ExpressionNode parseComparison() {
+        ExpressionNode left = parseExpression();
+        String op = peek();
+        if (op != null && ComparisonNode.Operator.isComparison(op)) {
+            consume();
+            return new ComparisonNode(
+                    ComparisonNode.Operator.fromSymbol(op), left, parseExpression());
+        }
+        return left;
+    }
+
+    private boolean matchKeyword(String keyword) {
+        String token = peek();
+        if (token != null && token.equalsIgnoreCase(keyword)) {
+            consume();
+            return true;
+        }
+        return false;
+    }
+
     private ExpressionNode parseExpression() {
         ExpressionNode left = parseTerm();
 
@@ -193,7 +271,7 @@ public class ExpressionParser {
         // Parentheses
         if ("(".equals(token)) {
             consume();
-            ExpressionNode inner = parseExpression();
+            ExpressionNode inner = conditions ? parseOr() : parseExpression();
             expect(")");
             return inner;
         }
@@ -215,6 +293,8 @@ public class ExpressionParser {
 
                 if (INDICATORS.contains(lower)) {
                     return parseIndicatorCall(lower);
+                } else if (CROSSES.contains(lower)) {
+                    return parseCrossCall(lower);
                 } else if (FUNCTIONS.contains(lower)) {
                     return parseFunctionCall(lower);
                 } else {
@@ -276,6 +356,17 @@ public class ExpressionParser {
         return new IndicatorNode(name, source, period);
     }
 
+    private ExpressionNode parseCrossCall(String name) {
+        List<ExpressionNode> args = parseArguments();
+        if (args.size() != 2) {
+            throw new IllegalArgumentException(name + " requires two arguments");
+        }
+        CrossNode.Direction direction = name.equals("crossabove") || name.equals("crossover")
+                ? CrossNode.Direction.ABOVE
+                : CrossNode.Direction.BELOW;
+        return new CrossNode(direction, args.get(0), args.get(1));
+    }
+
     private ExpressionNode parseFunctionCall(String name) {
         List<ExpressionNode> args = parseArguments();
         return new FunctionNode(name, args);
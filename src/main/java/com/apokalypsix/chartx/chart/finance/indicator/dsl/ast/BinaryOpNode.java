@@ -70,9 +70,15 @@ public class BinaryOpNode implements ExpressionNode {
 
     @Override
     public float evaluate(EvaluationContext context, int index) {
-        float leftVal = left.evaluate(context, index);
-        float rightVal = right.evaluate(context, index);
+        return apply(operator, left.evaluate(context, index), right.evaluate(context, index));
+    }
 
+    /**
+     * Applies an operator to two values.
+     *
+     * @return the result, or Float.NaN if either value is NaN or the result is undefined
+     */
+    public static float apply(Operator operator, float leftVal, float rightVal) {
         if (Float.isNaN(leftVal) || Float.isNaN(rightVal)) {
             return Float.NaN;
         }
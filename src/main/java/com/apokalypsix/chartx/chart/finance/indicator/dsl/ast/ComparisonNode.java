@@ -0,0 +1,119 @@
+package com.apokalypsix.chartx.chart.finance.indicator.dsl.ast;
+
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.EvaluationContext;
+
+/**
+ * AST node representing a comparison.
+ *
+ * <p>Supports: &gt;, &gt;=, &lt;, &lt;=, ==, !=
+ *
+ * <p>Evaluates to 1 (true) or 0 (false), or Float.NaN if either side is
+ * not available.
+ */
+public class ComparisonNode implements ExpressionNode {
+
+    /**
+     * Available comparison operators.
+     */
+    public enum Operator {
+        GREATER(">"),
+        GREATER_EQUAL(">="),
+        LESS("<"),
+        LESS_EQUAL("<="),
+        EQUAL("=="),
+        NOT_EQUAL("!=");
+
+        private final String symbol;
+
+        Operator(String symbol) {
+            this.symbol = symbol;
+        }
+
+        public String getSymbol() {
+            return symbol;
+        }
+
+        public static Operator fromSymbol(String symbol) {
+            for (Operator op : values()) {
+                if (op.symbol.equals(symbol)) {
+                    return op;
+                }
+            }
+            throw new IllegalArgumentException("Unknown comparison: " + symbol);
+        }
+
+        /**
+         * Returns true if the symbol is a comparison operator.
+         */
+        public static boolean isComparison(String symbol) {
+            for (Operator op : values()) {
+                if (op.symbol.equals(symbol)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    private final Operator operator;
+    private final ExpressionNode left;
+    private final ExpressionNode right;
+
+    public ComparisonNode(Operator operator, ExpressionNode left, ExpressionNode right) {
+        this.operator = operator;
+        this.left = left;
+        this.right = right;
+    }
+
+    public Operator getOperator() {
+        return operator;
+    }
+
+    public ExpressionNode getLeft() {
+        return left;
+    }
+
+    public ExpressionNode getRight() {
+        return right;
+    }
+
+    @Override
+    public float evaluate(EvaluationContext context, int index) {
+        return apply(operator, left.evaluate(context, index), right.evaluate(context, index));
+    }
+
+    /**
+     * Applies a comparison to two values.
+     *
+     * @return 1 if true, 0 if false, NaN if either value is NaN
+     */
+    public static float apply(Operator operator, float leftVal, float rightVal) {
+        if (Float.isNaN(leftVal) || Float.isNaN(rightVal)) {
+            return Float.NaN;
+        }
+
+        boolean result;
+        switch (operator) {
+            case GREATER:       result = leftVal > rightVal; break;
+            case GREATER_EQUAL: result = leftVal >= rightVal; break;
+            case LESS:          result = leftVal < rightVal; break;
+            case LESS_EQUAL:    result = leftVal <= rightVal; break;
+            case EQUAL:         result = leftVal == rightVal; break;
+            case NOT_EQUAL:     result = leftVal != rightVal; break;
+            default:
+                return Float.NaN;
+        }
+        return result ? 1 : 0;
+    }
+
+    @Override
+    public String toExpressionString() {
+        return "(" + left.toExpressionString() + " " + operator.getSymbol() +
+                " " + right.toExpressionString() + ")";
+    }
+
+    @Override
+    public int getMinimumBars() {
+        return Math.max(left.getMinimumBars(), right.getMinimumBars());
+    }
+}
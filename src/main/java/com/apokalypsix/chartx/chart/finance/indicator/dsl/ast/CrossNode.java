@@ -0,0 +1,96 @@
+package com.apokalypsix.chartx.chart.finance.indicator.dsl.ast;
+
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.EvaluationContext;
+
+/**
+ * AST node detecting one series crossing another.
+ *
+ * <p>Example usage in conditions:
+ * <ul>
+ *   <li>crossAbove(close, SMA(close, 200)) - close crosses above its SMA</li>
+ *   <li>crossBelow(EMA(close, 12), EMA(close, 26)) - bearish EMA cross</li>
+ * </ul>
+ *
+ * <p>Evaluates to 1 on the bar where the cross happens and 0 otherwise, or
+ * Float.NaN if either series is not available on this or the previous bar.
+ */
+public class CrossNode implements ExpressionNode {
+
+    /**
+     * Crossing direction.
+     */
+    public enum Direction {
+        ABOVE("crossAbove"),
+        BELOW("crossBelow");
+
+        private final String functionName;
+
+        Direction(String functionName) {
+            this.functionName = functionName;
+        }
+
+        public String getFunctionName() {
+            return functionName;
+        }
+    }
+
+    private final Direction direction;
+    private final ExpressionNode left;
+    private final ExpressionNode right;
+
+    public CrossNode(Direction direction, ExpressionNode left, ExpressionNode right) {
+        this.direction = direction;
+        this.left = left;
+        this.right = right;
+    }
+
+    public Direction getDirection() {
+        return direction;
+    }
+
+    public ExpressionNode getLeft() {
+        return left;
+    }
+
+    public ExpressionNode getRight() {
+        return right;
+    }
+
+    @Override
+    public float evaluate(EvaluationContext context, int index) {
+        if (index < 1) {
+            return Float.NaN;
+        }
+        return apply(direction,
+                left.evaluate(context, index - 1), right.evaluate(context, index - 1),
+                left.evaluate(context, index), right.evaluate(context, index));
+    }
+
+    /**
+     * Tests for a cross between the previous and the current bar.
+     *
+     * @return 1 if crossed, 0 if not, NaN if any value is NaN
+     */
+    public static float apply(Direction direction,
+                              float prevLeft, float prevRight, float left, float right) {
+        if (Float.isNaN(prevLeft) || Float.isNaN(prevRight)
+                || Float.isNaN(left) || Float.isNaN(right)) {
+            return Float.NaN;
+        }
+        boolean crossed = direction == Direction.ABOVE
+                ? left > right && prevLeft <= prevRight
+                : left < right && prevLeft >= prevRight;
+        return crossed ? 1 : 0;
+    }
+
+    @Override
+    public String toExpressionString() {
+        return direction.getFunctionName() + "(" + left.toExpressionString() + ", " +
+                right.toExpressionString() + ")";
+    }
+
+    @Override
+    public int getMinimumBars() {
+        return Math.max(left.getMinimumBars(), right.getMinimumBars()) + 1;
+    }
+}
@@ -8,15 +8,21 @@ import com.apokalypsix.chartx.chart.finance.indicator.dsl.EvaluationContext;
  * AST node representing a function call.
  *
  * <p>Supports mathematical functions: abs, sqrt, log, exp, min, max, sign
+ *
+ * <p>Like the evaluation context, a node is evaluated by one thread at a time.
  */
 public class FunctionNode implements ExpressionNode {
 
     private final String name;
     private final List<ExpressionNode> arguments;
 
+    // Argument values of the current evaluation, reused across bars
+    private final float[] argumentValues;
+
     public FunctionNode(String name, List<ExpressionNode> arguments) {
         this.name = name.toLowerCase();
         this.arguments = arguments;
+        this.argumentValues = new float[arguments.size()];
     }
 
     public String getName() {
@@ -29,128 +35,90 @@ public class FunctionNode implements ExpressionNode {
 
     @Override
     public float evaluate(EvaluationContext context, int index) {
+        float[] values = argumentValues;
+        for (int i = 0; i < values.length; i++) {
+            values[i] = arguments.get(i).evaluate(context, index);
+        }
+        return apply(name, values, values.length);
+    }
+
+    /**
+     * Applies a function to already evaluated arguments.
+     *
+     * @param name the lower-case function name
+     * @param args argument values
+     * @param count number of arguments in {@code args}
+     * @return the result, or Float.NaN if not defined for the arguments
+     */
+    public static float apply(String name, float[] args, int count) {
         switch (name) {
             case "abs":
-                return evaluateAbs(context, index);
+                requireArgs(name, count, 1);
+                return Float.isNaN(args[0]) ? Float.NaN : Math.abs(args[0]);
             case "sqrt":
-                return evaluateSqrt(context, index);
+                requireArgs(name, count, 1);
+                if (Float.isNaN(args[0]) || args[0] < 0) return Float.NaN;
+                return (float) Math.sqrt(args[0]);
             case "log":
-                return evaluateLog(context, index);
+                requireArgs(name, count, 1);
+                if (Float.isNaN(args[0]) || args[0] <= 0) return Float.NaN;
+                return (float) Math.log10(args[0]);
             case "ln":
-                return evaluateLn(context, index);
+                requireArgs(name, count, 1);
+                if (Float.isNaN(args[0]) || args[0] <= 0) return Float.NaN;
+                return (float) Math.log(args[0]);
             case "exp":
-                return evaluateExp(context, index);
+                requireArgs(name, count, 1);
+                return Float.isNaN(args[0]) ? Float.NaN : (float) Math.exp(args[0]);
             case "min":
-                return evaluateMin(context, index);
+                return applyMin(args, count);
             case "max":
-                return evaluateMax(context, index);
+                return applyMax(args, count);
             case "sign":
-                return evaluateSign(context, index);
+                requireArgs(name, count, 1);
+                return Float.isNaN(args[0]) ? Float.NaN : Math.signum(args[0]);
             case "floor":
-                return evaluateFloor(context, index);
+                requireArgs(name, count, 1);
+                return Float.isNaN(args[0]) ? Float.NaN : (float) Math.floor(args[0]);
             case "ceil":
-                return evaluateCeil(context, index);
+                requireArgs(name, count, 1);
+                return Float.isNaN(args[0]) ? Float.NaN : (float) Math.ceil(args[0]);
             case "round":
-                return evaluateRound(context, index);
+                requireArgs(name, count, 1);
+                return Float.isNaN(args[0]) ? Float.NaN : Math.round(args[0]);
             case "pow":
-                return evaluatePow(context, index);
+                requireArgs(name, count, 2);
+                if (Float.isNaN(args[0]) || Float.isNaN(args[1])) return Float.NaN;
+                return (float) Math.pow(args[0], args[1]);
             default:
                 throw new IllegalArgumentException("Unknown function: " + name);
         }
     }
 
-    private float evaluateAbs(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        return Float.isNaN(val) ? Float.NaN : Math.abs(val);
-    }
-
-    private float evaluateSqrt(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        if (Float.isNaN(val) || val < 0) return Float.NaN;
-        return (float) Math.sqrt(val);
-    }
-
-    private float evaluateLog(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        if (Float.isNaN(val) || val <= 0) return Float.NaN;
-        return (float) Math.log10(val);
-    }
-
-    private float evaluateLn(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        if (Float.isNaN(val) || val <= 0) return Float.NaN;
-        return (float) Math.log(val);
-    }
-
-    private float evaluateExp(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        return Float.isNaN(val) ? Float.NaN : (float) Math.exp(val);
-    }
-
-    private float evaluateMin(EvaluationContext context, int index) {
-        if (arguments.isEmpty()) return Float.NaN;
+    private static float applyMin(float[] args, int count) {
+        if (count == 0) return Float.NaN;
         float result = Float.POSITIVE_INFINITY;
-        for (ExpressionNode arg : arguments) {
-            float val = arg.evaluate(context, index);
-            if (!Float.isNaN(val) && val < result) {
-                result = val;
+        for (int i = 0; i < count; i++) {
+            if (!Float.isNaN(args[i]) && args[i] < result) {
+                result = args[i];
             }
         }
         return result == Float.POSITIVE_INFINITY ? Float.NaN : result;
     }
 
-    private float evaluateMax(EvaluationContext context, int index) {
-        if (arguments.isEmpty()) return Float.NaN;
+    private static float applyMax(float[] args, int count) {
+        if (count == 0) return Float.NaN;
         float result = Float.NEGATIVE_INFINITY;
-        for (ExpressionNode arg : arguments) {
-            float val = arg.evaluate(context, index);
-            if (!Float.isNaN(val) && val > result) {
-                result = val;
+        for (int i = 0; i < count; i++) {
+            if (!Float.isNaN(args[i]) && args[i] > result) {
+                result = args[i];
             }
         }
         return result == Float.NEGATIVE_INFINITY ? Float.NaN : result;
     }
 
-    private float evaluateSign(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        if (Float.isNaN(val)) return Float.NaN;
-        return Math.signum(val);
-    }
-
-    private float evaluateFloor(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        return Float.isNaN(val) ? Float.NaN : (float) Math.floor(val);
-    }
-
-    private float evaluateCeil(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        return Float.isNaN(val) ? Float.NaN : (float) Math.ceil(val);
-    }
-
-    private float evaluateRound(EvaluationContext context, int index) {
-        requireArgs(1);
-        float val = arguments.get(0).evaluate(context, index);
-        return Float.isNaN(val) ? Float.NaN : Math.round(val);
-    }
-
-    private float evaluatePow(EvaluationContext context, int index) {
-        requireArgs(2);
-        float base = arguments.get(0).evaluate(context, index);
-        float exp = arguments.get(1).evaluate(context, index);
-        if (Float.isNaN(base) || Float.isNaN(exp)) return Float.NaN;
-        return (float) Math.pow(base, exp);
-    }
-
-    private void requireArgs(int count) {
-        if (arguments.size() < count) {
+    private static void requireArgs(String name, int actual, int count) {
+        if (actual < count) {
             throw new IllegalArgumentException(
                     name + " requires at least " + count + " argument(s)");
         }
@@ -89,189 +89,64 @@ public class IndicatorNode implements ExpressionNode {
     }
 
     private void calculateSMA(EvaluationContext context, float[] outValues) {
-        int size = context.getSize();
+        Series input = i -> source.evaluate(context, i);
         double sum = 0;
-
-        for (int i = 0; i < size; i++) {
-            float val = source.evaluate(context, i);
-            if (Float.isNaN(val)) val = 0;
-            sum += val;
-
-            if (i < period - 1) {
-                outValues[i] = Float.NaN;
-            } else {
-                if (i >= period) {
-                    float oldVal = source.evaluate(context, i - period);
-                    if (Float.isNaN(oldVal)) oldVal = 0;
-                    sum -= oldVal;
-                }
-                outValues[i] = (float) (sum / period);
-            }
+        for (int i = 0; i < outValues.length; i++) {
+            sum = smaStep(input, i, period, sum);
+            outValues[i] = i < period - 1 ? Float.NaN : (float) (sum / period);
         }
     }
 
     private void calculateEMA(EvaluationContext context, float[] outValues) {
-        int size = context.getSize();
-        double multiplier = 2.0 / (period + 1);
         double ema = 0;
-
-        for (int i = 0; i < size; i++) {
-            float val = source.evaluate(context, i);
-            if (Float.isNaN(val)) val = 0;
-
-            if (i < period - 1) {
-                outValues[i] = Float.NaN;
-                ema += val;
-            } else if (i == period - 1) {
-                ema = (ema + val) / period;
-                outValues[i] = (float) ema;
-            } else {
-                ema = (val - ema) * multiplier + ema;
-                outValues[i] = (float) ema;
-            }
+        for (int i = 0; i < outValues.length; i++) {
+            ema = emaStep(source.evaluate(context, i), i, period, ema);
+            outValues[i] = i < period - 1 ? Float.NaN : (float) ema;
         }
     }
 
     private void calculateWMA(EvaluationContext context, float[] outValues) {
-        int size = context.getSize();
-        float weightSum = period * (period + 1) / 2.0f;
-
-        for (int i = 0; i < size; i++) {
-            if (i < period - 1) {
-                outValues[i] = Float.NaN;
-            } else {
-                float sum = 0;
-                int weight = 1;
-                for (int j = i - period + 1; j <= i; j++) {
-                    float val = source.evaluate(context, j);
-                    if (!Float.isNaN(val)) {
-                        sum += val * weight;
-                    }
-                    weight++;
-                }
-                outValues[i] = sum / weightSum;
-            }
+        Series input = i -> source.evaluate(context, i);
+        for (int i = 0; i < outValues.length; i++) {
+            outValues[i] = wma(input, i, period);
         }
     }
 
     private void calculateStdDev(EvaluationContext context, float[] outValues) {
-        int size = context.getSize();
-
-        for (int i = 0; i < size; i++) {
-            if (i < period - 1) {
-                outValues[i] = Float.NaN;
-            } else {
-                // Calculate mean
-                double sum = 0;
-                int count = 0;
-                for (int j = i - period + 1; j <= i; j++) {
-                    float val = source.evaluate(context, j);
-                    if (!Float.isNaN(val)) {
-                        sum += val;
-                        count++;
-                    }
-                }
-
-                if (count == 0) {
-                    outValues[i] = Float.NaN;
-                    continue;
-                }
-
-                double mean = sum / count;
-
-                // Calculate variance
-                double variance = 0;
-                for (int j = i - period + 1; j <= i; j++) {
-                    float val = source.evaluate(context, j);
-                    if (!Float.isNaN(val)) {
-                        double diff = val - mean;
-                        variance += diff * diff;
-                    }
-                }
-
-                outValues[i] = (float) Math.sqrt(variance / count);
-            }
+        Series input = i -> source.evaluate(context, i);
+        for (int i = 0; i < outValues.length; i++) {
+            outValues[i] = stdDev(input, i, period);
         }
     }
 
     private void calculateHighest(EvaluationContext context, float[] outValues) {
-        int size = context.getSize();
-
-        for (int i = 0; i < size; i++) {
-            if (i < period - 1) {
-                outValues[i] = Float.NaN;
-            } else {
-                float max = Float.NEGATIVE_INFINITY;
-                for (int j = i - period + 1; j <= i; j++) {
-                    float val = source.evaluate(context, j);
-                    if (!Float.isNaN(val) && val > max) {
-                        max = val;
-                    }
-                }
-                outValues[i] = max == Float.NEGATIVE_INFINITY ? Float.NaN : max;
-            }
+        Series input = i -> source.evaluate(context, i);
+        for (int i = 0; i < outValues.length; i++) {
+            outValues[i] = highest(input, i, period);
         }
     }
 
     private void calculateLowest(EvaluationContext context, float[] outValues) {
-        int size = context.getSize();
-
-        for (int i = 0; i < size; i++) {
-            if (i < period - 1) {
-                outValues[i] = Float.NaN;
-            } else {
-                float min = Float.POSITIVE_INFINITY;
-                for (int j = i - period + 1; j <= i; j++) {
-                    float val = source.evaluate(context, j);
-                    if (!Float.isNaN(val) && val < min) {
-                        min = val;
-                    }
-                }
-                outValues[i] = min == Float.POSITIVE_INFINITY ? Float.NaN : min;
-            }
+        Series input = i -> source.evaluate(context, i);
+        for (int i = 0; i < outValues.length; i++) {
+            outValues[i] = lowest(input, i, period);
         }
     }
 
     private void calculateATR(EvaluationContext context, float[] outValues) {
-        int size = context.getSize();
-        float prevClose = 0;
         double atr = 0;
-
-        for (int i = 0; i < size; i++) {
-            float high = context.getHigh(i);
-            float low = context.getLow(i);
-            float close = context.getClose(i);
-
-            float tr;
-            if (i == 0) {
-                tr = high - low;
-            } else {
-                tr = Math.max(high - low, Math.max(
-                        Math.abs(high - prevClose),
-                        Math.abs(low - prevClose)));
-            }
-            prevClose = close;
-
-            if (i < period) {
-                atr += tr;
-                outValues[i] = Float.NaN;
-            } else if (i == period) {
-                atr = (atr + tr) / period;
-                outValues[i] = (float) atr;
-            } else {
-                atr = (atr * (period - 1) + tr) / period;
-                outValues[i] = (float) atr;
-            }
+        for (int i = 0; i < outValues.length; i++) {
+            atr = wilderStep(trueRange(context, i), i, period, atr);
+            outValues[i] = i < period ? Float.NaN : (float) atr;
         }
     }
 
     private void calculateRSI(EvaluationContext context, float[] outValues) {
-        int size = context.getSize();
         double avgGain = 0, avgLoss = 0;
 
         outValues[0] = Float.NaN;
 
-        for (int i = 1; i < size; i++) {
+        for (int i = 1; i < outValues.length; i++) {
             float curr = source.evaluate(context, i);
             float prev = source.evaluate(context, i - 1);
 
@@ -281,23 +156,179 @@ public class IndicatorNode implements ExpressionNode {
             }
 
             float change = curr - prev;
-            float gain = Math.max(0, change);
-            float loss = Math.max(0, -change);
+            avgGain = wilderStep(Math.max(0, change), i, period, avgGain);
+            avgLoss = wilderStep(Math.max(0, -change), i, period, avgLoss);
+            outValues[i] = i < period ? Float.NaN : rsi(avgGain, avgLoss);
+        }
+    }
 
-            if (i < period) {
-                avgGain += gain;
-                avgLoss += loss;
-                outValues[i] = Float.NaN;
-            } else if (i == period) {
-                avgGain = (avgGain + gain) / period;
-                avgLoss = (avgLoss + loss) / period;
-                outValues[i] = avgLoss == 0 ? 100 : (float) (100 - 100 / (1 + avgGain / avgLoss));
-            } else {
-                avgGain = (avgGain * (period - 1) + gain) / period;
-                avgLoss = (avgLoss * (period - 1) + loss) / period;
-                outValues[i] = avgLoss == 0 ? 100 : (float) (100 - 100 / (1 + avgGain / avgLoss));
+    // ========== Kernels ==========
+    //
+    // Per-bar formulas shared with the alert engine's condition graph, which
+    // evaluates the same indicators incrementally on ring buffers. Recursive
+    // kernels map the running state at bar i - 1 to the state at bar i.
+
+    /**
+     * Values of an indicator's input by bar index.
+     */
+    @FunctionalInterface
+    public interface Series {
+        float get(int index);
+    }
+
+    /**
+     * Running sum of an SMA: adds bar {@code index} and drops the bar leaving
+     * the window, NaN counted as zero. The SMA is {@code sum / period} from
+     * bar {@code period - 1}.
+     */
+    public static double smaStep(Series input, int index, int period, double prevSum) {
+        double sum = prevSum + zeroIfNaN(input.get(index));
+        if (index >= period) {
+            sum -= zeroIfNaN(input.get(index - period));
+        }
+        return sum;
+    }
+
+    /**
+     * EMA state: a running sum until bar {@code period - 1}, where it becomes
+     * the SMA seed, then the EMA itself. NaN counts as zero.
+     */
+    public static double emaStep(float value, int index, int period, double prev) {
+        value = zeroIfNaN(value);
+        if (index < period - 1) {
+            return prev + value;
+        }
+        if (index == period - 1) {
+            return (prev + value) / period;
+        }
+        return (value - prev) * (2.0 / (period + 1)) + prev;
+    }
+
+    /**
+     * Wilder smoothing as used by ATR and RSI: a running sum until bar
+     * {@code period}, where it becomes the average, then
+     * {@code (prev * (period - 1) + value) / period}.
+     */
+    public static double wilderStep(double value, int index, int period, double prev) {
+        if (index < period) {
+            return prev + value;
+        }
+        if (index == period) {
+            return (prev + value) / period;
+        }
+        return (prev * (period - 1) + value) / period;
+    }
+
+    /**
+     * True range of a bar; the first bar uses its high-low range.
+     */
+    public static float trueRange(EvaluationContext context, int index) {
+        float high = context.getHigh(index);
+        float low = context.getLow(index);
+        float tr = high - low;
+        if (index > 0) {
+            float prevClose = context.getClose(index - 1);
+            tr = Math.max(tr, Math.max(Math.abs(high - prevClose), Math.abs(low - prevClose)));
+        }
+        return tr;
+    }
+
+    /**
+     * RSI from Wilder-smoothed average gain and loss.
+     */
+    public static float rsi(double avgGain, double avgLoss) {
+        return avgLoss == 0 ? 100 : (float) (100 - 100 / (1 + avgGain / avgLoss));
+    }
+
+    /**
+     * Linearly weighted average of the window ending at {@code index}, NaN
+     * counted as zero; NaN before the window is full.
+     */
+    public static float wma(Series input, int index, int period) {
+        if (index < period - 1) {
+            return Float.NaN;
+        }
+        float sum = 0;
+        int weight = 1;
+        for (int j = index - period + 1; j <= index; j++) {
+            float val = input.get(j);
+            if (!Float.isNaN(val)) {
+                sum += val * weight;
+            }
+            weight++;
+        }
+        return sum / (period * (period + 1) / 2.0f);
+    }
+
+    /**
+     * Population standard deviation of the non-NaN values in the window
+     * ending at {@code index}; NaN before the window is full or if it is empty.
+     */
+    public static float stdDev(Series input, int index, int period) {
+        if (index < period - 1) {
+            return Float.NaN;
+        }
+        double sum = 0;
+        int count = 0;
+        for (int j = index - period + 1; j <= index; j++) {
+            float val = input.get(j);
+            if (!Float.isNaN(val)) {
+                sum += val;
+                count++;
+            }
+        }
+        if (count == 0) {
+            return Float.NaN;
+        }
+
+        double mean = sum / count;
+        double variance = 0;
+        for (int j = index - period + 1; j <= index; j++) {
+            float val = input.get(j);
+            if (!Float.isNaN(val)) {
+                double diff = val - mean;
+                variance += diff * diff;
             }
         }
+        return (float) Math.sqrt(variance / count);
+    }
+
+    /**
+     * Highest non-NaN value in the window ending at {@code index}.
+     */
+    public static float highest(Series input, int index, int period) {
+        if (index < period - 1) {
+            return Float.NaN;
+        }
+        float max = Float.NEGATIVE_INFINITY;
+        for (int j = index - period + 1; j <= index; j++) {
+            float val = input.get(j);
+            if (!Float.isNaN(val) && val > max) {
+                max = val;
+            }
+        }
+        return max == Float.NEGATIVE_INFINITY ? Float.NaN : max;
+    }
+
+    /**
+     * Lowest non-NaN value in the window ending at {@code index}.
+     */
+    public static float lowest(Series input, int index, int period) {
+        if (index < period - 1) {
+            return Float.NaN;
+        }
+        float min = Float.POSITIVE_INFINITY;
+        for (int j = index - period + 1; j <= index; j++) {
+            float val = input.get(j);
+            if (!Float.isNaN(val) && val < min) {
+                min = val;
+            }
+        }
+        return min == Float.POSITIVE_INFINITY ? Float.NaN : min;
+    }
+
+    private static float zeroIfNaN(float value) {
+        return Float.isNaN(value) ? 0 : value;
     }
 
     @Override
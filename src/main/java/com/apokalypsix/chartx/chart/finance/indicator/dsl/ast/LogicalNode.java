@@ -0,0 +1,112 @@
+package com.apokalypsix.chartx.chart.finance.indicator.dsl.ast;
+
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.EvaluationContext;
+
+/**
+ * AST node representing a logical operation on conditions.
+ *
+ * <p>Supports: and, or, not. Non-zero operands are true. Float.NaN means
+ * "unknown" (e.g. an indicator still warming up) and follows three-valued
+ * logic: {@code false and NaN} is false, {@code true or NaN} is true, and
+ * every other combination involving NaN is NaN.
+ */
+public class LogicalNode implements ExpressionNode {
+
+    /**
+     * Available logical operators.
+     */
+    public enum Operator {
+        AND("and"),
+        OR("or"),
+        NOT("not");
+
+        private final String keyword;
+
+        Operator(String keyword) {
+            this.keyword = keyword;
+        }
+
+        public String getKeyword() {
+            return keyword;
+        }
+    }
+
+    private final Operator operator;
+    private final ExpressionNode left;
+    private final ExpressionNode right;
+
+    /**
+     * Creates a binary logical node.
+     */
+    public LogicalNode(Operator operator, ExpressionNode left, ExpressionNode right) {
+        this.operator = operator;
+        this.left = left;
+        this.right = right;
+    }
+
+    /**
+     * Creates a negation.
+     */
+    public static LogicalNode not(ExpressionNode operand) {
+        return new LogicalNode(Operator.NOT, operand, null);
+    }
+
+    public Operator getOperator() {
+        return operator;
+    }
+
+    public ExpressionNode getLeft() {
+        return left;
+    }
+
+    /**
+     * Returns the right operand, or null for NOT.
+     */
+    public ExpressionNode getRight() {
+        return right;
+    }
+
+    @Override
+    public float evaluate(EvaluationContext context, int index) {
+        float leftVal = left.evaluate(context, index);
+        float rightVal = right != null ? right.evaluate(context, index) : Float.NaN;
+        return apply(operator, leftVal, rightVal);
+    }
+
+    /**
+     * Applies a logical operator. The right value is ignored for NOT.
+     *
+     * @return 1 if true, 0 if false, NaN if unknown
+     */
+    public static float apply(Operator operator, float leftVal, float rightVal) {
+        switch (operator) {
+            case NOT:
+                return Float.isNaN(leftVal) ? Float.NaN : (leftVal != 0 ? 0 : 1);
+            case AND:
+                if (leftVal == 0 || rightVal == 0) return 0;
+                if (Float.isNaN(leftVal) || Float.isNaN(rightVal)) return Float.NaN;
+                return 1;
+            case OR:
+                if ((!Float.isNaN(leftVal) && leftVal != 0) || (!Float.isNaN(rightVal) && rightVal != 0)) return 1;
+                if (Float.isNaN(leftVal) || Float.isNaN(rightVal)) return Float.NaN;
+                return 0;
+            default:
+                return Float.NaN;
+        }
+    }
+
+    @Override
+    public String toExpressionString() {
+        if (operator == Operator.NOT) {
+            return "(not " + left.toExpressionString() + ")";
+        }
+        return "(" + left.toExpressionString() + " " + operator.getKeyword() +
+                " " + right.toExpressionString() + ")";
+    }
+
+    @Override
+    public int getMinimumBars() {
+        int min = left.getMinimumBars();
+        return right != null ? Math.max(min, right.getMinimumBars()) : min;
+    }
+}
@@ -0,0 +1,57 @@
+package com.apokalypsix.chartx.chart.finance.indicator.impl.trend;
+
+import com.apokalypsix.chartx.chart.finance.indicator.base.AbstractOhlcIndicator;
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.core.data.PrefixSums;
+
+/**
+ * Linear Regression (LSMA) indicator.
+ *
+ * <p>For each bar, fits a least-squares line through the closes of the last
+ * {@code period} bars and outputs the line's value at that bar.
+ *
+ * <p>Each window is fitted in constant time from the close prefix sums of the
+ * source ({@link OhlcData#getPrefixSums()}), so the cost does not grow with
+ * the period.
+ */
+public class LinearRegressionIndicator extends AbstractOhlcIndicator {
+
+    private final int period;
+
+    /**
+     * Creates a linear regression indicator with the specified period.
+     *
+     * @param period the number of bars in each regression window (at least 2)
+     */
+    public LinearRegressionIndicator(int period) {
+        super("linreg_" + period, "LinReg(" + period + ")", period);
+        if (period < 2) {
+            throw new IllegalArgumentException("Period must be at least 2");
+        }
+        this.period = period;
+    }
+
+    /**
+     * Returns the regression period.
+     */
+    public int getPeriod() {
+        return period;
+    }
+
+    @Override
+    protected void computeValues(OhlcData source, float[] outValues, long[] timestamps) {
+        PrefixSums sums = source.getPrefixSums();
+        int size = source.size();
+        sums.ensure(size);
+
+        for (int i = 0; i < size; i++) {
+            if (i < period - 1) {
+                // Not enough data yet
+                outValues[i] = Float.NaN;
+            } else {
+                PrefixSums.Fit fit = sums.fit(i - period + 1, i);
+                outValues[i] = fit.count() < 2 ? Float.NaN : (float) fit.valueAt(i);
+            }
+        }
+    }
+}
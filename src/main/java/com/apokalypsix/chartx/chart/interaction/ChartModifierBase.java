@@ -8,6 +8,7 @@ import com.apokalypsix.chartx.core.interaction.modifier.ModifierKeyEventArgs;
 import com.apokalypsix.chartx.core.interaction.modifier.ModifierMouseEventArgs;
 
 import java.awt.Cursor;
+import java.util.concurrent.locks.Lock;
 
 /**
  * Abstract base class for chart modifiers providing common functionality.
@@ -212,4 +213,24 @@ public abstract class ChartModifierBase implements ChartModifier {
     protected int scaleForHiDPI(int coord) {
         return surface != null ? surface.scaleForHiDPI(coord) : coord;
     }
+
+    /**
+     * Runs an action with the surface's state lock held. Use this for state
+     * changes made outside event dispatch, such as from a timer.
+     *
+     * @param action the action to run
+     */
+    protected void runWithStateLock(Runnable action) {
+        Lock lock = surface != null ? surface.getStateLock() : null;
+        if (lock == null) {
+            action.run();
+            return;
+        }
+        lock.lock();
+        try {
+            action.run();
+        } finally {
+            lock.unlock();
+        }
+    }
 }
@@ -12,6 +12,7 @@ import com.apokalypsix.chartx.core.interaction.modifier.ModifierMouseEventArgs;
 import com.apokalypsix.chartx.core.interaction.DrawingInteractionHandler;
 
 import java.awt.Cursor;
+import java.util.concurrent.locks.Lock;
 
 /**
  * Interface for accessing chart components from within modifiers.
@@ -104,6 +105,19 @@ public interface ModifierSurface {
      */
     void setCursor(Cursor cursor);
 
+    /**
+     * Returns the lock guarding chart state while a frame renders off the EDT.
+     *
+     * <p>Mouse and key events are already dispatched with this lock held.
+     * Modifiers that change the viewport or layers from elsewhere, e.g. a
+     * Swing timer, must hold it too.
+     *
+     * @return the state lock, or null if rendering happens on the EDT
+     */
+    default Lock getStateLock() {
+        return null;
+    }
+
     // ========== Multi-Chart Sync ==========
 
     /**
@@ -88,7 +88,7 @@ public class MouseWheelZoomModifier extends ChartModifierBase {
         // Timer to flush any pending zoom after scrolling stops
         flushTimer = new Timer((int) THROTTLE_MS * 2, e -> {
             if (hasPendingZoom) {
-                applyAccumulatedZoom();
+                runWithStateLock(this::applyAccumulatedZoom);
             }
         });
         flushTimer.setRepeats(false);
@@ -8,6 +8,7 @@ import com.apokalypsix.chartx.chart.data.Data;
 import com.apokalypsix.chartx.chart.data.OhlcData;
 import com.apokalypsix.chartx.chart.data.XyData;
 import com.apokalypsix.chartx.chart.interaction.ChartModifierBase;
+import com.apokalypsix.chartx.core.interaction.ScreenColumnIndex;
 import com.apokalypsix.chartx.core.interaction.modifier.ModifierMouseEventArgs;
 import com.apokalypsix.chartx.chart.interaction.ModifierSurface;
 import com.apokalypsix.chartx.core.interaction.modifier.MouseEventGroup;
@@ -66,6 +67,15 @@ public class RolloverModifier extends ChartModifierBase {
     /** Reusable tooltip data container (avoid allocations) */
     private final TooltipData tooltipData = new TooltipData();
 
+    /** Nearest data index per pixel column of the primary data */
+    private final ScreenColumnIndex columnIndex = new ScreenColumnIndex();
+
+    /** Bar index and data version the tooltip rows were formatted for */
+    private int tooltipIndex = -1;
+    private int tooltipVersion;
+    private Data<?> tooltipSeries;
+    private boolean tooltipRowsValid;
+
     /** Default series color for tooltips */
     private Color defaultSeriesColor = new Color(100, 149, 237); // Cornflower blue
 
@@ -172,6 +182,7 @@ public class RolloverModifier extends ChartModifierBase {
      */
     public RolloverModifier setTooltipConfig(TooltipConfig config) {
         this.tooltipConfig = config;
+        invalidateTooltipRows();
         return this;
     }
 
@@ -192,6 +203,8 @@ public class RolloverModifier extends ChartModifierBase {
      */
     public RolloverModifier setDefaultSeriesColor(Color color) {
         this.defaultSeriesColor = color;
+        invalidateTooltipRows();
+        tooltipSeries = null;
         return this;
     }
 
@@ -235,6 +248,8 @@ public class RolloverModifier extends ChartModifierBase {
         int x = args.getScreenX();
         int y = args.getScreenY();
 
+        syncColumnIndex();
+
         // Optionally snap to nearest data point
         if (snapToDataPoint && args.isMaster()) {
             x = snapXToDataPoint(x);
@@ -280,6 +295,15 @@ public class RolloverModifier extends ChartModifierBase {
         requestRepaint();
     }
 
+    /**
+     * Points the column index at the current primary data and brings it up
+     * to date with the viewport. Rebuilds only after a pan, zoom or data change.
+     */
+    private void syncColumnIndex() {
+        columnIndex.attach(surface.getPrimaryData());
+        columnIndex.update(getCoordinates(), getViewport());
+    }
+
     /**
      * Calculates the bar index at the given screen X coordinate.
      *
@@ -287,31 +311,12 @@ public class RolloverModifier extends ChartModifierBase {
      * @return the bar index, or -1 if not available
      */
     private int calculateBarIndex(int screenX) {
-        Data<?> data = surface.getPrimaryData();
-        var coords = getCoordinates();
-
-        if (data == null || data.isEmpty() || coords == null) {
+        Data<?> data = columnIndex.getData();
+        if (data == null || data.isEmpty() || getCoordinates() == null) {
             return -1;
         }
 
-        // Convert screen X to timestamp
-        long timestamp = coords.screenXToXValue(screenX);
-
-        // Find the nearest data point
-        int idx = data.indexAtOrBefore(timestamp);
-        if (idx < 0) {
-            idx = 0;
-        }
-
-        // If we have a next point, check which is closer
-        if (idx < data.size() - 1) {
-            long timeBefore = data.getXValue(idx);
-            long timeAfter = data.getXValue(idx + 1);
-            if (Math.abs(timestamp - timeAfter) < Math.abs(timestamp - timeBefore)) {
-                idx = idx + 1;
-            }
-        }
-
+        int idx = columnIndex.indexAt(screenX, getCoordinates());
         if (idx < 0 || idx >= data.size()) {
             return -1;
         }
@@ -325,13 +330,25 @@ public class RolloverModifier extends ChartModifierBase {
      * @param barIndex the bar index, or -1 if no valid bar
      */
     private void updateTooltipData(int barIndex) {
+        Data<?> data = columnIndex.getData();
+        int version = columnIndex.getDataVersion();
+
+        // Rows are already formatted for this bar unless the data changed
+        if (tooltipRowsValid && barIndex == tooltipIndex && data == tooltipSeries
+                && version == tooltipVersion) {
+            return;
+        }
+        tooltipRowsValid = true;
+        tooltipIndex = barIndex;
+        tooltipSeries = data;
+        tooltipVersion = version;
+
         tooltipData.clear();
 
         if (barIndex < 0) {
             return;
         }
 
-        Data<?> data = surface.getPrimaryData();
         if (data == null || barIndex >= data.size()) {
             return;
         }
@@ -346,6 +363,13 @@ public class RolloverModifier extends ChartModifierBase {
         }
     }
 
+    /**
+     * Forces the tooltip rows to be formatted again on the next move.
+     */
+    private void invalidateTooltipRows() {
+        tooltipRowsValid = false;
+    }
+
     /**
      * Collects OHLCV tooltip data from candlestick data.
      */
@@ -379,30 +403,15 @@ public class RolloverModifier extends ChartModifierBase {
             return screenX;
         }
 
-        Data<?> data = surface.getPrimaryData();
+        Data<?> data = columnIndex.getData();
         var coords = getCoordinates();
 
         if (data == null || data.isEmpty() || coords == null) {
             return screenX;
         }
 
-        // Convert screen X to timestamp
-        long timestamp = coords.screenXToXValue(screenX);
-
-        // Find nearest data point
-        int idx = data.indexAtOrBefore(timestamp);
-        if (idx < 0) {
-            idx = 0;
-        } else if (idx < data.size() - 1) {
-            // Check if next point is closer
-            long timeBefore = data.getXValue(idx);
-            long timeAfter = data.getXValue(idx + 1);
-            if (Math.abs(timestamp - timeAfter) < Math.abs(timestamp - timeBefore)) {
-                idx = idx + 1;
-            }
-        }
-
         // Convert back to screen coordinate
+        int idx = columnIndex.indexAt(screenX, coords);
         if (idx >= 0 && idx < data.size()) {
             long snappedTime = data.getXValue(idx);
             return (int) coords.xValueToScreenX(snappedTime);
@@ -513,6 +522,8 @@ public class RolloverModifier extends ChartModifierBase {
     public void onDetached() {
         // Hide crosshair when detached
         setCrosshairVisible(false);
+        columnIndex.detach();
+        tooltipSeries = null;
         super.onDetached();
     }
 }
@@ -1,6 +1,7 @@
 package com.apokalypsix.chartx.chart.overlay;
 
 import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+import com.apokalypsix.chartx.core.data.PrefixSums;
 
 import java.util.ArrayList;
 import java.util.List;
@@ -91,6 +92,23 @@ public class MeasureTool extends Drawing {
         return (int) (getTimeDifference() / barDurationMillis);
     }
 
+    /**
+     * Computes mean, standard deviation, trend and R² of a series over the
+     * measured bars. Constant time, so it can run on every drag frame.
+     *
+     * @param sums prefix sums of the series, e.g. {@code OhlcData.getPrefixSums()}
+     * @return the statistics, or null if the tool is incomplete or no bar is covered
+     */
+    public PrefixSums.Fit computeStatistics(PrefixSums sums) {
+        if (!isComplete()) return null;
+        long fromTime = Math.min(start.timestamp(), end.timestamp());
+        long toTime = Math.max(start.timestamp(), end.timestamp());
+        int from = sums.getData().indexAtOrAfter(fromTime);
+        int to = sums.getData().indexAtOrBefore(toTime);
+        if (from < 0 || to < 0 || from > to) return null;
+        return sums.fit(from, to);
+    }
+
     @Override
     public boolean containsPoint(int screenX, int screenY, CoordinateSystem coords, int hitDistance) {
         if (!isComplete()) return false;
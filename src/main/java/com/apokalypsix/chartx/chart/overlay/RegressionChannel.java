@@ -1,6 +1,9 @@
 package com.apokalypsix.chartx.chart.overlay;
 
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.chart.data.DataListener;
 import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+import com.apokalypsix.chartx.core.data.PrefixSums;
 
 import java.awt.Color;
 import java.util.ArrayList;
@@ -11,17 +14,49 @@ import java.util.List;
  *
  * <p>The channel consists of a linear regression line through two points
  * with parallel upper and lower bands at a configurable standard deviation distance.
+ *
+ * <p>Without a source the line simply joins the two anchors. With a source
+ * set via {@link #setSource}, the anchors only select the bar range: the
+ * line is the least-squares fit of the source over that range and the bands
+ * lie {@code standardDeviations} standard errors away. The channel refits
+ * itself when an anchor moves or a bar inside the range changes; each
+ * {@link #refit()} is O(1) thanks to the prefix sums. Renderers only read the
+ * fitted anchors. A width set with {@link #setChannelWidth} is kept until
+ * {@link #setStandardDeviations} is called.
  */
 public class RegressionChannel extends Drawing {
 
-    private AnchorPoint start;
-    private AnchorPoint end;
+    private volatile AnchorPoint start;
+    private volatile AnchorPoint end;
 
     private double standardDeviations = 2.0;
-    private double channelWidth = 0;  // Calculated or manually set
+    private volatile double channelWidth = 0;  // Calculated or manually set
+    private boolean manualWidth;
     private boolean filled = true;
     private Color fillColor = new Color(100, 149, 237, 30);
 
+    // Data the channel is fitted to, or null for a manual channel
+    private PrefixSums source;
+    private volatile PrefixSums.Fit fit;
+
+    // Registered after the source's own listener, so the sums see a change first
+    private final DataListener dataListener = new DataListener() {
+        @Override
+        public void onDataAppended(Data<?> data, int newIndex) {
+            refitIfInRange(data, newIndex);
+        }
+
+        @Override
+        public void onDataUpdated(Data<?> data, int index) {
+            refitIfInRange(data, index);
+        }
+
+        @Override
+        public void onDataCleared(Data<?> data) {
+            refit();
+        }
+    };
+
     public RegressionChannel(String id, long startTimestamp, double startPrice) {
         super(id);
         this.start = new AnchorPoint(startTimestamp, startPrice);
@@ -53,12 +88,13 @@ public class RegressionChannel extends Drawing {
     }
 
     @Override
-    public void setAnchorPoint(int index, AnchorPoint point) {
+    public synchronized void setAnchorPoint(int index, AnchorPoint point) {
         switch (index) {
             case 0 -> start = point;
             case 1 -> end = point;
             default -> throw new IndexOutOfBoundsException("RegressionChannel has only 2 anchor points");
         }
+        refit();
     }
 
     @Override
@@ -66,6 +102,90 @@ public class RegressionChannel extends Drawing {
         return 2;
     }
 
+    /**
+     * Fits the channel to the given data over the anchored bar range and
+     * keeps it fitted as the data changes. Set the source back to null when
+     * the channel is removed, so the data no longer references it.
+     *
+     * <p>Bulk loads do not notify listeners; call {@link #refit()} after one.
+     *
+     * @param source prefix sums of the fitted series, or null to draw the
+     *               channel through the anchors as placed
+     */
+    public synchronized void setSource(PrefixSums source) {
+        if (this.source != null) {
+            this.source.getData().removeListener(dataListener);
+        }
+        this.source = source;
+        this.fit = null;
+        if (source != null) {
+            source.getData().addListener(dataListener);
+        }
+        refit();
+    }
+
+    public PrefixSums getSource() { return source; }
+
+    /**
+     * Returns the fit of the last {@link #refit()}, or null for a manual channel.
+     */
+    public PrefixSums.Fit getFit() { return fit; }
+
+    /**
+     * Moves the anchor prices onto the least-squares line of the source over
+     * the anchored bars and, unless it was set manually, sets the channel
+     * width from the standard error. Does nothing without a source.
+     */
+    public synchronized void refit() {
+        if (source == null || !isComplete()) {
+            return;
+        }
+        long fromTime = Math.min(start.timestamp(), end.timestamp());
+        long toTime = Math.max(start.timestamp(), end.timestamp());
+        int from = source.getData().indexAtOrAfter(fromTime);
+        int to = source.getData().indexAtOrBefore(toTime);
+        if (from < 0 || to < 0 || from > to) {
+            return;
+        }
+
+        PrefixSums.Fit result = source.fit(from, to);
+        if (result.count() == 0) {
+            return;
+        }
+        fit = result;
+
+        // Line value at the anchor times, interpolated between bar indices
+        start = new AnchorPoint(start.timestamp(), result.valueAt(barPosition(start.timestamp(), from, to)));
+        end = new AnchorPoint(end.timestamp(), result.valueAt(barPosition(end.timestamp(), from, to)));
+        if (!manualWidth) {
+            channelWidth = standardDeviations * result.standardError();
+        }
+    }
+
+    /**
+     * Refits if the changed bar lies before the end of the anchored range;
+     * bars after it do not change the fit.
+     */
+    private void refitIfInRange(Data<?> data, int index) {
+        AnchorPoint a = start;
+        AnchorPoint b = end;
+        if (a == null || b == null || index < 0 || index >= data.size()) {
+            return;
+        }
+        if (data.getXValue(index) <= Math.max(a.timestamp(), b.timestamp())) {
+            refit();
+        }
+    }
+
+    private double barPosition(long timestamp, int from, int to) {
+        long fromTime = source.getData().getXValue(from);
+        long toTime = source.getData().getXValue(to);
+        if (to == from || toTime == fromTime) {
+            return from;
+        }
+        return from + (double) (timestamp - fromTime) / (toTime - fromTime) * (to - from);
+    }
+
     /**
      * Returns the slope of the regression line in price per millisecond.
      */
@@ -145,13 +265,32 @@ public class RegressionChannel extends Drawing {
 
     public AnchorPoint getStart() { return start; }
     public AnchorPoint getEnd() { return end; }
-    public void setEnd(AnchorPoint end) { this.end = end; }
+    public synchronized void setEnd(AnchorPoint end) {
+        this.end = end;
+        refit();
+    }
 
     public double getStandardDeviations() { return standardDeviations; }
-    public void setStandardDeviations(double standardDeviations) { this.standardDeviations = standardDeviations; }
+
+    /**
+     * Sets the band distance in standard errors. A fitted channel goes back
+     * to deriving its width from the fit.
+     */
+    public synchronized void setStandardDeviations(double standardDeviations) {
+        this.standardDeviations = standardDeviations;
+        this.manualWidth = false;
+        refit();
+    }
 
     public double getChannelWidth() { return channelWidth; }
-    public void setChannelWidth(double channelWidth) { this.channelWidth = channelWidth; }
+
+    /**
+     * Sets the band distance in price units. Refits keep this width.
+     */
+    public synchronized void setChannelWidth(double channelWidth) {
+        this.channelWidth = channelWidth;
+        this.manualWidth = true;
+    }
 
     public boolean isFilled() { return filled; }
     public void setFilled(boolean filled) { this.filled = filled; }
@@ -159,8 +298,9 @@ public class RegressionChannel extends Drawing {
     public Color getFillColor() { return fillColor; }
     public void setFillColor(Color fillColor) { this.fillColor = fillColor; }
 
-    public void move(long deltaTime, double deltaPrice) {
+    public synchronized void move(long deltaTime, double deltaPrice) {
         if (start != null) start = new AnchorPoint(start.timestamp() + deltaTime, start.price() + deltaPrice);
         if (end != null) end = new AnchorPoint(end.timestamp() + deltaTime, end.price() + deltaPrice);
+        refit();
     }
 }
@@ -1,6 +1,7 @@
 package com.apokalypsix.chartx.chart.overlay.region;
 
 import java.awt.Color;
+import java.util.concurrent.atomic.AtomicLong;
 
 /**
  * Represents a price range region with background coloring.
@@ -22,6 +23,9 @@ import java.awt.Color;
  */
 public class PriceRangeRegion {
 
+    // Bumped by every setter that affects rendering, across all instances
+    private static final AtomicLong MODIFICATION_COUNT = new AtomicLong();
+
     private final String id;
     private double minPrice;
     private double maxPrice;
@@ -76,6 +80,15 @@ public class PriceRangeRegion {
         this.label = label;
     }
 
+    /**
+     * Returns a counter that changes whenever any region of this type has its
+     * range, colors or visibility changed. Render layers compare it between
+     * frames to detect in-place edits without scanning every region.
+     */
+    public static long getModificationCount() {
+        return MODIFICATION_COUNT.get();
+    }
+
     private static String generateId() {
         return "price_region_" + System.nanoTime();
     }
@@ -133,6 +146,7 @@ public class PriceRangeRegion {
             throw new IllegalArgumentException("Min price must be <= max price");
         }
         this.minPrice = minPrice;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setMaxPrice(double maxPrice) {
@@ -140,6 +154,7 @@ public class PriceRangeRegion {
             throw new IllegalArgumentException("Max price must be >= min price");
         }
         this.maxPrice = maxPrice;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setPriceRange(double minPrice, double maxPrice) {
@@ -148,14 +163,17 @@ public class PriceRangeRegion {
         }
         this.minPrice = minPrice;
         this.maxPrice = maxPrice;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setFillColor(Color fillColor) {
         this.fillColor = fillColor;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setBorderColor(Color borderColor) {
         this.borderColor = borderColor;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setLabel(String label) {
@@ -164,6 +182,7 @@ public class PriceRangeRegion {
 
     public void setVisible(boolean visible) {
         this.visible = visible;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     // ========== Utility ==========
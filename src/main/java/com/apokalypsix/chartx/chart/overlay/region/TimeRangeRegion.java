@@ -1,6 +1,7 @@
 package com.apokalypsix.chartx.chart.overlay.region;
 
 import java.awt.Color;
+import java.util.concurrent.atomic.AtomicLong;
 
 /**
  * Represents a time range region with background coloring.
@@ -21,6 +22,9 @@ import java.awt.Color;
  */
 public class TimeRangeRegion {
 
+    // Bumped by every setter that affects rendering, across all instances
+    private static final AtomicLong MODIFICATION_COUNT = new AtomicLong();
+
     private final String id;
     private long startTime;
     private long endTime;
@@ -75,6 +79,15 @@ public class TimeRangeRegion {
         this.label = label;
     }
 
+    /**
+     * Returns a counter that changes whenever any region of this type has its
+     * range, colors or visibility changed. Render layers compare it between
+     * frames to detect in-place edits without scanning every region.
+     */
+    public static long getModificationCount() {
+        return MODIFICATION_COUNT.get();
+    }
+
     private static String generateId() {
         return "region_" + System.nanoTime();
     }
@@ -128,6 +141,7 @@ public class TimeRangeRegion {
             throw new IllegalArgumentException("Start time must be <= end time");
         }
         this.startTime = startTime;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setEndTime(long endTime) {
@@ -135,6 +149,7 @@ public class TimeRangeRegion {
             throw new IllegalArgumentException("End time must be >= start time");
         }
         this.endTime = endTime;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setTimeRange(long startTime, long endTime) {
@@ -143,14 +158,17 @@ public class TimeRangeRegion {
         }
         this.startTime = startTime;
         this.endTime = endTime;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setFillColor(Color fillColor) {
         this.fillColor = fillColor;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setBorderColor(Color borderColor) {
         this.borderColor = borderColor;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     public void setLabel(String label) {
@@ -159,6 +177,7 @@ public class TimeRangeRegion {
 
     public void setVisible(boolean visible) {
         this.visible = visible;
+        MODIFICATION_COUNT.incrementAndGet();
     }
 
     // ========== Utility ==========
@@ -9,6 +9,7 @@ import com.apokalypsix.chartx.core.render.api.BufferDescriptor;
 import com.apokalypsix.chartx.core.render.api.DrawMode;
 import com.apokalypsix.chartx.core.render.api.ResourceManager;
 import com.apokalypsix.chartx.core.render.api.Shader;
+import com.apokalypsix.chartx.core.render.util.BandFillMesh;
 
 import java.awt.Color;
 
@@ -17,6 +18,10 @@ import java.awt.Color;
  *
  * <p>Renders Bollinger Bands, Keltner Channels, and similar indicators
  * with optional fill between bands and configurable line colors.
+ *
+ * <p>On linearizable axis scales the fill is drawn from a cached
+ * {@link BandFillMesh}, colored by {@code crossFillColor} where the lower
+ * band is on top, so panning does not re-tessellate it.
  */
 public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOptions> {
 
@@ -26,12 +31,18 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
     private Buffer fillBuffer;
     private Buffer lineBuffer;
     private ResourceManager resourceManager;
+    private BandFillMesh fillMesh;
 
     // Reusable vertex arrays
     private float[] fillVertices;
     private float[] lineVertices;
     private int vertexCapacity;
 
+    // Reusable screen coordinates of the visible points
+    private float[] screenXs;
+    private float[] screenYs;
+    private float[] lowerYs;
+
     /**
      * Creates a band series with the given data and default options.
      */
@@ -68,9 +79,14 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
         BufferDescriptor lineDesc = BufferDescriptor.positionOnly2D(2048);
         lineBuffer = resources.getOrCreateBuffer(id + "_line", lineDesc);
 
+        fillMesh = new BandFillMesh(id + "_fillmesh", data, data::getUpperArray, data::getLowerArray);
+
         vertexCapacity = 1024;
         fillVertices = new float[vertexCapacity * FLOATS_PER_VERTEX * 2]; // 2 verts per point for strip
         lineVertices = new float[vertexCapacity * FLOATS_PER_VERTEX];
+        screenXs = new float[vertexCapacity];
+        screenYs = new float[vertexCapacity];
+        lowerYs = new float[vertexCapacity];
     }
 
     @Override
@@ -79,6 +95,10 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
             resourceManager.disposeBuffer(id + "_fill");
             resourceManager.disposeBuffer(id + "_line");
         }
+        if (fillMesh != null) {
+            fillMesh.dispose();
+            fillMesh = null;
+        }
         fillBuffer = null;
         lineBuffer = null;
     }
@@ -105,6 +125,15 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
 
         CoordinateSystem coords = ctx.getCoordinatesForAxis(options.getYAxisId());
 
+        // Render fill between bands first, from the cached mesh when possible
+        boolean showFill = options.isShowFill() && options.getFillColor() != null;
+        boolean meshFill = showFill && BandFillMesh.supports(coords.getYAxisScale());
+        if (meshFill) {
+            Color crossFill = options.getCrossFillColor();
+            fillMesh.setColors(options.getFillColor(), crossFill != null ? crossFill : options.getFillColor());
+            fillMesh.draw(ctx, coords, resourceManager, firstIdx, lastIdx);
+        }
+
         Shader shader = resourceManager.getShader(ResourceManager.SHADER_SIMPLE);
         if (shader == null || !shader.isValid()) {
             return;
@@ -113,8 +142,9 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
         shader.bind();
         shader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
-        // Render fill between bands first
-        if (options.isShowFill() && options.getFillColor() != null) {
+        coords.xValueToScreenX(data.getTimestampsArray(), screenXs, firstIdx, visibleCount);
+
+        if (showFill && !meshFill) {
             renderFill(shader, coords, firstIdx, lastIdx);
         }
 
@@ -143,9 +173,11 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
                 fillColor.getBlue() / 255f,
                 fillColor.getAlpha() / 255f);
 
-        long[] timestamps = data.getTimestampsArray();
         float[] upper = data.getUpperArray();
         float[] lower = data.getLowerArray();
+        int count = lastIdx - firstIdx + 1;
+        coords.yValueToScreenY(upper, screenYs, firstIdx, count);
+        coords.yValueToScreenY(lower, lowerYs, firstIdx, count);
 
         int floatIndex = 0;
         for (int i = firstIdx; i <= lastIdx; i++) {
@@ -153,9 +185,9 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
                 continue;
             }
 
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float upperY = (float) coords.yValueToScreenY(upper[i]);
-            float lowerY = (float) coords.yValueToScreenY(lower[i]);
+            float x = screenXs[i - firstIdx];
+            float upperY = screenYs[i - firstIdx];
+            float lowerY = lowerYs[i - firstIdx];
 
             // Triangle strip: alternate upper/lower
             fillVertices[floatIndex++] = x;
@@ -179,8 +211,8 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
                 color.getBlue() / 255f,
                 1.0f);
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = isUpper ? data.getUpperArray() : data.getLowerArray();
+        coords.yValueToScreenY(values, screenYs, firstIdx, lastIdx - firstIdx + 1);
 
         int segmentStart = -1;
         int floatIndex = 0;
@@ -195,8 +227,8 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
                 }
                 segmentStart = -1;
             } else {
-                float x = (float) coords.xValueToScreenX(timestamps[i]);
-                float y = (float) coords.yValueToScreenY(value);
+                float x = screenXs[i - firstIdx];
+                float y = screenYs[i - firstIdx];
 
                 lineVertices[floatIndex++] = x;
                 lineVertices[floatIndex++] = y;
@@ -220,8 +252,8 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
                 color.getBlue() / 255f,
                 1.0f);
 
-        long[] timestamps = data.getTimestampsArray();
         float[] middle = data.getMiddleArray();
+        coords.yValueToScreenY(middle, screenYs, firstIdx, lastIdx - firstIdx + 1);
 
         int segmentStart = -1;
         int floatIndex = 0;
@@ -236,8 +268,8 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
                 }
                 segmentStart = -1;
             } else {
-                float x = (float) coords.xValueToScreenX(timestamps[i]);
-                float y = (float) coords.yValueToScreenY(value);
+                float x = screenXs[i - firstIdx];
+                float y = screenYs[i - firstIdx];
 
                 lineVertices[floatIndex++] = x;
                 lineVertices[floatIndex++] = y;
@@ -275,6 +307,12 @@ public class BandSeries extends AbstractRenderableSeries<XyyData, BandSeriesOpti
         if (requiredLineFloats > lineVertices.length) {
             lineVertices = new float[vertexCapacity * FLOATS_PER_VERTEX];
         }
+
+        if (pointCount > screenXs.length) {
+            screenXs = new float[vertexCapacity];
+            screenYs = new float[vertexCapacity];
+            lowerYs = new float[vertexCapacity];
+        }
     }
 
     @Override
@@ -1,6 +1,10 @@
 package com.apokalypsix.chartx.chart.series;
 
+import com.apokalypsix.chartx.chart.axis.scale.AxisScale;
+import com.apokalypsix.chartx.chart.axis.scale.LinearScale;
+import com.apokalypsix.chartx.chart.axis.scale.PercentageScale;
 import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+import com.apokalypsix.chartx.core.data.ScaledColumns;
 import com.apokalypsix.chartx.core.render.model.RenderContext;
 import com.apokalypsix.chartx.chart.style.OhlcSeriesOptions;
 import com.apokalypsix.chartx.chart.style.OhlcSeriesOptions.OhlcStyle;
@@ -45,6 +49,16 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
     private float[] lineVertices;
     private int vertexCapacity;
 
+    // Screen coordinates of the visible candles, mapped once per frame
+    private float[] screenX = new float[0];
+    private float[] openY = new float[0];
+    private float[] highY = new float[0];
+    private float[] lowY = new float[0];
+    private float[] closeY = new float[0];
+
+    // Scale whose cached columns this series uses, released when it changes
+    private AxisScale columnsScale;
+
     /**
      * Creates a candlestick series with the given data and default options.
      */
@@ -98,6 +112,7 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
         bodyBuffer = null;
         wickBuffer = null;
         lineBuffer = null;
+        releaseColumns(null);
     }
 
     @Override
@@ -117,6 +132,7 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
         ensureCapacity(visibleCount);
 
         CoordinateSystem coords = ctx.getCoordinatesForAxis(options.getYAxisId());
+        mapToScreen(coords, firstIdx, lastIdx);
 
         Shader shader = resourceManager.getShader(ResourceManager.SHADER_DEFAULT);
         if (shader == null || !shader.isValid()) {
@@ -233,7 +249,6 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
                                          double halfBodyWidth, boolean bearishOnly) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] opens = data.getOpenArray();
         float[] closes = data.getCloseArray();
 
@@ -247,11 +262,13 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
                 continue;
             }
 
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
+            int c = i - firstIdx;
+            float x = screenX[c];
             Color color = options.getColorForCandle(bullish);
 
-            float top = (float) coords.yValueToScreenY(Math.max(open, close));
-            float bottom = (float) coords.yValueToScreenY(Math.min(open, close));
+            // Screen Y grows downwards, so the higher price has the smaller Y
+            float top = Math.min(openY[c], closeY[c]);
+            float bottom = Math.max(openY[c], closeY[c]);
             float left = (float) (x - halfBodyWidth);
             float right = (float) (x + halfBodyWidth);
 
@@ -285,7 +302,6 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
                                             double halfBodyWidth) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] opens = data.getOpenArray();
         float[] closes = data.getCloseArray();
 
@@ -299,11 +315,12 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
                 continue;
             }
 
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
+            int c = i - firstIdx;
+            float x = screenX[c];
             Color color = options.getColorForCandle(true);
 
-            float top = (float) coords.yValueToScreenY(close);
-            float bottom = (float) coords.yValueToScreenY(open);
+            float top = closeY[c];
+            float bottom = openY[c];
             float left = (float) (x - halfBodyWidth);
             float right = (float) (x + halfBodyWidth);
 
@@ -341,18 +358,16 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
                                       double tickWidth) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] opens = data.getOpenArray();
-        float[] highs = data.getHighArray();
-        float[] lows = data.getLowArray();
         float[] closes = data.getCloseArray();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float highY = (float) coords.yValueToScreenY(highs[i]);
-            float lowY = (float) coords.yValueToScreenY(lows[i]);
-            float openY = (float) coords.yValueToScreenY(opens[i]);
-            float closeY = (float) coords.yValueToScreenY(closes[i]);
+            int c = i - firstIdx;
+            float x = screenX[c];
+            float highY = this.highY[c];
+            float lowY = this.lowY[c];
+            float openY = this.openY[c];
+            float closeY = this.closeY[c];
 
             boolean bullish = closes[i] >= opens[i];
             Color color = options.getColorForCandle(bullish);
@@ -380,9 +395,6 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
     private int buildCloseLineVertices(CoordinateSystem coords, int firstIdx, int lastIdx) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
-        float[] closes = data.getCloseArray();
-
         // Use upColor for the line
         Color color = options.getUpColor();
         float r = color.getRed() / 255f;
@@ -391,9 +403,8 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
         float a = 1.0f;
 
         for (int i = firstIdx; i <= lastIdx; i++) {
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float y = (float) coords.yValueToScreenY(closes[i]);
-            floatIndex = addVertex(lineVertices, floatIndex, x, y, r, g, b, a);
+            int c = i - firstIdx;
+            floatIndex = addVertex(lineVertices, floatIndex, screenX[c], closeY[c], r, g, b, a);
         }
 
         return floatIndex;
@@ -402,16 +413,14 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
     private int buildWickVertices(CoordinateSystem coords, int firstIdx, int lastIdx) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] opens = data.getOpenArray();
-        float[] highs = data.getHighArray();
-        float[] lows = data.getLowArray();
         float[] closes = data.getCloseArray();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float highY = (float) coords.yValueToScreenY(highs[i]);
-            float lowY = (float) coords.yValueToScreenY(lows[i]);
+            int c = i - firstIdx;
+            float x = screenX[c];
+            float highY = this.highY[c];
+            float lowY = this.lowY[c];
 
             boolean bullish = closes[i] >= opens[i];
             Color color = options.getWickColorForCandle(bullish);
@@ -435,20 +444,18 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
     private int buildSplitWickVertices(CoordinateSystem coords, int firstIdx, int lastIdx) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] opens = data.getOpenArray();
-        float[] highs = data.getHighArray();
-        float[] lows = data.getLowArray();
         float[] closes = data.getCloseArray();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float highY = (float) coords.yValueToScreenY(highs[i]);
-            float lowY = (float) coords.yValueToScreenY(lows[i]);
+            int c = i - firstIdx;
+            float x = screenX[c];
+            float highY = this.highY[c];
+            float lowY = this.lowY[c];
 
             // Body top and bottom (in screen coordinates)
-            float bodyTop = (float) coords.yValueToScreenY(Math.max(opens[i], closes[i]));
-            float bodyBottom = (float) coords.yValueToScreenY(Math.min(opens[i], closes[i]));
+            float bodyTop = Math.min(openY[c], closeY[c]);
+            float bodyBottom = Math.max(openY[c], closeY[c]);
 
             boolean bullish = closes[i] >= opens[i];
             Color color = options.getWickColorForCandle(bullish);
@@ -469,6 +476,48 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
         return floatIndex;
     }
 
+    /**
+     * Maps the visible slice to screen space with the batch transforms.
+     *
+     * <p>On logarithmic (and other linearizable, non-linear) axes the prices
+     * come from the data's cached {@link ScaledColumns}, so only the affine
+     * axis constants are applied per frame.
+     */
+    private void mapToScreen(CoordinateSystem coords, int firstIdx, int lastIdx) {
+        int count = lastIdx - firstIdx + 1;
+        coords.xValueToScreenX(data.getTimestampsArray(), screenX, firstIdx, count);
+
+        AxisScale scale = coords.getYAxisScale();
+        boolean linear = scale instanceof LinearScale || scale instanceof PercentageScale;
+        boolean scaled = !linear && scale.isLinearizable();
+        releaseColumns(scaled ? scale : null);
+        if (scaled) {
+            columnsScale = scale;
+            ScaledColumns columns = data.getScaledColumns(scale);
+            columns.ensure(lastIdx + 1);
+            coords.linearSpaceToScreenY(columns.getOpenArray(), openY, firstIdx, count);
+            coords.linearSpaceToScreenY(columns.getHighArray(), highY, firstIdx, count);
+            coords.linearSpaceToScreenY(columns.getLowArray(), lowY, firstIdx, count);
+            coords.linearSpaceToScreenY(columns.getCloseArray(), closeY, firstIdx, count);
+        } else {
+            coords.yValueToScreenY(data.getOpenArray(), openY, firstIdx, count);
+            coords.yValueToScreenY(data.getHighArray(), highY, firstIdx, count);
+            coords.yValueToScreenY(data.getLowArray(), lowY, firstIdx, count);
+            coords.yValueToScreenY(data.getCloseArray(), closeY, firstIdx, count);
+        }
+    }
+
+    /**
+     * Releases the cached columns of the previous scale unless it is still
+     * the current one.
+     */
+    private void releaseColumns(AxisScale current) {
+        if (columnsScale != null && columnsScale != current) {
+            data.releaseScaledColumns(columnsScale);
+            columnsScale = null;
+        }
+    }
+
     private int addVertex(float[] vertices, int index, float x, float y,
                           float r, float g, float b, float a) {
         vertices[index++] = x;
@@ -494,6 +543,14 @@ public class CandlestickSeries extends AbstractRenderableSeries<OhlcData, OhlcSe
             wickVertices = new float[vertexCapacity * WICK_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX];
             lineVertices = new float[vertexCapacity * OUTLINE_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX];
         }
+        if (candleCount > screenX.length) {
+            int columnCapacity = Math.max(candleCount, vertexCapacity);
+            screenX = new float[columnCapacity];
+            openY = new float[columnCapacity];
+            highY = new float[columnCapacity];
+            lowY = new float[columnCapacity];
+            closeY = new float[columnCapacity];
+        }
     }
 
     @Override
@@ -12,7 +12,11 @@ import com.apokalypsix.chartx.core.render.api.ResourceManager;
 import com.apokalypsix.chartx.core.render.api.Shader;
 
 import java.awt.Color;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Set;
 import java.util.UUID;
 
 /**
@@ -20,6 +24,10 @@ import java.util.UUID;
  *
  * <p>Renders task bars, milestones, progress indicators,
  * and dependency lines for project management visualizations.
+ *
+ * <p>Only tasks intersecting the visible time range and the rows that fit
+ * in the chart height are queried from the data index, and dependency
+ * lines are drawn only when at least one endpoint task is visible.
  */
 public class GanttSeries {
 
@@ -39,6 +47,11 @@ public class GanttSeries {
     private float[] fillVertices;
     private float[] lineVertices;
 
+    // Per-frame visible task window
+    private final List<GanttData.Task> visibleTasks = new ArrayList<>();
+    private final Set<GanttData.Task> visibleTaskSet =
+            Collections.newSetFromMap(new IdentityHashMap<>());
+
     /**
      * Creates a Gantt series with default options.
      */
@@ -138,6 +151,12 @@ public class GanttSeries {
         long visibleStart = viewport.getStartTime();
         long visibleEnd = viewport.getEndTime();
 
+        // Query only the tasks in the visible time x row window, plus unassigned tasks
+        visibleTasks.clear();
+        visibleTaskSet.clear();
+        data.getTasksInWindow(visibleStart, visibleEnd, -1, getLastVisibleRow(viewport), visibleTasks);
+        visibleTaskSet.addAll(visibleTasks);
+
         // Build and draw fills (row stripes, task bars, progress, milestones)
         int fillFloatCount = buildFillVertices(coords, viewport, visibleStart, visibleEnd);
         if (fillFloatCount > 0) {
@@ -168,6 +187,12 @@ public class GanttSeries {
         float chartLeft = (float) coords.xValueToScreenX(visibleStart);
         float chartRight = (float) coords.xValueToScreenX(visibleEnd);
 
+        // Rows beyond the chart height are not drawn
+        int rowCount = Math.min(data.getRowCount(), getLastVisibleRow(viewport) + 1);
+        int milestoneCount = options.isShowMilestones() ? data.getMilestones().size() : 0;
+        fillVertices = ensureCapacity(fillVertices,
+                ((rowCount + 1) / 2 + visibleTasks.size() * 2 + milestoneCount) * 6 * FLOATS_PER_VERTEX);
+
         // Draw row stripes
         if (options.isShowRowStripes()) {
             Color stripeColor = options.getRowStripeColor();
@@ -176,7 +201,6 @@ public class GanttSeries {
             float sb = stripeColor.getBlue() / 255f;
             float sa = (stripeColor.getAlpha() / 255f) * opacity;
 
-            int rowCount = data.getRowCount();
             for (int row = 0; row < rowCount; row += 2) {
                 float y = chartTop + row * rowHeight;
                 floatIndex = addQuad(fillVertices, floatIndex,
@@ -185,9 +209,6 @@ public class GanttSeries {
             }
         }
 
-        // Get visible tasks
-        List<GanttData.Task> visibleTasks = data.getTasksInRange(visibleStart, visibleEnd);
-
         // Draw task bars
         for (GanttData.Task task : visibleTasks) {
             float startX = (float) coords.xValueToScreenX(task.getStartTime());
@@ -266,6 +287,17 @@ public class GanttSeries {
         float taskOffset = options.getTaskVerticalOffset();
         float chartTop = viewport.getTopInset();
 
+        int dependencyCount = 0;
+        if (options.isShowDependencies()) {
+            for (GanttData.Task task : visibleTasks) {
+                dependencyCount += data.getDependenciesFrom(task.getId()).size()
+                        + data.getDependenciesTo(task.getId()).size();
+            }
+        }
+        int borderCount = options.getBorderWidth() > 0 ? visibleTasks.size() : 0;
+        lineVertices = ensureCapacity(lineVertices,
+                (borderCount * 8 + dependencyCount * 6) * FLOATS_PER_VERTEX);
+
         // Draw task borders
         if (options.getBorderWidth() > 0) {
             Color borderColor = options.getTaskBorderColor();
@@ -274,8 +306,6 @@ public class GanttSeries {
             float bb = borderColor.getBlue() / 255f;
             float ba = opacity;
 
-            List<GanttData.Task> visibleTasks = data.getTasksInRange(visibleStart, visibleEnd);
-
             for (GanttData.Task task : visibleTasks) {
                 float startX = (float) coords.xValueToScreenX(task.getStartTime());
                 float endX = (float) coords.xValueToScreenX(task.getEndTime());
@@ -304,68 +334,125 @@ public class GanttSeries {
             float db = depColor.getBlue() / 255f;
             float da = opacity;
 
-            List<GanttData.Dependency> deps = data.getDependencies();
-
-            for (GanttData.Dependency dep : deps) {
-                GanttData.Task fromTask = data.getTask(dep.getFromTaskId());
-                GanttData.Task toTask = data.getTask(dep.getToTaskId());
-
-                if (fromTask == null || toTask == null) {
-                    continue;
+            for (GanttData.Task task : visibleTasks) {
+                // Outgoing from visible tasks, plus incoming whose source is off-screen
+                for (GanttData.Dependency dep : data.getDependenciesFrom(task.getId())) {
+                    floatIndex = addDependency(coords, chartTop, dep, task, data.getTask(dep.getToTaskId()),
+                            floatIndex, dr, dg, db, da);
                 }
-
-                // Calculate connection points based on dependency type
-                float fromX, fromY, toX, toY;
-
-                switch (dep.getType()) {
-                    case FINISH_TO_START:
-                        fromX = (float) coords.xValueToScreenX(fromTask.getEndTime());
-                        fromY = chartTop + fromTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
-                        toX = (float) coords.xValueToScreenX(toTask.getStartTime());
-                        toY = chartTop + toTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
-                        break;
-                    case START_TO_START:
-                        fromX = (float) coords.xValueToScreenX(fromTask.getStartTime());
-                        fromY = chartTop + fromTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
-                        toX = (float) coords.xValueToScreenX(toTask.getStartTime());
-                        toY = chartTop + toTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
-                        break;
-                    case FINISH_TO_FINISH:
-                        fromX = (float) coords.xValueToScreenX(fromTask.getEndTime());
-                        fromY = chartTop + fromTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
-                        toX = (float) coords.xValueToScreenX(toTask.getEndTime());
-                        toY = chartTop + toTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
-                        break;
-                    case START_TO_FINISH:
-                        fromX = (float) coords.xValueToScreenX(fromTask.getStartTime());
-                        fromY = chartTop + fromTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
-                        toX = (float) coords.xValueToScreenX(toTask.getEndTime());
-                        toY = chartTop + toTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
-                        break;
-                    default:
-                        continue;
+                for (GanttData.Dependency dep : data.getDependenciesTo(task.getId())) {
+                    GanttData.Task fromTask = data.getTask(dep.getFromTaskId());
+                    if (!visibleTaskSet.contains(fromTask)) {
+                        floatIndex = addDependency(coords, chartTop, dep, fromTask, task,
+                                floatIndex, dr, dg, db, da);
+                    }
                 }
+            }
+        }
 
-                // Draw connecting line with elbow
-                float elbowOffset = 10f;
+        return floatIndex;
+    }
 
-                // Horizontal segment from source
-                floatIndex = addVertex(lineVertices, floatIndex, fromX, fromY, dr, dg, db, da);
-                floatIndex = addVertex(lineVertices, floatIndex, fromX + elbowOffset, fromY, dr, dg, db, da);
+    private int addDependency(CoordinateSystem coords, float chartTop, GanttData.Dependency dep,
+                              GanttData.Task fromTask, GanttData.Task toTask,
+                              int floatIndex, float dr, float dg, float db, float da) {
+        if (fromTask == null || toTask == null) {
+            return floatIndex;
+        }
 
-                // Vertical segment
-                floatIndex = addVertex(lineVertices, floatIndex, fromX + elbowOffset, fromY, dr, dg, db, da);
-                floatIndex = addVertex(lineVertices, floatIndex, fromX + elbowOffset, toY, dr, dg, db, da);
+        float rowHeight = options.getRowHeight();
+        float taskHeight = options.getTaskHeight();
+        float taskOffset = options.getTaskVerticalOffset();
 
-                // Horizontal segment to target
-                floatIndex = addVertex(lineVertices, floatIndex, fromX + elbowOffset, toY, dr, dg, db, da);
-                floatIndex = addVertex(lineVertices, floatIndex, toX, toY, dr, dg, db, da);
-            }
+        // Calculate connection points based on dependency type
+        float fromX, fromY, toX, toY;
+
+        switch (dep.getType()) {
+            case FINISH_TO_START:
+                fromX = (float) coords.xValueToScreenX(fromTask.getEndTime());
+                fromY = chartTop + fromTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
+                toX = (float) coords.xValueToScreenX(toTask.getStartTime());
+                toY = chartTop + toTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
+                break;
+            case START_TO_START:
+                fromX = (float) coords.xValueToScreenX(fromTask.getStartTime());
+                fromY = chartTop + fromTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
+                toX = (float) coords.xValueToScreenX(toTask.getStartTime());
+                toY = chartTop + toTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
+                break;
+            case FINISH_TO_FINISH:
+                fromX = (float) coords.xValueToScreenX(fromTask.getEndTime());
+                fromY = chartTop + fromTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
+                toX = (float) coords.xValueToScreenX(toTask.getEndTime());
+                toY = chartTop + toTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
+                break;
+            case START_TO_FINISH:
+                fromX = (float) coords.xValueToScreenX(fromTask.getStartTime());
+                fromY = chartTop + fromTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
+                toX = (float) coords.xValueToScreenX(toTask.getEndTime());
+                toY = chartTop + toTask.getRow() * rowHeight + taskOffset + taskHeight / 2;
+                break;
+            default:
+                return floatIndex;
         }
 
+        // Draw connecting line with elbow
+        float elbowOffset = 10f;
+
+        // Horizontal segment from source
+        floatIndex = addVertex(lineVertices, floatIndex, fromX, fromY, dr, dg, db, da);
+        floatIndex = addVertex(lineVertices, floatIndex, fromX + elbowOffset, fromY, dr, dg, db, da);
+
+        // Vertical segment
+        floatIndex = addVertex(lineVertices, floatIndex, fromX + elbowOffset, fromY, dr, dg, db, da);
+        floatIndex = addVertex(lineVertices, floatIndex, fromX + elbowOffset, toY, dr, dg, db, da);
+
+        // Horizontal segment to target
+        floatIndex = addVertex(lineVertices, floatIndex, fromX + elbowOffset, toY, dr, dg, db, da);
+        floatIndex = addVertex(lineVertices, floatIndex, toX, toY, dr, dg, db, da);
+
         return floatIndex;
     }
 
+    /**
+     * Finds the task under a screen position, or null if none.
+     *
+     * <p>Resolves the row from the screen Y and searches only that row's index.
+     */
+    public GanttData.Task findTaskAt(CoordinateSystem coords, Viewport viewport,
+                                     double screenX, double screenY) {
+        float rowHeight = options.getRowHeight();
+        if (rowHeight <= 0) {
+            return null;
+        }
+        double rowY = screenY - viewport.getTopInset();
+        int row = (int) Math.floor(rowY / rowHeight);
+        double offsetInRow = rowY - row * rowHeight;
+        if (offsetInRow < options.getTaskVerticalOffset()
+                || offsetInRow > options.getTaskVerticalOffset() + options.getTaskHeight()) {
+            return null;
+        }
+        return data.findTaskAt(coords.screenXToXValue(screenX), row);
+    }
+
+    /**
+     * Returns the last row that fits in the chart height.
+     */
+    private int getLastVisibleRow(Viewport viewport) {
+        float rowHeight = options.getRowHeight();
+        if (rowHeight <= 0) {
+            return -1;
+        }
+        return (int) (viewport.getChartHeight() / rowHeight);
+    }
+
+    private static float[] ensureCapacity(float[] vertices, int floatCount) {
+        if (vertices.length < floatCount) {
+            return new float[floatCount + floatCount / 2];
+        }
+        return vertices;
+    }
+
     private int addQuad(float[] vertices, int index, float x, float y, float width, float height,
                         float r, float g, float b, float a) {
         // Triangle 1
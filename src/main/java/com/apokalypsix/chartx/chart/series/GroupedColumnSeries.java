@@ -35,6 +35,12 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
     private float[] borderVertices;
     private int vertexCapacity;
 
+    // Per-frame geometry shared across categories
+    private float[] centerXs = new float[0];
+    private float[] groupLeft = new float[0];
+    private float[] groupRight = new float[0];
+    private float[] groupColors = new float[0];
+
     /**
      * Creates a grouped column series with default options.
      */
@@ -95,6 +101,10 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
 
         int firstIdx = data.getFirstVisibleIndex(ctx.getViewport().getStartTime());
         int lastIdx = data.getLastVisibleIndex(ctx.getViewport().getEndTime());
+        if (ctx.hasCategoryAxis()) {
+            // The category axis only lays out its own categories
+            lastIdx = Math.min(lastIdx, ctx.getCategoryAxis().getCategoryCount() - 1);
+        }
 
         if (firstIdx < 0 || lastIdx < 0 || firstIdx > lastIdx) {
             return;
@@ -113,12 +123,18 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
         double singleBarWidth = (groupTotalWidth - barSpacing * (groupCount - 1)) / groupCount;
         double groupStartOffset = -groupTotalWidth / 2.0;
 
+        // Per-group geometry and colors are the same for every category
+        prepareGroups(groupCount, groupStartOffset, singleBarWidth, barSpacing, options.getOpacity());
+
+        // Category centers are shared by bars and borders
+        for (int i = 0; i < visibleCount; i++) {
+            centerXs[i] = (float) coords.xValueToScreenX(firstIdx + i);
+        }
+
         float baselineY = (float) coords.yValueToScreenY(options.getBaseline());
-        float opacity = options.getOpacity();
 
         // Build bar vertices
-        int barFloatIndex = buildBarVertices(coords, firstIdx, lastIdx,
-                groupStartOffset, singleBarWidth, barSpacing, baselineY, opacity);
+        int barFloatIndex = buildBarVertices(coords, firstIdx, lastIdx, baselineY);
 
         // Render filled bars
         Shader shader = resourceManager.getShader(ResourceManager.SHADER_DEFAULT);
@@ -136,8 +152,7 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
 
         // Render borders if enabled
         if (options.isShowBorders() && options.getBorderWidth() > 0) {
-            int borderFloatIndex = buildBorderVertices(coords, firstIdx, lastIdx,
-                    groupStartOffset, singleBarWidth, barSpacing, baselineY);
+            int borderFloatIndex = buildBorderVertices(coords, firstIdx, lastIdx, baselineY);
 
             if (borderFloatIndex > 0) {
                 ctx.getDevice().setLineWidth(options.getBorderWidth());
@@ -149,18 +164,44 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
         shader.unbind();
     }
 
-    private int buildBarVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
-                                  double groupStartOffset, double singleBarWidth,
-                                  float barSpacing, float baselineY, float opacity) {
+    /**
+     * Computes the horizontal offsets and RGBA colors of each group once per
+     * frame instead of once per bar.
+     */
+    private void prepareGroups(int groupCount, double groupStartOffset, double singleBarWidth,
+                               float barSpacing, float opacity) {
+        if (groupLeft.length < groupCount) {
+            groupLeft = new float[groupCount];
+            groupRight = new float[groupCount];
+            groupColors = new float[groupCount * 4];
+        }
+        for (int g = 0; g < groupCount; g++) {
+            double barOffset = groupStartOffset + g * (singleBarWidth + barSpacing);
+            groupLeft[g] = (float) barOffset;
+            groupRight[g] = (float) (barOffset + singleBarWidth);
+
+            Color color = options.getGroupColor(g);
+            groupColors[g * 4] = color.getRed() / 255f;
+            groupColors[g * 4 + 1] = color.getGreen() / 255f;
+            groupColors[g * 4 + 2] = color.getBlue() / 255f;
+            groupColors[g * 4 + 3] = opacity;
+        }
+    }
+
+    private int buildBarVertices(CoordinateSystem coords, int firstIdx, int lastIdx, float baselineY) {
         int floatIndex = 0;
         int groupCount = data.getGroupCount();
+        float baseline = options.getBaseline();
 
-        for (int i = firstIdx; i <= lastIdx; i++) {
-            // Use index as X value for category-based grouped columns
-            float centerX = (float) coords.xValueToScreenX(data.getXValue(i));
+        for (int g = 0; g < groupCount; g++) {
+            float[] values = data.getGroupValuesArray(g);
+            float r = groupColors[g * 4];
+            float gr = groupColors[g * 4 + 1];
+            float b = groupColors[g * 4 + 2];
+            float a = groupColors[g * 4 + 3];
 
-            for (int g = 0; g < groupCount; g++) {
-                float value = data.getValue(i, g);
+            for (int i = firstIdx; i <= lastIdx; i++) {
+                float value = values[i];
                 if (Float.isNaN(value)) {
                     continue;
                 }
@@ -168,20 +209,13 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
                 float valueY = (float) coords.yValueToScreenY(value);
 
                 // Calculate bar position within group
-                double barOffset = groupStartOffset + g * (singleBarWidth + barSpacing);
-                float left = (float) (centerX + barOffset);
-                float right = (float) (centerX + barOffset + singleBarWidth);
-
-                // Get color for this group
-                Color color = options.getGroupColor(g);
-                float r = color.getRed() / 255f;
-                float gr = color.getGreen() / 255f;
-                float b = color.getBlue() / 255f;
-                float a = opacity;
+                float centerX = centerXs[i - firstIdx];
+                float left = centerX + groupLeft[g];
+                float right = centerX + groupRight[g];
 
                 // Bar rectangle from baseline to value
                 float top, bottom;
-                if (value >= options.getBaseline()) {
+                if (value >= baseline) {
                     top = valueY;
                     bottom = baselineY;
                 } else {
@@ -204,11 +238,10 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
         return floatIndex;
     }
 
-    private int buildBorderVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
-                                     double groupStartOffset, double singleBarWidth,
-                                     float barSpacing, float baselineY) {
+    private int buildBorderVertices(CoordinateSystem coords, int firstIdx, int lastIdx, float baselineY) {
         int floatIndex = 0;
         int groupCount = data.getGroupCount();
+        float baseline = options.getBaseline();
 
         Color borderColor = options.getBorderColor();
         float r = borderColor.getRed() / 255f;
@@ -216,24 +249,23 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
         float b = borderColor.getBlue() / 255f;
         float a = 1.0f;
 
-        for (int i = firstIdx; i <= lastIdx; i++) {
-            // Use index as X value for category-based grouped columns
-            float centerX = (float) coords.xValueToScreenX(data.getXValue(i));
+        for (int gr = 0; gr < groupCount; gr++) {
+            float[] values = data.getGroupValuesArray(gr);
 
-            for (int gr = 0; gr < groupCount; gr++) {
-                float value = data.getValue(i, gr);
+            for (int i = firstIdx; i <= lastIdx; i++) {
+                float value = values[i];
                 if (Float.isNaN(value)) {
                     continue;
                 }
 
                 float valueY = (float) coords.yValueToScreenY(value);
 
-                double barOffset = groupStartOffset + gr * (singleBarWidth + barSpacing);
-                float left = (float) (centerX + barOffset);
-                float right = (float) (centerX + barOffset + singleBarWidth);
+                float centerX = centerXs[i - firstIdx];
+                float left = centerX + groupLeft[gr];
+                float right = centerX + groupRight[gr];
 
                 float top, bottom;
-                if (value >= options.getBaseline()) {
+                if (value >= baseline) {
                     top = valueY;
                     bottom = baselineY;
                 } else {
@@ -279,6 +311,9 @@ public class GroupedColumnSeries extends AbstractRenderableSeries<GroupedColumnD
             barVertices = new float[vertexCapacity * groupCount * VERTICES_PER_BAR * FLOATS_PER_VERTEX];
             borderVertices = new float[vertexCapacity * groupCount * 8 * FLOATS_PER_VERTEX];
         }
+        if (centerXs.length < dataCount) {
+            centerXs = new float[Math.max(dataCount, vertexCapacity)];
+        }
     }
 
     @Override
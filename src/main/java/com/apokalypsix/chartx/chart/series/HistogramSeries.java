@@ -31,6 +31,10 @@ public class HistogramSeries extends AbstractRenderableSeries<HistogramData, His
     private float[] barVertices;
     private int vertexCapacity;
 
+    // Reusable screen coordinates of the visible points
+    private float[] screenXs;
+    private float[] screenYs;
+
     /**
      * Creates a histogram series with the given data and default options.
      */
@@ -66,6 +70,8 @@ public class HistogramSeries extends AbstractRenderableSeries<HistogramData, His
 
         vertexCapacity = 256;
         barVertices = new float[vertexCapacity * VERTICES_PER_BAR * FLOATS_PER_VERTEX];
+        screenXs = new float[vertexCapacity];
+        screenYs = new float[vertexCapacity];
     }
 
     @Override
@@ -122,13 +128,15 @@ public class HistogramSeries extends AbstractRenderableSeries<HistogramData, His
                                   double halfBodyWidth, float baselineY, float opacity) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
+        int count = lastIdx - firstIdx + 1;
+        coords.xValueToScreenX(data.getTimestampsArray(), screenXs, firstIdx, count);
+        coords.yValueToScreenY(values, screenYs, firstIdx, count);
 
         for (int i = firstIdx; i <= lastIdx; i++) {
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
+            float x = screenXs[i - firstIdx];
             float value = values[i];
-            float valueY = (float) coords.yValueToScreenY(value);
+            float valueY = screenYs[i - firstIdx];
 
             Color color = options.getColorForValue(value);
             float r = color.getRed() / 255f;
@@ -179,6 +187,8 @@ public class HistogramSeries extends AbstractRenderableSeries<HistogramData, His
         if (requiredFloats > barVertices.length) {
             vertexCapacity = barCount + barCount / 2;
             barVertices = new float[vertexCapacity * VERTICES_PER_BAR * FLOATS_PER_VERTEX];
+            screenXs = new float[vertexCapacity];
+            screenYs = new float[vertexCapacity];
         }
     }
 
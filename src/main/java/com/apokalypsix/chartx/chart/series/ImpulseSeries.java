@@ -33,6 +33,10 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
     private float[] markerVertices;
     private int vertexCapacity;
 
+    // Reusable screen coordinates of the visible points
+    private float[] screenXs;
+    private float[] screenYs;
+
     /**
      * Creates an impulse series with default options.
      */
@@ -72,6 +76,8 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
         vertexCapacity = 256;
         stemVertices = new float[vertexCapacity * 2 * FLOATS_PER_VERTEX]; // 2 vertices per stem
         markerVertices = new float[vertexCapacity * SEGMENTS_PER_CIRCLE * 3 * FLOATS_PER_VERTEX];
+        screenXs = new float[vertexCapacity];
+        screenYs = new float[vertexCapacity];
     }
 
     @Override
@@ -101,6 +107,8 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
         ensureCapacity(visibleCount);
 
         CoordinateSystem coords = ctx.getCoordinatesForAxis(options.getYAxisId());
+        coords.xValueToScreenX(data.getTimestampsArray(), screenXs, firstIdx, visibleCount);
+        coords.yValueToScreenY(data.getValuesArray(), screenYs, firstIdx, visibleCount);
 
         Shader shader = resourceManager.getShader(ResourceManager.SHADER_DEFAULT);
         if (shader == null || !shader.isValid()) {
@@ -120,7 +128,7 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
 
         // Draw markers if enabled
         if (options.getMarkerShape() != ImpulseSeriesOptions.MarkerShape.NONE) {
-            int markerFloatCount = buildMarkerVertices(coords, firstIdx, lastIdx);
+            int markerFloatCount = buildMarkerVertices(firstIdx, lastIdx);
             if (markerFloatCount > 0) {
                 markerBuffer.upload(markerVertices, 0, markerFloatCount);
                 markerBuffer.draw(DrawMode.TRIANGLES);
@@ -133,7 +141,6 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
     private int buildStemVertices(CoordinateSystem coords, int firstIdx, int lastIdx) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
 
         Color color = options.getColor();
@@ -150,8 +157,8 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
                 continue;
             }
 
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float valueY = (float) coords.yValueToScreenY(value);
+            float x = screenXs[i - firstIdx];
+            float valueY = screenYs[i - firstIdx];
 
             // Baseline point
             floatIndex = addVertex(stemVertices, floatIndex, x, baselineY, r, g, b, a);
@@ -162,10 +169,9 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
         return floatIndex;
     }
 
-    private int buildMarkerVertices(CoordinateSystem coords, int firstIdx, int lastIdx) {
+    private int buildMarkerVertices(int firstIdx, int lastIdx) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
 
         Color markerColor = options.getMarkerColor();
@@ -183,8 +189,8 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
                 continue;
             }
 
-            float cx = (float) coords.xValueToScreenX(timestamps[i]);
-            float cy = (float) coords.yValueToScreenY(value);
+            float cx = screenXs[i - firstIdx];
+            float cy = screenYs[i - firstIdx];
 
             switch (shape) {
                 case CIRCLE:
@@ -270,6 +276,8 @@ public class ImpulseSeries extends AbstractRenderableSeries<XyData, ImpulseSerie
             vertexCapacity = pointCount + pointCount / 2;
             stemVertices = new float[vertexCapacity * 2 * FLOATS_PER_VERTEX];
             markerVertices = new float[vertexCapacity * SEGMENTS_PER_CIRCLE * 3 * FLOATS_PER_VERTEX];
+        screenXs = new float[vertexCapacity];
+        screenYs = new float[vertexCapacity];
         }
     }
 
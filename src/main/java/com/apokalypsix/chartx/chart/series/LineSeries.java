@@ -3,6 +3,7 @@ package com.apokalypsix.chartx.chart.series;
 import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
 import com.apokalypsix.chartx.core.render.model.RenderContext;
 import com.apokalypsix.chartx.chart.style.LineSeriesOptions;
+import com.apokalypsix.chartx.chart.data.ComparisonGroup;
 import com.apokalypsix.chartx.chart.data.XyData;
 import com.apokalypsix.chartx.core.render.api.Buffer;
 import com.apokalypsix.chartx.core.render.api.BufferDescriptor;
@@ -17,6 +18,9 @@ import java.awt.Color;
  *
  * <p>Supports various display modes including standard lines, filled areas,
  * and step functions. Handles gaps in data (NaN values) by breaking the line.
+ *
+ * <p>When part of a {@link ComparisonGroup}, values are drawn rebased to the
+ * first visible bar through a per-frame factor in the Y transform.
  */
 public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptions> {
 
@@ -32,6 +36,16 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
     private float[] fillVertices;
     private int vertexCapacity;
 
+    // Screen coordinates of the visible points, from the batch transforms
+    private float[] screenXs;
+    private float[] screenYs;
+
+    // Optional rebasing for multi-symbol comparison
+    private ComparisonGroup comparison;
+
+    // Rebase factor of the current frame
+    private double valueScale = 1.0;
+
     /**
      * Creates a line series with the given data and default options.
      */
@@ -53,6 +67,18 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
         super(id, data, options);
     }
 
+    /**
+     * Draws this series rebased within the given comparison group, which
+     * must contain the series data. Pass null to draw raw values.
+     */
+    public void setComparison(ComparisonGroup comparison) {
+        this.comparison = comparison;
+    }
+
+    public ComparisonGroup getComparison() {
+        return comparison;
+    }
+
     @Override
     public SeriesType getType() {
         return SeriesType.LINE;
@@ -71,6 +97,8 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
         vertexCapacity = 1024;
         lineVertices = new float[vertexCapacity * FLOATS_PER_VERTEX];
         fillVertices = new float[vertexCapacity * FLOATS_PER_VERTEX * 2]; // Extra for triangles
+        screenXs = new float[vertexCapacity];
+        screenYs = new float[vertexCapacity];
     }
 
     @Override
@@ -100,6 +128,14 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
         if (firstIdx > 0) firstIdx--;
         if (lastIdx < data.size() - 1) lastIdx++;
 
+        valueScale = 1.0;
+        if (comparison != null) {
+            valueScale = comparison.getRebaseScale(data, ctx.getViewport().getStartTime());
+            if (Double.isNaN(valueScale)) {
+                return;
+            }
+        }
+
         int visibleCount = lastIdx - firstIdx + 1;
         ensureCapacity(visibleCount);
 
@@ -135,8 +171,8 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
 
         ctx.getDevice().setLineWidth(options.getLineWidth());
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
+        toScreen(coords, firstIdx, lastIdx);
 
         int segmentStart = -1;
         int floatIndex = 0;
@@ -151,11 +187,8 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
                 }
                 segmentStart = -1;
             } else {
-                float x = (float) coords.xValueToScreenX(timestamps[i]);
-                float y = (float) coords.yValueToScreenY(value);
-
-                lineVertices[floatIndex++] = x;
-                lineVertices[floatIndex++] = y;
+                lineVertices[floatIndex++] = screenXs[i - firstIdx];
+                lineVertices[floatIndex++] = screenYs[i - firstIdx];
 
                 if (segmentStart < 0) {
                     segmentStart = i;
@@ -198,9 +231,9 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
                 fillColor.getBlue() / 255f,
                 fillColor.getAlpha() / 255f * options.getOpacity());
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
         float baselineY = (float) coords.yValueToScreenY(options.getBaseline());
+        toScreen(coords, firstIdx, lastIdx);
 
         int floatIndex = 0;
 
@@ -210,8 +243,8 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
                 continue;
             }
 
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float y = (float) coords.yValueToScreenY(value);
+            float x = screenXs[i - firstIdx];
+            float y = screenYs[i - firstIdx];
 
             // Build triangle strip: alternate between baseline and value
             fillVertices[floatIndex++] = x;
@@ -229,32 +262,82 @@ public class LineSeries extends AbstractRenderableSeries<XyData, LineSeriesOptio
         shader.unbind();
     }
 
+    /**
+     * Transforms the visible slice with the coordinate system's batch kernels,
+     * which use the axis constants precomputed for this frame. The rebase
+     * factor, if any, is folded into those constants.
+     */
+    private void toScreen(CoordinateSystem coords, int firstIdx, int lastIdx) {
+        int count = lastIdx - firstIdx + 1;
+        coords.xValueToScreenX(data.getTimestampsArray(), screenXs, firstIdx, count);
+        if (comparison != null) {
+            coords.yValueToScreenY(data.getValuesArray(), screenYs, firstIdx, count, valueScale);
+        } else {
+            coords.yValueToScreenY(data.getValuesArray(), screenYs, firstIdx, count);
+        }
+    }
+
     private void ensureCapacity(int pointCount) {
         int requiredFloats = pointCount * FLOATS_PER_VERTEX;
         if (requiredFloats > lineVertices.length) {
             vertexCapacity = pointCount + pointCount / 2;
             lineVertices = new float[vertexCapacity * FLOATS_PER_VERTEX];
             fillVertices = new float[vertexCapacity * FLOATS_PER_VERTEX * 2];
+            screenXs = new float[vertexCapacity];
+            screenYs = new float[vertexCapacity];
         }
     }
 
     @Override
     public double getMinValue(int startIdx, int endIdx) {
+        return getMinValue(startIdx, endIdx, Long.MIN_VALUE);
+    }
+
+    @Override
+    public double getMaxValue(int startIdx, int endIdx) {
+        return getMaxValue(startIdx, endIdx, Long.MIN_VALUE);
+    }
+
+    @Override
+    public double getMinValue(int startIdx, int endIdx, long viewportStart) {
         if (data.isEmpty() || startIdx < 0 || endIdx < 0) {
             return Double.NaN;
         }
         startIdx = Math.max(0, startIdx);
         endIdx = Math.min(data.size() - 1, endIdx);
+        if (comparison != null) {
+            return rebaseRange(startIdx, endIdx, viewportStart, true);
+        }
         return data.findMinValue(startIdx, endIdx);
     }
 
     @Override
-    public double getMaxValue(int startIdx, int endIdx) {
+    public double getMaxValue(int startIdx, int endIdx, long viewportStart) {
         if (data.isEmpty() || startIdx < 0 || endIdx < 0) {
             return Double.NaN;
         }
         startIdx = Math.max(0, startIdx);
         endIdx = Math.min(data.size() - 1, endIdx);
+        if (comparison != null) {
+            return rebaseRange(startIdx, endIdx, viewportStart, false);
+        }
         return data.findMaxValue(startIdx, endIdx);
     }
+
+    /**
+     * Rebases a value range for autoscaling, anchored like {@link #render}
+     * at the viewport start, or at the range start if the viewport is
+     * unknown.
+     */
+    private double rebaseRange(int startIdx, int endIdx, long viewportStart, boolean wantMin) {
+        long anchor = viewportStart != Long.MIN_VALUE ? viewportStart : data.getXValue(startIdx);
+        double scale = comparison.getRebaseScale(data, anchor);
+        if (Double.isNaN(scale)) {
+            return Double.NaN;
+        }
+        // A negative factor swaps the ends
+        double a = data.findMinValue(startIdx, endIdx) * scale;
+        double b = data.findMaxValue(startIdx, endIdx) * scale;
+        return wantMin ? Math.min(a, b) : Math.max(a, b);
+    }
 }
@@ -119,4 +119,33 @@ public interface RenderableSeries<D extends Data<?>, O extends SeriesOptions> {
      * @return the maximum value, or Double.NaN if no valid data
      */
     double getMaxValue(int startIdx, int endIdx);
+
+    /**
+     * Returns the minimum Y value in the given index range as drawn in a
+     * viewport starting at the given time. Series whose values depend on the
+     * viewport, such as rebased comparison lines, override this; the default
+     * ignores the time.
+     *
+     * @param startIdx the start index (inclusive)
+     * @param endIdx the end index (inclusive)
+     * @param viewportStart the viewport start time
+     * @return the minimum value, or Double.NaN if no valid data
+     */
+    default double getMinValue(int startIdx, int endIdx, long viewportStart) {
+        return getMinValue(startIdx, endIdx);
+    }
+
+    /**
+     * Returns the maximum Y value in the given index range as drawn in a
+     * viewport starting at the given time.
+     *
+     * @param startIdx the start index (inclusive)
+     * @param endIdx the end index (inclusive)
+     * @param viewportStart the viewport start time
+     * @return the maximum value, or Double.NaN if no valid data
+     * @see #getMinValue(int, int, long)
+     */
+    default double getMaxValue(int startIdx, int endIdx, long viewportStart) {
+        return getMaxValue(startIdx, endIdx);
+    }
 }
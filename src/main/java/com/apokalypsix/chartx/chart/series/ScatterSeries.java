@@ -32,6 +32,10 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
     private float[] markerVertices;
     private int vertexCapacity;
 
+    // Reusable screen coordinates of the visible points
+    private float[] screenXs;
+    private float[] screenYs;
+
     /**
      * Creates a scatter series with the given data and default options.
      */
@@ -68,6 +72,8 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
         vertexCapacity = 256;
         // Circles need more vertices
         markerVertices = new float[vertexCapacity * (SEGMENTS_PER_CIRCLE + 2) * FLOATS_PER_VERTEX];
+        screenXs = new float[vertexCapacity];
+        screenYs = new float[vertexCapacity];
     }
 
     @Override
@@ -95,6 +101,8 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
         ensureCapacity(visibleCount);
 
         CoordinateSystem coords = ctx.getCoordinatesForAxis(options.getYAxisId());
+        coords.xValueToScreenX(data.getTimestampsArray(), screenXs, firstIdx, visibleCount);
+        coords.yValueToScreenY(data.getValuesArray(), screenYs, firstIdx, visibleCount);
 
         float markerSize = options.getMarkerSize();
         float halfSize = markerSize / 2.0f;
@@ -122,23 +130,23 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
         switch (shape) {
             case SQUARE:
             case DIAMOND:
-                floatCount = buildSquareVertices(coords, firstIdx, lastIdx, halfSize, r, g, b, a, shape == ScatterSeriesOptions.MarkerShape.DIAMOND);
+                floatCount = buildSquareVertices(firstIdx, lastIdx, halfSize, r, g, b, a, shape == ScatterSeriesOptions.MarkerShape.DIAMOND);
                 drawMode = DrawMode.TRIANGLES;
                 break;
             case TRIANGLE_UP:
             case TRIANGLE_DOWN:
-                floatCount = buildTriangleVertices(coords, firstIdx, lastIdx, halfSize, r, g, b, a, shape == ScatterSeriesOptions.MarkerShape.TRIANGLE_DOWN);
+                floatCount = buildTriangleVertices(firstIdx, lastIdx, halfSize, r, g, b, a, shape == ScatterSeriesOptions.MarkerShape.TRIANGLE_DOWN);
                 drawMode = DrawMode.TRIANGLES;
                 break;
             case PLUS:
             case CROSS:
-                floatCount = buildCrossVertices(coords, firstIdx, lastIdx, halfSize, r, g, b, a, shape == ScatterSeriesOptions.MarkerShape.CROSS);
+                floatCount = buildCrossVertices(firstIdx, lastIdx, halfSize, r, g, b, a, shape == ScatterSeriesOptions.MarkerShape.CROSS);
                 ctx.getDevice().setLineWidth(2.0f);
                 drawMode = DrawMode.LINES;
                 break;
             case CIRCLE:
             default:
-                floatCount = buildCircleVertices(coords, firstIdx, lastIdx, halfSize, r, g, b, a);
+                floatCount = buildCircleVertices(firstIdx, lastIdx, halfSize, r, g, b, a);
                 drawMode = DrawMode.TRIANGLES;
                 break;
         }
@@ -151,11 +159,10 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
         shader.unbind();
     }
 
-    private int buildCircleVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
+    private int buildCircleVertices(int firstIdx, int lastIdx,
                                      float radius, float r, float g, float b, float a) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
@@ -163,8 +170,8 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
                 continue;
             }
 
-            float cx = (float) coords.xValueToScreenX(timestamps[i]);
-            float cy = (float) coords.yValueToScreenY(values[i]);
+            float cx = screenXs[i - firstIdx];
+            float cy = screenYs[i - firstIdx];
 
             // Triangle fan for circle
             for (int j = 0; j < SEGMENTS_PER_CIRCLE; j++) {
@@ -187,11 +194,10 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
         return floatIndex;
     }
 
-    private int buildSquareVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
+    private int buildSquareVertices(int firstIdx, int lastIdx,
                                      float halfSize, float r, float g, float b, float a, boolean isDiamond) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
@@ -199,8 +205,8 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
                 continue;
             }
 
-            float cx = (float) coords.xValueToScreenX(timestamps[i]);
-            float cy = (float) coords.yValueToScreenY(values[i]);
+            float cx = screenXs[i - firstIdx];
+            float cy = screenYs[i - firstIdx];
 
             if (isDiamond) {
                 // Diamond: rotated square
@@ -239,11 +245,10 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
         return floatIndex;
     }
 
-    private int buildTriangleVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
+    private int buildTriangleVertices(int firstIdx, int lastIdx,
                                        float halfSize, float r, float g, float b, float a, boolean pointDown) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
@@ -251,8 +256,8 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
                 continue;
             }
 
-            float cx = (float) coords.xValueToScreenX(timestamps[i]);
-            float cy = (float) coords.yValueToScreenY(values[i]);
+            float cx = screenXs[i - firstIdx];
+            float cy = screenYs[i - firstIdx];
 
             if (pointDown) {
                 floatIndex = addVertex(markerVertices, floatIndex, cx - halfSize, cy - halfSize, r, g, b, a);
@@ -268,11 +273,10 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
         return floatIndex;
     }
 
-    private int buildCrossVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
+    private int buildCrossVertices(int firstIdx, int lastIdx,
                                     float halfSize, float r, float g, float b, float a, boolean isX) {
         int floatIndex = 0;
 
-        long[] timestamps = data.getTimestampsArray();
         float[] values = data.getValuesArray();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
@@ -280,8 +284,8 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
                 continue;
             }
 
-            float cx = (float) coords.xValueToScreenX(timestamps[i]);
-            float cy = (float) coords.yValueToScreenY(values[i]);
+            float cx = screenXs[i - firstIdx];
+            float cy = screenYs[i - firstIdx];
 
             if (isX) {
                 // X cross
@@ -319,6 +323,10 @@ public class ScatterSeries extends AbstractRenderableSeries<XyData, ScatterSerie
             vertexCapacity = pointCount + pointCount / 2;
             markerVertices = new float[vertexCapacity * (SEGMENTS_PER_CIRCLE * 3) * FLOATS_PER_VERTEX];
         }
+        if (pointCount > screenXs.length) {
+            screenXs = new float[pointCount + pointCount / 2];
+            screenYs = new float[screenXs.length];
+        }
     }
 
     @Override
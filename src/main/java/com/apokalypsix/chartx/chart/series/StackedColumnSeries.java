@@ -156,6 +156,7 @@ public class StackedColumnSeries implements RenderableSeries<XyData, StackedSeri
             }
             barBuffer = null;
             borderBuffer = null;
+            calculator.dispose();
             initialized = false;
         }
     }
@@ -139,6 +139,7 @@ public class StackedMountainSeries implements RenderableSeries<XyData, StackedSe
             }
             fillBuffer = null;
             lineBuffer = null;
+            calculator.dispose();
             initialized = false;
         }
     }
@@ -13,6 +13,7 @@ import com.apokalypsix.chartx.core.render.api.ResourceManager;
 import com.apokalypsix.chartx.core.render.api.Shader;
 
 import java.awt.Color;
+import java.util.Arrays;
 import java.util.UUID;
 
 /**
@@ -20,6 +21,14 @@ import java.util.UUID;
  *
  * <p>Renders arrows or lines representing vector directions
  * and magnitudes on a 2D grid.
+ *
+ * <p>Per-cell glyph attributes (unit direction, pixel length and color) are
+ * cached and rebuilt only when the field or the styling changes, so a frame
+ * only maps the visible columns and rows to screen once and emits vertices
+ * from the cache. If {@code minArrowSpacing} is set, dense grids are thinned
+ * with a zoom-dependent stride that keeps arrows at least that many pixels
+ * apart; the stride is aligned to the grid so glyphs do not shimmer while
+ * panning.
  */
 public class VectorFieldSeries {
 
@@ -39,6 +48,16 @@ public class VectorFieldSeries {
     private float[] fillVertices;
     private float[] lineVertices;
     private float[] rgba = new float[4];
+    private float[] colScreenX = new float[0];
+    private float[] rowScreenY = new float[0];
+
+    // Cached per-cell glyph attributes (row-major, like the data)
+    private float[] glyphDirX;
+    private float[] glyphDirY;
+    private float[] glyphLength;   // pixels, 0 = not drawn
+    private float[] glyphColor;    // r, g, b, a per cell
+    private long glyphVersion = -1;
+    private Object[] glyphStyleKey;
 
     /**
      * Creates a vector field series with default options.
@@ -146,18 +165,24 @@ public class VectorFieldSeries {
         int[] colRange = data.getVisibleColumnRange(visibleStart, visibleEnd);
         int[] rowRange = data.getVisibleRowRange(priceMin, priceMax);
 
+        updateGlyphCache();
+        mapGridToScreen(coords, colRange, rowRange);
+
+        int colStride = computeStride(colScreenX, colRange[1] - colRange[0] + 1);
+        int rowStride = computeStride(rowScreenY, rowRange[1] - rowRange[0] + 1);
+
         VectorFieldSeriesOptions.ArrowStyle style = options.getArrowStyle();
 
         if (style == VectorFieldSeriesOptions.ArrowStyle.TRIANGLE) {
             // Build triangle arrows
-            int fillFloatCount = buildTriangleArrows(coords, colRange, rowRange);
+            int fillFloatCount = buildTriangleArrows(colRange, rowRange, colStride, rowStride);
             if (fillFloatCount > 0) {
                 fillBuffer.upload(fillVertices, 0, fillFloatCount);
                 fillBuffer.draw(DrawMode.TRIANGLES);
             }
         } else {
             // Build line arrows
-            int lineFloatCount = buildLineArrows(coords, colRange, rowRange, style);
+            int lineFloatCount = buildLineArrows(colRange, rowRange, colStride, rowStride, style);
             if (lineFloatCount > 0) {
                 ctx.getDevice().setLineWidth(options.getLineWidth());
                 lineBuffer.upload(lineVertices, 0, lineFloatCount);
@@ -168,12 +193,24 @@ public class VectorFieldSeries {
         shader.unbind();
     }
 
-    private int buildLineArrows(CoordinateSystem coords, int[] colRange, int[] rowRange,
-                                 VectorFieldSeriesOptions.ArrowStyle style) {
-        int floatIndex = 0;
-        float opacity = options.getOpacity();
-        int skip = options.getSkipFactor();
+    /**
+     * Rebuilds the per-cell glyph attributes if the field or style changed.
+     */
+    private void updateGlyphCache() {
+        int size = data.getRows() * data.getCols();
+        if (glyphLength != null && glyphLength.length == size &&
+            glyphVersion == data.getVersion() && Arrays.equals(styleKey(), glyphStyleKey)) {
+            return;
+        }
 
+        if (glyphLength == null || glyphLength.length != size) {
+            glyphDirX = new float[size];
+            glyphDirY = new float[size];
+            glyphLength = new float[size];
+            glyphColor = new float[size * 4];
+        }
+
+        float opacity = options.getOpacity();
         ColorMap colorMap = options.getColorMap();
         Color fixedColor = options.getArrowColor();
         float minMag = data.getMinMagnitude();
@@ -186,81 +223,166 @@ public class VectorFieldSeries {
         boolean scaleByMag = options.isScaleByMagnitude();
         boolean normalize = options.isNormalizeLength();
 
-        float arrowheadRatio = options.getArrowheadRatio();
-        double arrowheadAngle = Math.toRadians(options.getArrowheadAngle());
+        float[] dxArray = data.getDxArray();
+        float[] dyArray = data.getDyArray();
+        float[] magnitudes = data.getMagnitudesArray();
 
-        for (int row = rowRange[0]; row <= rowRange[1]; row += skip) {
-            for (int col = colRange[0]; col <= colRange[1]; col += skip) {
-                double x = data.getX(col);
-                double y = data.getY(row);
-                float dx = data.getDx(row, col);
-                float dy = data.getDy(row, col);
+        for (int i = 0; i < size; i++) {
+            float mag = magnitudes[i];
+            if (mag < 0.001f) {
+                glyphLength[i] = 0; // Skip zero vectors
+                continue;
+            }
 
-                float mag = data.getMagnitude(row, col);
-                if (mag < 0.001f) {
-                    continue; // Skip zero vectors
-                }
+            // Calculate arrow length
+            float arrowLength;
+            if (normalize) {
+                arrowLength = maxLength * lengthScale;
+            } else if (scaleByMag) {
+                float normMag = (mag - minMag) / (maxMag - minMag + 0.001f);
+                arrowLength = minLength + normMag * (maxLength - minLength);
+                arrowLength *= lengthScale;
+            } else {
+                arrowLength = mag * lengthScale;
+            }
+            glyphLength[i] = Math.max(minLength, Math.min(maxLength, arrowLength));
+
+            // Direction (normalized)
+            glyphDirX[i] = dxArray[i] / mag;
+            glyphDirY[i] = dyArray[i] / mag;
+
+            // Color
+            int c = i * 4;
+            if (fixedColor != null) {
+                glyphColor[c] = fixedColor.getRed() / 255f;
+                glyphColor[c + 1] = fixedColor.getGreen() / 255f;
+                glyphColor[c + 2] = fixedColor.getBlue() / 255f;
+                glyphColor[c + 3] = (fixedColor.getAlpha() / 255f) * opacity;
+            } else {
+                colorMap.getColor(mag, rgba);
+                glyphColor[c] = rgba[0];
+                glyphColor[c + 1] = rgba[1];
+                glyphColor[c + 2] = rgba[2];
+                glyphColor[c + 3] = rgba[3] * opacity;
+            }
+        }
+
+        glyphVersion = data.getVersion();
+        // Taken after valueRange() above, which may bump the color map version
+        glyphStyleKey = styleKey();
+    }
+
+    /**
+     * Returns the styling the glyph cache depends on. The color map is
+     * mutable, so it is keyed by its version as well as its identity.
+     */
+    private Object[] styleKey() {
+        ColorMap colorMap = options.getColorMap();
+        return new Object[] {
+                options.getArrowColor(), colorMap, colorMap.getVersion(), options.getLengthScale(),
+                options.getMinLength(), options.getMaxLength(), options.isScaleByMagnitude(),
+                options.isNormalizeLength(), options.getOpacity()
+        };
+    }
+
+    /**
+     * Maps the visible grid columns and rows to screen once per frame.
+     */
+    private void mapGridToScreen(CoordinateSystem coords, int[] colRange, int[] rowRange) {
+        int colCount = colRange[1] - colRange[0] + 1;
+        int rowCount = rowRange[1] - rowRange[0] + 1;
+        if (colScreenX.length < colCount) {
+            colScreenX = new float[colCount];
+        }
+        if (rowScreenY.length < rowCount) {
+            rowScreenY = new float[rowCount];
+        }
+        for (int i = 0; i < colCount; i++) {
+            colScreenX[i] = (float) coords.xValueToScreenX((long) data.getX(colRange[0] + i));
+        }
+        for (int i = 0; i < rowCount; i++) {
+            rowScreenY[i] = (float) coords.yValueToScreenY(data.getY(rowRange[0] + i));
+        }
+    }
+
+    /**
+     * Returns the grid stride for one axis: the configured skip factor,
+     * raised so that drawn arrows are at least minArrowSpacing pixels apart.
+     */
+    private int computeStride(float[] screenPositions, int count) {
+        int skip = options.getSkipFactor();
+        float minSpacing = options.getMinArrowSpacing();
+        if (count < 2 || minSpacing <= 0) {
+            return skip;
+        }
+        float pixelsPerCell = Math.abs(screenPositions[count - 1] - screenPositions[0]) / (count - 1);
+        if (pixelsPerCell <= 0) {
+            return Math.max(skip, count);
+        }
+        return Math.max(skip, (int) Math.ceil(minSpacing / pixelsPerCell));
+    }
+
+    private static int alignToStride(int index, int stride) {
+        return ((index + stride - 1) / stride) * stride;
+    }
+
+    private int buildLineArrows(int[] colRange, int[] rowRange, int colStride, int rowStride,
+                                 VectorFieldSeriesOptions.ArrowStyle style) {
+        boolean withHead = style == VectorFieldSeriesOptions.ArrowStyle.ARROW;
+        int firstRow = alignToStride(rowRange[0], rowStride);
+        int firstCol = alignToStride(colRange[0], colStride);
+        int maxGlyphs = ((rowRange[1] - firstRow) / rowStride + 1) * ((colRange[1] - firstCol) / colStride + 1);
+        lineVertices = ensureCapacity(lineVertices, maxGlyphs * (withHead ? 6 : 2) * FLOATS_PER_VERTEX);
 
-                // Get screen position
-                float screenX = (float) coords.xValueToScreenX((long) x);
-                float screenY = (float) coords.yValueToScreenY(y);
-
-                // Calculate arrow length
-                float arrowLength;
-                if (normalize) {
-                    arrowLength = maxLength * lengthScale;
-                } else if (scaleByMag) {
-                    float normMag = (mag - minMag) / (maxMag - minMag + 0.001f);
-                    arrowLength = minLength + normMag * (maxLength - minLength);
-                    arrowLength *= lengthScale;
-                } else {
-                    arrowLength = mag * lengthScale;
+        int floatIndex = 0;
+        float arrowheadRatio = options.getArrowheadRatio();
+        double arrowheadAngle = Math.toRadians(options.getArrowheadAngle());
+        float cosHead = (float) Math.cos(arrowheadAngle);
+        float sinHead = (float) Math.sin(arrowheadAngle);
+        int cols = data.getCols();
+
+        for (int row = firstRow; row <= rowRange[1]; row += rowStride) {
+            float screenY = rowScreenY[row - rowRange[0]];
+            for (int col = firstCol; col <= colRange[1]; col += colStride) {
+                int idx = row * cols + col;
+                float arrowLength = glyphLength[idx];
+                if (arrowLength == 0) {
+                    continue;
                 }
-                arrowLength = Math.max(minLength, Math.min(maxLength, arrowLength));
 
-                // Get direction (normalized)
-                float dirX = dx / mag;
-                float dirY = dy / mag;
+                float screenX = colScreenX[col - colRange[0]];
+                float dirX = glyphDirX[idx];
+                float dirY = glyphDirY[idx];
 
                 // Arrow endpoint
                 float endX = screenX + dirX * arrowLength;
                 float endY = screenY - dirY * arrowLength; // Y is inverted in screen coords
 
-                // Get color
-                float r, g, b, a;
-                if (fixedColor != null) {
-                    r = fixedColor.getRed() / 255f;
-                    g = fixedColor.getGreen() / 255f;
-                    b = fixedColor.getBlue() / 255f;
-                    a = (fixedColor.getAlpha() / 255f) * opacity;
-                } else {
-                    colorMap.getColor(mag, rgba);
-                    r = rgba[0];
-                    g = rgba[1];
-                    b = rgba[2];
-                    a = rgba[3] * opacity;
-                }
+                int c = idx * 4;
+                float r = glyphColor[c];
+                float g = glyphColor[c + 1];
+                float b = glyphColor[c + 2];
+                float a = glyphColor[c + 3];
 
                 // Draw arrow line
                 floatIndex = addVertex(lineVertices, floatIndex, screenX, screenY, r, g, b, a);
                 floatIndex = addVertex(lineVertices, floatIndex, endX, endY, r, g, b, a);
 
-                // Draw arrowhead if style is ARROW
-                if (style == VectorFieldSeriesOptions.ArrowStyle.ARROW) {
+                // Draw arrowhead if style is ARROW; barbs are the reversed
+                // direction rotated by +/- the arrowhead angle
+                if (withHead) {
                     float headLen = arrowLength * arrowheadRatio;
 
                     // Left barb
-                    double angle1 = Math.atan2(-dirY, dirX) + Math.PI - arrowheadAngle;
-                    float lx = endX + (float) Math.cos(angle1) * headLen;
-                    float ly = endY - (float) Math.sin(angle1) * headLen;
+                    float lx = endX - (dirX * cosHead - dirY * sinHead) * headLen;
+                    float ly = endY - (dirY * cosHead + dirX * sinHead) * headLen;
 
                     floatIndex = addVertex(lineVertices, floatIndex, endX, endY, r, g, b, a);
                     floatIndex = addVertex(lineVertices, floatIndex, lx, ly, r, g, b, a);
 
                     // Right barb
-                    double angle2 = Math.atan2(-dirY, dirX) + Math.PI + arrowheadAngle;
-                    float rx = endX + (float) Math.cos(angle2) * headLen;
-                    float ry = endY - (float) Math.sin(angle2) * headLen;
+                    float rx = endX - (dirX * cosHead + dirY * sinHead) * headLen;
+                    float ry = endY - (dirY * cosHead - dirX * sinHead) * headLen;
 
                     floatIndex = addVertex(lineVertices, floatIndex, endX, endY, r, g, b, a);
                     floatIndex = addVertex(lineVertices, floatIndex, rx, ry, r, g, b, a);
@@ -271,54 +393,27 @@ public class VectorFieldSeries {
         return floatIndex;
     }
 
-    private int buildTriangleArrows(CoordinateSystem coords, int[] colRange, int[] rowRange) {
-        int floatIndex = 0;
-        float opacity = options.getOpacity();
-        int skip = options.getSkipFactor();
-
-        ColorMap colorMap = options.getColorMap();
-        Color fixedColor = options.getArrowColor();
-        float minMag = data.getMinMagnitude();
-        float maxMag = data.getMaxMagnitude();
-        colorMap.valueRange(minMag, maxMag);
+    private int buildTriangleArrows(int[] colRange, int[] rowRange, int colStride, int rowStride) {
+        int firstRow = alignToStride(rowRange[0], rowStride);
+        int firstCol = alignToStride(colRange[0], colStride);
+        int maxGlyphs = ((rowRange[1] - firstRow) / rowStride + 1) * ((colRange[1] - firstCol) / colStride + 1);
+        fillVertices = ensureCapacity(fillVertices, maxGlyphs * 3 * FLOATS_PER_VERTEX);
 
-        float lengthScale = options.getLengthScale();
-        float minLength = options.getMinLength();
-        float maxLength = options.getMaxLength();
-        boolean scaleByMag = options.isScaleByMagnitude();
-        boolean normalize = options.isNormalizeLength();
-
-        for (int row = rowRange[0]; row <= rowRange[1]; row += skip) {
-            for (int col = colRange[0]; col <= colRange[1]; col += skip) {
-                double x = data.getX(col);
-                double y = data.getY(row);
-                float dx = data.getDx(row, col);
-                float dy = data.getDy(row, col);
-
-                float mag = data.getMagnitude(row, col);
-                if (mag < 0.001f) {
+        int floatIndex = 0;
+        int cols = data.getCols();
+
+        for (int row = firstRow; row <= rowRange[1]; row += rowStride) {
+            float screenY = rowScreenY[row - rowRange[0]];
+            for (int col = firstCol; col <= colRange[1]; col += colStride) {
+                int idx = row * cols + col;
+                float arrowLength = glyphLength[idx];
+                if (arrowLength == 0) {
                     continue;
                 }
 
-                float screenX = (float) coords.xValueToScreenX((long) x);
-                float screenY = (float) coords.yValueToScreenY(y);
-
-                // Calculate arrow length
-                float arrowLength;
-                if (normalize) {
-                    arrowLength = maxLength * lengthScale;
-                } else if (scaleByMag) {
-                    float normMag = (mag - minMag) / (maxMag - minMag + 0.001f);
-                    arrowLength = minLength + normMag * (maxLength - minLength);
-                    arrowLength *= lengthScale;
-                } else {
-                    arrowLength = mag * lengthScale;
-                }
-                arrowLength = Math.max(minLength, Math.min(maxLength, arrowLength));
-
-                // Get direction
-                float dirX = dx / mag;
-                float dirY = dy / mag;
+                float screenX = colScreenX[col - colRange[0]];
+                float dirX = glyphDirX[idx];
+                float dirY = glyphDirY[idx];
 
                 // Calculate triangle vertices
                 float tipX = screenX + dirX * arrowLength;
@@ -333,20 +428,11 @@ public class VectorFieldSeries {
                 float base2X = screenX - perpX * baseWidth;
                 float base2Y = screenY - perpY * baseWidth;
 
-                // Get color
-                float r, g, b, a;
-                if (fixedColor != null) {
-                    r = fixedColor.getRed() / 255f;
-                    g = fixedColor.getGreen() / 255f;
-                    b = fixedColor.getBlue() / 255f;
-                    a = (fixedColor.getAlpha() / 255f) * opacity;
-                } else {
-                    colorMap.getColor(mag, rgba);
-                    r = rgba[0];
-                    g = rgba[1];
-                    b = rgba[2];
-                    a = rgba[3] * opacity;
-                }
+                int c = idx * 4;
+                float r = glyphColor[c];
+                float g = glyphColor[c + 1];
+                float b = glyphColor[c + 2];
+                float a = glyphColor[c + 3];
 
                 // Draw triangle
                 floatIndex = addVertex(fillVertices, floatIndex, tipX, tipY, r, g, b, a);
@@ -358,6 +444,13 @@ public class VectorFieldSeries {
         return floatIndex;
     }
 
+    private static float[] ensureCapacity(float[] vertices, int floatCount) {
+        if (vertices.length < floatCount) {
+            return new float[floatCount + floatCount / 2];
+        }
+        return vertices;
+    }
+
     private int addVertex(float[] vertices, int index, float x, float y,
                           float r, float g, float b, float a) {
         vertices[index++] = x;
@@ -36,6 +36,11 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
     private float[] connectorVertices;
     private int vertexCapacity;
 
+    // Screen-space columns for the visible bars, mapped once per frame
+    private float[] screenX = new float[0];
+    private float[] topY = new float[0];
+    private float[] baselineY = new float[0];
+
     /**
      * Creates a waterfall series with default options.
      */
@@ -101,19 +106,25 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
 
         int firstIdx = data.getFirstVisibleIndex(ctx.getViewport().getStartTime());
         int lastIdx = data.getLastVisibleIndex(ctx.getViewport().getEndTime());
+        if (ctx.hasCategoryAxis()) {
+            // The category axis only lays out its own categories
+            lastIdx = Math.min(lastIdx, ctx.getCategoryAxis().getCategoryCount() - 1);
+        }
 
         if (firstIdx < 0 || lastIdx < 0 || firstIdx > lastIdx) {
             return;
         }
 
-        int visibleCount = lastIdx - firstIdx + 1;
-        ensureCapacity(visibleCount);
+        // Include the previous bar so the first connector has its left end
+        int columnStart = Math.max(0, firstIdx - 1);
+        ensureCapacity(lastIdx - columnStart + 1);
 
         CoordinateSystem coords = ctx.getCoordinatesForAxis(options.getYAxisId());
+        mapToScreen(coords, columnStart, lastIdx);
 
         double barSlotWidth = ctx.getBarWidth();
         double barWidth = barSlotWidth * options.getBarWidthRatio();
-        double halfBarWidth = barWidth / 2.0;
+        float halfBarWidth = (float) (barWidth / 2.0);
 
         Shader shader = resourceManager.getShader(ResourceManager.SHADER_DEFAULT);
         if (shader == null || !shader.isValid()) {
@@ -126,7 +137,7 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
         // Draw connector lines first (behind bars)
         if (options.isShowConnectors()) {
             ctx.getDevice().setLineWidth(options.getConnectorWidth());
-            int connectorFloatCount = buildConnectorVertices(coords, firstIdx, lastIdx, halfBarWidth);
+            int connectorFloatCount = buildConnectorVertices(columnStart, firstIdx, lastIdx, halfBarWidth);
             if (connectorFloatCount > 0) {
                 connectorBuffer.upload(connectorVertices, 0, connectorFloatCount);
                 connectorBuffer.draw(DrawMode.LINES);
@@ -134,7 +145,7 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
         }
 
         // Draw filled bars
-        int barFloatCount = buildBarVertices(coords, firstIdx, lastIdx, halfBarWidth);
+        int barFloatCount = buildBarVertices(columnStart, firstIdx, lastIdx, halfBarWidth);
         if (barFloatCount > 0) {
             barBuffer.upload(barVertices, 0, barFloatCount);
             barBuffer.draw(DrawMode.TRIANGLES);
@@ -143,7 +154,7 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
         // Draw borders
         if (options.getBorderColor() != null && options.getBorderWidth() > 0) {
             ctx.getDevice().setLineWidth(options.getBorderWidth());
-            int borderFloatCount = buildBorderVertices(coords, firstIdx, lastIdx, halfBarWidth);
+            int borderFloatCount = buildBorderVertices(columnStart, firstIdx, lastIdx, halfBarWidth);
             if (borderFloatCount > 0) {
                 borderBuffer.upload(borderVertices, 0, borderFloatCount);
                 borderBuffer.draw(DrawMode.LINES);
@@ -153,37 +164,60 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
         shader.unbind();
     }
 
-    private int buildBarVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
-                                  double halfBarWidth) {
+    /**
+     * Maps the stored running totals of [fromIdx, toIdx] to screen space once
+     * per frame. Bars, borders and connectors all read from these columns.
+     */
+    private void mapToScreen(CoordinateSystem coords, int fromIdx, int toIdx) {
+        float[] runningTotals = data.getRunningTotalsArray();
+        boolean[] isTotalBar = data.getIsTotalBarArray();
+        float zeroY = (float) coords.yValueToScreenY(0);
+
+        for (int i = fromIdx; i <= toIdx; i++) {
+            int c = i - fromIdx;
+            screenX[c] = (float) coords.xValueToScreenX(i);
+            topY[c] = (float) coords.yValueToScreenY(runningTotals[i]);
+            if (isTotalBar[i] || i == 0) {
+                baselineY[c] = zeroY;
+            } else if (i == fromIdx) {
+                baselineY[c] = (float) coords.yValueToScreenY(runningTotals[i - 1]);
+            } else {
+                // Baseline is the previous bar's running total
+                baselineY[c] = topY[c - 1];
+            }
+        }
+    }
+
+    private int buildBarVertices(int columnStart, int firstIdx, int lastIdx, float halfBarWidth) {
         int floatIndex = 0;
 
-        float[] runningTotals = data.getRunningTotalsArray();
         boolean[] isTotalBar = data.getIsTotalBarArray();
         float[] values = data.getValuesArray();
 
         float opacity = options.getOpacity();
+        Color totalColor = options.getTotalColor();
+        Color positiveColor = options.getPositiveColor();
+        Color negativeColor = options.getNegativeColor();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
-            if (!data.hasValue(i)) {
+            if (Float.isNaN(values[i])) {
                 continue;
             }
 
-            // Use index as X value for category-based waterfall charts
-            float x = (float) coords.xValueToScreenX(data.getXValue(i));
-            float baseline = (float) coords.yValueToScreenY(data.getBaseline(i));
-            float top = (float) coords.yValueToScreenY(runningTotals[i]);
-
-            float left = (float) (x - halfBarWidth);
-            float right = (float) (x + halfBarWidth);
+            int c = i - columnStart;
+            float baseline = baselineY[c];
+            float top = topY[c];
+            float left = screenX[c] - halfBarWidth;
+            float right = screenX[c] + halfBarWidth;
 
             // Determine color based on bar type
             Color color;
             if (isTotalBar[i]) {
-                color = options.getTotalColor();
+                color = totalColor;
             } else if (values[i] >= 0) {
-                color = options.getPositiveColor();
+                color = positiveColor;
             } else {
-                color = options.getNegativeColor();
+                color = negativeColor;
             }
 
             float r = color.getRed() / 255f;
@@ -204,11 +238,10 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
         return floatIndex;
     }
 
-    private int buildBorderVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
-                                     double halfBarWidth) {
+    private int buildBorderVertices(int columnStart, int firstIdx, int lastIdx, float halfBarWidth) {
         int floatIndex = 0;
 
-        float[] runningTotals = data.getRunningTotalsArray();
+        float[] values = data.getValuesArray();
 
         Color borderColor = options.getBorderColor();
         float r = borderColor.getRed() / 255f;
@@ -217,17 +250,15 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
         float a = options.getOpacity();
 
         for (int i = firstIdx; i <= lastIdx; i++) {
-            if (!data.hasValue(i)) {
+            if (Float.isNaN(values[i])) {
                 continue;
             }
 
-            // Use index as X value for category-based waterfall charts
-            float x = (float) coords.xValueToScreenX(data.getXValue(i));
-            float baseline = (float) coords.yValueToScreenY(data.getBaseline(i));
-            float top = (float) coords.yValueToScreenY(runningTotals[i]);
-
-            float left = (float) (x - halfBarWidth);
-            float right = (float) (x + halfBarWidth);
+            int c = i - columnStart;
+            float baseline = baselineY[c];
+            float top = topY[c];
+            float left = screenX[c] - halfBarWidth;
+            float right = screenX[c] + halfBarWidth;
 
             // Left edge
             floatIndex = addVertex(borderVertices, floatIndex, left, baseline, r, g, b, a);
@@ -249,12 +280,11 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
         return floatIndex;
     }
 
-    private int buildConnectorVertices(CoordinateSystem coords, int firstIdx, int lastIdx,
-                                        double halfBarWidth) {
+    private int buildConnectorVertices(int columnStart, int firstIdx, int lastIdx, float halfBarWidth) {
         int floatIndex = 0;
 
-        float[] runningTotals = data.getRunningTotalsArray();
         boolean[] isTotalBar = data.getIsTotalBarArray();
+        float[] values = data.getValuesArray();
 
         Color connectorColor = options.getConnectorColor();
         float r = connectorColor.getRed() / 255f;
@@ -262,35 +292,20 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
         float b = connectorColor.getBlue() / 255f;
         float a = options.getOpacity() * 0.7f; // Slightly transparent
 
-        for (int i = firstIdx; i <= lastIdx; i++) {
-            if (!data.hasValue(i)) {
+        // The first bar has no predecessor
+        for (int i = Math.max(1, firstIdx); i <= lastIdx; i++) {
+            // Skip connector to total bars (they start from 0) and across gaps
+            if (isTotalBar[i] || Float.isNaN(values[i]) || Float.isNaN(values[i - 1])) {
                 continue;
             }
 
-            // Skip connector for the first visible bar
-            if (i == 0) {
-                continue;
-            }
-
-            // Skip connector to total bars (they start from 0)
-            if (isTotalBar[i]) {
-                continue;
-            }
-
-            // Check if previous bar exists
-            if (i > 0 && !data.hasValue(i - 1)) {
-                continue;
-            }
-
-            // Use index as X value for category-based waterfall charts
-            float prevX = (float) coords.xValueToScreenX(data.getXValue(i - 1));
-            float currX = (float) coords.xValueToScreenX(data.getXValue(i));
-            float prevTop = (float) coords.yValueToScreenY(runningTotals[i - 1]);
+            int c = i - columnStart;
 
             // Connector line from previous bar's right edge to current bar's left edge
             // at the previous running total level
-            float prevRight = (float) (prevX + halfBarWidth);
-            float currLeft = (float) (currX - halfBarWidth);
+            float prevRight = screenX[c - 1] + halfBarWidth;
+            float currLeft = screenX[c] - halfBarWidth;
+            float prevTop = topY[c - 1];
 
             floatIndex = addVertex(connectorVertices, floatIndex, prevRight, prevTop, r, g, b, a);
             floatIndex = addVertex(connectorVertices, floatIndex, currLeft, prevTop, r, g, b, a);
@@ -317,6 +332,12 @@ public class WaterfallSeries extends AbstractRenderableSeries<WaterfallData, Wat
             borderVertices = new float[vertexCapacity * 8 * FLOATS_PER_VERTEX];
             connectorVertices = new float[vertexCapacity * 2 * FLOATS_PER_VERTEX];
         }
+        if (screenX.length < barCount) {
+            int columnCapacity = Math.max(barCount, vertexCapacity);
+            screenX = new float[columnCapacity];
+            topY = new float[columnCapacity];
+            baselineY = new float[columnCapacity];
+        }
     }
 
     @Override
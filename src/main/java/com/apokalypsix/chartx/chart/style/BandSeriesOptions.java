@@ -22,6 +22,9 @@ public class BandSeriesOptions extends SeriesOptions {
     /** Fill color between upper and lower bands */
     private Color fillColor = new Color(100, 149, 237, 30); // Semi-transparent
 
+    /** Fill color where the lower band is above the upper one (null = fill color) */
+    private Color crossFillColor;
+
     /** Line width for all bands */
     private float lineWidth = 1.0f;
 
@@ -46,6 +49,7 @@ public class BandSeriesOptions extends SeriesOptions {
         this.middleColor = other.middleColor;
         this.lowerColor = other.lowerColor;
         this.fillColor = other.fillColor;
+        this.crossFillColor = other.crossFillColor;
         this.lineWidth = other.lineWidth;
         this.showFill = other.showFill;
         this.showMiddle = other.showMiddle;
@@ -69,6 +73,10 @@ public class BandSeriesOptions extends SeriesOptions {
         return fillColor;
     }
 
+    public Color getCrossFillColor() {
+        return crossFillColor;
+    }
+
     public float getLineWidth() {
         return lineWidth;
     }
@@ -193,6 +201,18 @@ public class BandSeriesOptions extends SeriesOptions {
         return this;
     }
 
+    /**
+     * Sets the fill color where the lower band crosses above the upper one,
+     * e.g. the bearish color of an Ichimoku cloud.
+     *
+     * @param crossFillColor the fill color, or null to use the fill color
+     * @return this for chaining
+     */
+    public BandSeriesOptions crossFillColor(Color crossFillColor) {
+        this.crossFillColor = crossFillColor;
+        return this;
+    }
+
     /**
      * Sets the line width for all bands.
      *
@@ -55,6 +55,9 @@ public class VectorFieldSeriesOptions {
     /** Skip factor for sparse rendering (1 = all, 2 = every other, etc.) */
     private int skipFactor = 1;
 
+    /** Minimum screen spacing between arrows in pixels; denser grids are thinned (0 = off) */
+    private float minArrowSpacing = 0f;
+
     /** Overall opacity */
     private float opacity = 1.0f;
 
@@ -86,6 +89,7 @@ public class VectorFieldSeriesOptions {
         this.scaleByMagnitude = other.scaleByMagnitude;
         this.normalizeLength = other.normalizeLength;
         this.skipFactor = other.skipFactor;
+        this.minArrowSpacing = other.minArrowSpacing;
         this.opacity = other.opacity;
         this.visible = other.visible;
         this.yAxisId = other.yAxisId;
@@ -141,6 +145,10 @@ public class VectorFieldSeriesOptions {
         return skipFactor;
     }
 
+    public float getMinArrowSpacing() {
+        return minArrowSpacing;
+    }
+
     public float getOpacity() {
         return opacity;
     }
@@ -215,6 +223,11 @@ public class VectorFieldSeriesOptions {
         return this;
     }
 
+    public VectorFieldSeriesOptions minArrowSpacing(float pixels) {
+        this.minArrowSpacing = Math.max(0, pixels);
+        return this;
+    }
+
     public VectorFieldSeriesOptions opacity(float opacity) {
         this.opacity = Math.max(0, Math.min(1, opacity));
         return this;
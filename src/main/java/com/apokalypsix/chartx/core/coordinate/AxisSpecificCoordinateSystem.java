@@ -1,5 +1,7 @@
 package com.apokalypsix.chartx.core.coordinate;
 
+import com.apokalypsix.chartx.chart.axis.scale.AxisScale;
+
 /**
  * Lightweight wrapper that implements CoordinateSystem for a specific axis.
  *
@@ -76,6 +78,21 @@ public class AxisSpecificCoordinateSystem implements CoordinateSystem {
         multiAxis.yValueToScreenY(yValues, screenY, offset, count, axisId);
     }
 
+    @Override
+    public void yValueToScreenY(float[] yValues, float[] screenY, int offset, int count, double valueScale) {
+        multiAxis.yValueToScreenY(yValues, screenY, offset, count, valueScale, axisId);
+    }
+
+    @Override
+    public AxisScale getYAxisScale() {
+        return multiAxis.getYAxisScale(axisId);
+    }
+
+    @Override
+    public void linearSpaceToScreenY(float[] linearValues, float[] screenY, int offset, int count) {
+        multiAxis.linearSpaceToScreenY(linearValues, screenY, offset, count, axisId);
+    }
+
     @Override
     public double getPixelHeight(double ySpan) {
         return multiAxis.getPixelHeight(ySpan, axisId);
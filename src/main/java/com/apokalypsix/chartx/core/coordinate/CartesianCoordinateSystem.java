@@ -120,6 +120,16 @@ public class CartesianCoordinateSystem implements CoordinateSystem {
         }
     }
 
+    @Override
+    public void yValueToScreenY(float[] yValues, float[] screenY, int offset, int count, double valueScale) {
+        ensureCacheValid();
+        // The value factor folds into the axis scale
+        double scale = yScale * valueScale;
+        for (int i = 0; i < count; i++) {
+            screenY[i] = (float) (yOffset - yValues[offset + i] * scale);
+        }
+    }
+
     @Override
     public double getPixelWidth(long xSpan) {
         ensureCacheValid();
@@ -1,5 +1,8 @@
 package com.apokalypsix.chartx.core.coordinate;
 
+import com.apokalypsix.chartx.chart.axis.scale.AxisScale;
+import com.apokalypsix.chartx.chart.axis.scale.LinearScale;
+
 /**
  * Interface for coordinate transformation between data space and screen space.
  *
@@ -76,6 +79,55 @@ public interface CoordinateSystem {
         }
     }
 
+    /**
+     * Batch conversion of scaled Y-values to screen Y coordinates.
+     *
+     * <p>Each value is multiplied by {@code valueScale} before the axis
+     * transform, e.g. to rebase a series to a reference value per frame
+     * without rewriting its data. Implementations fold the factor into their
+     * per-frame axis constants where the scale allows it.
+     *
+     * @param yValues array of Y-values
+     * @param screenY output array for Y coordinates (must be same length or larger)
+     * @param offset starting index in yValues array
+     * @param count number of elements to convert
+     * @param valueScale factor applied to every value
+     */
+    default void yValueToScreenY(float[] yValues, float[] screenY, int offset, int count, double valueScale) {
+        for (int i = 0; i < count; i++) {
+            screenY[i] = (float) yValueToScreenY(yValues[offset + i] * valueScale);
+        }
+    }
+
+    /**
+     * Returns the scale of the Y-axis this coordinate system maps to.
+     *
+     * @return the Y-axis scale ({@link LinearScale#INSTANCE} by default)
+     */
+    default AxisScale getYAxisScale() {
+        return LinearScale.INSTANCE;
+    }
+
+    /**
+     * Batch conversion of values that are already in the Y-axis scale's
+     * linear space (see {@link AxisScale#toLinearSpace(double)}) to screen Y
+     * coordinates.
+     *
+     * <p>Lets renderers keep pre-transformed columns (e.g. logs of prices)
+     * and apply only the per-frame affine axis constants. Infinite values
+     * stand for values outside the scale's domain and are placed like
+     * {@link #yValueToScreenY} places them; NaN stays NaN.
+     *
+     * @param linearValues array of values in linear space
+     * @param screenY output array for Y coordinates (must be same length or larger)
+     * @param offset starting index in linearValues array
+     * @param count number of elements to convert
+     */
+    default void linearSpaceToScreenY(float[] linearValues, float[] screenY, int offset, int count) {
+        // Only linear scales by default, where linear space is the value itself
+        yValueToScreenY(linearValues, screenY, offset, count);
+    }
+
     /**
      * Returns the width in pixels for a given X-value span.
      * For time-series: xSpan is duration in milliseconds.
@@ -2,10 +2,13 @@ package com.apokalypsix.chartx.core.coordinate;
 
 import com.apokalypsix.chartx.chart.axis.Viewport;
 import com.apokalypsix.chartx.chart.axis.YAxis;
+import com.apokalypsix.chartx.chart.axis.scale.AxisScale;
 import com.apokalypsix.chartx.chart.axis.scale.LinearScale;
+import com.apokalypsix.chartx.chart.axis.scale.LogarithmicScale;
+import com.apokalypsix.chartx.chart.axis.scale.PercentageScale;
 
-import java.util.HashMap;
 import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
 
 /**
  * Coordinate system that supports multiple Y-axes with independent value transformations.
@@ -16,6 +19,11 @@ import java.util.Map;
  *
  * <p>This class extends the single-axis CartesianCoordinateSystem pattern to support
  * arbitrary numbers of Y-axes, each with cached transformation parameters for performance.
+ *
+ * <p>Transforms may be read from several threads at once, e.g. by layers in the
+ * pipeline's parallel prepare phase. {@link #updateCache} warms every axis up
+ * front; an axis invalidated afterwards is recomputed into a fresh transform
+ * that is published whole, so readers never see a half-written one.
  */
 public class MultiAxisCoordinateSystem implements CoordinateSystem {
 
@@ -27,9 +35,10 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
     private double xOffset;
 
     // Per-axis Y transformation caches
-    private final Map<String, AxisTransform> axisTransforms = new HashMap<>();
+    private final Map<String, AxisTransform> axisTransforms = new ConcurrentHashMap<>();
 
-    private boolean xCacheValid = false;
+    // Written after xScale and xOffset, which it publishes
+    private volatile boolean xCacheValid = false;
 
     /**
      * Creates a multi-axis coordinate system.
@@ -72,49 +81,97 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
      * Updates the per-axis Y transformation caches.
      */
     private void updateAxisCaches() {
+        for (YAxis axis : axisManager.getAllAxes()) {
+            AxisTransform transform = new AxisTransform();
+            computeTransform(axis, transform);
+            axisTransforms.put(axis.getId(), transform);
+        }
+    }
+
+    /**
+     * Precomputes the per-frame constants of an axis.
+     *
+     * <p>Linear, percentage and logarithmic scales reduce to
+     * {@code screenY = yOffset - t(value) * yScale}, where {@code t} is the
+     * identity or the natural log, so per-point transforms never go through
+     * {@link com.apokalypsix.chartx.chart.axis.scale.AxisScale#normalize}.
+     */
+    private void computeTransform(YAxis axis, AxisTransform transform) {
         int chartHeight = viewport.getChartHeight();
         int topInset = viewport.getTopInset();
 
-        for (YAxis axis : axisManager.getAllAxes()) {
-            AxisTransform transform = axisTransforms.computeIfAbsent(
-                    axis.getId(), id -> new AxisTransform());
-
-            // Calculate effective height and top offset based on heightRatio and anchor
-            int effectiveHeight;
-            int effectiveTop;
-            switch (axis.getAnchor()) {
-                case TOP:
-                    effectiveHeight = (int) (chartHeight * axis.getHeightRatio());
-                    effectiveTop = topInset;
-                    break;
-                case BOTTOM:
-                    effectiveHeight = (int) (chartHeight * axis.getHeightRatio());
-                    effectiveTop = topInset + chartHeight - effectiveHeight;
-                    break;
-                default: // FULL
-                    effectiveHeight = chartHeight;
-                    effectiveTop = topInset;
-                    break;
-            }
-
-            transform.effectiveHeight = effectiveHeight;
-            transform.effectiveTop = effectiveTop;
-            transform.axis = axis;
-            transform.isLinear = (axis.getScale() instanceof LinearScale);
+        // Calculate effective height and top offset based on heightRatio and anchor
+        int effectiveHeight;
+        int effectiveTop;
+        switch (axis.getAnchor()) {
+            case TOP:
+                effectiveHeight = (int) (chartHeight * axis.getHeightRatio());
+                effectiveTop = topInset;
+                break;
+            case BOTTOM:
+                effectiveHeight = (int) (chartHeight * axis.getHeightRatio());
+                effectiveTop = topInset + chartHeight - effectiveHeight;
+                break;
+            default: // FULL
+                effectiveHeight = chartHeight;
+                effectiveTop = topInset;
+                break;
+        }
 
-            double valueSpan = axis.getValueSpan();
+        transform.effectiveHeight = effectiveHeight;
+        transform.effectiveTop = effectiveTop;
+        transform.axis = axis;
+        transform.midY = effectiveTop + effectiveHeight * 0.5;
+
+        AxisScale scale = axis.getScale();
+        double min = axis.getMinValue();
+        double max = axis.getMaxValue();
+
+        if (scale instanceof LinearScale || scale instanceof PercentageScale) {
+            transform.kind = ScaleKind.LINEAR;
+        } else if (scale instanceof LogarithmicScale) {
+            transform.kind = ScaleKind.LOG;
+        } else if (scale.isLinearizable()) {
+            transform.kind = ScaleKind.LINEARIZED;
+        } else {
+            transform.kind = ScaleKind.GENERIC;
+        }
 
-            if (valueSpan > 0) {
-                transform.yScale = effectiveHeight / valueSpan;
-            } else {
-                transform.yScale = 0;
+        switch (transform.kind) {
+            case LINEAR: {
+                double valueSpan = axis.getValueSpan();
+                if (valueSpan > 0) {
+                    transform.yScale = effectiveHeight / valueSpan;
+                    // Y is inverted: screenY = effectiveTop + effectiveHeight - (value - minValue) * scale
+                    // Simplify: screenY = (effectiveTop + effectiveHeight + minValue * scale) - value * scale
+                    transform.yOffset = effectiveTop + effectiveHeight + min * transform.yScale;
+                } else {
+                    // Zero span: everything sits mid-axis, as normalize() returns 0.5
+                    transform.yScale = 0;
+                    transform.yOffset = transform.midY;
+                }
+                break;
             }
-
-            // Y is inverted: screenY = effectiveTop + effectiveHeight - (value - minValue) * scale
-            // Simplify: screenY = (effectiveTop + effectiveHeight + minValue * scale) - value * scale
-            transform.yOffset = effectiveTop + effectiveHeight + axis.getMinValue() * transform.yScale;
-            transform.valid = true;
+            case LOG:
+            case LINEARIZED: {
+                double tMin = scale.toLinearSpace(min);
+                double tSpan = scale.toLinearSpace(max) - tMin;
+                if (scale.isValidRange(min, max) && tSpan > 0 && Double.isFinite(tSpan)) {
+                    transform.yScale = effectiveHeight / tSpan;
+                    transform.yOffset = effectiveTop + effectiveHeight + tMin * transform.yScale;
+                } else {
+                    // Degenerate range: everything sits mid-axis, as normalize() returns 0.5
+                    transform.yScale = 0;
+                    transform.yOffset = transform.midY;
+                }
+                break;
+            }
+            default:
+                transform.yScale = 0;
+                transform.yOffset = 0;
+                break;
         }
+        transform.valid = true;
     }
 
     /**
@@ -151,43 +208,9 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
                 axis = axisManager.getDefaultAxis();
                 axisId = YAxis.DEFAULT_AXIS_ID;
             }
-            transform = axisTransforms.computeIfAbsent(axisId, id -> new AxisTransform());
-
-            int chartHeight = viewport.getChartHeight();
-            int topInset = viewport.getTopInset();
-
-            // Calculate effective height and top offset based on heightRatio and anchor
-            int effectiveHeight;
-            int effectiveTop;
-            switch (axis.getAnchor()) {
-                case TOP:
-                    effectiveHeight = (int) (chartHeight * axis.getHeightRatio());
-                    effectiveTop = topInset;
-                    break;
-                case BOTTOM:
-                    effectiveHeight = (int) (chartHeight * axis.getHeightRatio());
-                    effectiveTop = topInset + chartHeight - effectiveHeight;
-                    break;
-                default: // FULL
-                    effectiveHeight = chartHeight;
-                    effectiveTop = topInset;
-                    break;
-            }
-
-            transform.effectiveHeight = effectiveHeight;
-            transform.effectiveTop = effectiveTop;
-            transform.axis = axis;
-            transform.isLinear = (axis.getScale() instanceof LinearScale);
-
-            double valueSpan = axis.getValueSpan();
-
-            if (valueSpan > 0) {
-                transform.yScale = effectiveHeight / valueSpan;
-            } else {
-                transform.yScale = 0;
-            }
-            transform.yOffset = effectiveTop + effectiveHeight + axis.getMinValue() * transform.yScale;
-            transform.valid = true;
+            transform = new AxisTransform();
+            computeTransform(axis, transform);
+            axisTransforms.put(axisId, transform);
         }
         return transform;
     }
@@ -240,6 +263,11 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
         yValueToScreenY(yValues, screenY, offset, count, YAxis.DEFAULT_AXIS_ID);
     }
 
+    @Override
+    public void yValueToScreenY(float[] yValues, float[] screenY, int offset, int count, double valueScale) {
+        yValueToScreenY(yValues, screenY, offset, count, valueScale, YAxis.DEFAULT_AXIS_ID);
+    }
+
     @Override
     public double getPixelHeight(double ySpan) {
         return getPixelHeight(ySpan, YAxis.DEFAULT_AXIS_ID);
@@ -257,14 +285,25 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
     public double yValueToScreenY(double yValue, String axisId) {
         AxisTransform transform = ensureAxisCacheValid(axisId);
 
-        if (transform.isLinear) {
-            // Fast path for linear scale - use precomputed scale and offset
-            return transform.yOffset - yValue * transform.yScale;
-        } else {
-            // Non-linear scale - use axis normalize
-            double normalized = transform.axis.normalize(yValue);
-            // Y is inverted: normalized 0 (min) at bottom, 1 (max) at top
-            return transform.effectiveTop + transform.effectiveHeight * (1.0 - normalized);
+        switch (transform.kind) {
+            case LINEAR:
+                return transform.yOffset - yValue * transform.yScale;
+            case LOG:
+                if (yValue > 0) {
+                    return transform.yOffset - Math.log(yValue) * transform.yScale;
+                }
+                // Gaps stay NaN; non-positive values sit mid-axis like normalize()
+                return Double.isNaN(yValue) ? yValue : transform.midY;
+            case LINEARIZED: {
+                double t = transform.axis.getScale().toLinearSpace(yValue);
+                return Double.isNaN(t) && !Double.isNaN(yValue)
+                        ? transform.midY : transform.yOffset - t * transform.yScale;
+            }
+            default: {
+                double normalized = transform.axis.normalize(yValue);
+                // Y is inverted: normalized 0 (min) at bottom, 1 (max) at top
+                return transform.effectiveTop + transform.effectiveHeight * (1.0 - normalized);
+            }
         }
     }
 
@@ -278,12 +317,19 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
     public double screenYToYValue(double screenY, String axisId) {
         AxisTransform transform = ensureAxisCacheValid(axisId);
 
-        if (transform.isLinear) {
-            // Fast path for linear scale
+        if (transform.kind != ScaleKind.GENERIC) {
             if (transform.yScale == 0) {
                 return transform.axis != null ? transform.axis.getMinValue() : 0;
             }
-            return (transform.yOffset - screenY) / transform.yScale;
+            double t = (transform.yOffset - screenY) / transform.yScale;
+            switch (transform.kind) {
+                case LINEAR:
+                    return t;
+                case LOG:
+                    return Math.exp(t);
+                default:
+                    return transform.axis.getScale().fromLinearSpace(t);
+            }
         } else {
             // Non-linear scale - use axis interpolate
             if (transform.effectiveHeight == 0) {
@@ -306,11 +352,28 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
      */
     public void yValueToScreenY(float[] yValues, float[] screenY, int offset, int count, String axisId) {
         AxisTransform transform = ensureAxisCacheValid(axisId);
+        double yOffset = transform.yOffset;
+        double yScale = transform.yScale;
 
-        if (transform.isLinear) {
-            // Fast path for linear scale
+        if (transform.kind == ScaleKind.LINEAR) {
+            for (int i = 0; i < count; i++) {
+                screenY[i] = (float) (yOffset - yValues[offset + i] * yScale);
+            }
+        } else if (transform.kind == ScaleKind.LOG) {
+            // One log per value; the range logs are folded into yOffset
+            float midY = (float) transform.midY;
             for (int i = 0; i < count; i++) {
-                screenY[i] = (float) (transform.yOffset - yValues[offset + i] * transform.yScale);
+                float value = yValues[offset + i];
+                if (value > 0) {
+                    screenY[i] = (float) (yOffset - Math.log(value) * yScale);
+                } else {
+                    // Gaps stay NaN; non-positive values sit mid-axis like normalize()
+                    screenY[i] = Float.isNaN(value) ? value : midY;
+                }
+            }
+        } else if (transform.kind == ScaleKind.LINEARIZED) {
+            for (int i = 0; i < count; i++) {
+                screenY[i] = (float) yValueToScreenY(yValues[offset + i], axisId);
             }
         } else {
             // Non-linear scale - use axis normalize
@@ -327,6 +390,109 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
         }
     }
 
+    /**
+     * Batch conversion of scaled Y-values to screen Y coordinates using the
+     * specified axis. Each value is multiplied by {@code valueScale} first.
+     *
+     * <p>On linear and log scales the factor is folded into the per-frame
+     * constants, so the loop costs the same as the unscaled one.
+     *
+     * @param yValues array of Y-values
+     * @param screenY output array for Y coordinates
+     * @param offset starting index in yValues array
+     * @param count number of elements to convert
+     * @param valueScale factor applied to every value
+     * @param axisId the axis ID
+     */
+    public void yValueToScreenY(float[] yValues, float[] screenY, int offset, int count,
+                                double valueScale, String axisId) {
+        AxisTransform transform = ensureAxisCacheValid(axisId);
+        double yOffset = transform.yOffset;
+        double yScale = transform.yScale;
+
+        if (transform.kind == ScaleKind.LINEAR) {
+            double scale = yScale * valueScale;
+            for (int i = 0; i < count; i++) {
+                screenY[i] = (float) (yOffset - yValues[offset + i] * scale);
+            }
+        } else if (transform.kind == ScaleKind.LOG && valueScale > 0) {
+            // log(v * s) = log(v) + log(s); the constant term joins yOffset
+            double shiftedOffset = yOffset - Math.log(valueScale) * yScale;
+            float midY = (float) transform.midY;
+            for (int i = 0; i < count; i++) {
+                float value = yValues[offset + i];
+                if (value > 0) {
+                    screenY[i] = (float) (shiftedOffset - Math.log(value) * yScale);
+                } else {
+                    screenY[i] = Float.isNaN(value) ? value : midY;
+                }
+            }
+        } else {
+            for (int i = 0; i < count; i++) {
+                screenY[i] = (float) yValueToScreenY(yValues[offset + i] * valueScale, axisId);
+            }
+        }
+    }
+
+    /**
+     * Returns the scale of the specified axis.
+     *
+     * @param axisId the axis ID
+     * @return the axis scale
+     */
+    public AxisScale getYAxisScale(String axisId) {
+        AxisTransform transform = ensureAxisCacheValid(axisId);
+        return transform.axis != null ? transform.axis.getScale() : LinearScale.INSTANCE;
+    }
+
+    @Override
+    public AxisScale getYAxisScale() {
+        return getYAxisScale(YAxis.DEFAULT_AXIS_ID);
+    }
+
+    @Override
+    public void linearSpaceToScreenY(float[] linearValues, float[] screenY, int offset, int count) {
+        linearSpaceToScreenY(linearValues, screenY, offset, count, YAxis.DEFAULT_AXIS_ID);
+    }
+
+    /**
+     * Batch conversion of values already in the axis scale's linear space to
+     * screen Y coordinates, applying only the precomputed affine constants.
+     *
+     * <p>Falls back to {@link #yValueToScreenY(float[], float[], int, int, String)}
+     * for scales that are not linearizable.
+     *
+     * @param linearValues array of values in linear space
+     * @param screenY output array for Y coordinates
+     * @param offset starting index in linearValues array
+     * @param count number of elements to convert
+     * @param axisId the axis ID
+     */
+    public void linearSpaceToScreenY(float[] linearValues, float[] screenY, int offset, int count,
+                                     String axisId) {
+        AxisTransform transform = ensureAxisCacheValid(axisId);
+        if (transform.kind == ScaleKind.GENERIC) {
+            yValueToScreenY(linearValues, screenY, offset, count, axisId);
+            return;
+        }
+
+        double yOffset = transform.yOffset;
+        double yScale = transform.yScale;
+        if (transform.kind == ScaleKind.LINEAR) {
+            for (int i = 0; i < count; i++) {
+                screenY[i] = (float) (yOffset - linearValues[offset + i] * yScale);
+            }
+            return;
+        }
+
+        // Out-of-domain values sit mid-axis, as in yValueToScreenY
+        float midY = (float) transform.midY;
+        for (int i = 0; i < count; i++) {
+            float value = linearValues[offset + i];
+            screenY[i] = Float.isInfinite(value) ? midY : (float) (yOffset - value * yScale);
+        }
+    }
+
     /**
      * Returns the height of a Y-value span in pixels using the specified axis.
      *
@@ -340,7 +506,7 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
     public double getPixelHeight(double ySpan, String axisId) {
         AxisTransform transform = ensureAxisCacheValid(axisId);
 
-        if (transform.isLinear) {
+        if (transform.kind == ScaleKind.LINEAR) {
             return ySpan * transform.yScale;
         } else {
             // For non-linear scales, approximate using fraction of total range
@@ -380,16 +546,31 @@ public class MultiAxisCoordinateSystem implements CoordinateSystem {
         return axisManager;
     }
 
+    /**
+     * How an axis maps values to screen positions.
+     */
+    private enum ScaleKind {
+        /** Affine in the value (linear and percentage scales) */
+        LINEAR,
+        /** Affine in the natural log of the value */
+        LOG,
+        /** Affine in the scale's {@code toLinearSpace} */
+        LINEARIZED,
+        /** Arbitrary scale, evaluated through {@code normalize} */
+        GENERIC
+    }
+
     /**
      * Cached transformation parameters for a single axis.
      */
     private static class AxisTransform {
         double yScale;
         double yOffset;
+        double midY;
         int effectiveHeight;
         int effectiveTop;
         YAxis axis;
-        boolean isLinear;
-        boolean valid = false;
+        ScaleKind kind = ScaleKind.LINEAR;
+        volatile boolean valid = false;
     }
 }
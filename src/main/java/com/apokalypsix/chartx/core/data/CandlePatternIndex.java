@@ -0,0 +1,255 @@
+package com.apokalypsix.chartx.core.data;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+
+import java.util.Arrays;
+
+/**
+ * Bitset index of classic candlestick patterns over OHLC data.
+ *
+ * <p>Each {@link Pattern} has one bit per bar, set if the pattern completes
+ * on that bar. All patterns are evaluated together in one pass over the
+ * column arrays, 64 bars per bitset word. The predicates are plain
+ * arithmetic and non-short-circuit comparisons, so the loop has no
+ * data-dependent branches and a bar costs the same whether it matches or
+ * not. Hits are then enumerated with {@link #nextHit} and counted with
+ * {@link #countHits} using word-level bit operations instead of per-bar
+ * objects.
+ *
+ * <p>Like {@link OhlcPyramid}, bits are computed lazily up to the highest
+ * index requested and kept current through a data listener. A pattern at bar
+ * {@code i} depends on at most bars {@code i - 2 .. i}, so an update to the
+ * forming bar only re-evaluates the words from that bar onwards.
+ *
+ * <p>Obtain instances through {@link OhlcData#getPatterns()}.
+ */
+public class CandlePatternIndex extends LazyDataColumns {
+
+    /**
+     * Recognized patterns.
+     */
+    public enum Pattern {
+        /** Body at most 10% of the range */
+        DOJI(Bias.NEUTRAL),
+        /** Small body at the top, lower shadow at least twice the body */
+        HAMMER(Bias.BULLISH),
+        /** Small body at the bottom, upper shadow at least twice the body */
+        SHOOTING_STAR(Bias.BEARISH),
+        /** Bullish body engulfing the previous bearish body */
+        BULLISH_ENGULFING(Bias.BULLISH),
+        /** Bearish body engulfing the previous bullish body */
+        BEARISH_ENGULFING(Bias.BEARISH),
+        /** Three bullish bars with rising closes, each opening inside the previous body */
+        THREE_WHITE_SOLDIERS(Bias.BULLISH),
+        /** Three bearish bars with falling closes, each opening inside the previous body */
+        THREE_BLACK_CROWS(Bias.BEARISH);
+
+        private final Bias bias;
+
+        Pattern(Bias bias) {
+            this.bias = bias;
+        }
+
+        public Bias getBias() {
+            return bias;
+        }
+    }
+
+    /**
+     * Expected direction after a pattern.
+     */
+    public enum Bias {
+        BULLISH,
+        BEARISH,
+        NEUTRAL
+    }
+
+    private static final Pattern[] PATTERNS = Pattern.values();
+
+    /** Largest body/range ratio of a doji */
+    private static final float DOJI_BODY_RATIO = 0.1f;
+
+    private final OhlcData data;
+
+    // words[pattern.ordinal()][i >> 6] bit (i & 63)
+    private long[][] words = new long[PATTERNS.length][0];
+
+    /**
+     * Creates a pattern index for the given data.
+     *
+     * @param data the source OHLC data
+     */
+    public CandlePatternIndex(OhlcData data) {
+        super(data);
+        this.data = data;
+    }
+
+    @Override
+    protected void rebuild(int from, int to) {
+        ensureCapacity(to);
+        scan(from, to);
+    }
+
+    /**
+     * Returns true if the pattern completes on the given bar.
+     *
+     * <p>The index must lie within the last {@link #ensure} call.
+     */
+    public boolean isHit(Pattern pattern, int index) {
+        return (words[pattern.ordinal()][index >> 6] & (1L << index)) != 0;
+    }
+
+    /**
+     * Returns the first bar in [fromIndex, toIndex) on which the pattern
+     * completes.
+     *
+     * <p>The range must lie within the last {@link #ensure} call.
+     *
+     * @return the bar index, or -1 if there is none
+     */
+    public int nextHit(Pattern pattern, int fromIndex, int toIndex) {
+        if (fromIndex >= toIndex) {
+            return -1;
+        }
+        long[] bits = words[pattern.ordinal()];
+        int w = fromIndex >> 6;
+        long word = bits[w] & (-1L << fromIndex);
+        int lastWord = (toIndex - 1) >> 6;
+        while (true) {
+            if (word != 0) {
+                int index = (w << 6) + Long.numberOfTrailingZeros(word);
+                return index < toIndex ? index : -1;
+            }
+            if (++w > lastWord) {
+                return -1;
+            }
+            word = bits[w];
+        }
+    }
+
+    /**
+     * Counts the bars in [fromIndex, toIndex) on which the pattern completes.
+     *
+     * <p>The range must lie within the last {@link #ensure} call.
+     */
+    public int countHits(Pattern pattern, int fromIndex, int toIndex) {
+        if (fromIndex >= toIndex) {
+            return 0;
+        }
+        long[] bits = words[pattern.ordinal()];
+        int firstWord = fromIndex >> 6;
+        int lastWord = (toIndex - 1) >> 6;
+        long firstMask = -1L << fromIndex;
+        long lastMask = -1L >>> (63 - ((toIndex - 1) & 63));
+        if (firstWord == lastWord) {
+            return Long.bitCount(bits[firstWord] & firstMask & lastMask);
+        }
+        int count = Long.bitCount(bits[firstWord] & firstMask);
+        for (int w = firstWord + 1; w < lastWord; w++) {
+            count += Long.bitCount(bits[w]);
+        }
+        return count + Long.bitCount(bits[lastWord] & lastMask);
+    }
+
+    /**
+     * Evaluates all patterns for bars [from, to), one bitset word at a time.
+     */
+    private void scan(int from, int to) {
+        float[] open = data.getOpenArray();
+        float[] high = data.getHighArray();
+        float[] low = data.getLowArray();
+        float[] close = data.getCloseArray();
+
+        long[] doji = words[Pattern.DOJI.ordinal()];
+        long[] hammer = words[Pattern.HAMMER.ordinal()];
+        long[] star = words[Pattern.SHOOTING_STAR.ordinal()];
+        long[] bullEngulf = words[Pattern.BULLISH_ENGULFING.ordinal()];
+        long[] bearEngulf = words[Pattern.BEARISH_ENGULFING.ordinal()];
+        long[] soldiers = words[Pattern.THREE_WHITE_SOLDIERS.ordinal()];
+        long[] crows = words[Pattern.THREE_BLACK_CROWS.ordinal()];
+
+        for (int w = from >> 6; w <= (to - 1) >> 6; w++) {
+            int base = w << 6;
+            int start = Math.max(from, base);
+            int end = Math.min(to, base + 64);
+
+            // Keep bits of bars before 'from', drop everything from there on
+            long keep = (1L << (start - base)) - 1;
+            long dojiBits = doji[w] & keep;
+            long hammerBits = hammer[w] & keep;
+            long starBits = star[w] & keep;
+            long bullEngulfBits = bullEngulf[w] & keep;
+            long bearEngulfBits = bearEngulf[w] & keep;
+            long soldierBits = soldiers[w] & keep;
+            long crowBits = crows[w] & keep;
+
+            for (int i = start; i < end; i++) {
+                // Previous bars clamp to bar 0; the has1/has2 flags mask the result
+                int p1 = Math.max(i - 1, 0);
+                int p2 = Math.max(i - 2, 0);
+                boolean has1 = i >= 1;
+                boolean has2 = i >= 2;
+
+                float o = open[i], h = high[i], l = low[i], c = close[i];
+                float o1 = open[p1], c1 = close[p1];
+                float o2 = open[p2], c2 = close[p2];
+
+                float top = Math.max(o, c);
+                float bottom = Math.min(o, c);
+                float body = top - bottom;
+                float range = h - l;
+                float upper = h - top;
+                float lower = bottom - l;
+                float body1 = Math.abs(c1 - o1);
+
+                boolean up = c > o;
+                boolean down = c < o;
+                boolean up1 = c1 > o1;
+                boolean down1 = c1 < o1;
+                boolean up2 = c2 > o2;
+                boolean down2 = c2 < o2;
+                boolean small = body <= DOJI_BODY_RATIO * range;
+
+                // Non-short-circuit '&' keeps the loop free of branches
+                boolean isDoji = (range > 0) & small;
+                boolean isHammer = !small & (lower >= 2 * body) & (upper <= 0.5f * body);
+                boolean isStar = !small & (upper >= 2 * body) & (lower <= 0.5f * body);
+                boolean isBullEngulf = has1 & down1 & up & (o <= c1) & (c >= o1) & (body > body1);
+                boolean isBearEngulf = has1 & up1 & down & (o >= c1) & (c <= o1) & (body > body1);
+                boolean isSoldiers = has2 & up2 & up1 & up
+                        & (c1 > c2) & (c > c1)
+                        & (o1 > o2) & (o1 <= c2) & (o > o1) & (o <= c1);
+                boolean isCrows = has2 & down2 & down1 & down
+                        & (c1 < c2) & (c < c1)
+                        & (o1 < o2) & (o1 >= c2) & (o < o1) & (o >= c1);
+
+                int bit = i - base;
+                dojiBits |= (isDoji ? 1L : 0L) << bit;
+                hammerBits |= (isHammer ? 1L : 0L) << bit;
+                starBits |= (isStar ? 1L : 0L) << bit;
+                bullEngulfBits |= (isBullEngulf ? 1L : 0L) << bit;
+                bearEngulfBits |= (isBearEngulf ? 1L : 0L) << bit;
+                soldierBits |= (isSoldiers ? 1L : 0L) << bit;
+                crowBits |= (isCrows ? 1L : 0L) << bit;
+            }
+
+            doji[w] = dojiBits;
+            hammer[w] = hammerBits;
+            star[w] = starBits;
+            bullEngulf[w] = bullEngulfBits;
+            bearEngulf[w] = bearEngulfBits;
+            soldiers[w] = soldierBits;
+            crows[w] = crowBits;
+        }
+    }
+
+    private void ensureCapacity(int size) {
+        int needed = (size + 63) >> 6;
+        if (needed > words[0].length) {
+            int capacity = Math.max(needed, words[0].length + (words[0].length >> 1));
+            for (int p = 0; p < words.length; p++) {
+                words[p] = Arrays.copyOf(words[p], capacity);
+            }
+        }
+    }
+}
@@ -0,0 +1,355 @@
+package com.apokalypsix.chartx.core.data;
+
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.chart.data.XyData;
+
+import java.util.Arrays;
+
+/**
+ * Unified timestamp index over several XyData series.
+ *
+ * <p>The timestamps of all sources are merged into one sorted timeline without
+ * duplicates. For every source and timeline row the index keeps the last
+ * source point at or before that row, so a row maps to a source point in
+ * O(1): the point lies exactly on the row or the source has a gap there.
+ * Source values are never copied; they are read from the source arrays.
+ *
+ * <p>Like {@link OhlcPyramid}, the index is built lazily and kept current
+ * through data listeners. Appends only merge the new points, and updates
+ * re-merge from the first affected row.
+ *
+ * <p>Obtain instances through
+ * {@link com.apokalypsix.chartx.chart.data.ComparisonGroup#getIndex()}.
+ */
+public class ComparisonIndex extends LazyDataColumns {
+
+    private final XyData[] sources;
+
+    // Merged timeline
+    private long[] timeline = new long[0];
+    private int rowCount;
+
+    // floors[s][row]: last index of source s at or before timeline[row], or -1
+    private int[][] floors;
+
+    // Number of leading points of each source merged into the timeline
+    private final int[] merged;
+
+    // Incremented on every source change, for per-frame caches
+    private volatile int modCount;
+
+    /**
+     * Creates an index over the given series.
+     *
+     * @param sources the series to align
+     */
+    public ComparisonIndex(XyData... sources) {
+        super(sources);
+        this.sources = sources.clone();
+        this.floors = new int[sources.length][0];
+        this.merged = new int[sources.length];
+    }
+
+    /**
+     * Brings the timeline up to date with all source points.
+     */
+    public void ensure() {
+        ensure(Integer.MAX_VALUE);
+    }
+
+    /**
+     * Brings the timeline up to date with all source points. The timeline
+     * always covers every point, so {@code toIndex} is ignored.
+     */
+    @Override
+    public void ensure(int toIndex) {
+        synchronized (lock) {
+            ensureLocked();
+        }
+    }
+
+    private void ensureLocked() {
+        int rewindTo = rowCount;
+        for (int s = 0; s < sources.length; s++) {
+            XyData source = sources[s];
+            int dirtyFrom = takeDirtyFrom(s);
+
+            if (source.size() < merged[s]) {
+                // Shrunk without an update event
+                dirtyFrom = 0;
+            }
+            if (dirtyFrom < merged[s]) {
+                rewindTo = Math.min(rewindTo, firstRowReaching(s, dirtyFrom));
+            }
+            // Points older than the newest row must be merged in place
+            if (source.size() > merged[s] && rowCount > 0) {
+                long next = source.getXValuesArray()[merged[s]];
+                if (next <= timeline[rowCount - 1]) {
+                    rewindTo = Math.min(rewindTo, rowAtOrAfter(next));
+                }
+            }
+        }
+        rebuild(rewindTo, Integer.MAX_VALUE);
+    }
+
+    /**
+     * Drops timeline rows from {@code from} on and merges all pending source
+     * points. Rows are not a prefix of any one source, so {@code to} is
+     * ignored.
+     */
+    @Override
+    protected void rebuild(int from, int to) {
+        if (from < rowCount) {
+            rewind(from);
+        }
+        merge();
+    }
+
+    /**
+     * Returns the number of timeline rows.
+     */
+    public int getRowCount() {
+        synchronized (lock) {
+            ensureLocked();
+            return rowCount;
+        }
+    }
+
+    /**
+     * Returns the timestamp of a timeline row.
+     */
+    public long getTimestamp(int row) {
+        synchronized (lock) {
+            ensureLocked();
+            return timeline[row];
+        }
+    }
+
+    /**
+     * Returns the first row at or after the given time, or the row count if
+     * all rows are earlier.
+     */
+    public int findRow(long time) {
+        synchronized (lock) {
+            ensureLocked();
+            return rowAtOrAfter(time);
+        }
+    }
+
+    /**
+     * Returns the index of the source point on the given row, or -1 if the
+     * source has a gap there.
+     *
+     * @param source the source position in this index
+     * @param row the timeline row
+     */
+    public int getSourceIndex(int source, int row) {
+        synchronized (lock) {
+            ensureLocked();
+            int index = floors[source][row];
+            if (index < 0 || sources[source].getXValuesArray()[index] != timeline[row]) {
+                return -1;
+            }
+            return index;
+        }
+    }
+
+    /**
+     * Returns the index of the last source point at or before the given row,
+     * or -1 if the source starts later.
+     *
+     * @param source the source position in this index
+     * @param row the timeline row
+     */
+    public int getFloorIndex(int source, int row) {
+        synchronized (lock) {
+            ensureLocked();
+            return floors[source][row];
+        }
+    }
+
+    /**
+     * Returns the value of a source as of the given row: its last valid value
+     * at or before the row, or its first valid value after the row if it has
+     * none. Gaps and NaN values are skipped.
+     *
+     * @param source the source position in this index
+     * @param row the timeline row, clamped to the timeline
+     * @return the value, or NaN if the source has no valid value
+     */
+    public float getValueAsOf(int source, int row) {
+        synchronized (lock) {
+            ensureLocked();
+            XyData data = sources[source];
+            float[] values = data.getValuesArray();
+            int size = data.size();
+            if (rowCount == 0 || size == 0) {
+                return Float.NaN;
+            }
+            row = Math.max(0, Math.min(row, rowCount - 1));
+
+            for (int i = floors[source][row]; i >= 0; i--) {
+                if (!Float.isNaN(values[i])) {
+                    return values[i];
+                }
+            }
+            for (int i = floors[source][row] + 1; i < size; i++) {
+                if (!Float.isNaN(values[i])) {
+                    return values[i];
+                }
+            }
+            return Float.NaN;
+        }
+    }
+
+    /**
+     * Returns the number of sources.
+     */
+    public int getSourceCount() {
+        return sources.length;
+    }
+
+    /**
+     * Returns the source at the given position.
+     */
+    public XyData getSource(int source) {
+        return sources[source];
+    }
+
+    /**
+     * Returns the position of a source in this index, or -1.
+     */
+    public int indexOf(Data<?> data) {
+        for (int s = 0; s < sources.length; s++) {
+            if (sources[s] == data) {
+                return s;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Returns a counter that changes whenever a source changes.
+     */
+    public int getModCount() {
+        return modCount;
+    }
+
+    /**
+     * Returns the raw timeline array. For rendering use only.
+     * Valid up to {@link #getRowCount()}; do not modify.
+     */
+    public long[] getTimelineArray() {
+        synchronized (lock) {
+            ensureLocked();
+            return timeline;
+        }
+    }
+
+    // ========== Merge ==========
+
+    @Override
+    protected void onSourceChanged(int source) {
+        modCount++;
+    }
+
+    private int rowAtOrAfter(long time) {
+        int lo = 0;
+        int hi = rowCount;
+        while (lo < hi) {
+            int mid = (lo + hi) >>> 1;
+            if (timeline[mid] < time) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    /**
+     * Returns the first row whose floor in source {@code s} reaches the given
+     * source index, i.e. the row of that point before it changed.
+     */
+    private int firstRowReaching(int s, int index) {
+        int[] floor = floors[s];
+        int lo = 0;
+        int hi = rowCount;
+        while (lo < hi) {
+            int mid = (lo + hi) >>> 1;
+            if (floor[mid] < index) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    /**
+     * Drops rows from {@code row} on and rewinds each source to the first
+     * point after the remaining rows.
+     */
+    private void rewind(int row) {
+        rowCount = row;
+        for (int s = 0; s < sources.length; s++) {
+            merged[s] = row == 0 ? 0 : floors[s][row - 1] + 1;
+        }
+    }
+
+    /**
+     * Merges the unmerged source points into the timeline. Each row takes
+     * the smallest pending timestamp and advances every source past all of
+     * its points at that timestamp.
+     */
+    private void merge() {
+        int k = sources.length;
+        long[][] xs = new long[k][];
+        int[] sizes = new int[k];
+        int pending = 0;
+        for (int s = 0; s < k; s++) {
+            xs[s] = sources[s].getXValuesArray();
+            sizes[s] = sources[s].size();
+            pending += sizes[s] - merged[s];
+        }
+        if (pending <= 0) {
+            return;
+        }
+        ensureCapacity(rowCount + pending);
+
+        while (true) {
+            long next = Long.MAX_VALUE;
+            boolean any = false;
+            for (int s = 0; s < k; s++) {
+                if (merged[s] < sizes[s]) {
+                    next = Math.min(next, xs[s][merged[s]]);
+                    any = true;
+                }
+            }
+            if (!any) {
+                break;
+            }
+
+            int row = rowCount++;
+            timeline[row] = next;
+            for (int s = 0; s < k; s++) {
+                // Repeated timestamps collapse onto one row; the floor is the last of them
+                while (merged[s] < sizes[s] && xs[s][merged[s]] == next) {
+                    merged[s]++;
+                }
+                floors[s][row] = merged[s] - 1;
+            }
+        }
+    }
+
+    private void ensureCapacity(int rows) {
+        if (rows <= timeline.length) {
+            return;
+        }
+        int capacity = Math.max(rows, timeline.length + (timeline.length >> 1));
+        timeline = Arrays.copyOf(timeline, capacity);
+        for (int s = 0; s < floors.length; s++) {
+            floors[s] = Arrays.copyOf(floors[s], capacity);
+        }
+    }
+}
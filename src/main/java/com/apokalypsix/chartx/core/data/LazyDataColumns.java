@@ -0,0 +1,228 @@
+package com.apokalypsix.chartx.core.data;
+
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.chart.data.DataListener;
+
+import java.util.Arrays;
+import java.util.concurrent.atomic.AtomicIntegerArray;
+
+/**
+ * Base class of companion columns that are derived from data, built lazily up
+ * to the highest index requested and kept current through data listeners.
+ *
+ * <p>Listener events only lower a per-source dirty index, atomically, so they
+ * are cheap on the thread that feeds the data. {@link #ensure} then recomputes
+ * from the lowest dirty index through {@link #rebuild}. Bulk loads, which do
+ * not notify listeners, are detected through {@link Data#getLoadCount()} and
+ * rebuild everything.
+ *
+ * <p>Columns are guarded by {@link #lock}, a private object rather than the
+ * instance itself, so callers synchronizing on a column object cannot stall
+ * the renderer.
+ */
+public abstract class LazyDataColumns {
+
+    /** Guards the columns; held while rebuilding and while reading them */
+    protected final Object lock = new Object();
+
+    // Tracked sources; replaced as a whole so listener threads see a consistent array
+    private volatile Data<?>[] sources = new Data<?>[0];
+
+    // Lowest index changed since the last ensure, per source
+    private volatile AtomicIntegerArray dirtyFromIndex = new AtomicIntegerArray(0);
+
+    // Load count of each source when its changes were last taken
+    private int[] loadCounts = new int[0];
+
+    /** Number of leading indices that are up to date */
+    protected int computedCount;
+
+    private final DataListener dataListener = new DataListener() {
+        @Override
+        public void onDataAppended(Data<?> data, int newIndex) {
+            // Only rewinds if a shorter source grew below the computed count
+            markDirty(data, newIndex);
+        }
+
+        @Override
+        public void onDataUpdated(Data<?> data, int index) {
+            markDirty(data, Math.max(0, index));
+        }
+
+        @Override
+        public void onDataCleared(Data<?> data) {
+            markDirty(data, 0);
+        }
+    };
+
+    /**
+     * Creates columns over the given sources.
+     *
+     * @param sources the data whose changes invalidate the columns
+     */
+    protected LazyDataColumns(Data<?>... sources) {
+        setSources(sources);
+    }
+
+    /**
+     * Brings the columns up to date for indices [0, toIndex).
+     *
+     * @param toIndex exclusive end index, clamped to {@link #indexCount()}
+     */
+    public void ensure(int toIndex) {
+        synchronized (lock) {
+            int dirtyFrom = takeDirtyFrom();
+            if (dirtyFrom < computedCount) {
+                computedCount = dirtyFrom;
+            }
+
+            int count = indexCount();
+            computedCount = Math.min(computedCount, count);
+            toIndex = Math.min(toIndex, count);
+            if (toIndex <= computedCount) {
+                return;
+            }
+
+            rebuild(computedCount, toIndex);
+            computedCount = toIndex;
+        }
+    }
+
+    /**
+     * Recomputes the columns for indices [from, to). Called with
+     * {@link #lock} held; everything before {@code from} is up to date.
+     */
+    protected abstract void rebuild(int from, int to);
+
+    /**
+     * Returns the number of indices the columns can cover. Defaults to the
+     * size of the first source.
+     */
+    protected int indexCount() {
+        Data<?>[] current = sources;
+        return current.length > 0 ? current[0].size() : 0;
+    }
+
+    /**
+     * Forces the columns to be rebuilt from scratch on the next
+     * {@link #ensure}.
+     */
+    public void invalidate() {
+        Data<?>[] current = sources;
+        for (int s = 0; s < current.length; s++) {
+            markDirty(s, 0);
+        }
+    }
+
+    /**
+     * Stops tracking the sources.
+     */
+    public void dispose() {
+        synchronized (lock) {
+            for (Data<?> source : sources) {
+                source.removeListener(dataListener);
+            }
+            sources = new Data<?>[0];
+            dirtyFromIndex = new AtomicIntegerArray(0);
+            loadCounts = new int[0];
+            computedCount = 0;
+        }
+    }
+
+    // ========== Sources ==========
+
+    /**
+     * Replaces the tracked sources. Everything is rebuilt on the next
+     * {@link #ensure}.
+     */
+    protected final void setSources(Data<?>... newSources) {
+        synchronized (lock) {
+            for (Data<?> source : sources) {
+                source.removeListener(dataListener);
+            }
+            AtomicIntegerArray dirty = new AtomicIntegerArray(newSources.length);
+            int[] loads = new int[newSources.length];
+            for (int s = 0; s < newSources.length; s++) {
+                dirty.set(s, Integer.MAX_VALUE);
+                loads[s] = newSources[s].getLoadCount();
+            }
+            dirtyFromIndex = dirty;
+            loadCounts = loads;
+            sources = newSources.clone();
+            computedCount = 0;
+            for (Data<?> source : newSources) {
+                source.addListener(dataListener);
+            }
+        }
+    }
+
+    /**
+     * Adds a source whose changes also invalidate the columns, e.g. a
+     * separate data object that is index-aligned with the first source.
+     * Everything is rebuilt on the next {@link #ensure}.
+     */
+    protected final void addSource(Data<?> source) {
+        synchronized (lock) {
+            Data<?>[] newSources = Arrays.copyOf(sources, sources.length + 1);
+            newSources[newSources.length - 1] = source;
+            setSources(newSources);
+        }
+    }
+
+    /**
+     * Returns and resets the lowest index of a source changed since the last
+     * call, 0 if the source was bulk loaded since, or
+     * {@link Integer#MAX_VALUE} if it is unchanged. Call with {@link #lock}
+     * held.
+     */
+    protected final int takeDirtyFrom(int source) {
+        int dirtyFrom = dirtyFromIndex.getAndSet(source, Integer.MAX_VALUE);
+        int loads = sources[source].getLoadCount();
+        if (loads != loadCounts[source]) {
+            // Bulk loads don't notify listeners
+            loadCounts[source] = loads;
+            dirtyFrom = 0;
+        }
+        return dirtyFrom;
+    }
+
+    /**
+     * Returns and resets the lowest changed index over all sources.
+     *
+     * @see #takeDirtyFrom(int)
+     */
+    protected final int takeDirtyFrom() {
+        int dirtyFrom = Integer.MAX_VALUE;
+        for (int s = 0; s < sources.length; s++) {
+            dirtyFrom = Math.min(dirtyFrom, takeDirtyFrom(s));
+        }
+        return dirtyFrom;
+    }
+
+    /**
+     * Called after a change of a source was recorded, on the thread that
+     * changed it.
+     *
+     * @param source the position of the changed source
+     */
+    protected void onSourceChanged(int source) {
+    }
+
+    private void markDirty(Data<?> data, int index) {
+        Data<?>[] current = sources;
+        for (int s = 0; s < current.length; s++) {
+            if (current[s] == data) {
+                markDirty(s, index);
+                return;
+            }
+        }
+    }
+
+    private void markDirty(int source, int index) {
+        AtomicIntegerArray dirty = dirtyFromIndex;
+        if (source < dirty.length()) {
+            dirty.accumulateAndGet(source, index, Math::min);
+        }
+        onSourceChanged(source);
+    }
+}
@@ -0,0 +1,131 @@
+package com.apokalypsix.chartx.core.data;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+
+import java.util.Arrays;
+
+/**
+ * Power-of-two high/low pyramid over OHLC data for fast range aggregation.
+ *
+ * <p>Level {@code k} holds the highest high and lowest low of every aligned
+ * block of {@code 2^k} bars; level 0 is the data itself. The high and low of
+ * any index range are then found from O(log n) blocks via
+ * {@link #queryRange}, while open and close of the range are simply the
+ * first open and last close. Renderers use this to merge all bars that fall
+ * into one pixel column into a single synthetic candle without scanning them.
+ *
+ * <p>Like {@link ScaledColumns}, levels are built lazily up to the highest
+ * index requested and kept current through a data listener: appends only
+ * extend the trailing blocks, and updates rebuild from the updated index.
+ *
+ * <p>Obtain instances through {@link OhlcData#getPyramid()}.
+ */
+public class OhlcPyramid extends LazyDataColumns {
+
+    private final OhlcData data;
+
+    // highs[k - 1] / lows[k - 1] hold level k (blocks of 2^k bars)
+    private float[][] highs = new float[0][];
+    private float[][] lows = new float[0][];
+    private int levelCount;
+
+    /**
+     * Creates a pyramid for the given data.
+     *
+     * @param data the source OHLC data
+     */
+    public OhlcPyramid(OhlcData data) {
+        super(data);
+        this.data = data;
+    }
+
+    @Override
+    protected void rebuild(int from, int to) {
+        ensureLevels(to);
+
+        float[] srcHigh = data.getHighArray();
+        float[] srcLow = data.getLowArray();
+
+        for (int k = 1; k <= levelCount; k++) {
+            float[] childHigh = k == 1 ? srcHigh : highs[k - 2];
+            float[] childLow = k == 1 ? srcLow : lows[k - 2];
+            float[] levelHigh = highs[k - 1];
+            float[] levelLow = lows[k - 1];
+
+            // Only complete blocks are stored
+            int endBlock = to >> k;
+            for (int j = from >> k; j < endBlock; j++) {
+                int child = j << 1;
+                levelHigh[j] = Math.max(childHigh[child], childHigh[child + 1]);
+                levelLow[j] = Math.min(childLow[child], childLow[child + 1]);
+            }
+        }
+    }
+
+    /**
+     * Computes the highest high and lowest low of bars [from, to].
+     *
+     * <p>The range must lie within the last {@link #ensure} call.
+     *
+     * @param from first bar index (inclusive)
+     * @param to last bar index (inclusive)
+     * @param out receives the high at index 0 and the low at index 1
+     */
+    public void queryRange(int from, int to, float[] out) {
+        float[] srcHigh = data.getHighArray();
+        float[] srcLow = data.getLowArray();
+
+        float high = Float.NEGATIVE_INFINITY;
+        float low = Float.POSITIVE_INFINITY;
+        int i = from;
+        while (i <= to) {
+            // Largest aligned block starting at i that fits in the range
+            int k = 0;
+            while (k < levelCount
+                    && (i & ((2 << k) - 1)) == 0
+                    && i + (2 << k) - 1 <= to) {
+                k++;
+            }
+
+            if (k == 0) {
+                high = Math.max(high, srcHigh[i]);
+                low = Math.min(low, srcLow[i]);
+                i++;
+            } else {
+                int block = i >> k;
+                high = Math.max(high, highs[k - 1][block]);
+                low = Math.min(low, lows[k - 1][block]);
+                i += 1 << k;
+            }
+        }
+        out[0] = high;
+        out[1] = low;
+    }
+
+    /**
+     * Returns the number of levels above the raw data.
+     */
+    public int getLevelCount() {
+        return levelCount;
+    }
+
+    private void ensureLevels(int size) {
+        int needed = 31 - Integer.numberOfLeadingZeros(Math.max(1, size));
+        if (needed > levelCount) {
+            highs = Arrays.copyOf(highs, needed);
+            lows = Arrays.copyOf(lows, needed);
+            levelCount = needed;
+        }
+        for (int k = 1; k <= levelCount; k++) {
+            int blocks = size >> k;
+            float[] levelHigh = highs[k - 1];
+            if (levelHigh == null || blocks > levelHigh.length) {
+                int capacity = levelHigh == null
+                        ? blocks
+                        : Math.max(blocks, levelHigh.length + (levelHigh.length >> 1));
+                highs[k - 1] = levelHigh == null ? new float[capacity] : Arrays.copyOf(levelHigh, capacity);
+                lows[k - 1] = lows[k - 1] == null ? new float[capacity] : Arrays.copyOf(lows[k - 1], capacity);
+            }
+        }
+    }
+}
@@ -0,0 +1,222 @@
+package com.apokalypsix.chartx.core.data;
+
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.data.XyData;
+
+import java.util.Arrays;
+import java.util.function.Supplier;
+
+/**
+ * Prefix-sum companion columns over one value column of a data set.
+ *
+ * <p>With x the bar index and y the value, entry {@code i} holds the count,
+ * Σx, Σx², Σy, Σxy and Σy² of all valid (non-NaN) values before bar
+ * {@code i}. Any index range then reduces to one subtraction per column, so
+ * {@link #fit} returns mean, standard deviation, the least-squares line and
+ * R² in O(1), independent of the range length. Regression channels and
+ * measure statistics can therefore be recomputed on every drag frame.
+ *
+ * <p>The x columns are kept as wrapping {@code long}s: differences of two
+ * prefixes are exact as long as the range's own sum fits in a long, which
+ * holds for ranges of up to about three million bars. The y columns are
+ * {@code double}s taken relative to the first value, which keeps them small
+ * for price series that move within a band. Series that trend far from their
+ * first value would still lose the digits of a short range to cancellation
+ * between two large prefixes, so each y column carries a second column with
+ * the rounding error of every addition and product (TwoSum/TwoProduct), and
+ * range sums combine both.
+ *
+ * <p>Columns are built lazily up to the highest index requested and kept
+ * current through a data listener (see {@link LazyDataColumns}). Obtain
+ * instances through {@link OhlcData#getPrefixSums()} or
+ * {@link XyData#getPrefixSums()}.
+ */
+public class PrefixSums extends LazyDataColumns {
+
+    /**
+     * Statistics and least-squares line of the valid values in an index range.
+     *
+     * @param fromIndex first bar of the range; the intercept is the line value there
+     * @param count number of valid values
+     * @param mean mean value
+     * @param stdDev population standard deviation of the values
+     * @param slope change of the line per bar
+     * @param intercept line value at {@code fromIndex}
+     * @param standardError standard deviation of the residuals around the line
+     * @param rSquared coefficient of determination, 0 if undefined
+     */
+    public record Fit(int fromIndex, int count, double mean, double stdDev,
+                      double slope, double intercept, double standardError, double rSquared) {
+
+        /** Fit of a range without valid values */
+        public static Fit empty(int fromIndex) {
+            return new Fit(fromIndex, 0, Double.NaN, Double.NaN, 0, Double.NaN, Double.NaN, 0);
+        }
+
+        /**
+         * Returns the line value at the given bar index.
+         */
+        public double valueAt(double index) {
+            return intercept + slope * (index - fromIndex);
+        }
+    }
+
+    private final Data<?> data;
+    private final Supplier<float[]> column;
+
+    // Entry i covers bars [0, i)
+    private long[] count = new long[1];
+    private long[] sumX = new long[1];
+    private long[] sumXX = new long[1];
+    private double[] sumY = new double[1];
+    private double[] sumXY = new double[1];
+    private double[] sumYY = new double[1];
+
+    // Accumulated rounding errors of the y columns; hi + lo is the compensated sum
+    private double[] sumYLo = new double[1];
+    private double[] sumXYLo = new double[1];
+    private double[] sumYYLo = new double[1];
+
+    // Value subtracted from every y before summing
+    private double origin = Double.NaN;
+
+    /**
+     * Creates prefix sums over a value column.
+     *
+     * @param data the source data, used for its size and change notifications
+     * @param column returns the current value array of the data
+     */
+    public PrefixSums(Data<?> data, Supplier<float[]> column) {
+        super(data);
+        this.data = data;
+        this.column = column;
+    }
+
+    @Override
+    protected void rebuild(int from, int to) {
+        ensureCapacity(to + 1);
+        float[] values = column.get();
+        if (from == 0) {
+            origin = Double.NaN;
+        }
+
+        for (int i = from; i < to; i++) {
+            float value = values[i];
+            boolean valid = !Float.isNaN(value);
+            if (valid && Double.isNaN(origin)) {
+                origin = value;
+            }
+            long x = valid ? i : 0;
+            double y = valid ? value - origin : 0;
+
+            count[i + 1] = count[i] + (valid ? 1 : 0);
+            sumX[i + 1] = sumX[i] + x;
+            sumXX[i + 1] = sumXX[i] + x * x;
+
+            // TwoSum of the running sum and TwoProduct of each term
+            double xy = x * y;
+            double yy = y * y;
+            sumY[i + 1] = sumY[i] + y;
+            sumYLo[i + 1] = sumYLo[i] + sumError(sumY[i], y, sumY[i + 1]);
+            sumXY[i + 1] = sumXY[i] + xy;
+            sumXYLo[i + 1] = sumXYLo[i] + sumError(sumXY[i], xy, sumXY[i + 1])
+                    + Math.fma(x, y, -xy);
+            sumYY[i + 1] = sumYY[i] + yy;
+            sumYYLo[i + 1] = sumYYLo[i] + sumError(sumYY[i], yy, sumYY[i + 1])
+                    + Math.fma(y, y, -yy);
+        }
+    }
+
+    /**
+     * Fits the valid values of bars [from, to].
+     *
+     * <p>Calls {@link #ensure} as needed, so the cost is O(1) once the sums
+     * cover the range.
+     *
+     * @param from first bar index (inclusive)
+     * @param to last bar index (inclusive)
+     * @return the fit, or {@link Fit#empty} if the range has no valid values
+     */
+    public Fit fit(int from, int to) {
+        synchronized (lock) {
+            return fitLocked(Math.max(0, from), to);
+        }
+    }
+
+    private Fit fitLocked(int from, int to) {
+        ensure(to + 1);
+        to = Math.min(to, computedCount - 1);
+        if (from > to) {
+            return Fit.empty(from);
+        }
+
+        long n = count[to + 1] - count[from];
+        if (n == 0) {
+            return Fit.empty(from);
+        }
+
+        // x relative to 'from'; exact in wrapping long arithmetic
+        long sx = sumX[to + 1] - sumX[from];
+        long sxx = sumXX[to + 1] - sumXX[from];
+        long rx = sx - from * n;
+        long rxx = sxx - 2L * from * sx + (long) from * from * n;
+
+        double sy = rangeSum(sumY, sumYLo, from, to);
+        double syy = rangeSum(sumYY, sumYYLo, from, to);
+        double shift = (double) from * sy;
+        double rxy = rangeSum(sumXY, sumXYLo, from, to) - shift - Math.fma(from, sy, -shift);
+
+        double dxx = rxx - (double) rx * rx / n;
+        double dxy = rxy - rx * sy / n;
+        double dyy = Math.max(0, syy - sy * sy / n);
+
+        double mean = origin + sy / n;
+        double stdDev = Math.sqrt(dyy / n);
+
+        double slope = dxx > 0 ? dxy / dxx : 0;
+        double intercept = origin + (sy - slope * rx) / n;
+        double residual = Math.max(0, dyy - slope * dxy);
+        double standardError = n > 2 ? Math.sqrt(residual / (n - 2)) : 0;
+        double rSquared = dxx > 0 && dyy > 0 ? Math.min(1, dxy * dxy / (dxx * dyy)) : 0;
+
+        return new Fit(from, (int) n, mean, stdDev, slope, intercept, standardError, rSquared);
+    }
+
+    /**
+     * Returns the source data.
+     */
+    public Data<?> getData() {
+        return data;
+    }
+
+    /**
+     * Returns the compensated sum of bars [from, to] of a y column.
+     */
+    private static double rangeSum(double[] hi, double[] lo, int from, int to) {
+        return (hi[to + 1] - hi[from]) + (lo[to + 1] - lo[from]);
+    }
+
+    /**
+     * Returns the rounding error of {@code sum = a + b} (Knuth's TwoSum).
+     */
+    private static double sumError(double a, double b, double sum) {
+        double bVirtual = sum - a;
+        return (a - (sum - bVirtual)) + (b - bVirtual);
+    }
+
+    private void ensureCapacity(int size) {
+        if (size > count.length) {
+            int capacity = Math.max(size, count.length + (count.length >> 1));
+            count = Arrays.copyOf(count, capacity);
+            sumX = Arrays.copyOf(sumX, capacity);
+            sumXX = Arrays.copyOf(sumXX, capacity);
+            sumY = Arrays.copyOf(sumY, capacity);
+            sumXY = Arrays.copyOf(sumXY, capacity);
+            sumYY = Arrays.copyOf(sumYY, capacity);
+            sumYLo = Arrays.copyOf(sumYLo, capacity);
+            sumXYLo = Arrays.copyOf(sumXYLo, capacity);
+            sumYYLo = Arrays.copyOf(sumYYLo, capacity);
+        }
+    }
+}
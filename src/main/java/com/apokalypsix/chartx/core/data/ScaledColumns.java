@@ -0,0 +1,121 @@
+package com.apokalypsix.chartx.core.data;
+
+import com.apokalypsix.chartx.chart.axis.scale.AxisScale;
+import com.apokalypsix.chartx.chart.data.OhlcData;
+
+import java.util.Arrays;
+
+/**
+ * OHLC price columns mapped into an axis scale's linear space.
+ *
+ * <p>For a logarithmic axis this holds the logs of open, high, low and close,
+ * so renderers only apply the per-frame affine axis constants
+ * ({@link com.apokalypsix.chartx.core.coordinate.CoordinateSystem#linearSpaceToScreenY})
+ * instead of taking a log of every visible price in every frame.
+ *
+ * <p>Columns are materialized lazily up to the highest index requested and
+ * kept current through a data listener: appends only extend them, and
+ * updates recompute from the updated index onwards.
+ *
+ * <p>Prices outside the scale's domain (e.g. non-positive prices on a log
+ * axis) are stored as negative infinity, which
+ * {@link com.apokalypsix.chartx.core.coordinate.CoordinateSystem#linearSpaceToScreenY}
+ * places mid-axis exactly like {@code yValueToScreenY}. Gaps stay NaN.
+ *
+ * <p>Obtain instances through {@link OhlcData#getScaledColumns(AxisScale)},
+ * and drop them with {@link OhlcData#releaseScaledColumns(AxisScale)} once the
+ * scale is replaced.
+ */
+public class ScaledColumns extends LazyDataColumns {
+
+    private final OhlcData data;
+    private final AxisScale scale;
+
+    private float[] open = new float[0];
+    private float[] high = new float[0];
+    private float[] low = new float[0];
+    private float[] close = new float[0];
+
+    /**
+     * Creates scaled columns for the given data and scale.
+     *
+     * @param data the source OHLC data
+     * @param scale a scale whose {@link AxisScale#isLinearizable()} is true
+     */
+    public ScaledColumns(OhlcData data, AxisScale scale) {
+        super(data);
+        this.data = data;
+        this.scale = scale;
+    }
+
+    /**
+     * Returns the scale these columns are mapped into.
+     */
+    public AxisScale getScale() {
+        return scale;
+    }
+
+    @Override
+    protected void rebuild(int from, int to) {
+        ensureCapacity(data.size());
+
+        float[] srcOpen = data.getOpenArray();
+        float[] srcHigh = data.getHighArray();
+        float[] srcLow = data.getLowArray();
+        float[] srcClose = data.getCloseArray();
+
+        for (int i = from; i < to; i++) {
+            open[i] = toLinearSpace(srcOpen[i]);
+            high[i] = toLinearSpace(srcHigh[i]);
+            low[i] = toLinearSpace(srcLow[i]);
+            close[i] = toLinearSpace(srcClose[i]);
+        }
+    }
+
+    private float toLinearSpace(float value) {
+        double linear = scale.toLinearSpace(value);
+        if (Double.isNaN(linear) && !Float.isNaN(value)) {
+            // Outside the scale's domain, not a gap
+            return Float.NEGATIVE_INFINITY;
+        }
+        return (float) linear;
+    }
+
+    /**
+     * Returns the mapped open column. Valid up to the last {@link #ensure} index.
+     */
+    public float[] getOpenArray() {
+        return open;
+    }
+
+    /**
+     * Returns the mapped high column. Valid up to the last {@link #ensure} index.
+     */
+    public float[] getHighArray() {
+        return high;
+    }
+
+    /**
+     * Returns the mapped low column. Valid up to the last {@link #ensure} index.
+     */
+    public float[] getLowArray() {
+        return low;
+    }
+
+    /**
+     * Returns the mapped close column. Valid up to the last {@link #ensure} index.
+     */
+    public float[] getCloseArray() {
+        return close;
+    }
+
+    private void ensureCapacity(int size) {
+        if (size > open.length) {
+            int newCapacity = Math.max(size, open.length + (open.length >> 1));
+            open = Arrays.copyOf(open, newCapacity);
+            high = Arrays.copyOf(high, newCapacity);
+            low = Arrays.copyOf(low, newCapacity);
+            close = Arrays.copyOf(close, newCapacity);
+        }
+    }
+}
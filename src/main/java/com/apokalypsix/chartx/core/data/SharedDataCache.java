@@ -0,0 +1,301 @@
+package com.apokalypsix.chartx.core.data;
+
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.chart.data.DataListener;
+
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Objects;
+import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.function.Supplier;
+
+/**
+ * Process-wide, reference-counted cache for values derived from a data source.
+ *
+ * <p>Entries are keyed by (source data instance, transform name, parameters).
+ * When several charts show the same source - e.g. linked charts of one symbol
+ * in a {@code ChartLayout} - they acquire the same aggregated series or
+ * indicator output instead of each computing their own copy. The first
+ * {@link #acquire acquire} computes the value; later acquires only bump the
+ * reference count.
+ *
+ * <p>Each entry listens to its source once and keeps the value current on
+ * behalf of all holders: appends are passed to the entry's {@link Updater};
+ * in-place updates, including live updates of the last point, and clears
+ * mark the entry stale and it is recomputed into a new object on the next
+ * {@link Lease#get()}, so updaters only ever see appended points. Holders
+ * should therefore read the value through their lease rather than keeping
+ * the object, or rebind when their
+ * {@linkplain Lease#setReplacementListener replacement listener} is called.
+ *
+ * <p>The entry is dropped when the last lease is released.
+ *
+ * <h2>Usage</h2>
+ * <pre>{@code
+ * SharedDataCache.Lease<OhlcData> lease = SharedDataCache.getInstance().acquire(
+ *         source, "aggregate", Timeframe.H1,
+ *         () -> TimeframeAggregator.aggregate(source, Timeframe.H1),
+ *         (htf, from) -> TimeframeAggregator.updateAggregated(htf, source, Timeframe.H1, from));
+ * OhlcData htf = lease.get();
+ * ...
+ * lease.release();
+ * }</pre>
+ */
+public final class SharedDataCache {
+
+    private static final SharedDataCache INSTANCE = new SharedDataCache();
+
+    /**
+     * Returns the process-wide cache.
+     */
+    public static SharedDataCache getInstance() {
+        return INSTANCE;
+    }
+
+    /**
+     * Incrementally brings a cached value up to date with its source.
+     *
+     * @param <T> the cached value type
+     */
+    @FunctionalInterface
+    public interface Updater<T> {
+        /**
+         * Updates the value after points were appended to the source.
+         *
+         * @param value the cached value
+         * @param fromIndex first appended source index
+         */
+        void update(T value, int fromIndex);
+    }
+
+    private final Map<Key, Entry<?>> entries = new HashMap<>();
+
+    SharedDataCache() {
+    }
+
+    /**
+     * Acquires a shared value, computing it if no other holder has it yet.
+     *
+     * @param source the source data (matched by identity)
+     * @param transform name of the transform, e.g. an indicator ID
+     * @param params transform parameters (matched by {@code equals}); must be immutable
+     * @param factory computes the value from scratch
+     * @param updater incrementally updates the value, or null to recompute on every change
+     * @return a lease that must be released when no longer needed
+     */
+    public synchronized <T> Lease<T> acquire(Data<?> source, String transform, Object params,
+                                             Supplier<T> factory, Updater<T> updater) {
+        Objects.requireNonNull(source, "source");
+        Objects.requireNonNull(transform, "transform");
+        Objects.requireNonNull(factory, "factory");
+
+        Key key = new Key(source, transform, params);
+        @SuppressWarnings("unchecked")
+        Entry<T> entry = (Entry<T>) entries.get(key);
+        if (entry == null) {
+            entry = new Entry<>(key, factory, updater);
+            entries.put(key, entry);
+            source.addListener(entry);
+        }
+        entry.refCount++;
+        Lease<T> lease = new Lease<>(entry);
+        entry.leases.add(lease);
+        return lease;
+    }
+
+    /**
+     * Returns the number of holders of an entry, or 0 if it is not cached.
+     */
+    public synchronized int getReferenceCount(Data<?> source, String transform, Object params) {
+        Entry<?> entry = entries.get(new Key(source, transform, params));
+        return entry != null ? entry.refCount : 0;
+    }
+
+    /**
+     * Returns the number of cached entries.
+     */
+    public synchronized int size() {
+        return entries.size();
+    }
+
+    private synchronized <T> void release(Entry<T> entry, Lease<T> lease) {
+        entry.leases.remove(lease);
+        if (--entry.refCount > 0) {
+            return;
+        }
+        entries.remove(entry.key);
+        entry.key.source.removeListener(entry);
+        entry.dispose();
+    }
+
+    // ========== Lease ==========
+
+    /**
+     * A holder's reference to a shared value.
+     *
+     * @param <T> the cached value type
+     */
+    public final class Lease<T> {
+
+        private final Entry<T> entry;
+        private boolean released;
+        private volatile Runnable replacementListener;
+
+        private Lease(Entry<T> entry) {
+            this.entry = entry;
+        }
+
+        /**
+         * Returns the current value, recomputing it first if it went stale.
+         */
+        public T get() {
+            return entry.get();
+        }
+
+        /**
+         * Sets a listener called after the shared value was recomputed into
+         * a new object, so holders that keep the object can rebind it. The
+         * listener runs on the thread whose {@link #get()} recomputed the
+         * value, after the entry's lock is released.
+         *
+         * @param listener the listener, or null to remove it
+         */
+        public void setReplacementListener(Runnable listener) {
+            this.replacementListener = listener;
+        }
+
+        /**
+         * Returns the number of holders sharing this value.
+         */
+        public int getReferenceCount() {
+            synchronized (SharedDataCache.this) {
+                return entry.refCount;
+            }
+        }
+
+        /**
+         * Releases this lease. Releasing twice has no effect.
+         */
+        public void release() {
+            synchronized (SharedDataCache.this) {
+                if (released) {
+                    return;
+                }
+                released = true;
+            }
+            SharedDataCache.this.release(entry, this);
+        }
+
+        /**
+         * Returns true if this lease has been released.
+         */
+        public boolean isReleased() {
+            return released;
+        }
+    }
+
+    // ========== Internal ==========
+
+    private static final class Key {
+        final Data<?> source;
+        final String transform;
+        final Object params;
+        final int hash;
+
+        Key(Data<?> source, String transform, Object params) {
+            this.source = source;
+            this.transform = transform;
+            this.params = params;
+            this.hash = 31 * (31 * System.identityHashCode(source) + transform.hashCode())
+                    + Objects.hashCode(params);
+        }
+
+        @Override
+        public boolean equals(Object o) {
+            if (this == o) return true;
+            if (!(o instanceof Key)) return false;
+            Key other = (Key) o;
+            return source == other.source
+                    && transform.equals(other.transform)
+                    && Objects.equals(params, other.params);
+        }
+
+        @Override
+        public int hashCode() {
+            return hash;
+        }
+    }
+
+    private static final class Entry<T> implements DataListener {
+        final Key key;
+        final Supplier<T> factory;
+        final Updater<T> updater;
+        final List<Lease<T>> leases = new CopyOnWriteArrayList<>();
+        int refCount;
+
+        private T value;
+        private boolean stale = true;
+
+        Entry(Key key, Supplier<T> factory, Updater<T> updater) {
+            this.key = key;
+            this.factory = factory;
+            this.updater = updater;
+        }
+
+        T get() {
+            T replaced;
+            T current;
+            synchronized (this) {
+                if (!stale) {
+                    return value;
+                }
+                replaced = value;
+                value = factory.get();
+                stale = false;
+                current = value;
+            }
+            if (replaced != null && replaced != current) {
+                for (Lease<T> lease : leases) {
+                    Runnable listener = lease.replacementListener;
+                    if (listener != null) {
+                        listener.run();
+                    }
+                }
+            }
+            return current;
+        }
+
+        synchronized void dispose() {
+            value = null;
+            stale = true;
+        }
+
+        @Override
+        public synchronized void onDataAppended(Data<?> data, int newIndex) {
+            update(newIndex);
+        }
+
+        @Override
+        public synchronized void onDataUpdated(Data<?> data, int index) {
+            // Updaters are append-only, so any in-place change recomputes
+            stale = true;
+        }
+
+        @Override
+        public synchronized void onDataCleared(Data<?> data) {
+            stale = true;
+        }
+
+        private void update(int fromIndex) {
+            if (stale || value == null) {
+                return;
+            }
+            if (updater != null) {
+                updater.update(value, fromIndex);
+            } else {
+                stale = true;
+            }
+        }
+    }
+}
@@ -1,7 +1,10 @@
 package com.apokalypsix.chartx.core.data;
 
+import com.apokalypsix.chartx.chart.data.Data;
 import com.apokalypsix.chartx.chart.data.XyData;
 
+import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 
 /**
@@ -11,10 +14,20 @@ import java.util.List;
  * (normalized to percentages). Handles NaN gaps and positive/negative
  * value separation.
  *
- * <p>This class caches computed values and tracks the visible range to
- * avoid recomputation when the data hasn't changed.
+ * <p>Stacked tops are maintained as cumulative columns over the whole data
+ * range, together with per-index positive and negative totals. Appending a
+ * point only extends the columns (O(series) per new index), panning only
+ * changes the slice that is read, and 100% normalization is derived on the
+ * fly from the totals, so switching modes never recomputes anything.
+ * Baselines are not stored: a baseline is always {@code top - value}.
+ *
+ * <p>Value updates (e.g. {@code updateLast}) are picked up through a data
+ * listener and recompute only from the updated index onwards. A bulk load
+ * of any series (see {@link Data#getLoadCount()}) recomputes all columns.
+ * The tracking is shared with the other lazy columns through
+ * {@link LazyDataColumns}.
  */
-public class StackingCalculator {
+public class StackingCalculator extends LazyDataColumns {
 
     /** Stacking mode enumeration */
     public enum StackMode {
@@ -24,23 +37,19 @@ public class StackingCalculator {
         PERCENT_100
     }
 
-    // Cached computation results
-    private float[][] stackedBaselines;  // Bottom of each series [seriesIdx][dataIdx]
+    // Cumulative columns over the full data range
     private float[][] stackedTops;       // Top of each series [seriesIdx][dataIdx]
-    private float[][] percentValues;     // Percentage values for 100% mode
+    private float[] positiveTotals;      // Sum of positive values per data index
+    private float[] negativeTotals;      // Sum of |negative values| per data index
+    private int columnCapacity;
+
+    // Tracked series, bottom to top
+    private final List<XyData> trackedSeries = new ArrayList<>();
 
-    // Cache invalidation tracking
-    private List<XyData> lastSeriesList;
+    // Currently requested slice
     private int lastStartIdx = -1;
     private int lastEndIdx = -1;
-    private StackMode lastMode = null;
-    private long lastComputeVersion;
-
-    // Reusable arrays for computation
-    private float[] positiveStack;
-    private float[] negativeStack;
-    private float[] positiveSum;
-    private float[] negativeSum;
+    private StackMode lastMode = StackMode.NORMAL;
 
     /**
      * Creates a new stacking calculator.
@@ -53,6 +62,9 @@ public class StackingCalculator {
      *
      * <p>After calling this method, use {@link #getStackedBaseline(int, int)}
      * and {@link #getStackedTop(int, int)} to retrieve the computed values.
+     * Only indices that were appended or updated since the previous call are
+     * recomputed; the range arguments select the slice used by
+     * {@link #findMinStackedValue()} and {@link #findMaxStackedValue()}.
      *
      * @param seriesList list of XyData series to stack (bottom to top order)
      * @param startIdx starting data index
@@ -64,28 +76,15 @@ public class StackingCalculator {
             return;
         }
 
-        // Check if we can reuse cached results
-        if (isCacheValid(seriesList, startIdx, endIdx, mode)) {
-            return;
+        if (!isSameSeries(seriesList)) {
+            trackSeries(seriesList);
         }
 
-        int seriesCount = seriesList.size();
-        int dataCount = endIdx - startIdx + 1;
-
-        ensureCapacity(seriesCount, dataCount);
+        ensure(Integer.MAX_VALUE);
 
-        if (mode == StackMode.PERCENT_100) {
-            computePercentStacking(seriesList, startIdx, endIdx, dataCount);
-        } else {
-            computeNormalStacking(seriesList, startIdx, endIdx, dataCount);
-        }
-
-        // Update cache tracking
-        lastSeriesList = seriesList;
         lastStartIdx = startIdx;
         lastEndIdx = endIdx;
-        lastMode = mode;
-        lastComputeVersion = computeDataVersion(seriesList);
+        lastMode = mode != null ? mode : StackMode.NORMAL;
     }
 
     /**
@@ -96,15 +95,15 @@ public class StackingCalculator {
      * @return baseline value in data units
      */
     public float getStackedBaseline(int seriesIndex, int dataIndex) {
-        if (stackedBaselines == null || seriesIndex < 0 ||
-            seriesIndex >= stackedBaselines.length) {
+        if (!isComputed(seriesIndex, dataIndex)) {
             return 0;
         }
-        int adjustedIdx = dataIndex - lastStartIdx;
-        if (adjustedIdx < 0 || adjustedIdx >= stackedBaselines[seriesIndex].length) {
-            return 0;
+        float top = stackedTops[seriesIndex][dataIndex];
+        if (Float.isNaN(top)) {
+            return Float.NaN;
         }
-        return stackedBaselines[seriesIndex][adjustedIdx];
+        float value = trackedSeries.get(seriesIndex).getValuesArray()[dataIndex];
+        return normalize(top - value, value, dataIndex);
     }
 
     /**
@@ -115,15 +114,15 @@ public class StackingCalculator {
      * @return top value in data units
      */
     public float getStackedTop(int seriesIndex, int dataIndex) {
-        if (stackedTops == null || seriesIndex < 0 ||
-            seriesIndex >= stackedTops.length) {
+        if (!isComputed(seriesIndex, dataIndex)) {
             return 0;
         }
-        int adjustedIdx = dataIndex - lastStartIdx;
-        if (adjustedIdx < 0 || adjustedIdx >= stackedTops[seriesIndex].length) {
-            return 0;
+        float top = stackedTops[seriesIndex][dataIndex];
+        if (Float.isNaN(top)) {
+            return Float.NaN;
         }
-        return stackedTops[seriesIndex][adjustedIdx];
+        float value = trackedSeries.get(seriesIndex).getValuesArray()[dataIndex];
+        return normalize(top, value, dataIndex);
     }
 
     /**
@@ -134,27 +133,27 @@ public class StackingCalculator {
      * @return percentage value (0-100), or NaN if not valid
      */
     public float getPercentValue(int seriesIndex, int dataIndex) {
-        if (percentValues == null || seriesIndex < 0 ||
-            seriesIndex >= percentValues.length) {
+        if (!isComputed(seriesIndex, dataIndex) ||
+            Float.isNaN(stackedTops[seriesIndex][dataIndex])) {
             return Float.NaN;
         }
-        int adjustedIdx = dataIndex - lastStartIdx;
-        if (adjustedIdx < 0 || adjustedIdx >= percentValues[seriesIndex].length) {
-            return Float.NaN;
-        }
-        return percentValues[seriesIndex][adjustedIdx];
+        float value = trackedSeries.get(seriesIndex).getValuesArray()[dataIndex];
+        float total = value >= 0 ? positiveTotals[dataIndex] : negativeTotals[dataIndex];
+        return total > 0 ? (Math.abs(value) / total) * 100 : 0;
     }
 
     /**
      * Finds the minimum stacked value across all series in the visible range.
      */
     public float findMinStackedValue() {
-        if (stackedBaselines == null) {
+        if (stackedTops == null || lastStartIdx < 0) {
             return 0;
         }
+        int end = Math.min(lastEndIdx, computedCount - 1);
         float min = Float.POSITIVE_INFINITY;
-        for (float[] baselines : stackedBaselines) {
-            for (float baseline : baselines) {
+        for (int s = 0; s < trackedSeries.size(); s++) {
+            for (int d = lastStartIdx; d <= end; d++) {
+                float baseline = getStackedBaseline(s, d);
                 if (!Float.isNaN(baseline) && baseline < min) {
                     min = baseline;
                 }
@@ -167,12 +166,14 @@ public class StackingCalculator {
      * Finds the maximum stacked value across all series in the visible range.
      */
     public float findMaxStackedValue() {
-        if (stackedTops == null) {
+        if (stackedTops == null || lastStartIdx < 0) {
             return 0;
         }
+        int end = Math.min(lastEndIdx, computedCount - 1);
         float max = Float.NEGATIVE_INFINITY;
-        for (float[] tops : stackedTops) {
-            for (float top : tops) {
+        for (int s = 0; s < trackedSeries.size(); s++) {
+            for (int d = lastStartIdx; d <= end; d++) {
+                float top = getStackedTop(s, d);
                 if (!Float.isNaN(top) && top > max) {
                     max = top;
                 }
@@ -182,176 +183,143 @@ public class StackingCalculator {
     }
 
     /**
-     * Clears the cache, forcing recomputation on next call.
+     * Clears the cache, forcing a full recomputation on next call.
      */
     public void invalidateCache() {
-        lastSeriesList = null;
+        invalidate();
         lastStartIdx = -1;
         lastEndIdx = -1;
-        lastMode = null;
     }
 
-    // ========== Internal computation ==========
-
-    private void computeNormalStacking(List<XyData> seriesList, int startIdx,
-                                       int endIdx, int dataCount) {
-        int seriesCount = seriesList.size();
-
-        // Initialize running stacks
-        java.util.Arrays.fill(positiveStack, 0, dataCount, 0);
-        java.util.Arrays.fill(negativeStack, 0, dataCount, 0);
-
-        for (int s = 0; s < seriesCount; s++) {
-            XyData series = seriesList.get(s);
-            float[] values = series.getValuesArray();
-
-            for (int d = 0; d < dataCount; d++) {
-                int dataIdx = startIdx + d;
+    /**
+     * Stops listening to the tracked series and releases the columns.
+     *
+     * <p>Call when the owning series is disposed.
+     */
+    @Override
+    public void dispose() {
+        super.dispose();
+        trackedSeries.clear();
+        stackedTops = null;
+        positiveTotals = null;
+        negativeTotals = null;
+        columnCapacity = 0;
+        invalidateCache();
+    }
 
-                if (dataIdx >= series.size()) {
-                    stackedBaselines[s][d] = Float.NaN;
-                    stackedTops[s][d] = Float.NaN;
-                    continue;
-                }
+    // ========== Internal computation ==========
 
-                float value = values[dataIdx];
-                if (Float.isNaN(value)) {
-                    stackedBaselines[s][d] = Float.NaN;
-                    stackedTops[s][d] = Float.NaN;
-                    continue;
-                }
+    @Override
+    protected void rebuild(int from, int to) {
+        ensureCapacity(trackedSeries.size(), to);
+        computeColumns(from, to);
+    }
 
-                // Stack positive and negative values separately
-                if (value >= 0) {
-                    stackedBaselines[s][d] = positiveStack[d];
-                    positiveStack[d] += value;
-                    stackedTops[s][d] = positiveStack[d];
-                } else {
-                    stackedBaselines[s][d] = negativeStack[d];
-                    negativeStack[d] += value;
-                    stackedTops[s][d] = negativeStack[d];
-                }
-            }
+    /**
+     * Returns the size of the longest tracked series.
+     */
+    @Override
+    protected int indexCount() {
+        int maxSize = 0;
+        for (XyData series : trackedSeries) {
+            maxSize = Math.max(maxSize, series.size());
         }
+        return maxSize;
     }
 
-    private void computePercentStacking(List<XyData> seriesList, int startIdx,
-                                        int endIdx, int dataCount) {
-        int seriesCount = seriesList.size();
-
-        // First pass: compute totals for each data point
-        java.util.Arrays.fill(positiveSum, 0, dataCount, 0);
-        java.util.Arrays.fill(negativeSum, 0, dataCount, 0);
+    /**
+     * Recomputes the cumulative columns for data indices [fromIdx, toIdx).
+     *
+     * <p>The running totals double as the per-index stacks while the series
+     * are folded in from bottom to top.
+     */
+    private void computeColumns(int fromIdx, int toIdx) {
+        Arrays.fill(positiveTotals, fromIdx, toIdx, 0);
+        Arrays.fill(negativeTotals, fromIdx, toIdx, 0);
 
-        for (XyData series : seriesList) {
+        for (int s = 0; s < trackedSeries.size(); s++) {
+            XyData series = trackedSeries.get(s);
             float[] values = series.getValuesArray();
-            for (int d = 0; d < dataCount; d++) {
-                int dataIdx = startIdx + d;
-                if (dataIdx >= series.size()) continue;
-
-                float value = values[dataIdx];
-                if (Float.isNaN(value)) continue;
+            float[] tops = stackedTops[s];
+            int seriesEnd = Math.min(toIdx, series.size());
 
-                if (value >= 0) {
-                    positiveSum[d] += value;
+            for (int d = fromIdx; d < seriesEnd; d++) {
+                float value = values[d];
+                if (Float.isNaN(value)) {
+                    tops[d] = Float.NaN;
+                } else if (value >= 0) {
+                    positiveTotals[d] += value;
+                    tops[d] = positiveTotals[d];
                 } else {
-                    negativeSum[d] += Math.abs(value);
+                    negativeTotals[d] -= value;
+                    tops[d] = -negativeTotals[d];
                 }
             }
+            if (seriesEnd < toIdx) {
+                Arrays.fill(tops, Math.max(fromIdx, seriesEnd), toIdx, Float.NaN);
+            }
         }
+    }
 
-        // Second pass: compute stacked percentages
-        java.util.Arrays.fill(positiveStack, 0, dataCount, 0);
-        java.util.Arrays.fill(negativeStack, 0, dataCount, 0);
-
-        for (int s = 0; s < seriesCount; s++) {
-            XyData series = seriesList.get(s);
-            float[] values = series.getValuesArray();
-
-            for (int d = 0; d < dataCount; d++) {
-                int dataIdx = startIdx + d;
-
-                if (dataIdx >= series.size()) {
-                    stackedBaselines[s][d] = Float.NaN;
-                    stackedTops[s][d] = Float.NaN;
-                    percentValues[s][d] = Float.NaN;
-                    continue;
-                }
-
-                float value = values[dataIdx];
-                if (Float.isNaN(value)) {
-                    stackedBaselines[s][d] = Float.NaN;
-                    stackedTops[s][d] = Float.NaN;
-                    percentValues[s][d] = Float.NaN;
-                    continue;
-                }
-
-                // Compute percentage
-                float total = (value >= 0) ? positiveSum[d] : negativeSum[d];
-                float percent;
-                if (total > 0) {
-                    percent = (Math.abs(value) / total) * 100;
-                } else {
-                    percent = 0;
-                }
-                percentValues[s][d] = percent;
-
-                // Stack the percentage values
-                if (value >= 0) {
-                    stackedBaselines[s][d] = positiveStack[d];
-                    positiveStack[d] += percent;
-                    stackedTops[s][d] = positiveStack[d];
-                } else {
-                    stackedBaselines[s][d] = -negativeStack[d];
-                    negativeStack[d] += percent;
-                    stackedTops[s][d] = -negativeStack[d];
-                }
-            }
+    /**
+     * Converts a cumulative value to the current mode's units.
+     */
+    private float normalize(float cumulative, float value, int dataIndex) {
+        if (lastMode != StackMode.PERCENT_100) {
+            return cumulative;
         }
+        float total = value >= 0 ? positiveTotals[dataIndex] : negativeTotals[dataIndex];
+        return total > 0 ? (cumulative / total) * 100 : 0;
+    }
+
+    private boolean isComputed(int seriesIndex, int dataIndex) {
+        return stackedTops != null && seriesIndex >= 0 && seriesIndex < trackedSeries.size() &&
+               dataIndex >= 0 && dataIndex < computedCount;
     }
 
     private void ensureCapacity(int seriesCount, int dataCount) {
-        // Ensure output arrays
-        if (stackedBaselines == null || stackedBaselines.length < seriesCount) {
-            stackedBaselines = new float[seriesCount][];
+        if (stackedTops == null || stackedTops.length != seriesCount) {
             stackedTops = new float[seriesCount][];
-            percentValues = new float[seriesCount][];
+            columnCapacity = 0;
         }
-
-        for (int s = 0; s < seriesCount; s++) {
-            if (stackedBaselines[s] == null || stackedBaselines[s].length < dataCount) {
-                stackedBaselines[s] = new float[dataCount];
-                stackedTops[s] = new float[dataCount];
-                percentValues[s] = new float[dataCount];
+        if (dataCount > columnCapacity || stackedTops[0] == null) {
+            int newCapacity = Math.max(dataCount, columnCapacity + (columnCapacity >> 1));
+            for (int s = 0; s < seriesCount; s++) {
+                stackedTops[s] = stackedTops[s] == null
+                        ? new float[newCapacity]
+                        : Arrays.copyOf(stackedTops[s], newCapacity);
             }
-        }
-
-        // Ensure working arrays
-        if (positiveStack == null || positiveStack.length < dataCount) {
-            positiveStack = new float[dataCount];
-            negativeStack = new float[dataCount];
-            positiveSum = new float[dataCount];
-            negativeSum = new float[dataCount];
+            positiveTotals = positiveTotals == null
+                    ? new float[newCapacity] : Arrays.copyOf(positiveTotals, newCapacity);
+            negativeTotals = negativeTotals == null
+                    ? new float[newCapacity] : Arrays.copyOf(negativeTotals, newCapacity);
+            columnCapacity = newCapacity;
         }
     }
 
-    private boolean isCacheValid(List<XyData> seriesList, int startIdx,
-                                 int endIdx, StackMode mode) {
-        if (lastSeriesList != seriesList || lastMode != mode ||
-            lastStartIdx != startIdx || lastEndIdx != endIdx) {
+    /**
+     * Compares by series identity, since callers typically pass a fresh
+     * unmodifiable view of the same underlying list on every frame.
+     */
+    private boolean isSameSeries(List<XyData> seriesList) {
+        if (seriesList.size() != trackedSeries.size()) {
             return false;
         }
-
-        // Check if any series data has changed
-        return computeDataVersion(seriesList) == lastComputeVersion;
+        for (int s = 0; s < seriesList.size(); s++) {
+            if (seriesList.get(s) != trackedSeries.get(s)) {
+                return false;
+            }
+        }
+        return true;
     }
 
-    private long computeDataVersion(List<XyData> seriesList) {
-        // Simple version based on series sizes
-        long version = 0;
-        for (XyData series : seriesList) {
-            version = version * 31 + series.size();
-        }
-        return version;
+    private void trackSeries(List<XyData> seriesList) {
+        trackedSeries.clear();
+        trackedSeries.addAll(seriesList);
+        setSources(trackedSeries.toArray(new Data<?>[0]));
+
+        // Stack order changed: every column must be rebuilt
+        stackedTops = null;
+        columnCapacity = 0;
     }
 }
@@ -260,6 +260,23 @@ public class TimeframeAggregator {
         return size;
     }
 
+    /**
+     * Acquires an aggregated series from the process-wide {@link SharedDataCache}.
+     *
+     * <p>Charts that aggregate the same source to the same timeframe share a
+     * single series, which is kept up to date incrementally as the source
+     * grows. Release the lease when the series is no longer displayed.
+     *
+     * @param source the source series to aggregate
+     * @param targetTimeframe the target timeframe
+     * @return a lease on the shared aggregated series
+     */
+    public static SharedDataCache.Lease<OhlcData> aggregateShared(OhlcData source, Timeframe targetTimeframe) {
+        return SharedDataCache.getInstance().acquire(source, "aggregate", targetTimeframe,
+                () -> aggregate(source, targetTimeframe),
+                (aggregated, fromIndex) -> updateAggregated(aggregated, source, targetTimeframe, fromIndex));
+    }
+
     /**
      * Validates that aggregation from one timeframe to another is possible.
      *
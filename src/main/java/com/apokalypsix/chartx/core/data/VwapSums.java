@@ -0,0 +1,192 @@
+package com.apokalypsix.chartx.core.data;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+
+import java.util.Arrays;
+
+/**
+ * Volume-weighted prefix-sum columns over OHLC data.
+ *
+ * <p>With p the typical price {@code (high + low + close) / 3} and v the
+ * volume, entry {@code i} holds Σv, Σpv and Σp²v of all bars before bar
+ * {@code i}. The VWAP of any bar range and the volume-weighted standard
+ * deviation around it then take one subtraction per column, so
+ * {@link #vwap} is O(1) for any anchor and bar. Anchored VWAPs can be
+ * evaluated for any number of anchors, and an anchor can be dragged, without
+ * re-accumulating from the anchor.
+ *
+ * <p>Prices are taken relative to the first typical price, which keeps the
+ * Σp²v column small and the variance free of cancellation for price series
+ * that move within a band. Bars with a NaN price or a non-positive volume do
+ * not contribute.
+ *
+ * <p>Like {@link PrefixSums}, columns are built lazily up to the highest index
+ * requested and kept current through a data listener. Obtain instances
+ * through {@link OhlcData#getVwapSums()}.
+ */
+public class VwapSums extends LazyDataColumns {
+
+    /**
+     * Volume-weighted statistics of a bar range.
+     *
+     * @param volume total volume
+     * @param vwap volume-weighted average typical price
+     * @param stdDev volume-weighted standard deviation of the typical price
+     */
+    public record Vwap(double volume, double vwap, double stdDev) {
+
+        /** Statistics of a range without volume */
+        public static final Vwap EMPTY = new Vwap(0, Double.NaN, Double.NaN);
+
+        /**
+         * Returns the band {@code multiplier} standard deviations from the VWAP;
+         * negative multipliers give lower bands.
+         */
+        public double band(double multiplier) {
+            return vwap + multiplier * stdDev;
+        }
+    }
+
+    private final OhlcData data;
+
+    // Entry i covers bars [0, i)
+    private double[] sumV = new double[1];
+    private double[] sumPV = new double[1];
+    private double[] sumPPV = new double[1];
+
+    // Price subtracted from every typical price before summing
+    private double origin = Double.NaN;
+
+    /**
+     * Creates VWAP sums for the given data.
+     *
+     * @param data the source OHLC data
+     */
+    public VwapSums(OhlcData data) {
+        super(data);
+        this.data = data;
+    }
+
+    @Override
+    protected void rebuild(int from, int to) {
+        ensureCapacity(to + 1);
+        float[] high = data.getHighArray();
+        float[] low = data.getLowArray();
+        float[] close = data.getCloseArray();
+        float[] volume = data.getVolumeArray();
+        if (from == 0) {
+            origin = Double.NaN;
+        }
+
+        for (int i = from; i < to; i++) {
+            double price = (high[i] + low[i] + close[i]) / 3.0;
+            double v = volume[i];
+            boolean valid = !Double.isNaN(price) && v > 0;
+            if (valid && Double.isNaN(origin)) {
+                origin = price;
+            }
+            double p = valid ? price - origin : 0;
+            double w = valid ? v : 0;
+
+            sumV[i + 1] = sumV[i] + w;
+            sumPV[i + 1] = sumPV[i] + p * w;
+            sumPPV[i + 1] = sumPPV[i] + p * p * w;
+        }
+    }
+
+    /**
+     * Computes the VWAP of bars [anchor, index].
+     *
+     * <p>Calls {@link #ensure} as needed, so the cost is O(1) once the sums
+     * cover the range.
+     *
+     * @param anchor first bar of the range (inclusive)
+     * @param index last bar of the range (inclusive)
+     * @return the statistics, or {@link Vwap#EMPTY} if the range has no volume
+     */
+    public Vwap vwap(int anchor, int index) {
+        synchronized (lock) {
+            return vwapLocked(Math.max(0, anchor), index);
+        }
+    }
+
+    private Vwap vwapLocked(int anchor, int index) {
+        ensure(index + 1);
+        index = Math.min(index, computedCount - 1);
+        if (anchor > index) {
+            return Vwap.EMPTY;
+        }
+
+        double v = sumV[index + 1] - sumV[anchor];
+        if (v <= 0) {
+            return Vwap.EMPTY;
+        }
+        double mean = (sumPV[index + 1] - sumPV[anchor]) / v;
+        double variance = Math.max(0, (sumPPV[index + 1] - sumPPV[anchor]) / v - mean * mean);
+        return new Vwap(v, origin + mean, Math.sqrt(variance));
+    }
+
+    /**
+     * Writes the VWAP and standard deviation anchored at {@code anchor} for
+     * each bar of [from, to] into the output arrays, bar {@code from} going to
+     * {@code outOffset}. Bars before the anchor or without volume get NaN.
+     *
+     * <p>Each bar costs O(1), regardless of its distance from the anchor.
+     *
+     * @param anchor the anchor bar
+     * @param from first output bar (inclusive)
+     * @param to last output bar (inclusive)
+     * @param vwapOut receives the VWAP per bar
+     * @param stdDevOut receives the standard deviation per bar, or null
+     * @param outOffset output index of bar {@code from}
+     */
+    public void fill(int anchor, int from, int to, float[] vwapOut, float[] stdDevOut, int outOffset) {
+        synchronized (lock) {
+            fillLocked(Math.max(0, anchor), from, to, vwapOut, stdDevOut, outOffset);
+        }
+    }
+
+    private void fillLocked(int anchor, int from, int to, float[] vwapOut, float[] stdDevOut,
+                            int outOffset) {
+        ensure(to + 1);
+        int last = Math.min(to, computedCount - 1);
+        boolean anchored = anchor <= last;
+        double baseV = anchored ? sumV[anchor] : 0;
+        double basePV = anchored ? sumPV[anchor] : 0;
+        double basePPV = anchored ? sumPPV[anchor] : 0;
+
+        for (int i = from; i <= to; i++) {
+            int k = outOffset + i - from;
+            double v = anchored && i >= anchor && i <= last ? sumV[i + 1] - baseV : 0;
+            if (v <= 0) {
+                vwapOut[k] = Float.NaN;
+                if (stdDevOut != null) {
+                    stdDevOut[k] = Float.NaN;
+                }
+                continue;
+            }
+            double mean = (sumPV[i + 1] - basePV) / v;
+            vwapOut[k] = (float) (origin + mean);
+            if (stdDevOut != null) {
+                double variance = (sumPPV[i + 1] - basePPV) / v - mean * mean;
+                stdDevOut[k] = (float) Math.sqrt(Math.max(0, variance));
+            }
+        }
+    }
+
+    /**
+     * Returns the source data.
+     */
+    public OhlcData getData() {
+        return data;
+    }
+
+    private void ensureCapacity(int size) {
+        if (size > sumV.length) {
+            int capacity = Math.max(size, sumV.length + (sumV.length >> 1));
+            sumV = Arrays.copyOf(sumV, capacity);
+            sumPV = Arrays.copyOf(sumPV, capacity);
+            sumPPV = Arrays.copyOf(sumPPV, capacity);
+        }
+    }
+}
@@ -0,0 +1,802 @@
+package com.apokalypsix.chartx.core.data.io;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.data.XyData;
+
+import java.io.IOException;
+import java.nio.BufferUnderflowException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.nio.channels.ReadableByteChannel;
+import java.nio.channels.WritableByteChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Reader and writer for the Apache Arrow IPC file and stream formats.
+ *
+ * <p>Self-contained: the FlatBuffers metadata is decoded by a minimal
+ * built-in reader, so no Arrow library is needed. Flat schemas of
+ * fixed-width columns are supported; string and binary columns may be
+ * present and are skipped. Nested, dictionary-encoded, compressed and
+ * big-endian data are rejected, as is metadata pointing outside the file.
+ *
+ * <p>Columns are selected by name. The timestamp column may be an Arrow
+ * timestamp of any unit, an int64 of epoch milliseconds, or a date. Value
+ * columns may be float32, float64 or integers; nulls become {@code NaN}.
+ * Files are memory-mapped one record batch at a time and float32 and int64
+ * columns are copied with bulk buffer transfers, so no per-row parsing is
+ * involved. Record batch bodies are limited to 2 GB each.
+ *
+ * <p>Written files use a millisecond timestamp column followed by float32
+ * value columns, split into record batches of {@link #batchSize} rows.
+ *
+ * <h2>Usage</h2>
+ * <pre>{@code
+ * ArrowIpc arrow = new ArrowIpc().timestampColumn("ts");
+ * OhlcData data = arrow.readOhlc(Path.of("bars.arrow"), "es", "ES");
+ * arrow.writeXy(Path.of("signal.arrow"), signal);
+ * }</pre>
+ */
+public class ArrowIpc {
+
+    private static final byte[] MAGIC = "ARROW1".getBytes(StandardCharsets.US_ASCII);
+    private static final int CONTINUATION = 0xFFFFFFFF;
+    private static final short METADATA_V5 = 4;
+
+    // MessageHeader union
+    private static final byte HEADER_SCHEMA = 1;
+    private static final byte HEADER_RECORD_BATCH = 3;
+
+    // Type union
+    private static final byte TYPE_INT = 2;
+    private static final byte TYPE_FLOAT = 3;
+    private static final byte TYPE_BINARY = 4;
+    private static final byte TYPE_UTF8 = 5;
+    private static final byte TYPE_BOOL = 6;
+    private static final byte TYPE_DECIMAL = 7;
+    private static final byte TYPE_DATE = 8;
+    private static final byte TYPE_TIME = 9;
+    private static final byte TYPE_TIMESTAMP = 10;
+    private static final byte TYPE_INTERVAL = 11;
+    private static final byte TYPE_FIXED_SIZE_BINARY = 15;
+    private static final byte TYPE_DURATION = 18;
+    private static final byte TYPE_LARGE_BINARY = 19;
+    private static final byte TYPE_LARGE_UTF8 = 20;
+
+    // FloatingPoint precision, TimeUnit and DateUnit
+    private static final short PRECISION_SINGLE = 1;
+    private static final short PRECISION_DOUBLE = 2;
+    private static final short UNIT_SECOND = 0;
+    private static final short UNIT_MILLISECOND = 1;
+    private static final short UNIT_MICROSECOND = 2;
+    private static final short DATE_DAY = 0;
+
+    private static final int WRITE_CHUNK_BYTES = 1 << 20;
+
+    private String timestampColumn = "timestamp";
+    private String[] ohlcvColumns = {"open", "high", "low", "close", "volume"};
+    private String valueColumn = "value";
+    private int batchSize = 1 << 23;
+
+    /**
+     * Sets the name of the timestamp column (default "timestamp"). If no
+     * column has that name, the first Arrow timestamp column is used.
+     */
+    public ArrowIpc timestampColumn(String name) {
+        this.timestampColumn = name;
+        return this;
+    }
+
+    /**
+     * Sets the OHLCV column names (default "open", "high", "low", "close",
+     * "volume"). A missing volume column reads as zero.
+     */
+    public ArrowIpc ohlcColumns(String open, String high, String low, String close, String volume) {
+        this.ohlcvColumns = new String[] {open, high, low, close, volume};
+        return this;
+    }
+
+    /**
+     * Sets the name of the value column of XY data (default "value").
+     */
+    public ArrowIpc valueColumn(String name) {
+        this.valueColumn = name;
+        return this;
+    }
+
+    /**
+     * Sets the maximum number of rows per written record batch.
+     */
+    public ArrowIpc batchSize(int rows) {
+        this.batchSize = Math.max(1, rows);
+        return this;
+    }
+
+    // ========== Reading ==========
+
+    /**
+     * Reads OHLC data from an Arrow IPC file.
+     *
+     * @throws IOException if the file cannot be read or has an unsupported layout
+     * @throws IllegalArgumentException if timestamps are not ascending
+     */
+    public OhlcData readOhlc(Path path, String id, String name) throws IOException {
+        return toOhlc(readFile(path, ohlcvColumns, 4), id, name);
+    }
+
+    /**
+     * Reads OHLC data from an Arrow IPC stream.
+     *
+     * @throws IOException if the stream cannot be read or has an unsupported layout
+     * @throws IllegalArgumentException if timestamps are not ascending
+     */
+    public OhlcData readOhlc(ReadableByteChannel in, String id, String name) throws IOException {
+        return toOhlc(readStream(in, ohlcvColumns, 4), id, name);
+    }
+
+    /**
+     * Reads XY data from an Arrow IPC file.
+     *
+     * @throws IOException if the file cannot be read or has an unsupported layout
+     * @throws IllegalArgumentException if timestamps are not ascending
+     */
+    public XyData readXy(Path path, String id, String name) throws IOException {
+        return toXy(readFile(path, new String[] {valueColumn}, 1), id, name);
+    }
+
+    /**
+     * Reads XY data from an Arrow IPC stream.
+     *
+     * @throws IOException if the stream cannot be read or has an unsupported layout
+     * @throws IllegalArgumentException if timestamps are not ascending
+     */
+    public XyData readXy(ReadableByteChannel in, String id, String name) throws IOException {
+        return toXy(readStream(in, new String[] {valueColumn}, 1), id, name);
+    }
+
+    private static OhlcData toOhlc(Columns columns, String id, String name) {
+        OhlcData data = new OhlcData(id, name, Math.max(1, columns.count));
+        float[][] v = columns.values;
+        data.loadFromArrays(trim(columns.timestamps, columns.count), trim(v[0], columns.count),
+                trim(v[1], columns.count), trim(v[2], columns.count), trim(v[3], columns.count),
+                trim(v[4], columns.count));
+        return data;
+    }
+
+    private static XyData toXy(Columns columns, String id, String name) {
+        XyData data = new XyData(id, name, Math.max(1, columns.count));
+        data.loadFromArrays(trim(columns.timestamps, columns.count), trim(columns.values[0], columns.count));
+        return data;
+    }
+
+    private Columns readFile(Path path, String[] names, int required) throws IOException {
+        try (FileChannel channel = FileChannel.open(path, StandardOpenOption.READ)) {
+            long size = channel.size();
+            ByteBuffer head = readAt(channel, 0, MAGIC.length);
+            ByteBuffer tail = readAt(channel, size - MAGIC.length - 4, MAGIC.length + 4);
+            if (!hasMagic(head, 0) || !hasMagic(tail, 4)) {
+                throw new IOException("Not an Arrow IPC file: " + path);
+            }
+
+            int footerLength = tail.getInt(0);
+            ByteBuffer footer = readAt(channel, size - MAGIC.length - 4 - footerLength, footerLength);
+            int root = FlatBuffers.root(footer, 0);
+            Schema schema = Schema.parse(footer, FlatBuffers.child(footer, root, 1));
+            int[] selected = select(schema, names, required);
+
+            // Block: offset (long), metaDataLength (int, padded), bodyLength (long)
+            int blocks = FlatBuffers.child(footer, root, 3);
+            int blockCount = FlatBuffers.vectorLength(footer, blocks);
+            ByteBuffer[] metadata = new ByteBuffer[blockCount];
+            long[] bodyOffsets = new long[blockCount];
+            long totalRows = 0;
+            for (int b = 0; b < blockCount; b++) {
+                int block = FlatBuffers.vectorStart(blocks) + b * 24;
+                long offset = footer.getLong(block);
+                int metaLength = footer.getInt(block + 8);
+                metadata[b] = readAt(channel, offset, metaLength);
+                bodyOffsets[b] = offset + metaLength;
+                totalRows += FlatBuffers.getLong(metadata[b], recordBatch(metadata[b]), 0, 0);
+            }
+            if (totalRows > Integer.MAX_VALUE - 8) {
+                throw new IOException("Too many rows: " + totalRows);
+            }
+
+            Columns columns = new Columns((int) totalRows, names.length);
+            for (int b = 0; b < blockCount; b++) {
+                int message = message(metadata[b]);
+                long bodyLength = FlatBuffers.getLong(metadata[b], message, 3, 0);
+                ByteBuffer body = channel.map(FileChannel.MapMode.READ_ONLY, bodyOffsets[b], bodyLength)
+                        .order(ByteOrder.LITTLE_ENDIAN);
+                readBatch(metadata[b], recordBatch(metadata[b]), body, schema, selected, columns);
+            }
+            columns.checkAscending();
+            return columns;
+        } catch (IndexOutOfBoundsException | BufferUnderflowException e) {
+            throw new IOException("Malformed Arrow file: " + path, e);
+        }
+    }
+
+    private Columns readStream(ReadableByteChannel in, String[] names, int required) throws IOException {
+        try {
+            return readMessages(in, names, required);
+        } catch (IndexOutOfBoundsException | BufferUnderflowException e) {
+            throw new IOException("Malformed Arrow stream", e);
+        }
+    }
+
+    private Columns readMessages(ReadableByteChannel in, String[] names, int required) throws IOException {
+        Schema schema = null;
+        int[] selected = null;
+        Columns columns = new Columns(1024, names.length);
+
+        while (true) {
+            ByteBuffer prefix = readFully(in, 4);
+            if (prefix == null) {
+                break;
+            }
+            int length = prefix.getInt(0);
+            if (length == CONTINUATION) {
+                prefix = readFully(in, 4);
+                length = prefix == null ? 0 : prefix.getInt(0);
+            }
+            if (length == 0) {
+                break;
+            }
+
+            ByteBuffer metadata = readFully(in, length);
+            if (metadata == null) {
+                throw new IOException("Truncated Arrow stream");
+            }
+            int message = FlatBuffers.root(metadata, 0);
+            long bodyLength = FlatBuffers.getLong(metadata, message, 3, 0);
+            if (bodyLength > Integer.MAX_VALUE) {
+                throw new IOException("Record batch body too large: " + bodyLength);
+            }
+            ByteBuffer body = bodyLength == 0 ? ByteBuffer.allocate(0) : readFully(in, (int) bodyLength);
+            if (body == null) {
+                throw new IOException("Truncated Arrow stream");
+            }
+
+            byte headerType = FlatBuffers.getByte(metadata, message, 1, (byte) 0);
+            int header = FlatBuffers.child(metadata, message, 2);
+            if (headerType == HEADER_SCHEMA) {
+                schema = Schema.parse(metadata, header);
+                selected = select(schema, names, required);
+            } else if (headerType == HEADER_RECORD_BATCH) {
+                if (schema == null) {
+                    throw new IOException("Record batch before schema");
+                }
+                int rows = (int) FlatBuffers.getLong(metadata, header, 0, 0);
+                columns.ensureCapacity(columns.count + rows);
+                readBatch(metadata, header, body.order(ByteOrder.LITTLE_ENDIAN), schema, selected, columns);
+            } else {
+                throw new IOException("Unsupported Arrow message type " + headerType);
+            }
+        }
+        if (schema == null) {
+            throw new IOException("Arrow stream has no schema");
+        }
+        columns.checkAscending();
+        return columns;
+    }
+
+    /**
+     * Resolves the timestamp column and value columns by name.
+     *
+     * @return field indices: timestamp first, then values (-1 if missing)
+     */
+    private int[] select(Schema schema, String[] names, int required) throws IOException {
+        int[] selected = new int[names.length + 1];
+        selected[0] = schema.indexOf(timestampColumn);
+        if (selected[0] < 0) {
+            for (int f = 0; f < schema.fieldCount; f++) {
+                if (schema.types[f] == TYPE_TIMESTAMP) {
+                    selected[0] = f;
+                    break;
+                }
+            }
+        }
+        if (selected[0] < 0) {
+            throw new IOException("No timestamp column '" + timestampColumn + "'");
+        }
+        for (int i = 0; i < names.length; i++) {
+            selected[i + 1] = schema.indexOf(names[i]);
+            if (selected[i + 1] < 0 && i < required) {
+                throw new IOException("No column '" + names[i] + "'");
+            }
+        }
+        return selected;
+    }
+
+    private static int message(ByteBuffer metadata) {
+        // Skip the continuation marker and length (or the legacy length only)
+        int start = metadata.getInt(0) == CONTINUATION ? 8 : 4;
+        return FlatBuffers.root(metadata, start);
+    }
+
+    private static int recordBatch(ByteBuffer metadata) throws IOException {
+        int message = message(metadata);
+        if (FlatBuffers.getByte(metadata, message, 1, (byte) 0) != HEADER_RECORD_BATCH) {
+            throw new IOException("Expected a record batch");
+        }
+        return FlatBuffers.child(metadata, message, 2);
+    }
+
+    /**
+     * Appends the selected columns of one record batch.
+     */
+    private static void readBatch(ByteBuffer meta, int batch, ByteBuffer body, Schema schema,
+                                  int[] selected, Columns out) throws IOException {
+        if (FlatBuffers.child(meta, batch, 3) != 0) {
+            throw new IOException("Compressed Arrow record batches are not supported");
+        }
+        int rows = (int) FlatBuffers.getLong(meta, batch, 0, 0);
+        int nodes = FlatBuffers.vectorStart(FlatBuffers.child(meta, batch, 1));
+        int buffers = FlatBuffers.vectorStart(FlatBuffers.child(meta, batch, 2));
+
+        for (int s = 0; s < selected.length; s++) {
+            int field = selected[s];
+            if (field < 0) {
+                continue;
+            }
+            // FieldNode: length, null_count; Buffer: offset, length
+            long nullCount = meta.getLong(nodes + field * 16 + 8);
+            int validity = buffers + schema.firstBuffer[field] * 16;
+            long validityLength = meta.getLong(validity + 8);
+            boolean hasNulls = nullCount > 0 && validityLength > 0;
+            int validityOffset = hasNulls
+                    ? bufferOffset(body, meta.getLong(validity), validityLength, (rows + 7) / 8)
+                    : 0;
+            int dataOffset = bufferOffset(body, meta.getLong(validity + 16), meta.getLong(validity + 24), 0);
+
+            if (s == 0) {
+                if (hasNulls) {
+                    throw new IOException("Null timestamps are not supported");
+                }
+                readTimestamps(body, dataOffset, rows, schema, field, out.timestamps, out.count);
+            } else {
+                float[] dst = out.values[s - 1];
+                readValues(body, dataOffset, rows, schema, field, dst, out.count);
+                if (hasNulls) {
+                    for (int i = 0; i < rows; i++) {
+                        if ((body.get(validityOffset + (i >> 3)) & (1 << (i & 7))) == 0) {
+                            dst[out.count + i] = Float.NaN;
+                        }
+                    }
+                }
+            }
+        }
+        out.count += rows;
+    }
+
+    /**
+     * Checks that a buffer lies within the record batch body.
+     *
+     * @param minLength the least length the buffer must have
+     * @return the buffer offset
+     */
+    private static int bufferOffset(ByteBuffer body, long offset, long length, long minLength)
+            throws IOException {
+        if (offset < 0 || length < minLength || length > body.capacity() - offset) {
+            throw new IOException("Arrow buffer [" + offset + ", +" + length
+                    + ") lies outside the record batch body");
+        }
+        return (int) offset;
+    }
+
+    private static void readTimestamps(ByteBuffer body, int offset, int rows, Schema schema, int field,
+                                       long[] dst, int at) throws IOException {
+        byte type = schema.types[field];
+        if (type == TYPE_DATE && schema.units[field] == DATE_DAY) {
+            for (int i = 0; i < rows; i++) {
+                dst[at + i] = body.getInt(offset + i * 4) * 86_400_000L;
+            }
+            return;
+        }
+        boolean int64 = type == TYPE_INT && schema.bitWidths[field] == 64;
+        if (type != TYPE_TIMESTAMP && type != TYPE_DATE && !int64) {
+            throw new IOException("Unsupported timestamp column type " + type);
+        }
+
+        body.duplicate().order(ByteOrder.LITTLE_ENDIAN).position(offset)
+                .asLongBuffer().get(dst, at, rows);
+        if (type == TYPE_TIMESTAMP && schema.units[field] != UNIT_MILLISECOND) {
+            short unit = schema.units[field];
+            for (int i = at; i < at + rows; i++) {
+                dst[i] = unit == UNIT_SECOND ? dst[i] * 1000
+                        : unit == UNIT_MICROSECOND ? Math.floorDiv(dst[i], 1000)
+                        : Math.floorDiv(dst[i], 1_000_000);
+            }
+        }
+    }
+
+    private static void readValues(ByteBuffer body, int offset, int rows, Schema schema, int field,
+                                   float[] dst, int at) throws IOException {
+        byte type = schema.types[field];
+        if (type == TYPE_FLOAT && schema.units[field] == PRECISION_SINGLE) {
+            body.duplicate().order(ByteOrder.LITTLE_ENDIAN).position(offset)
+                    .asFloatBuffer().get(dst, at, rows);
+        } else if (type == TYPE_FLOAT && schema.units[field] == PRECISION_DOUBLE) {
+            for (int i = 0; i < rows; i++) {
+                dst[at + i] = (float) body.getDouble(offset + i * 8);
+            }
+        } else if (type == TYPE_INT) {
+            switch (schema.bitWidths[field]) {
+                case 8 -> { for (int i = 0; i < rows; i++) dst[at + i] = body.get(offset + i); }
+                case 16 -> { for (int i = 0; i < rows; i++) dst[at + i] = body.getShort(offset + i * 2); }
+                case 32 -> { for (int i = 0; i < rows; i++) dst[at + i] = body.getInt(offset + i * 4); }
+                case 64 -> { for (int i = 0; i < rows; i++) dst[at + i] = body.getLong(offset + i * 8); }
+                default -> throw new IOException("Unsupported integer width " + schema.bitWidths[field]);
+            }
+        } else {
+            throw new IOException("Unsupported value column type " + type);
+        }
+    }
+
+    // ========== Writing ==========
+
+    /**
+     * Writes OHLC data as an Arrow IPC file.
+     *
+     * @throws IOException if the file cannot be written
+     */
+    public void writeOhlc(Path path, OhlcData data) throws IOException {
+        try (FileChannel out = openForWrite(path)) {
+            write(out, true, data.getTimestampsArray(), ohlcvArrays(data), ohlcvColumns, data.size());
+        }
+    }
+
+    /**
+     * Writes OHLC data in the Arrow IPC stream format.
+     *
+     * @throws IOException if the stream cannot be written
+     */
+    public void writeOhlc(WritableByteChannel out, OhlcData data) throws IOException {
+        write(out, false, data.getTimestampsArray(), ohlcvArrays(data), ohlcvColumns, data.size());
+    }
+
+    /**
+     * Writes XY data as an Arrow IPC file.
+     *
+     * @throws IOException if the file cannot be written
+     */
+    public void writeXy(Path path, XyData data) throws IOException {
+        try (FileChannel out = openForWrite(path)) {
+            write(out, true, data.getTimestampsArray(), new float[][] {data.getValuesArray()},
+                    new String[] {valueColumn}, data.size());
+        }
+    }
+
+    /**
+     * Writes XY data in the Arrow IPC stream format.
+     *
+     * @throws IOException if the stream cannot be written
+     */
+    public void writeXy(WritableByteChannel out, XyData data) throws IOException {
+        write(out, false, data.getTimestampsArray(), new float[][] {data.getValuesArray()},
+                new String[] {valueColumn}, data.size());
+    }
+
+    private static float[][] ohlcvArrays(OhlcData data) {
+        return new float[][] {data.getOpenArray(), data.getHighArray(), data.getLowArray(),
+                data.getCloseArray(), data.getVolumeArray()};
+    }
+
+    private static FileChannel openForWrite(Path path) throws IOException {
+        return FileChannel.open(path, StandardOpenOption.CREATE, StandardOpenOption.WRITE,
+                StandardOpenOption.TRUNCATE_EXISTING);
+    }
+
+    private void write(WritableByteChannel out, boolean file, long[] timestamps, float[][] values,
+                       String[] names, int rows) throws IOException {
+        Writer writer = new Writer(out);
+        if (file) {
+            writer.write(ByteBuffer.wrap(Arrays.copyOf(MAGIC, 8)));
+        }
+        writer.writeMessage(FlatBuffers.finish(message(HEADER_SCHEMA, schemaTable(names), 0)));
+
+        // At least one batch, so empty data still round-trips
+        List<long[]> blocks = new ArrayList<>();
+        int start = 0;
+        do {
+            int count = Math.min(batchSize, rows - start);
+            blocks.add(writer.writeBatch(timestamps, values, start, count));
+            start += count;
+        } while (start < rows);
+
+        // End-of-stream marker
+        writer.write(littleEndian(8).putInt(CONTINUATION).putInt(0).flip());
+
+        if (file) {
+            ByteBuffer blockBytes = littleEndian(blocks.size() * 24);
+            for (long[] block : blocks) {
+                blockBytes.putLong(block[0]).putInt((int) block[1]).putInt(0).putLong(block[2]);
+            }
+            FlatBuffers.Table footer = new FlatBuffers.Table()
+                    .addShort(0, METADATA_V5)
+                    .addOffset(1, schemaTable(names))
+                    .addOffset(2, new FlatBuffers.StructVector(0, new byte[0]))
+                    .addOffset(3, new FlatBuffers.StructVector(blocks.size(), blockBytes.array()));
+            byte[] footerBytes = FlatBuffers.finish(footer);
+            writer.write(ByteBuffer.wrap(footerBytes));
+            writer.write(littleEndian(4).putInt(footerBytes.length).flip());
+            writer.write(ByteBuffer.wrap(MAGIC));
+        }
+    }
+
+    private FlatBuffers.Table schemaTable(String[] names) {
+        List<FlatBuffers.Table> fields = new ArrayList<>(names.length + 1);
+        fields.add(new FlatBuffers.Table()
+                .addOffset(0, timestampColumn)
+                .addByte(1, 0)
+                .addByte(2, TYPE_TIMESTAMP)
+                .addOffset(3, new FlatBuffers.Table().addShort(0, UNIT_MILLISECOND))
+                .addOffset(5, new ArrayList<FlatBuffers.Table>()));
+        for (String name : names) {
+            fields.add(new FlatBuffers.Table()
+                    .addOffset(0, name)
+                    .addByte(1, 1)
+                    .addByte(2, TYPE_FLOAT)
+                    .addOffset(3, new FlatBuffers.Table().addShort(0, PRECISION_SINGLE))
+                    .addOffset(5, new ArrayList<FlatBuffers.Table>()));
+        }
+        return new FlatBuffers.Table().addShort(0, 0).addOffset(1, fields);
+    }
+
+    private static FlatBuffers.Table message(byte headerType, FlatBuffers.Table header, long bodyLength) {
+        return new FlatBuffers.Table()
+                .addShort(0, METADATA_V5)
+                .addByte(1, headerType)
+                .addOffset(2, header)
+                .addLong(3, bodyLength);
+    }
+
+    private static ByteBuffer littleEndian(int capacity) {
+        return ByteBuffer.allocate(capacity).order(ByteOrder.LITTLE_ENDIAN);
+    }
+
+    private static long pad8(long length) {
+        return (length + 7) & ~7L;
+    }
+
+    /**
+     * Writes encapsulated messages and tracks the byte position for the footer.
+     */
+    private static final class Writer {
+
+        private final WritableByteChannel out;
+        private final ByteBuffer chunk = ByteBuffer.allocateDirect(WRITE_CHUNK_BYTES).order(ByteOrder.LITTLE_ENDIAN);
+        private long position;
+
+        Writer(WritableByteChannel out) {
+            this.out = out;
+        }
+
+        void write(ByteBuffer buffer) throws IOException {
+            while (buffer.hasRemaining()) {
+                position += out.write(buffer);
+            }
+        }
+
+        /**
+         * Writes a message and returns the length of its metadata including the prefix.
+         */
+        int writeMessage(byte[] metadata) throws IOException {
+            write(littleEndian(8).putInt(CONTINUATION).putInt(metadata.length).flip());
+            write(ByteBuffer.wrap(metadata));
+            return 8 + metadata.length;
+        }
+
+        /**
+         * Writes one record batch.
+         *
+         * @return the footer block: offset, metadata length, body length
+         */
+        long[] writeBatch(long[] timestamps, float[][] values, int start, int rows) throws IOException {
+            int columns = values.length + 1;
+            ByteBuffer nodes = littleEndian(columns * 16);
+            ByteBuffer buffers = littleEndian(columns * 32);
+            long bodyOffset = 0;
+            for (int c = 0; c < columns; c++) {
+                long length = (long) rows * (c == 0 ? 8 : 4);
+                nodes.putLong(rows).putLong(0);
+                buffers.putLong(bodyOffset).putLong(0);
+                buffers.putLong(bodyOffset).putLong(length);
+                bodyOffset += pad8(length);
+            }
+
+            FlatBuffers.Table batch = new FlatBuffers.Table()
+                    .addLong(0, rows)
+                    .addOffset(1, new FlatBuffers.StructVector(columns, nodes.array()))
+                    .addOffset(2, new FlatBuffers.StructVector(columns * 2, buffers.array()));
+            long offset = position;
+            int metaLength = writeMessage(FlatBuffers.finish(message(HEADER_RECORD_BATCH, batch, bodyOffset)));
+
+            // Body: timestamps, then each value column, each padded to 8 bytes
+            int perChunk = WRITE_CHUNK_BYTES / 8;
+            for (int i = 0; i < rows; i += perChunk) {
+                int n = Math.min(perChunk, rows - i);
+                chunk.clear();
+                chunk.asLongBuffer().put(timestamps, start + i, n);
+                chunk.limit(n * 8);
+                write(chunk);
+            }
+            for (float[] column : values) {
+                perChunk = WRITE_CHUNK_BYTES / 4;
+                for (int i = 0; i < rows; i += perChunk) {
+                    int n = Math.min(perChunk, rows - i);
+                    chunk.clear();
+                    chunk.asFloatBuffer().put(column, start + i, n);
+                    chunk.limit(n * 4);
+                    write(chunk);
+                }
+                if ((rows & 1) != 0) {
+                    write(littleEndian(4));
+                }
+            }
+            return new long[] {offset, metaLength, bodyOffset};
+        }
+    }
+
+    // ========== Helpers ==========
+
+    private static boolean hasMagic(ByteBuffer buf, int at) {
+        for (int i = 0; i < MAGIC.length; i++) {
+            if (buf.get(at + i) != MAGIC[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static ByteBuffer readAt(FileChannel channel, long position, int length) throws IOException {
+        if (position < 0 || length < 0 || position + length > channel.size()) {
+            throw new IOException("Truncated Arrow file");
+        }
+        ByteBuffer buffer = littleEndian(length);
+        while (buffer.hasRemaining()) {
+            if (channel.read(buffer, position + buffer.position()) < 0) {
+                throw new IOException("Truncated Arrow file");
+            }
+        }
+        return buffer.flip();
+    }
+
+    /**
+     * Reads exactly {@code length} bytes, or returns null at a clean end of stream.
+     */
+    private static ByteBuffer readFully(ReadableByteChannel in, int length) throws IOException {
+        ByteBuffer buffer = littleEndian(length);
+        while (buffer.hasRemaining()) {
+            if (in.read(buffer) < 0) {
+                if (buffer.position() == 0) {
+                    return null;
+                }
+                throw new IOException("Truncated Arrow stream");
+            }
+        }
+        return buffer.flip();
+    }
+
+    private static long[] trim(long[] array, int length) {
+        return array.length == length ? array : Arrays.copyOf(array, length);
+    }
+
+    private static float[] trim(float[] array, int length) {
+        return array.length == length ? array : Arrays.copyOf(array, length);
+    }
+
+    /**
+     * Flat schema: per field name, type and the type's width/unit/precision.
+     */
+    private static final class Schema {
+        final int fieldCount;
+        final String[] names;
+        final byte[] types;
+        final int[] bitWidths;
+        final short[] units;
+        final int[] firstBuffer;
+
+        private Schema(int fieldCount) {
+            this.fieldCount = fieldCount;
+            this.names = new String[fieldCount];
+            this.types = new byte[fieldCount];
+            this.bitWidths = new int[fieldCount];
+            this.units = new short[fieldCount];
+            this.firstBuffer = new int[fieldCount];
+        }
+
+        static Schema parse(ByteBuffer buf, int schema) throws IOException {
+            if (schema == 0) {
+                throw new IOException("Missing Arrow schema");
+            }
+            // Endianness: 0 little, 1 big; buffers are always read little-endian
+            if (FlatBuffers.getShort(buf, schema, 0, (short) 0) != 0) {
+                throw new IOException("Big-endian Arrow data is not supported");
+            }
+            int fields = FlatBuffers.child(buf, schema, 1);
+            int count = FlatBuffers.vectorLength(buf, fields);
+            Schema result = new Schema(count);
+            int bufferIndex = 0;
+            for (int f = 0; f < count; f++) {
+                int field = FlatBuffers.tableAt(buf, fields, f);
+                result.names[f] = FlatBuffers.string(buf, FlatBuffers.child(buf, field, 0));
+                byte type = FlatBuffers.getByte(buf, field, 2, (byte) 0);
+                int typeTable = FlatBuffers.child(buf, field, 3);
+                result.types[f] = type;
+
+                if (FlatBuffers.child(buf, field, 4) != 0
+                        || FlatBuffers.vectorLength(buf, FlatBuffers.child(buf, field, 5)) > 0) {
+                    throw new IOException("Dictionary-encoded or nested column '" + result.names[f]
+                            + "' is not supported");
+                }
+                switch (type) {
+                    case TYPE_INT -> result.bitWidths[f] = FlatBuffers.getInt(buf, typeTable, 0, 0);
+                    case TYPE_FLOAT -> result.units[f] = FlatBuffers.getShort(buf, typeTable, 0, (short) 0);
+                    case TYPE_TIMESTAMP -> result.units[f] = FlatBuffers.getShort(buf, typeTable, 0, UNIT_SECOND);
+                    case TYPE_DATE -> result.units[f] = FlatBuffers.getShort(buf, typeTable, 0, UNIT_MILLISECOND);
+                    default -> { }
+                }
+
+                result.firstBuffer[f] = bufferIndex;
+                switch (type) {
+                    case TYPE_INT, TYPE_FLOAT, TYPE_BOOL, TYPE_DECIMAL, TYPE_DATE, TYPE_TIME, TYPE_TIMESTAMP,
+                            TYPE_INTERVAL, TYPE_FIXED_SIZE_BINARY, TYPE_DURATION -> bufferIndex += 2;
+                    case TYPE_BINARY, TYPE_UTF8, TYPE_LARGE_BINARY, TYPE_LARGE_UTF8 -> bufferIndex += 3;
+                    default -> throw new IOException("Unsupported Arrow type " + type
+                            + " in column '" + result.names[f] + "'");
+                }
+            }
+            return result;
+        }
+
+        int indexOf(String name) {
+            for (int f = 0; f < fieldCount; f++) {
+                if (names[f] != null && names[f].equals(name)) {
+                    return f;
+                }
+            }
+            return -1;
+        }
+    }
+
+    /**
+     * Accumulated output columns.
+     */
+    private static final class Columns {
+        long[] timestamps;
+        final float[][] values;
+        int count;
+
+        Columns(int capacity, int valueCount) {
+            this.timestamps = new long[capacity];
+            this.values = new float[valueCount][capacity];
+        }
+
+        void ensureCapacity(int size) {
+            if (size > timestamps.length) {
+                int capacity = Math.max(size, timestamps.length + (timestamps.length >> 1));
+                timestamps = Arrays.copyOf(timestamps, capacity);
+                for (int v = 0; v < values.length; v++) {
+                    values[v] = Arrays.copyOf(values[v], capacity);
+                }
+            }
+        }
+
+        void checkAscending() {
+            for (int i = 1; i < count; i++) {
+                if (timestamps[i] <= timestamps[i - 1]) {
+                    throw new IllegalArgumentException("X-value must be ascending. Last: "
+                            + timestamps[i - 1] + ", given: " + timestamps[i]);
+                }
+            }
+        }
+    }
+}
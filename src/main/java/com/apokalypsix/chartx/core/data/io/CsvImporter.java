@@ -0,0 +1,566 @@
+package com.apokalypsix.chartx.core.data.io;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.data.XyData;
+
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.nio.ByteBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CompletionException;
+import java.util.concurrent.Executor;
+import java.util.concurrent.ForkJoinPool;
+
+/**
+ * Parallel bulk importer for delimited text files.
+ *
+ * <p>The file is split into newline-aligned chunks which are memory-mapped
+ * and parsed concurrently in two passes. The first pass counts the rows of
+ * each chunk, which sizes the output columns and gives every chunk its row
+ * offset. The second pass parses each chunk straight into its slice of the
+ * shared primitive columns, using allocation-free number and
+ * {@link TimestampFormat timestamp} parsers, and the columns are published
+ * with a single {@code loadFromArrays} call. Per-row {@code append} calls,
+ * with their ordering check and listener events, are avoided entirely.
+ *
+ * <p>Rows must be in ascending timestamp order, as required by the data
+ * classes. Blank lines are skipped. Fields may be surrounded by spaces or
+ * double quotes, but quoted fields must not contain the delimiter. An empty
+ * or non-numeric value field becomes {@code Float.NaN}. A row with an
+ * unparseable timestamp or too few fields is an error, unless
+ * {@link #skipMalformed} is set.
+ *
+ * <h2>Usage</h2>
+ * <pre>{@code
+ * OhlcData data = new CsvImporter()
+ *         .header(true)
+ *         .timestampFormat(TimestampFormat.iso())
+ *         .importOhlc(Path.of("es-1m.csv"), "es", "ES 1m");
+ * }</pre>
+ */
+public class CsvImporter {
+
+    /** Nominal chunk size; files are split into at least one chunk per core */
+    private static final long MAX_CHUNK_BYTES = 64L << 20;
+
+    /** Bytes read at a time when aligning chunk boundaries */
+    private static final int ALIGN_PROBE_BYTES = 4096;
+
+    private static final double[] POW10 = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    private byte delimiter = ',';
+    private boolean header;
+    private boolean skipMalformed;
+    private TimestampFormat timestampFormat = TimestampFormat.EPOCH_MILLIS;
+    private int timestampColumn = 0;
+    private int[] ohlcvColumns = {1, 2, 3, 4, 5};
+    private Executor executor = ForkJoinPool.commonPool();
+    private int parallelism = Runtime.getRuntime().availableProcessors();
+
+    // Rows skipped by the last import
+    private volatile long skippedRows;
+
+    /**
+     * Sets the field delimiter (default comma).
+     */
+    public CsvImporter delimiter(char delimiter) {
+        if (delimiter > 0x7F) {
+            throw new IllegalArgumentException("Delimiter must be an ASCII character");
+        }
+        this.delimiter = (byte) delimiter;
+        return this;
+    }
+
+    /**
+     * Sets whether the first line is a header to skip (default false).
+     */
+    public CsvImporter header(boolean header) {
+        this.header = header;
+        return this;
+    }
+
+    /**
+     * Sets whether malformed rows are skipped instead of failing the import
+     * (default false). The count is available from {@link #getSkippedRows()}.
+     */
+    public CsvImporter skipMalformed(boolean skipMalformed) {
+        this.skipMalformed = skipMalformed;
+        return this;
+    }
+
+    /**
+     * Sets the timestamp format (default {@link TimestampFormat#EPOCH_MILLIS}).
+     */
+    public CsvImporter timestampFormat(TimestampFormat format) {
+        this.timestampFormat = format;
+        return this;
+    }
+
+    /**
+     * Sets the zero-based timestamp column (default 0).
+     */
+    public CsvImporter timestampColumn(int column) {
+        this.timestampColumn = column;
+        return this;
+    }
+
+    /**
+     * Sets the zero-based open, high, low, close and volume columns used by
+     * {@link #importOhlc} (default 1 to 5). A negative volume column imports
+     * zero volume.
+     */
+    public CsvImporter ohlcColumns(int open, int high, int low, int close, int volume) {
+        this.ohlcvColumns = new int[] {open, high, low, close, volume};
+        return this;
+    }
+
+    /**
+     * Sets the executor running the chunk parsers (default the common pool)
+     * and the number of chunks to aim for (default one per core).
+     */
+    public CsvImporter executor(Executor executor, int parallelism) {
+        this.executor = executor;
+        this.parallelism = Math.max(1, parallelism);
+        return this;
+    }
+
+    /**
+     * Returns the number of malformed rows skipped by the last import.
+     */
+    public long getSkippedRows() {
+        return skippedRows;
+    }
+
+    // ========== Import ==========
+
+    /**
+     * Imports OHLC bars into new data.
+     *
+     * @throws IOException if the file cannot be read or a row is malformed
+     * @throws IllegalArgumentException if timestamps are not ascending
+     */
+    public OhlcData importOhlc(Path path, String id, String name) throws IOException {
+        OhlcData data = new OhlcData(id, name);
+        importInto(path, data);
+        return data;
+    }
+
+    /**
+     * Replaces the contents of OHLC data with the file's bars.
+     *
+     * @throws IOException if the file cannot be read or a row is malformed
+     * @throws IllegalArgumentException if timestamps are not ascending
+     */
+    public void importInto(Path path, OhlcData data) throws IOException {
+        Columns columns = read(path, ohlcvColumns);
+        float[][] v = columns.values;
+        data.loadFromArrays(columns.timestamps, v[0], v[1], v[2], v[3], v[4]);
+    }
+
+    /**
+     * Imports one value column into new XY data.
+     *
+     * @param valueColumn the zero-based value column
+     * @throws IOException if the file cannot be read or a row is malformed
+     * @throws IllegalArgumentException if timestamps are not ascending
+     */
+    public XyData importXy(Path path, String id, String name, int valueColumn) throws IOException {
+        XyData data = new XyData(id, name);
+        importInto(path, data, valueColumn);
+        return data;
+    }
+
+    /**
+     * Replaces the contents of XY data with one value column of the file.
+     *
+     * @param valueColumn the zero-based value column
+     * @throws IOException if the file cannot be read or a row is malformed
+     * @throws IllegalArgumentException if timestamps are not ascending
+     */
+    public void importInto(Path path, XyData data, int valueColumn) throws IOException {
+        Columns columns = read(path, new int[] {valueColumn});
+        data.loadFromArrays(columns.timestamps, columns.values[0]);
+    }
+
+    /**
+     * Parses all chunks in parallel into columns sized for the whole file.
+     */
+    private Columns read(Path path, int[] valueColumns) throws IOException {
+        // Map field index -> output slot: 0 = timestamp, 1.. = value columns
+        int maxColumn = timestampColumn;
+        for (int column : valueColumns) {
+            maxColumn = Math.max(maxColumn, column);
+        }
+        int[] slots = new int[maxColumn + 1];
+        Arrays.fill(slots, -1);
+        for (int i = 0; i < valueColumns.length; i++) {
+            if (valueColumns[i] >= 0) {
+                slots[valueColumns[i]] = i + 1;
+            }
+        }
+        if (slots[timestampColumn] > 0) {
+            throw new IllegalArgumentException("Timestamp column is also a value column");
+        }
+        slots[timestampColumn] = 0;
+        int requiredFields = maxColumn + 1;
+
+        skippedRows = 0;
+        try (FileChannel channel = FileChannel.open(path, StandardOpenOption.READ)) {
+            long[] bounds = chunkBounds(channel);
+            int chunkCount = bounds.length - 1;
+
+            // Pass 1: map and count the rows of every chunk
+            MappedByteBuffer[] buffers = new MappedByteBuffer[chunkCount];
+            List<CompletableFuture<Integer>> counts = new ArrayList<>(chunkCount);
+            for (int c = 0; c < chunkCount; c++) {
+                int chunk = c;
+                long start = bounds[c];
+                long end = bounds[c + 1];
+                boolean skipFirst = header && c == 0;
+                counts.add(CompletableFuture.supplyAsync(() -> {
+                    try {
+                        buffers[chunk] = channel.map(FileChannel.MapMode.READ_ONLY, start, end - start);
+                        return countRows(buffers[chunk], skipFirst);
+                    } catch (IOException e) {
+                        throw new UncheckedIOException(e);
+                    }
+                }, executor));
+            }
+
+            int[] offsets = new int[chunkCount + 1];
+            for (int c = 0; c < chunkCount; c++) {
+                offsets[c + 1] = offsets[c] + join(counts.get(c));
+            }
+
+            // Pass 2: parse every chunk into its final slice
+            Columns out = new Columns(offsets[chunkCount], valueColumns.length);
+            List<CompletableFuture<Integer>> parsed = new ArrayList<>(chunkCount);
+            for (int c = 0; c < chunkCount; c++) {
+                int chunk = c;
+                boolean skipFirst = header && c == 0;
+                parsed.add(CompletableFuture.supplyAsync(() -> {
+                    try {
+                        return parseChunk(buffers[chunk], bounds[chunk], skipFirst,
+                                slots, requiredFields, out, offsets[chunk]);
+                    } catch (IOException e) {
+                        throw new UncheckedIOException(e);
+                    }
+                }, executor));
+            }
+
+            int[] rows = new int[chunkCount];
+            for (int c = 0; c < chunkCount; c++) {
+                rows[c] = join(parsed.get(c));
+            }
+            finish(out, bounds, offsets, rows);
+            return out;
+        }
+    }
+
+    /**
+     * Splits the file into chunks that each start at a line start.
+     */
+    private long[] chunkBounds(FileChannel channel) throws IOException {
+        long size = channel.size();
+        long chunkCount = Math.max(parallelism, (size + MAX_CHUNK_BYTES - 1) / MAX_CHUNK_BYTES);
+        chunkCount = Math.max(1, Math.min(chunkCount, size / ALIGN_PROBE_BYTES + 1));
+
+        long[] bounds = new long[(int) chunkCount + 1];
+        int count = 1;
+        ByteBuffer probe = ByteBuffer.allocate(ALIGN_PROBE_BYTES);
+        for (int c = 1; c < chunkCount; c++) {
+            long aligned = nextLineStart(channel, size * c / chunkCount, size, probe);
+            if (aligned > bounds[count - 1] && aligned < size) {
+                bounds[count++] = aligned;
+            }
+        }
+        bounds[count++] = size;
+        return Arrays.copyOf(bounds, count);
+    }
+
+    private static long nextLineStart(FileChannel channel, long position, long size, ByteBuffer probe)
+            throws IOException {
+        while (position < size) {
+            probe.clear();
+            int read = channel.read(probe, position);
+            if (read <= 0) {
+                break;
+            }
+            for (int i = 0; i < read; i++) {
+                if (probe.get(i) == '\n') {
+                    return position + i + 1;
+                }
+            }
+            position += read;
+        }
+        return size;
+    }
+
+    private static <T> T join(CompletableFuture<T> future) throws IOException {
+        try {
+            return future.join();
+        } catch (CompletionException e) {
+            Throwable cause = e.getCause();
+            if (cause instanceof UncheckedIOException io) {
+                throw io.getCause();
+            }
+            if (cause instanceof RuntimeException runtime) {
+                throw runtime;
+            }
+            throw e;
+        }
+    }
+
+    /**
+     * Checks the order across chunk boundaries and closes the gaps left by
+     * skipped rows. Without skipped rows the columns are used as parsed.
+     *
+     * @param rows the number of rows parsed by each chunk
+     */
+    private void finish(Columns out, long[] bounds, int[] offsets, int[] rows) {
+        long lastTimestamp = Long.MIN_VALUE;
+        int total = 0;
+        for (int c = 0; c < rows.length; c++) {
+            int offset = offsets[c];
+            int count = rows[c];
+            if (count > 0) {
+                if (out.timestamps[offset] <= lastTimestamp) {
+                    throw new IllegalArgumentException("X-value must be ascending near byte "
+                            + bounds[c] + ". Last: " + lastTimestamp + ", given: " + out.timestamps[offset]);
+                }
+                lastTimestamp = out.timestamps[offset + count - 1];
+            }
+            if (offset != total) {
+                System.arraycopy(out.timestamps, offset, out.timestamps, total, count);
+                for (float[] column : out.values) {
+                    System.arraycopy(column, offset, column, total, count);
+                }
+            }
+            total += count;
+            skippedRows += offsets[c + 1] - offset - count;
+        }
+
+        if (total < out.timestamps.length) {
+            out.trim(total);
+        }
+    }
+
+    // ========== Chunk parsing ==========
+
+    /**
+     * Counts the non-blank lines of a chunk, an upper bound of its rows.
+     */
+    private static int countRows(ByteBuffer buf, boolean skipFirst) {
+        int limit = buf.limit();
+        int pos = skipFirst ? lineEnd(buf, 0, limit) + 1 : 0;
+        int rows = 0;
+        while (pos < limit) {
+            int lineEnd = lineEnd(buf, pos, limit);
+            if (contentEnd(buf, pos, lineEnd) > pos) {
+                rows++;
+            }
+            pos = lineEnd + 1;
+        }
+        return rows;
+    }
+
+    /**
+     * Parses a chunk into the output rows starting at {@code firstRow}.
+     *
+     * @return the number of rows parsed; skipped rows are not counted
+     */
+    private int parseChunk(ByteBuffer buf, long baseOffset, boolean skipFirst,
+                           int[] slots, int requiredFields, Columns out, int firstRow) throws IOException {
+        int limit = buf.limit();
+        int pos = skipFirst ? lineEnd(buf, 0, limit) + 1 : 0;
+        int row = firstRow;
+
+        while (pos < limit) {
+            int lineEnd = lineEnd(buf, pos, limit);
+            int end = contentEnd(buf, pos, lineEnd);
+            if (end > pos) {
+                if (parseRow(buf, pos, end, slots, requiredFields, out, row, firstRow, baseOffset)) {
+                    row++;
+                } else if (!skipMalformed) {
+                    throw new IOException("Malformed row at byte " + (baseOffset + pos));
+                }
+            }
+            pos = lineEnd + 1;
+        }
+        return row - firstRow;
+    }
+
+    private static int lineEnd(ByteBuffer buf, int pos, int limit) {
+        while (pos < limit && buf.get(pos) != '\n') {
+            pos++;
+        }
+        return pos;
+    }
+
+    /**
+     * Returns the end of a line's content, excluding a trailing carriage return.
+     */
+    private static int contentEnd(ByteBuffer buf, int pos, int lineEnd) {
+        return lineEnd > pos && buf.get(lineEnd - 1) == '\r' ? lineEnd - 1 : lineEnd;
+    }
+
+    /**
+     * Parses one row into the given output row.
+     *
+     * @param firstRow the chunk's first output row, which has no predecessor to check against
+     * @return false if the row is malformed
+     */
+    private boolean parseRow(ByteBuffer buf, int start, int end, int[] slots, int requiredFields,
+                             Columns out, int row, int firstRow, long baseOffset) {
+        long timestamp = TimestampFormat.INVALID;
+
+        int field = 0;
+        int fieldStart = start;
+        for (int pos = start; pos <= end && field < requiredFields; pos++) {
+            if (pos < end && buf.get(pos) != delimiter) {
+                continue;
+            }
+            int slot = slots[field];
+            if (slot >= 0) {
+                // Trim spaces and quotes
+                int s = fieldStart;
+                int e = pos;
+                while (s < e && (buf.get(s) == ' ' || buf.get(s) == '"')) s++;
+                while (e > s && (buf.get(e - 1) == ' ' || buf.get(e - 1) == '"')) e--;
+
+                if (slot == 0) {
+                    timestamp = timestampFormat.parse(buf, s, e);
+                } else {
+                    out.values[slot - 1][row] = parseFloat(buf, s, e);
+                }
+            }
+            field++;
+            fieldStart = pos + 1;
+        }
+
+        if (field < requiredFields || timestamp == TimestampFormat.INVALID) {
+            return false;
+        }
+        if (row > firstRow && timestamp <= out.timestamps[row - 1]) {
+            throw new IllegalArgumentException("X-value must be ascending near byte "
+                    + (baseOffset + start) + ". Last: " + out.timestamps[row - 1] + ", given: " + timestamp);
+        }
+        out.timestamps[row] = timestamp;
+        return true;
+    }
+
+    /**
+     * Parses a decimal number without allocation. Precise to float accuracy.
+     *
+     * @return the value, or NaN for empty or non-numeric fields
+     */
+    static float parseFloat(ByteBuffer buf, int start, int end) {
+        int pos = start;
+        boolean negative = false;
+        if (pos < end && (buf.get(pos) == '-' || buf.get(pos) == '+')) {
+            negative = buf.get(pos) == '-';
+            pos++;
+        }
+
+        long mantissa = 0;
+        int significant = 0;
+        int exponent = 0;
+        boolean anyDigit = false;
+
+        while (pos < end) {
+            int d = buf.get(pos) - '0';
+            if (d < 0 || d > 9) break;
+            anyDigit = true;
+            if (significant < 18) {
+                mantissa = mantissa * 10 + d;
+                if (mantissa != 0) significant++;
+            } else {
+                exponent++;
+            }
+            pos++;
+        }
+        if (pos < end && buf.get(pos) == '.') {
+            pos++;
+            while (pos < end) {
+                int d = buf.get(pos) - '0';
+                if (d < 0 || d > 9) break;
+                anyDigit = true;
+                if (significant < 18) {
+                    mantissa = mantissa * 10 + d;
+                    if (mantissa != 0) significant++;
+                    exponent--;
+                }
+                pos++;
+            }
+        }
+        if (!anyDigit) {
+            return Float.NaN;
+        }
+        if (pos < end && (buf.get(pos) == 'e' || buf.get(pos) == 'E')) {
+            pos++;
+            boolean negativeExp = false;
+            if (pos < end && (buf.get(pos) == '-' || buf.get(pos) == '+')) {
+                negativeExp = buf.get(pos) == '-';
+                pos++;
+            }
+            int exp = 0;
+            int expStart = pos;
+            while (pos < end) {
+                int d = buf.get(pos) - '0';
+                if (d < 0 || d > 9) break;
+                exp = Math.min(exp * 10 + d, 1000);
+                pos++;
+            }
+            if (pos == expStart) {
+                return Float.NaN;
+            }
+            exponent += negativeExp ? -exp : exp;
+        }
+        if (pos != end) {
+            return Float.NaN;
+        }
+
+        double value = mantissa;
+        if (exponent > 0) {
+            value *= exponent < POW10.length ? POW10[exponent] : Math.pow(10, exponent);
+        } else if (exponent < 0) {
+            value /= -exponent < POW10.length ? POW10[-exponent] : Math.pow(10, -exponent);
+        }
+        return (float) (negative ? -value : value);
+    }
+
+    /**
+     * Output columns of the whole file, shared by all chunk parsers. Each
+     * chunk writes only its own slice.
+     */
+    private static final class Columns {
+        long[] timestamps;
+        final float[][] values;
+
+        Columns(int rows, int valueCount) {
+            this.timestamps = new long[rows];
+            this.values = new float[valueCount][rows];
+        }
+
+        /**
+         * Shrinks the columns to the given row count. Only needed when
+         * malformed rows were skipped.
+         */
+        void trim(int rows) {
+            timestamps = Arrays.copyOf(timestamps, rows);
+            for (int v = 0; v < values.length; v++) {
+                values[v] = Arrays.copyOf(values[v], rows);
+            }
+        }
+    }
+}
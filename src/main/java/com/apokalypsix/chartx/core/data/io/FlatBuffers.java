@@ -0,0 +1,355 @@
+package com.apokalypsix.chartx.core.data.io;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Minimal FlatBuffers reader and writer for Arrow IPC metadata.
+ *
+ * <p>Only what the Arrow schema, message and footer tables need is supported:
+ * tables with scalar, string, table, table-vector and struct-vector fields.
+ * Readers take absolute positions in a little-endian buffer; offsets and
+ * lengths that point outside it raise {@link IndexOutOfBoundsException}.
+ * The builder writes parents before children, so every unsigned offset
+ * points forward as the format requires.
+ */
+final class FlatBuffers {
+
+    private FlatBuffers() {
+        // Utility class
+    }
+
+    // ========== Reading ==========
+
+    /**
+     * Returns the position of the root table of a buffer starting at {@code base}.
+     */
+    static int root(ByteBuffer buf, int base) {
+        return base + uint32(buf, base);
+    }
+
+    /**
+     * Returns the absolute position of a table field, or 0 if absent.
+     */
+    static int field(ByteBuffer buf, int table, int slot) {
+        // The vtable offset is the one signed offset
+        int vtable = table - buf.getInt(table);
+        int vtableSize = buf.getShort(vtable) & 0xFFFF;
+        int entry = 4 + slot * 2;
+        if (entry >= vtableSize) {
+            return 0;
+        }
+        int offset = buf.getShort(vtable + entry) & 0xFFFF;
+        return offset == 0 ? 0 : table + offset;
+    }
+
+    /**
+     * Follows the offset stored at a field or vector element position.
+     */
+    static int indirect(ByteBuffer buf, int pos) {
+        return pos + uint32(buf, pos);
+    }
+
+    /**
+     * Returns the referenced table, string or vector of a field, or 0 if absent.
+     */
+    static int child(ByteBuffer buf, int table, int slot) {
+        int pos = field(buf, table, slot);
+        return pos == 0 ? 0 : indirect(buf, pos);
+    }
+
+    static byte getByte(ByteBuffer buf, int table, int slot, byte defaultValue) {
+        int pos = field(buf, table, slot);
+        return pos == 0 ? defaultValue : buf.get(pos);
+    }
+
+    static short getShort(ByteBuffer buf, int table, int slot, short defaultValue) {
+        int pos = field(buf, table, slot);
+        return pos == 0 ? defaultValue : buf.getShort(pos);
+    }
+
+    static int getInt(ByteBuffer buf, int table, int slot, int defaultValue) {
+        int pos = field(buf, table, slot);
+        return pos == 0 ? defaultValue : buf.getInt(pos);
+    }
+
+    static long getLong(ByteBuffer buf, int table, int slot, long defaultValue) {
+        int pos = field(buf, table, slot);
+        return pos == 0 ? defaultValue : buf.getLong(pos);
+    }
+
+    /**
+     * Returns the element count of a vector, or 0 for an absent vector.
+     */
+    static int vectorLength(ByteBuffer buf, int vector) {
+        return vector == 0 ? 0 : uint32(buf, vector);
+    }
+
+    /**
+     * Returns the position of the first element of a vector.
+     */
+    static int vectorStart(int vector) {
+        return vector + 4;
+    }
+
+    /**
+     * Returns the position of a table element of a vector of tables.
+     */
+    static int tableAt(ByteBuffer buf, int vector, int index) {
+        return indirect(buf, vectorStart(vector) + index * 4);
+    }
+
+    static String string(ByteBuffer buf, int pos) {
+        if (pos == 0) {
+            return null;
+        }
+        int length = uint32(buf, pos);
+        byte[] bytes = new byte[length];
+        for (int i = 0; i < length; i++) {
+            bytes[i] = buf.get(pos + 4 + i);
+        }
+        return new String(bytes, StandardCharsets.UTF_8);
+    }
+
+    /**
+     * Reads an unsigned 32-bit offset or length. No valid value exceeds the
+     * buffer, so larger ones are rejected instead of wrapping negative.
+     */
+    private static int uint32(ByteBuffer buf, int pos) {
+        long value = buf.getInt(pos) & 0xFFFFFFFFL;
+        if (value > buf.limit()) {
+            throw new IndexOutOfBoundsException("Offset " + value + " at " + pos + " exceeds the buffer");
+        }
+        return (int) value;
+    }
+
+    // ========== Writing ==========
+
+    /**
+     * A table under construction. Fields are added by slot in any order.
+     */
+    static final class Table {
+
+        // Per field: slot, byte size (1, 2, 4 or 8; 0 for an offset) and value
+        private final List<Object[]> fields = new ArrayList<>();
+
+        Table addByte(int slot, int value) {
+            fields.add(new Object[] {slot, 1, (long) value});
+            return this;
+        }
+
+        Table addShort(int slot, int value) {
+            fields.add(new Object[] {slot, 2, (long) value});
+            return this;
+        }
+
+        Table addInt(int slot, int value) {
+            fields.add(new Object[] {slot, 4, (long) value});
+            return this;
+        }
+
+        Table addLong(int slot, long value) {
+            fields.add(new Object[] {slot, 8, value});
+            return this;
+        }
+
+        /**
+         * Adds a reference to a {@link Table}, {@link String},
+         * {@code List<Table>} or {@link StructVector}.
+         */
+        Table addOffset(int slot, Object child) {
+            fields.add(new Object[] {slot, 0, child});
+            return this;
+        }
+    }
+
+    /**
+     * A vector of fixed-size structs, given as raw little-endian bytes.
+     */
+    record StructVector(int count, byte[] bytes) {
+    }
+
+    /**
+     * Serializes a root table.
+     *
+     * @return the buffer bytes, padded to a multiple of 8
+     */
+    static byte[] finish(Table root) {
+        Builder builder = new Builder();
+        builder.putInt(0);
+        int rootPos = builder.write(root);
+        builder.patchOffset(0, rootPos);
+        builder.align(8);
+        return Arrays.copyOf(builder.data, builder.size);
+    }
+
+    private static final class Builder {
+
+        private byte[] data = new byte[256];
+        private int size;
+
+        int write(Object node) {
+            if (node instanceof Table table) {
+                return writeTable(table);
+            }
+            if (node instanceof String string) {
+                return writeString(string);
+            }
+            if (node instanceof StructVector vector) {
+                return writeStructVector(vector);
+            }
+            if (node instanceof List<?> list) {
+                return writeTableVector(list);
+            }
+            throw new IllegalArgumentException("Unsupported node: " + node);
+        }
+
+        private int writeTable(Table table) {
+            // Lay out inline fields by descending size after the 4-byte vtable offset
+            List<Object[]> fields = new ArrayList<>(table.fields);
+            fields.sort((a, b) -> Integer.compare(inlineSize(b), inlineSize(a)));
+            int maxSlot = -1;
+            int[] offsets = new int[fields.size()];
+            int inline = 4;
+            for (int i = 0; i < fields.size(); i++) {
+                int fieldSize = inlineSize(fields.get(i));
+                inline = (inline + fieldSize - 1) / fieldSize * fieldSize;
+                offsets[i] = inline;
+                inline += fieldSize;
+                maxSlot = Math.max(maxSlot, (Integer) fields.get(i)[0]);
+            }
+
+            // Vtable first, then the table 8-aligned after it
+            int vtableSize = 4 + 2 * (maxSlot + 1);
+            align(2);
+            int vtable = size;
+            int[] slotOffsets = new int[maxSlot + 1];
+            for (int i = 0; i < fields.size(); i++) {
+                slotOffsets[(Integer) fields.get(i)[0]] = offsets[i];
+            }
+            putShort(vtableSize);
+            putShort(inline);
+            for (int offset : slotOffsets) {
+                putShort(offset);
+            }
+
+            align(8);
+            int tablePos = size;
+            reserve(inline);
+            putIntAt(tablePos, tablePos - vtable);
+            for (int i = 0; i < fields.size(); i++) {
+                Object[] field = fields.get(i);
+                int fieldSize = (Integer) field[1];
+                if (fieldSize > 0) {
+                    putScalarAt(tablePos + offsets[i], fieldSize, (Long) field[2]);
+                }
+            }
+            size = tablePos + inline;
+
+            // Children after the table so offsets point forward
+            for (int i = 0; i < fields.size(); i++) {
+                Object[] field = fields.get(i);
+                if ((Integer) field[1] == 0) {
+                    int childPos = write(field[2]);
+                    patchOffset(tablePos + offsets[i], childPos);
+                }
+            }
+            return tablePos;
+        }
+
+        private static int inlineSize(Object[] field) {
+            int size = (Integer) field[1];
+            return size == 0 ? 4 : size;
+        }
+
+        private int writeString(String string) {
+            byte[] bytes = string.getBytes(StandardCharsets.UTF_8);
+            align(4);
+            int pos = size;
+            putInt(bytes.length);
+            reserve(bytes.length + 1);
+            System.arraycopy(bytes, 0, data, size, bytes.length);
+            size += bytes.length;
+            data[size++] = 0;
+            return pos;
+        }
+
+        private int writeStructVector(StructVector vector) {
+            // Elements 8-aligned, so the length sits 4 bytes before
+            align(4);
+            if (size % 8 == 0) {
+                putInt(0);
+            }
+            int pos = size;
+            putInt(vector.count());
+            reserve(vector.bytes().length);
+            System.arraycopy(vector.bytes(), 0, data, size, vector.bytes().length);
+            size += vector.bytes().length;
+            return pos;
+        }
+
+        private int writeTableVector(List<?> tables) {
+            align(4);
+            int pos = size;
+            putInt(tables.size());
+            int elements = size;
+            for (int i = 0; i < tables.size(); i++) {
+                putInt(0);
+            }
+            for (int i = 0; i < tables.size(); i++) {
+                int childPos = write(tables.get(i));
+                patchOffset(elements + i * 4, childPos);
+            }
+            return pos;
+        }
+
+        void patchOffset(int at, int target) {
+            putIntAt(at, target - at);
+        }
+
+        void align(int alignment) {
+            int padding = (alignment - size % alignment) % alignment;
+            reserve(padding);
+            size += padding;
+        }
+
+        void putShort(int value) {
+            reserve(2);
+            data[size++] = (byte) value;
+            data[size++] = (byte) (value >> 8);
+        }
+
+        void putInt(int value) {
+            reserve(4);
+            putIntAt(size, value);
+            size += 4;
+        }
+
+        private void putIntAt(int at, int value) {
+            putScalarAt(at, 4, value);
+        }
+
+        private void putScalarAt(int at, int bytes, long value) {
+            for (int i = 0; i < bytes; i++) {
+                data[at + i] = (byte) (value >> (8 * i));
+            }
+        }
+
+        private void reserve(int bytes) {
+            if (size + bytes > data.length) {
+                data = Arrays.copyOf(data, Math.max(size + bytes, data.length * 2));
+            }
+        }
+    }
+
+    /**
+     * Wraps bytes as a little-endian buffer for the readers.
+     */
+    static ByteBuffer wrap(byte[] bytes) {
+        return ByteBuffer.wrap(bytes).order(ByteOrder.LITTLE_ENDIAN);
+    }
+}
@@ -0,0 +1,352 @@
+package com.apokalypsix.chartx.core.data.io;
+
+import java.nio.ByteBuffer;
+import java.time.ZoneOffset;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Allocation-free timestamp parser for ASCII text fields.
+ *
+ * <p>Parses bytes straight from a (typically memory-mapped) buffer into epoch
+ * milliseconds, without creating strings or {@code java.time} objects, so it
+ * can run once per row on hundreds of millions of rows. Instances are
+ * immutable and thread-safe.
+ *
+ * <p>Supported formats:
+ * <ul>
+ *   <li>{@link #EPOCH_MILLIS} - integer milliseconds</li>
+ *   <li>{@link #EPOCH_SECONDS} - seconds, optionally with a fraction</li>
+ *   <li>{@link #iso()} - ISO 8601 {@code yyyy-MM-dd[(T| )HH:mm[:ss[.f]]][Z|±HH[:]mm]}</li>
+ *   <li>{@link #pattern(String)} - fixed-width patterns built from {@code yyyy},
+ *       {@code MM}, {@code dd}, {@code HH}, {@code mm}, {@code ss},
+ *       {@code S..S} and literal characters, e.g. {@code "dd.MM.yyyy HH:mm"}</li>
+ * </ul>
+ */
+public abstract class TimestampFormat {
+
+    /** Returned by {@link #parse} for fields that do not match the format */
+    public static final long INVALID = Long.MIN_VALUE;
+
+    private static final long MILLIS_PER_DAY = 86_400_000L;
+
+    /** Integer epoch milliseconds */
+    public static final TimestampFormat EPOCH_MILLIS = new TimestampFormat() {
+        @Override
+        public long parse(ByteBuffer buf, int start, int end) {
+            return parseEpoch(buf, start, end, 1);
+        }
+    };
+
+    /** Epoch seconds with an optional fraction */
+    public static final TimestampFormat EPOCH_SECONDS = new TimestampFormat() {
+        @Override
+        public long parse(ByteBuffer buf, int start, int end) {
+            return parseEpoch(buf, start, end, 1000);
+        }
+    };
+
+    /**
+     * Parses the field {@code [start, end)} of the buffer using absolute gets.
+     *
+     * @return epoch milliseconds, or {@link #INVALID}
+     */
+    public abstract long parse(ByteBuffer buf, int start, int end);
+
+    /**
+     * Returns the ISO 8601 format, reading timestamps without an offset as UTC.
+     */
+    public static TimestampFormat iso() {
+        return iso(ZoneOffset.UTC);
+    }
+
+    /**
+     * Returns the ISO 8601 format.
+     *
+     * @param defaultOffset offset of timestamps that do not specify one
+     */
+    public static TimestampFormat iso(ZoneOffset defaultOffset) {
+        return new Iso(defaultOffset.getTotalSeconds() * 1000L);
+    }
+
+    /**
+     * Returns a fixed-width pattern format reading timestamps as UTC.
+     *
+     * @param pattern the pattern, e.g. {@code "yyyyMMdd HHmmss"}
+     * @throws IllegalArgumentException if the pattern has no year, month and day
+     */
+    public static TimestampFormat pattern(String pattern) {
+        return pattern(pattern, ZoneOffset.UTC);
+    }
+
+    /**
+     * Returns a fixed-width pattern format.
+     *
+     * @param pattern the pattern, e.g. {@code "dd/MM/yyyy HH:mm:ss.SSS"}
+     * @param offset offset of the parsed local times
+     * @throws IllegalArgumentException if the pattern has no year, month and day
+     */
+    public static TimestampFormat pattern(String pattern, ZoneOffset offset) {
+        return new Pattern(pattern, offset.getTotalSeconds() * 1000L);
+    }
+
+    // ========== Implementations ==========
+
+    private static long parseEpoch(ByteBuffer buf, int start, int end, long unitMillis) {
+        if (start >= end) {
+            return INVALID;
+        }
+        boolean negative = buf.get(start) == '-';
+        int pos = negative ? start + 1 : start;
+        long value = 0;
+        int digits = 0;
+        while (pos < end) {
+            int d = buf.get(pos) - '0';
+            if (d < 0 || d > 9) {
+                break;
+            }
+            value = value * 10 + d;
+            digits++;
+            pos++;
+        }
+        if (digits == 0 || digits > 18) {
+            return INVALID;
+        }
+        long millis = value * unitMillis;
+
+        // Fractional seconds
+        if (pos < end && buf.get(pos) == '.' && unitMillis > 1) {
+            pos++;
+            long scale = unitMillis / 10;
+            while (pos < end) {
+                int d = buf.get(pos) - '0';
+                if (d < 0 || d > 9) {
+                    return INVALID;
+                }
+                millis += d * scale;
+                scale /= 10;
+                pos++;
+            }
+        }
+        if (pos != end) {
+            return INVALID;
+        }
+        return negative ? -millis : millis;
+    }
+
+    /**
+     * Reads {@code count} digits at {@code pos}, or returns -1.
+     */
+    private static int digits(ByteBuffer buf, int pos, int count, int end) {
+        if (pos + count > end) {
+            return -1;
+        }
+        int value = 0;
+        for (int i = 0; i < count; i++) {
+            int d = buf.get(pos + i) - '0';
+            if (d < 0 || d > 9) {
+                return -1;
+            }
+            value = value * 10 + d;
+        }
+        return value;
+    }
+
+    /**
+     * Converts a date and time of day to epoch milliseconds.
+     */
+    static long toEpochMillis(int year, int month, int day, int hour, int minute, int second, int millis) {
+        if (month < 1 || month > 12 || day < 1 || day > 31
+                || hour > 23 || minute > 59 || second > 60) {
+            return INVALID;
+        }
+        return daysFromCivil(year, month, day) * MILLIS_PER_DAY
+                + hour * 3_600_000L + minute * 60_000L + second * 1000L + millis;
+    }
+
+    /**
+     * Days since 1970-01-01 of a proleptic Gregorian date.
+     */
+    private static long daysFromCivil(int year, int month, int day) {
+        int y = month <= 2 ? year - 1 : year;
+        int era = Math.floorDiv(y, 400);
+        int yoe = y - era * 400;
+        int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146_097L + doe - 719_468L;
+    }
+
+    private static final class Iso extends TimestampFormat {
+
+        private final long defaultOffsetMillis;
+
+        Iso(long defaultOffsetMillis) {
+            this.defaultOffsetMillis = defaultOffsetMillis;
+        }
+
+        @Override
+        public long parse(ByteBuffer buf, int start, int end) {
+            int year = digits(buf, start, 4, end);
+            int month = digits(buf, start + 5, 2, end);
+            int day = digits(buf, start + 8, 2, end);
+            if (year < 0 || month < 0 || day < 0
+                    || buf.get(start + 4) != '-' || buf.get(start + 7) != '-') {
+                return INVALID;
+            }
+
+            int pos = start + 10;
+            int hour = 0, minute = 0, second = 0, millis = 0;
+            if (pos < end && (buf.get(pos) == 'T' || buf.get(pos) == ' ')) {
+                hour = digits(buf, pos + 1, 2, end);
+                minute = digits(buf, pos + 4, 2, end);
+                if (hour < 0 || minute < 0 || buf.get(pos + 3) != ':') {
+                    return INVALID;
+                }
+                pos += 6;
+                if (pos < end && buf.get(pos) == ':') {
+                    second = digits(buf, pos + 1, 2, end);
+                    if (second < 0) {
+                        return INVALID;
+                    }
+                    pos += 3;
+                    if (pos < end && (buf.get(pos) == '.' || buf.get(pos) == ',')) {
+                        pos++;
+                        int scale = 100;
+                        while (pos < end) {
+                            int d = buf.get(pos) - '0';
+                            if (d < 0 || d > 9) {
+                                break;
+                            }
+                            millis += d * scale;
+                            scale /= 10;
+                            pos++;
+                        }
+                    }
+                }
+            }
+
+            long offsetMillis = defaultOffsetMillis;
+            if (pos < end) {
+                byte c = buf.get(pos);
+                if (c == 'Z' && pos + 1 == end) {
+                    offsetMillis = 0;
+                } else if (c == '+' || c == '-') {
+                    int oh = digits(buf, pos + 1, 2, end);
+                    int mPos = pos + 3 < end && buf.get(pos + 3) == ':' ? pos + 4 : pos + 3;
+                    int om = mPos < end ? digits(buf, mPos, 2, end) : 0;
+                    int zoneEnd = mPos < end ? mPos + 2 : mPos;
+                    if (oh < 0 || om < 0 || zoneEnd != end) {
+                        return INVALID;
+                    }
+                    offsetMillis = (oh * 60L + om) * 60_000L * (c == '-' ? -1 : 1);
+                } else {
+                    return INVALID;
+                }
+            }
+
+            long local = toEpochMillis(year, month, day, hour, minute, second, millis);
+            return local == INVALID ? INVALID : local - offsetMillis;
+        }
+    }
+
+    private static final class Pattern extends TimestampFormat {
+
+        private static final int YEAR = 0, MONTH = 1, DAY = 2, HOUR = 3, MINUTE = 4, SECOND = 5,
+                FRACTION = 6, LITERAL = 7;
+
+        // Parallel token arrays: kind, width and literal byte
+        private final int[] kinds;
+        private final int[] widths;
+        private final byte[] literals;
+        private final int length;
+        private final long offsetMillis;
+
+        Pattern(String pattern, long offsetMillis) {
+            this.offsetMillis = offsetMillis;
+            List<int[]> tokens = new ArrayList<>();
+            int seen = 0;
+            int i = 0;
+            while (i < pattern.length()) {
+                char c = pattern.charAt(i);
+                int run = 1;
+                while (i + run < pattern.length() && pattern.charAt(i + run) == c) {
+                    run++;
+                }
+                int kind = switch (c) {
+                    case 'y' -> YEAR;
+                    case 'M' -> MONTH;
+                    case 'd' -> DAY;
+                    case 'H' -> HOUR;
+                    case 'm' -> MINUTE;
+                    case 's' -> SECOND;
+                    case 'S' -> FRACTION;
+                    default -> LITERAL;
+                };
+                if (kind == LITERAL) {
+                    for (int k = 0; k < run; k++) {
+                        tokens.add(new int[] {LITERAL, 1, c});
+                    }
+                } else {
+                    if ((kind == YEAR && run != 4) || (kind < FRACTION && kind != YEAR && run != 2)) {
+                        throw new IllegalArgumentException("Unsupported field width in pattern: " + pattern);
+                    }
+                    tokens.add(new int[] {kind, run, 0});
+                    seen |= 1 << kind;
+                }
+                i += run;
+            }
+            if ((seen & 0b111) != 0b111) {
+                throw new IllegalArgumentException("Pattern needs yyyy, MM and dd: " + pattern);
+            }
+
+            int n = tokens.size();
+            this.kinds = new int[n];
+            this.widths = new int[n];
+            this.literals = new byte[n];
+            int total = 0;
+            for (int t = 0; t < n; t++) {
+                int[] token = tokens.get(t);
+                kinds[t] = token[0];
+                widths[t] = token[1];
+                literals[t] = (byte) token[2];
+                total += token[1];
+            }
+            this.length = total;
+        }
+
+        @Override
+        public long parse(ByteBuffer buf, int start, int end) {
+            if (end - start != length) {
+                return INVALID;
+            }
+            int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0, millis = 0;
+            int pos = start;
+            for (int t = 0; t < kinds.length; t++) {
+                int width = widths[t];
+                if (kinds[t] == LITERAL) {
+                    if (buf.get(pos) != literals[t]) {
+                        return INVALID;
+                    }
+                } else {
+                    // Fractions beyond milliseconds are truncated
+                    int value = digits(buf, pos, kinds[t] == FRACTION ? Math.min(width, 3) : width, end);
+                    if (value < 0) {
+                        return INVALID;
+                    }
+                    switch (kinds[t]) {
+                        case YEAR -> year = value;
+                        case MONTH -> month = value;
+                        case DAY -> day = value;
+                        case HOUR -> hour = value;
+                        case MINUTE -> minute = value;
+                        case SECOND -> second = value;
+                        default -> millis = width == 1 ? value * 100 : width == 2 ? value * 10 : value;
+                    }
+                }
+                pos += width;
+            }
+            long local = toEpochMillis(year, month, day, hour, minute, second, millis);
+            return local == INVALID ? INVALID : local - offsetMillis;
+        }
+    }
+}
@@ -0,0 +1,196 @@
+package com.apokalypsix.chartx.core.data.paged;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+
+/**
+ * Page loader reading a local binary file, mainly for testing paged data
+ * without a history server.
+ *
+ * <p>File layout (big-endian): a 16-byte header of magic {@code "CXPG"},
+ * format version, bar count and page size, followed by one 28-byte record per
+ * bar: timestamp (long), open, high, low, close, volume (floats). Pages are
+ * read with positional reads on a small daemon thread pool, so several pages
+ * can load concurrently. Files are written with {@link #write}.
+ */
+public class FilePageLoader implements PageLoader, AutoCloseable {
+
+    private static final int MAGIC = 0x43585047; // "CXPG"
+    private static final int VERSION = 1;
+    private static final int HEADER_BYTES = 16;
+    private static final int RECORD_BYTES = Long.BYTES + 5 * Float.BYTES;
+
+    private final FileChannel channel;
+    private final int barCount;
+    private final int pageSize;
+    private final long[] pageStartTimes;
+    private final ExecutorService executor;
+
+    /**
+     * Opens a page file.
+     *
+     * @param path the file written by {@link #write}
+     * @throws IOException if the file cannot be read or has the wrong format
+     */
+    public FilePageLoader(Path path) throws IOException {
+        this.channel = FileChannel.open(path, StandardOpenOption.READ);
+        try {
+            ByteBuffer header = ByteBuffer.allocate(HEADER_BYTES);
+            readFully(header, 0);
+            header.flip();
+            if (header.getInt() != MAGIC || header.getInt() != VERSION) {
+                throw new IOException("Not a ChartX page file: " + path);
+            }
+            this.barCount = header.getInt();
+            this.pageSize = header.getInt();
+            if (barCount < 0 || pageSize < 1
+                    || channel.size() < HEADER_BYTES + (long) barCount * RECORD_BYTES) {
+                throw new IOException("Corrupt page file: " + path);
+            }
+
+            // Read the first timestamp of every page
+            int pageCount = (barCount + pageSize - 1) / pageSize;
+            this.pageStartTimes = new long[pageCount];
+            ByteBuffer timestamp = ByteBuffer.allocate(Long.BYTES);
+            for (int p = 0; p < pageCount; p++) {
+                timestamp.clear();
+                readFully(timestamp, recordOffset((long) p * pageSize));
+                pageStartTimes[p] = timestamp.getLong(0);
+            }
+        } catch (IOException e) {
+            channel.close();
+            throw e;
+        }
+
+        this.executor = Executors.newFixedThreadPool(2, r -> {
+            Thread t = new Thread(r, "FilePageLoader");
+            t.setDaemon(true);
+            return t;
+        });
+    }
+
+    @Override
+    public int getPageSize() {
+        return pageSize;
+    }
+
+    @Override
+    public int getBarCount() {
+        return barCount;
+    }
+
+    @Override
+    public long getPageStartTime(int page) {
+        return pageStartTimes[page];
+    }
+
+    @Override
+    public CompletableFuture<OhlcPage> loadPage(int page) {
+        return CompletableFuture.supplyAsync(() -> {
+            try {
+                return readPage(page);
+            } catch (IOException e) {
+                throw new UncheckedIOException(e);
+            }
+        }, executor);
+    }
+
+    private OhlcPage readPage(int page) throws IOException {
+        int first = page * pageSize;
+        int count = Math.min(pageSize, barCount - first);
+        ByteBuffer buffer = ByteBuffer.allocate(count * RECORD_BYTES);
+        readFully(buffer, recordOffset(first));
+        buffer.flip();
+
+        long[] timestamps = new long[count];
+        float[] open = new float[count];
+        float[] high = new float[count];
+        float[] low = new float[count];
+        float[] close = new float[count];
+        float[] volume = new float[count];
+        for (int i = 0; i < count; i++) {
+            timestamps[i] = buffer.getLong();
+            open[i] = buffer.getFloat();
+            high[i] = buffer.getFloat();
+            low[i] = buffer.getFloat();
+            close[i] = buffer.getFloat();
+            volume[i] = buffer.getFloat();
+        }
+        return new OhlcPage(page, timestamps, open, high, low, close, volume);
+    }
+
+    private void readFully(ByteBuffer buffer, long position) throws IOException {
+        while (buffer.hasRemaining()) {
+            int read = channel.read(buffer, position);
+            if (read < 0) {
+                throw new IOException("Unexpected end of page file");
+            }
+            position += read;
+        }
+    }
+
+    private static long recordOffset(long bar) {
+        return HEADER_BYTES + bar * RECORD_BYTES;
+    }
+
+    /**
+     * Stops the loader threads and closes the file.
+     */
+    @Override
+    public void close() throws IOException {
+        executor.shutdownNow();
+        channel.close();
+    }
+
+    /**
+     * Writes OHLC data to a page file.
+     *
+     * @param path the file to create or replace
+     * @param data the bars to write
+     * @param pageSize bars per page
+     * @throws IOException if the file cannot be written
+     */
+    public static void write(Path path, OhlcData data, int pageSize) throws IOException {
+        if (pageSize < 1) {
+            throw new IllegalArgumentException("Page size must be at least 1");
+        }
+        try (FileChannel out = FileChannel.open(path, StandardOpenOption.CREATE,
+                StandardOpenOption.WRITE, StandardOpenOption.TRUNCATE_EXISTING)) {
+            ByteBuffer buffer = ByteBuffer.allocate(Math.max(HEADER_BYTES, 4096 * RECORD_BYTES));
+            buffer.putInt(MAGIC).putInt(VERSION).putInt(data.size()).putInt(pageSize);
+
+            long[] timestamps = data.getTimestampsArray();
+            float[] open = data.getOpenArray();
+            float[] high = data.getHighArray();
+            float[] low = data.getLowArray();
+            float[] close = data.getCloseArray();
+            float[] volume = data.getVolumeArray();
+            for (int i = 0; i < data.size(); i++) {
+                if (buffer.remaining() < RECORD_BYTES) {
+                    drain(out, buffer);
+                }
+                buffer.putLong(timestamps[i])
+                        .putFloat(open[i]).putFloat(high[i]).putFloat(low[i])
+                        .putFloat(close[i]).putFloat(volume[i]);
+            }
+            drain(out, buffer);
+        }
+    }
+
+    private static void drain(FileChannel out, ByteBuffer buffer) throws IOException {
+        buffer.flip();
+        while (buffer.hasRemaining()) {
+            out.write(buffer);
+        }
+        buffer.clear();
+    }
+}
@@ -0,0 +1,34 @@
+package com.apokalypsix.chartx.core.data.paged;
+
+/**
+ * One page of OHLC bars as delivered by a {@link PageLoader}.
+ *
+ * <p>Arrays are owned by the page and must not be modified after it is
+ * handed to the data source. All arrays have the same length and timestamps
+ * are ascending.
+ *
+ * @param page index of the page
+ * @param timestamps bar timestamps in epoch milliseconds
+ * @param open open prices
+ * @param high high prices
+ * @param low low prices
+ * @param close close prices
+ * @param volume volumes
+ */
+public record OhlcPage(int page, long[] timestamps, float[] open, float[] high,
+                       float[] low, float[] close, float[] volume) {
+
+    /**
+     * Returns the number of bars in the page.
+     */
+    public int size() {
+        return timestamps.length;
+    }
+
+    /**
+     * Returns the approximate heap footprint of the page's columns in bytes.
+     */
+    public long byteSize() {
+        return (long) timestamps.length * (Long.BYTES + 5 * Float.BYTES);
+    }
+}
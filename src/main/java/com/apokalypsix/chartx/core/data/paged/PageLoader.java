@@ -0,0 +1,58 @@
+package com.apokalypsix.chartx.core.data.paged;
+
+import java.util.concurrent.CompletableFuture;
+
+/**
+ * Asynchronous source of fixed-size pages of OHLC bars.
+ *
+ * <p>Page {@code p} holds bars {@code [p * pageSize, (p + 1) * pageSize)} of
+ * the full history; only the last page may be shorter. The loader must know
+ * the first timestamp of every page up front so that time ranges can be
+ * mapped to pages without loading them.
+ *
+ * @see FilePageLoader
+ */
+public interface PageLoader {
+
+    /**
+     * Returns the number of bars per page.
+     */
+    int getPageSize();
+
+    /**
+     * Returns the total number of bars across all pages.
+     */
+    int getBarCount();
+
+    /**
+     * Returns the number of pages.
+     */
+    default int getPageCount() {
+        return (getBarCount() + getPageSize() - 1) / getPageSize();
+    }
+
+    /**
+     * Returns the timestamp of the first bar of the given page.
+     */
+    long getPageStartTime(int page);
+
+    /**
+     * Starts loading a page. The future may complete on any thread.
+     *
+     * @param page the page index
+     * @return future completing with the page, or exceptionally on I/O failure
+     */
+    CompletableFuture<OhlcPage> loadPage(int page);
+
+    /**
+     * Loads a coarse overview with one summary bar per page (first open,
+     * highest high, lowest low, last close, total volume), used as a
+     * placeholder for pages that are not resident.
+     *
+     * @return future completing with the overview, or with null if the
+     *         loader cannot provide one
+     */
+    default CompletableFuture<OhlcPage> loadOverview() {
+        return CompletableFuture.completedFuture(null);
+    }
+}
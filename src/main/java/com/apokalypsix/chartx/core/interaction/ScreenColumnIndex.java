@@ -0,0 +1,199 @@
+package com.apokalypsix.chartx.core.interaction;
+
+import java.util.Arrays;
+
+import com.apokalypsix.chartx.chart.axis.Viewport;
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.chart.data.DataListener;
+import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+
+/**
+ * Maps each pixel column of the chart area to the nearest data index of a series.
+ *
+ * <p>Hover handling resolves the data point under the cursor on every mouse
+ * move. Instead of converting the cursor to an x-value and binary searching
+ * the series each time, the mapping for the whole chart width is built once
+ * per viewport/data change in a single merge pass over the visible points,
+ * and each lookup is then an array read.
+ *
+ * <p>The index tracks its series through a data listener: any append, update
+ * or clear bumps {@link #getDataVersion()} and forces a rebuild on the next
+ * {@link #update}. Bulk loads, which don't notify listeners, are caught
+ * through {@link Data#getLoadCount()}. Positions outside the chart area fall back to a binary
+ * search so results match {@link #nearestIndex(Data, long)} everywhere.
+ */
+public class ScreenColumnIndex {
+
+    private Data<?> data;
+
+    // Nearest data index for each column, relative to chartLeft
+    private int[] columns = new int[0];
+    private int chartLeft;
+    private int columnCount;
+
+    // Viewport state the columns were built for
+    private boolean valid;
+    private long builtStartTime;
+    private long builtEndTime;
+    private int builtVersion;
+
+    private volatile int dataVersion;
+
+    private final DataListener dataListener = new DataListener() {
+        @Override
+        public void onDataAppended(Data<?> data, int newIndex) {
+            dataVersion++;
+        }
+
+        @Override
+        public void onDataUpdated(Data<?> data, int index) {
+            dataVersion++;
+        }
+
+        @Override
+        public void onDataCleared(Data<?> data) {
+            dataVersion++;
+        }
+    };
+
+    /**
+     * Starts tracking the given series, discarding the current mapping.
+     *
+     * @param data the series to index, or null to stop tracking
+     */
+    public void attach(Data<?> data) {
+        if (this.data == data) {
+            return;
+        }
+        detach();
+        this.data = data;
+        if (data != null) {
+            data.addListener(dataListener);
+        }
+        valid = false;
+    }
+
+    /**
+     * Stops tracking the current series.
+     */
+    public void detach() {
+        if (data != null) {
+            data.removeListener(dataListener);
+            data = null;
+        }
+        valid = false;
+    }
+
+    /**
+     * Returns the tracked series.
+     */
+    public Data<?> getData() {
+        return data;
+    }
+
+    /**
+     * Returns a counter that changes whenever the tracked series changes,
+     * including bulk loads.
+     */
+    public int getDataVersion() {
+        Data<?> tracked = data;
+        // Both counters only grow, so their sum changes when either does
+        return tracked != null ? dataVersion + tracked.getLoadCount() : dataVersion;
+    }
+
+    /**
+     * Rebuilds the column mapping if the viewport or the series changed.
+     *
+     * @param coords the coordinate system
+     * @param viewport the viewport
+     */
+    public void update(CoordinateSystem coords, Viewport viewport) {
+        if (data == null || coords == null || viewport == null) {
+            valid = false;
+            return;
+        }
+
+        int left = viewport.getLeftInset();
+        int count = Math.max(0, viewport.getWidth() - viewport.getRightInset() - left);
+        int version = getDataVersion();
+        if (valid
+                && builtVersion == version
+                && builtStartTime == viewport.getStartTime()
+                && builtEndTime == viewport.getEndTime()
+                && chartLeft == left
+                && columnCount == count) {
+            return;
+        }
+
+        if (columns.length < count) {
+            columns = new int[count];
+        }
+        chartLeft = left;
+        columnCount = count;
+        builtVersion = version;
+        builtStartTime = viewport.getStartTime();
+        builtEndTime = viewport.getEndTime();
+        valid = true;
+
+        int size = data.size();
+        if (size == 0 || count == 0) {
+            Arrays.fill(columns, 0, count, -1);
+            return;
+        }
+
+        // Columns map to increasing x-values, so walk the series once
+        int idx = Math.max(0, data.indexAtOrBefore(coords.screenXToXValue(left)));
+        for (int c = 0; c < count; c++) {
+            long xValue = coords.screenXToXValue(left + c);
+            while (idx + 1 < size && data.getXValue(idx + 1) <= xValue) {
+                idx++;
+            }
+            int nearest = idx;
+            if (idx + 1 < size
+                    && Math.abs(xValue - data.getXValue(idx + 1)) < Math.abs(xValue - data.getXValue(idx))) {
+                nearest = idx + 1;
+            }
+            columns[c] = nearest;
+        }
+    }
+
+    /**
+     * Returns the data index nearest to a screen x-coordinate.
+     *
+     * <p>Call {@link #update} first in the current frame/event.
+     *
+     * @param screenX the screen x-coordinate
+     * @param coords the coordinate system, used outside the chart area
+     * @return the nearest index, or -1 if the series is empty
+     */
+    public int indexAt(int screenX, CoordinateSystem coords) {
+        if (data == null) {
+            return -1;
+        }
+        int column = screenX - chartLeft;
+        if (valid && column >= 0 && column < columnCount) {
+            return columns[column];
+        }
+        return coords != null ? nearestIndex(data, coords.screenXToXValue(screenX)) : -1;
+    }
+
+    /**
+     * Returns the index whose x-value is nearest to the given value.
+     *
+     * @param data the series
+     * @param xValue the x-value
+     * @return the nearest index, or -1 if the series is empty
+     */
+    public static int nearestIndex(Data<?> data, long xValue) {
+        int size = data.size();
+        if (size == 0) {
+            return -1;
+        }
+        int idx = Math.max(0, data.indexAtOrBefore(xValue));
+        if (idx < size - 1
+                && Math.abs(xValue - data.getXValue(idx + 1)) < Math.abs(xValue - data.getXValue(idx))) {
+            idx++;
+        }
+        return idx;
+    }
+}
@@ -0,0 +1,80 @@
+package com.apokalypsix.chartx.core.overlay;
+
+import com.apokalypsix.chartx.chart.overlay.Drawing;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * Changes emitted by an {@link AnnotationGenerator} for a data update.
+ *
+ * <p>Added drawings are new; updated drawings were previously emitted by the
+ * same generator and have been modified in place; removed drawings were
+ * previously emitted and are no longer valid. A drawing appears in at most
+ * one of the three lists.
+ */
+public final class AnnotationDelta {
+
+    private final List<Drawing> added = new ArrayList<>();
+    private final List<Drawing> updated = new ArrayList<>();
+    private final List<Drawing> removed = new ArrayList<>();
+
+    /**
+     * Records a new drawing.
+     */
+    public void add(Drawing drawing) {
+        added.add(drawing);
+    }
+
+    /**
+     * Records a previously emitted drawing that was modified in place.
+     */
+    public void update(Drawing drawing) {
+        updated.add(drawing);
+    }
+
+    /**
+     * Records a previously emitted drawing that should be removed.
+     */
+    public void remove(Drawing drawing) {
+        removed.add(drawing);
+    }
+
+    /**
+     * Returns the added drawings.
+     */
+    public List<Drawing> getAdded() {
+        return Collections.unmodifiableList(added);
+    }
+
+    /**
+     * Returns the drawings modified in place.
+     */
+    public List<Drawing> getUpdated() {
+        return Collections.unmodifiableList(updated);
+    }
+
+    /**
+     * Returns the removed drawings.
+     */
+    public List<Drawing> getRemoved() {
+        return Collections.unmodifiableList(removed);
+    }
+
+    /**
+     * Returns true if no changes were recorded.
+     */
+    public boolean isEmpty() {
+        return added.isEmpty() && updated.isEmpty() && removed.isEmpty();
+    }
+
+    /**
+     * Discards all recorded changes so the delta can be reused.
+     */
+    public void clear() {
+        added.clear();
+        updated.clear();
+        removed.clear();
+    }
+}
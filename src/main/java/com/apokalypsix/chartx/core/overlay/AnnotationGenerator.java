@@ -50,15 +50,27 @@ public interface AnnotationGenerator {
     void setEnabled(boolean enabled);
 
     /**
-     * Called when the data is updated.
-     * Generators can implement incremental update logic.
+     * Called when bars were appended or updated.
+     *
+     * <p>Incremental generators keep resumable state from the last
+     * {@link #generate} or {@code update} call. Bars before {@code fromIndex}
+     * are unchanged since then, so only annotations depending on later bars
+     * need to be revisited. Changes are reported through {@code delta}:
+     * new drawings as added, drawings modified in place as updated and
+     * obsolete drawings as removed. The cost should depend on the changed
+     * range, not on the length of the history.
+     *
+     * <p>Returning false means the generator cannot update incrementally
+     * (no state yet, or configuration changed); the caller then discards
+     * its drawings and calls {@link #generate} instead.
      *
      * @param data the updated data
      * @param fromIndex the index from which data was added/changed
-     * @return new annotations to add, or null to regenerate all
+     * @param delta receives the changes
+     * @return true if the delta was produced, false to regenerate all
      */
-    default List<Drawing> onDataUpdated(OhlcData data, int fromIndex) {
+    default boolean update(OhlcData data, int fromIndex, AnnotationDelta delta) {
         // Default: regenerate all
-        return null;
+        return false;
     }
 }
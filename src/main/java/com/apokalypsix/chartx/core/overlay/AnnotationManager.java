@@ -18,11 +18,18 @@ import java.util.*;
  *   <li>Updates annotations when data changes</li>
  *   <li>Adds/removes annotations from the drawing layer</li>
  * </ul>
+ *
+ * <p>Data changes are forwarded to each generator's
+ * {@link AnnotationGenerator#update} with the first changed index. Generators
+ * that support it answer with an {@link AnnotationDelta}, which is applied to
+ * the drawing layer in place, so a live tick does not rescan the history.
+ * Generators without incremental support are regenerated in full.
  */
 public class AnnotationManager {
 
     private final Map<String, AnnotationGenerator> generators = new LinkedHashMap<>();
-    private final Map<String, List<Drawing>> generatedAnnotations = new HashMap<>();
+    private final Map<String, Set<Drawing>> generatedAnnotations = new HashMap<>();
+    private final AnnotationDelta delta = new AnnotationDelta();
 
     private OhlcData sourceData;
     private DrawingLayerV2 drawingLayer;
@@ -35,12 +42,16 @@ public class AnnotationManager {
         this.dataListener = new DataListener() {
             @Override
             public void onDataAppended(Data<?> data, int newIndex) {
-                regenerateAll();
+                updateAll(newIndex);
             }
 
             @Override
             public void onDataUpdated(Data<?> data, int index) {
-                regenerateAll();
+                if (index < 0) {
+                    regenerateAll();
+                } else {
+                    updateAll(index);
+                }
             }
 
             @Override
@@ -94,7 +105,7 @@ public class AnnotationManager {
      */
     public void registerGenerator(AnnotationGenerator generator) {
         generators.put(generator.getId(), generator);
-        generatedAnnotations.put(generator.getId(), new ArrayList<>());
+        generatedAnnotations.put(generator.getId(), new LinkedHashSet<>());
 
         if (sourceData != null && generator.isEnabled()) {
             regenerateForGenerator(generator.getId());
@@ -107,11 +118,9 @@ public class AnnotationManager {
     public void unregisterGenerator(String generatorId) {
         AnnotationGenerator generator = generators.remove(generatorId);
         if (generator != null) {
-            List<Drawing> annotations = generatedAnnotations.remove(generatorId);
+            Set<Drawing> annotations = generatedAnnotations.remove(generatorId);
             if (annotations != null && drawingLayer != null) {
-                for (Drawing drawing : annotations) {
-                    drawingLayer.removeDrawing(drawing);
-                }
+                drawingLayer.applyChanges(List.of(), List.of(), annotations);
             }
         }
     }
@@ -187,23 +196,58 @@ public class AnnotationManager {
 
             // Add to drawing layer
             if (drawingLayer != null) {
-                for (Drawing drawing : newAnnotations) {
-                    drawingLayer.addDrawing(drawing);
-                }
+                drawingLayer.addAllDrawings(newAnnotations);
             }
         }
     }
 
+    /**
+     * Updates annotations of all enabled generators after a data change.
+     *
+     * @param fromIndex the first appended or changed bar
+     */
+    private void updateAll(int fromIndex) {
+        for (String generatorId : generators.keySet()) {
+            updateForGenerator(generatorId, fromIndex);
+        }
+    }
+
+    /**
+     * Asks a generator for a delta, falling back to full regeneration.
+     */
+    private void updateForGenerator(String generatorId, int fromIndex) {
+        AnnotationGenerator generator = generators.get(generatorId);
+        if (generator == null || !generator.isEnabled() || sourceData == null) {
+            return;
+        }
+
+        delta.clear();
+        if (!generator.update(sourceData, fromIndex, delta)) {
+            regenerateForGenerator(generatorId);
+            return;
+        }
+        if (delta.isEmpty()) {
+            return;
+        }
+
+        Set<Drawing> annotations = generatedAnnotations.get(generatorId);
+        annotations.removeAll(delta.getRemoved());
+        annotations.addAll(delta.getAdded());
+
+        if (drawingLayer != null) {
+            drawingLayer.applyChanges(delta.getAdded(), delta.getUpdated(), delta.getRemoved());
+        }
+        delta.clear();
+    }
+
     /**
      * Clears annotations for a specific generator.
      */
     private void clearAnnotationsForGenerator(String generatorId) {
-        List<Drawing> annotations = generatedAnnotations.get(generatorId);
+        Set<Drawing> annotations = generatedAnnotations.get(generatorId);
         if (annotations != null) {
             if (drawingLayer != null) {
-                for (Drawing drawing : annotations) {
-                    drawingLayer.removeDrawing(drawing);
-                }
+                drawingLayer.applyChanges(List.of(), List.of(), annotations);
             }
             annotations.clear();
         }
@@ -224,10 +268,8 @@ public class AnnotationManager {
     private void removeAllFromLayer() {
         if (drawingLayer == null) return;
 
-        for (List<Drawing> annotations : generatedAnnotations.values()) {
-            for (Drawing drawing : annotations) {
-                drawingLayer.removeDrawing(drawing);
-            }
+        for (Set<Drawing> annotations : generatedAnnotations.values()) {
+            drawingLayer.applyChanges(List.of(), List.of(), annotations);
         }
     }
 
@@ -237,10 +279,8 @@ public class AnnotationManager {
     private void addAllToLayer() {
         if (drawingLayer == null) return;
 
-        for (List<Drawing> annotations : generatedAnnotations.values()) {
-            for (Drawing drawing : annotations) {
-                drawingLayer.addDrawing(drawing);
-            }
+        for (Set<Drawing> annotations : generatedAnnotations.values()) {
+            drawingLayer.addAllDrawings(new ArrayList<>(annotations));
         }
     }
 
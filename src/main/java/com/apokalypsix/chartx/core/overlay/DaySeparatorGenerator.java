@@ -2,6 +2,7 @@ package com.apokalypsix.chartx.core.overlay;
 
 import com.apokalypsix.chartx.chart.style.LineStyle;
 import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.overlay.AnchorPoint;
 import com.apokalypsix.chartx.chart.overlay.Drawing;
 import com.apokalypsix.chartx.chart.overlay.VerticalLine;
 
@@ -9,8 +10,8 @@ import java.awt.Color;
 import java.time.Instant;
 import java.time.LocalDate;
 import java.time.ZoneId;
-import java.time.ZonedDateTime;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 
 /**
@@ -25,6 +26,10 @@ import java.util.List;
  *   <li>Line style (color, dash pattern, opacity)</li>
  *   <li>Weekday-only mode (skip weekends)</li>
  * </ul>
+ *
+ * <p>Updates are incremental: the generator remembers the bar each separator
+ * was emitted for, so an update from bar {@code i} only drops separators at
+ * or after {@code i} and rescans the bars from there.
  */
 public class DaySeparatorGenerator implements AnnotationGenerator {
 
@@ -35,6 +40,12 @@ public class DaySeparatorGenerator implements AnnotationGenerator {
     private LineStyle lineStyle = LineStyle.dashed(new Color(100, 100, 100, 180), 1.0f);
     private boolean skipWeekends = false;
 
+    // Resumable state: emitted separators and the bar index of each
+    private final List<VerticalLine> separators = new ArrayList<>();
+    private int[] separatorBars = new int[64];
+    private int processedCount;
+    private boolean stateValid;
+
     @Override
     public String getId() {
         return ID;
@@ -60,6 +71,7 @@ public class DaySeparatorGenerator implements AnnotationGenerator {
      */
     public void setTimezone(ZoneId timezone) {
         this.timezone = timezone;
+        stateValid = false;
     }
 
     /**
@@ -74,6 +86,7 @@ public class DaySeparatorGenerator implements AnnotationGenerator {
      */
     public void setLineStyle(LineStyle style) {
         this.lineStyle = style;
+        stateValid = false;
     }
 
     /**
@@ -88,26 +101,78 @@ public class DaySeparatorGenerator implements AnnotationGenerator {
      */
     public void setSkipWeekends(boolean skip) {
         this.skipWeekends = skip;
+        stateValid = false;
     }
 
     @Override
     public List<Drawing> generate(OhlcData data) {
-        List<Drawing> lines = new ArrayList<>();
+        separators.clear();
+        processedCount = 0;
+        stateValid = false;
 
+        List<Drawing> lines = new ArrayList<>();
         if (!enabled || data == null || data.isEmpty()) {
             return lines;
         }
 
+        scan(data, 0, lines);
+        stateValid = true;
+        return lines;
+    }
+
+    @Override
+    public boolean update(OhlcData data, int fromIndex, AnnotationDelta delta) {
+        if (!stateValid || !enabled || data == null || data.size() < processedCount) {
+            return false;
+        }
+
+        int from = Math.max(0, Math.min(fromIndex, processedCount));
+
+        // Drop separators that depend on changed bars
+        int keep = separators.size();
+        while (keep > 0 && separatorBars[keep - 1] >= from) {
+            keep--;
+        }
+        List<VerticalLine> dropped = new ArrayList<>(separators.subList(keep, separators.size()));
+        separators.subList(keep, separators.size()).clear();
+
+        List<Drawing> added = new ArrayList<>();
+        scan(data, from, added);
+
+        // Ids are positional, so a re-emitted separator reuses the existing
+        // drawing; it only changes if the separator moved to another bar
+        int reused = Math.min(dropped.size(), added.size());
+        for (int i = 0; i < reused; i++) {
+            VerticalLine existing = dropped.get(i);
+            AnchorPoint anchor = added.get(i).getAnchorPoints().get(0);
+            separators.set(keep + i, existing);
+            if (!existing.getAnchorPoints().get(0).equals(anchor)) {
+                existing.setAnchorPoint(0, anchor);
+                delta.update(existing);
+            }
+        }
+        for (int i = reused; i < dropped.size(); i++) {
+            delta.remove(dropped.get(i));
+        }
+        for (int i = reused; i < added.size(); i++) {
+            delta.add(added.get(i));
+        }
+        return true;
+    }
+
+    /**
+     * Emits separators for bars [from, size), continuing from the state left
+     * by bars before {@code from}.
+     */
+    private void scan(OhlcData data, int from, List<Drawing> out) {
         long[] timestamps = data.getTimestampsArray();
         int size = data.size();
 
-        LocalDate previousDate = null;
-        int separatorCount = 0;
+        // The date of the previous bar is all the state a separator depends on
+        LocalDate previousDate = from > 0 ? toDate(timestamps[from - 1]) : null;
 
-        for (int i = 0; i < size; i++) {
-            ZonedDateTime dateTime = Instant.ofEpochMilli(timestamps[i])
-                    .atZone(timezone);
-            LocalDate date = dateTime.toLocalDate();
+        for (int i = from; i < size; i++) {
+            LocalDate date = toDate(timestamps[i]);
 
             if (!date.equals(previousDate)) {
                 // Check if we should skip weekends
@@ -121,15 +186,28 @@ public class DaySeparatorGenerator implements AnnotationGenerator {
 
                 if (previousDate != null) {
                     // Create separator line at this timestamp
-                    String id = "daysep-" + separatorCount++;
+                    String id = "daysep-" + separators.size();
                     VerticalLine line = new VerticalLine(id, timestamps[i], 0);
                     line.setLineStyle(lineStyle);
-                    lines.add(line);
+                    addSeparator(line, i);
+                    out.add(line);
                 }
                 previousDate = date;
             }
         }
+        processedCount = size;
+    }
 
-        return lines;
+    private void addSeparator(VerticalLine line, int barIndex) {
+        int count = separators.size();
+        if (count == separatorBars.length) {
+            separatorBars = Arrays.copyOf(separatorBars, count + (count >> 1));
+        }
+        separatorBars[count] = barIndex;
+        separators.add(line);
+    }
+
+    private LocalDate toDate(long timestamp) {
+        return Instant.ofEpochMilli(timestamp).atZone(timezone).toLocalDate();
     }
 }
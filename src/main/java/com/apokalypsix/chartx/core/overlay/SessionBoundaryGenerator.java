@@ -2,6 +2,7 @@ package com.apokalypsix.chartx.core.overlay;
 
 import com.apokalypsix.chartx.chart.style.LineStyle;
 import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.overlay.AnchorPoint;
 import com.apokalypsix.chartx.chart.overlay.Drawing;
 import com.apokalypsix.chartx.chart.overlay.Rectangle;
 import com.apokalypsix.chartx.chart.overlay.VerticalLine;
@@ -9,7 +10,9 @@ import com.apokalypsix.chartx.chart.overlay.VerticalLine;
 import java.awt.Color;
 import java.time.*;
 import java.util.ArrayList;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 
 /**
  * Generates annotations for trading session boundaries.
@@ -23,6 +26,13 @@ import java.util.List;
  * </ul>
  *
  * <p>Supports configurable session times for different markets.
+ *
+ * <p>Updates are incremental. Annotations are kept per trading day together
+ * with the end of the latest time window they depend on; an update from bar
+ * {@code i} only rebuilds the days whose windows reach the time of bar
+ * {@code i} (normally just the current day). Rebuilt annotations keep their
+ * existing drawing objects and are reported as updated when they change,
+ * e.g. a session fill growing with the forming bar.
  */
 public class SessionBoundaryGenerator implements AnnotationGenerator {
 
@@ -88,6 +98,31 @@ public class SessionBoundaryGenerator implements AnnotationGenerator {
     private boolean showInitialBalance = false;
     private int initialBalanceMinutes = 60;
 
+    // Resumable state: annotations per trading day, in data order
+    private final List<DayAnnotations> days = new ArrayList<>();
+    private int processedCount;
+    private long lastProcessedTime;
+    private boolean stateValid;
+
+    /**
+     * Annotations generated for one trading day.
+     */
+    private static final class DayAnnotations {
+        final LocalDate date;
+        final int firstBar;
+        final int counterStart;
+        int counterEnd;
+        // Latest end of the time windows whose bars the annotations depend on
+        long windowEnd = Long.MIN_VALUE;
+        final List<Drawing> drawings = new ArrayList<>();
+
+        DayAnnotations(LocalDate date, int firstBar, int counterStart) {
+            this.date = date;
+            this.firstBar = firstBar;
+            this.counterStart = counterStart;
+        }
+    }
+
     public SessionBoundaryGenerator() {
         // Default: show US regular session boundaries
         sessions.add(US_REGULAR_SESSION);
@@ -118,6 +153,7 @@ public class SessionBoundaryGenerator implements AnnotationGenerator {
      */
     public void setTimezone(ZoneId timezone) {
         this.timezone = timezone;
+        stateValid = false;
     }
 
     /**
@@ -125,6 +161,7 @@ public class SessionBoundaryGenerator implements AnnotationGenerator {
      */
     public void addSession(SessionDefinition session) {
         sessions.add(session);
+        stateValid = false;
     }
 
     /**
@@ -132,6 +169,7 @@ public class SessionBoundaryGenerator implements AnnotationGenerator {
      */
     public void removeSession(String name) {
         sessions.removeIf(s -> s.name().equals(name));
+        stateValid = false;
     }
 
     /**
@@ -139,6 +177,7 @@ public class SessionBoundaryGenerator implements AnnotationGenerator {
      */
     public void clearSessions() {
         sessions.clear();
+        stateValid = false;
     }
 
     /**
@@ -146,6 +185,7 @@ public class SessionBoundaryGenerator implements AnnotationGenerator {
      */
     public void setShowInitialBalance(boolean show) {
         this.showInitialBalance = show;
+        stateValid = false;
     }
 
     /**
@@ -153,6 +193,7 @@ public class SessionBoundaryGenerator implements AnnotationGenerator {
      */
     public void setInitialBalanceMinutes(int minutes) {
         this.initialBalanceMinutes = minutes;
+        stateValid = false;
     }
 
     /**
@@ -164,144 +205,247 @@ public class SessionBoundaryGenerator implements AnnotationGenerator {
         sessions.add(US_PREMARKET);
         sessions.add(US_AFTERHOURS);
         timezone = ZoneId.of("America/New_York");
+        stateValid = false;
     }
 
     @Override
     public List<Drawing> generate(OhlcData series) {
+        days.clear();
+        processedCount = 0;
+        stateValid = false;
+
         List<Drawing> annotations = new ArrayList<>();
 
         if (!enabled || series == null || series.isEmpty() || sessions.isEmpty()) {
             return annotations;
         }
 
+        scanDays(series, 0, 0);
+        for (DayAnnotations day : days) {
+            annotations.addAll(day.drawings);
+        }
+        stateValid = true;
+        return annotations;
+    }
+
+    @Override
+    public boolean update(OhlcData series, int fromIndex, AnnotationDelta delta) {
+        if (!stateValid || !enabled || series == null || sessions.isEmpty()
+                || series.size() < processedCount || processedCount == 0) {
+            return false;
+        }
+
+        int from = Math.max(0, Math.min(fromIndex, processedCount));
         long[] timestamps = series.getTimestampsArray();
-        float[] highs = series.getHighArray();
-        float[] lows = series.getLowArray();
-        int size = series.size();
 
-        // Find all unique days in the data
-        List<LocalDate> tradingDays = new ArrayList<>();
-        LocalDate lastDate = null;
+        // Days whose windows end before this time only see unchanged bars.
+        // Capped at the previous last bar, since "session in data range"
+        // depends on the last timestamp.
+        long changedTime = from < processedCount
+                ? Math.min(timestamps[from], lastProcessedTime)
+                : lastProcessedTime;
+
+        int first = days.size();
+        while (first > 0) {
+            DayAnnotations day = days.get(first - 1);
+            int dayEndBar = first < days.size() ? days.get(first).firstBar : processedCount;
+            if (day.windowEnd < changedTime && dayEndBar <= from) {
+                break;
+            }
+            first--;
+        }
 
-        for (int i = 0; i < size; i++) {
-            LocalDate date = Instant.ofEpochMilli(timestamps[i])
-                    .atZone(timezone)
-                    .toLocalDate();
+        // Detach the days to rebuild, remembering their drawings by id
+        Map<String, Drawing> previous = new HashMap<>();
+        List<DayAnnotations> rebuilt = days.subList(first, days.size());
+        for (DayAnnotations day : rebuilt) {
+            for (Drawing drawing : day.drawings) {
+                previous.put(drawing.getId(), drawing);
+            }
+        }
+        int startBar = first < days.size() ? days.get(first).firstBar : from;
+        int counter = first > 0 ? days.get(first - 1).counterEnd : 0;
+        rebuilt.clear();
+
+        int firstNewDay = days.size();
+        scanDays(series, startBar, counter);
+
+        // Reuse existing drawings with the same id so unchanged annotations
+        // produce no changes and changed ones are updated in place
+        for (int d = firstNewDay; d < days.size(); d++) {
+            List<Drawing> drawings = days.get(d).drawings;
+            for (int i = 0; i < drawings.size(); i++) {
+                Drawing generated = drawings.get(i);
+                Drawing existing = previous.remove(generated.getId());
+                if (existing == null) {
+                    delta.add(generated);
+                    continue;
+                }
+                drawings.set(i, existing);
+                List<AnchorPoint> anchors = generated.getAnchorPoints();
+                if (!existing.getAnchorPoints().equals(anchors)) {
+                    for (int a = 0; a < anchors.size(); a++) {
+                        existing.setAnchorPoint(a, anchors.get(a));
+                    }
+                    delta.update(existing);
+                }
+            }
+        }
+        for (Drawing drawing : previous.values()) {
+            delta.remove(drawing);
+        }
+        return true;
+    }
+
+    /**
+     * Splits bars [startBar, size) into trading days and generates their
+     * annotations, appending to {@link #days}.
+     */
+    private void scanDays(OhlcData series, int startBar, int counter) {
+        long[] timestamps = series.getTimestampsArray();
+        int size = series.size();
+
+        int firstNewDay = days.size();
+        LocalDate lastDate = startBar > 0 ? toDate(timestamps[startBar - 1]) : null;
+        for (int i = startBar; i < size; i++) {
+            LocalDate date = toDate(timestamps[i]);
             if (!date.equals(lastDate)) {
-                tradingDays.add(date);
+                days.add(new DayAnnotations(date, i, counter));
                 lastDate = date;
             }
         }
 
-        // Generate annotations for each day and session
-        int annotationCount = 0;
-        for (LocalDate day : tradingDays) {
-            for (SessionDefinition session : sessions) {
-                // Calculate session timestamps for this day
-                ZonedDateTime sessionStart = ZonedDateTime.of(day, session.startTime(), timezone);
-                ZonedDateTime sessionEnd = ZonedDateTime.of(day, session.endTime(), timezone);
-
-                // Handle overnight sessions
-                if (session.endTime().isBefore(session.startTime())) {
-                    sessionEnd = sessionEnd.plusDays(1);
-                }
+        // Days are known up front so each day sees the full data range
+        for (int d = firstNewDay; d < days.size(); d++) {
+            counter = generateDay(series, days.get(d), counter);
+        }
 
-                long startMillis = sessionStart.toInstant().toEpochMilli();
-                long endMillis = sessionEnd.toInstant().toEpochMilli();
+        processedCount = size;
+        lastProcessedTime = timestamps[size - 1];
+    }
 
-                // Check if session is within data range
-                if (startMillis > timestamps[size - 1] || endMillis < timestamps[0]) {
-                    continue;
-                }
+    /**
+     * Generates the session and Initial Balance annotations of one day.
+     *
+     * @return the annotation counter after this day
+     */
+    private int generateDay(OhlcData series, DayAnnotations day, int annotationCount) {
+        long[] timestamps = series.getTimestampsArray();
+        int size = series.size();
+        List<Drawing> annotations = day.drawings;
 
-                // Generate session start line
-                if (session.showLines() && session.lineColor() != null) {
-                    String startId = String.format("session-%s-start-%d", session.name(), annotationCount);
-                    VerticalLine startLine = new VerticalLine(startId, startMillis, 0);
-                    startLine.setLineStyle(lineStyle.withColor(session.lineColor()));
-                    annotations.add(startLine);
-
-                    String endId = String.format("session-%s-end-%d", session.name(), annotationCount);
-                    VerticalLine endLine = new VerticalLine(endId, endMillis, 0);
-                    endLine.setLineStyle(lineStyle.withColor(session.lineColor()));
-                    annotations.add(endLine);
-                }
+        for (SessionDefinition session : sessions) {
+            // Calculate session timestamps for this day
+            ZonedDateTime sessionStart = ZonedDateTime.of(day.date, session.startTime(), timezone);
+            ZonedDateTime sessionEnd = ZonedDateTime.of(day.date, session.endTime(), timezone);
 
-                // Generate session fill (as a rectangle)
-                if (session.showFill() && session.fillColor() != null) {
-                    // Find price range within session
-                    float sessionHigh = Float.MIN_VALUE;
-                    float sessionLow = Float.MAX_VALUE;
-
-                    for (int i = 0; i < size; i++) {
-                        if (timestamps[i] >= startMillis && timestamps[i] < endMillis) {
-                            sessionHigh = Math.max(sessionHigh, highs[i]);
-                            sessionLow = Math.min(sessionLow, lows[i]);
-                        }
-                    }
+            // Handle overnight sessions
+            if (session.endTime().isBefore(session.startTime())) {
+                sessionEnd = sessionEnd.plusDays(1);
+            }
 
-                    if (sessionHigh > sessionLow) {
-                        String rectId = String.format("session-%s-fill-%d", session.name(), annotationCount);
-                        Rectangle rect = new Rectangle(rectId, startMillis, sessionHigh);
-                        rect.setCorner2(new com.apokalypsix.chartx.chart.overlay.AnchorPoint(
-                                endMillis, sessionLow));
-                        rect.setColor(session.fillColor());
-                        rect.setOpacity(session.fillColor().getAlpha() / 255f);
-                        annotations.add(rect);
-                    }
-                }
+            long startMillis = sessionStart.toInstant().toEpochMilli();
+            long endMillis = sessionEnd.toInstant().toEpochMilli();
+            day.windowEnd = Math.max(day.windowEnd, endMillis);
+
+            // Check if session is within data range
+            if (startMillis > timestamps[size - 1] || endMillis < timestamps[0]) {
+                continue;
+            }
 
-                annotationCount++;
+            // Generate session start line
+            if (session.showLines() && session.lineColor() != null) {
+                String startId = String.format("session-%s-start-%d", session.name(), annotationCount);
+                VerticalLine startLine = new VerticalLine(startId, startMillis, 0);
+                startLine.setLineStyle(lineStyle.withColor(session.lineColor()));
+                annotations.add(startLine);
+
+                String endId = String.format("session-%s-end-%d", session.name(), annotationCount);
+                VerticalLine endLine = new VerticalLine(endId, endMillis, 0);
+                endLine.setLineStyle(lineStyle.withColor(session.lineColor()));
+                annotations.add(endLine);
             }
 
-            // Generate Initial Balance box if enabled
-            if (showInitialBalance) {
-                annotations.addAll(generateInitialBalance(series, day));
+            // Generate session fill (as a rectangle)
+            if (session.showFill() && session.fillColor() != null) {
+                // Find price range within session
+                float[] range = windowRange(series, startMillis, endMillis);
+                float sessionHigh = range[0];
+                float sessionLow = range[1];
+
+                if (sessionHigh > sessionLow) {
+                    String rectId = String.format("session-%s-fill-%d", session.name(), annotationCount);
+                    Rectangle rect = new Rectangle(rectId, startMillis, sessionHigh);
+                    rect.setCorner2(new AnchorPoint(endMillis, sessionLow));
+                    rect.setColor(session.fillColor());
+                    rect.setOpacity(session.fillColor().getAlpha() / 255f);
+                    annotations.add(rect);
+                }
             }
+
+            annotationCount++;
         }
 
-        return annotations;
-    }
+        // Generate Initial Balance box if enabled
+        if (showInitialBalance) {
+            generateInitialBalance(series, day);
+        }
 
-    private List<Drawing> generateInitialBalance(OhlcData series, LocalDate day) {
-        List<Drawing> annotations = new ArrayList<>();
+        day.counterEnd = annotationCount;
+        return annotationCount;
+    }
 
-        ZonedDateTime ibStart = ZonedDateTime.of(day, LocalTime.of(9, 30), timezone);
+    private void generateInitialBalance(OhlcData series, DayAnnotations day) {
+        ZonedDateTime ibStart = ZonedDateTime.of(day.date, LocalTime.of(9, 30), timezone);
         ZonedDateTime ibEnd = ibStart.plusMinutes(initialBalanceMinutes);
 
         long startMillis = ibStart.toInstant().toEpochMilli();
         long endMillis = ibEnd.toInstant().toEpochMilli();
-
-        long[] timestamps = series.getTimestampsArray();
-        float[] highs = series.getHighArray();
-        float[] lows = series.getLowArray();
-        int size = series.size();
+        day.windowEnd = Math.max(day.windowEnd, endMillis);
 
         // Find IB high and low
-        float ibHigh = Float.MIN_VALUE;
-        float ibLow = Float.MAX_VALUE;
-
-        for (int i = 0; i < size; i++) {
-            if (timestamps[i] >= startMillis && timestamps[i] < endMillis) {
-                ibHigh = Math.max(ibHigh, highs[i]);
-                ibLow = Math.min(ibLow, lows[i]);
-            }
-        }
+        float[] range = windowRange(series, startMillis, endMillis);
+        float ibHigh = range[0];
+        float ibLow = range[1];
 
         if (ibHigh > ibLow) {
             // Create IB rectangle (extends to end of session)
-            String rectId = "ib-" + day.toString();
-            ZonedDateTime sessionEnd = ZonedDateTime.of(day, LocalTime.of(16, 0), timezone);
+            String rectId = "ib-" + day.date.toString();
+            ZonedDateTime sessionEnd = ZonedDateTime.of(day.date, LocalTime.of(16, 0), timezone);
             long sessionEndMillis = sessionEnd.toInstant().toEpochMilli();
 
             Rectangle rect = new Rectangle(rectId, startMillis, ibHigh);
-            rect.setCorner2(new com.apokalypsix.chartx.chart.overlay.AnchorPoint(
-                    sessionEndMillis, ibLow));
+            rect.setCorner2(new AnchorPoint(sessionEndMillis, ibLow));
             rect.setColor(new Color(100, 100, 150, 30));
             rect.setOpacity(0.3f);
-            annotations.add(rect);
+            day.drawings.add(rect);
         }
+    }
 
-        return annotations;
+    /**
+     * Returns the highest high and lowest low of bars in [startMillis, endMillis),
+     * located by binary search rather than a scan of the whole series.
+     */
+    private static float[] windowRange(OhlcData series, long startMillis, long endMillis) {
+        long[] timestamps = series.getTimestampsArray();
+        float[] highs = series.getHighArray();
+        float[] lows = series.getLowArray();
+        int size = series.size();
+
+        float high = Float.MIN_VALUE;
+        float low = Float.MAX_VALUE;
+
+        int i = series.indexAtOrAfter(startMillis);
+        if (i >= 0) {
+            for (; i < size && timestamps[i] < endMillis; i++) {
+                high = Math.max(high, highs[i]);
+                low = Math.min(low, lows[i]);
+            }
+        }
+        return new float[] {high, low};
+    }
+
+    private LocalDate toDate(long timestamp) {
+        return Instant.ofEpochMilli(timestamp).atZone(timezone).toLocalDate();
     }
 }
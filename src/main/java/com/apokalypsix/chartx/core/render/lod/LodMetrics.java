@@ -0,0 +1,76 @@
+package com.apokalypsix.chartx.core.render.lod;
+
+import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+import com.apokalypsix.chartx.core.render.model.RenderContext;
+
+/**
+ * Pixel densities of the current frame along each axis.
+ *
+ * <p>Horizontal density is pixels per bar; vertical density is pixels per
+ * value unit, measured at the middle of the chart so it is also meaningful
+ * for non-linear axes. Instances are mutable so layers can reuse one per frame.
+ */
+public final class LodMetrics {
+
+    private double pixelsPerBar;
+    private double pixelsPerUnitY;
+
+    /**
+     * Creates empty metrics.
+     */
+    public LodMetrics() {
+    }
+
+    /**
+     * Measures the densities of a frame.
+     *
+     * @param ctx the render context
+     * @param coords the coordinate system of the layer's Y axis
+     * @return this instance
+     */
+    public LodMetrics update(RenderContext ctx, CoordinateSystem coords) {
+        pixelsPerBar = ctx.getBarWidth();
+
+        double midY = ctx.getViewport().getTopInset() + ctx.getChartHeight() / 2.0;
+        double unitSpan = Math.abs(coords.screenYToYValue(midY + 1) - coords.screenYToYValue(midY));
+        pixelsPerUnitY = unitSpan > 0 && Double.isFinite(unitSpan) ? 1.0 / unitSpan : 0;
+        return this;
+    }
+
+    /**
+     * Sets the densities directly.
+     *
+     * @return this instance
+     */
+    public LodMetrics set(double pixelsPerBar, double pixelsPerUnitY) {
+        this.pixelsPerBar = pixelsPerBar;
+        this.pixelsPerUnitY = pixelsPerUnitY;
+        return this;
+    }
+
+    /**
+     * Returns the horizontal density in pixels per bar.
+     */
+    public double getPixelsPerBar() {
+        return pixelsPerBar;
+    }
+
+    /**
+     * Returns the vertical density in pixels per value unit.
+     */
+    public double getPixelsPerUnitY() {
+        return pixelsPerUnitY;
+    }
+
+    /**
+     * Returns the vertical density in pixels per price tick.
+     */
+    public double getPixelsPerTick(double tickSize) {
+        return pixelsPerUnitY * tickSize;
+    }
+
+    @Override
+    public String toString() {
+        return String.format("LodMetrics[pxBar=%.2f, pxUnitY=%.4f]", pixelsPerBar, pixelsPerUnitY);
+    }
+}
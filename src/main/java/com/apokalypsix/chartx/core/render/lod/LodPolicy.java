@@ -0,0 +1,122 @@
+package com.apokalypsix.chartx.core.render.lod;
+
+/**
+ * Shared level-of-detail policy for dense render layers.
+ *
+ * <p>Layers describe their detail levels in a {@link LodTable} and obtain a
+ * {@link LodSelector} from a policy. The policy holds the settings that
+ * apply to every layer at once:
+ * <ul>
+ *   <li>enabled - when disabled, every selector returns its most detailed level</li>
+ *   <li>hysteresis - relative margin around thresholds that prevents flicker
+ *       while zooming near a level boundary</li>
+ *   <li>detail bias - multiplier on all thresholds; above 1 switches to
+ *       coarser levels sooner (cheaper), below 1 keeps detail longer</li>
+ * </ul>
+ *
+ * <p>It also provides {@link #curveSegments} for layers that tessellate
+ * curves, so segment counts follow on-screen size instead of being fixed.
+ *
+ * <p>{@link FootprintLOD} predates this policy and keeps its own thresholds.
+ */
+public final class LodPolicy {
+
+    private static final LodPolicy DEFAULT = new LodPolicy();
+
+    /** Default hysteresis margin (15%) */
+    public static final double DEFAULT_HYSTERESIS = 0.15;
+
+    /** Target on-screen length of one curve segment in pixels */
+    private static final double PIXELS_PER_CURVE_SEGMENT = 4.0;
+
+    private volatile boolean enabled = true;
+    private volatile double hysteresis = DEFAULT_HYSTERESIS;
+    private volatile double detailBias = 1.0;
+
+    /**
+     * Returns the process-wide default policy used by the built-in layers.
+     */
+    public static LodPolicy getDefault() {
+        return DEFAULT;
+    }
+
+    /**
+     * Creates a policy with default settings.
+     */
+    public LodPolicy() {
+    }
+
+    /**
+     * Creates a selector for one layer instance.
+     *
+     * @param table the layer's level table
+     * @return a new selector starting at the most detailed level
+     */
+    public <L extends Enum<L>> LodSelector<L> createSelector(LodTable<L> table) {
+        return new LodSelector<>(this, table);
+    }
+
+    /**
+     * Returns the number of segments to use for a curve of the given on-screen
+     * radius, never more than {@code maxSegments}.
+     *
+     * @param radiusPixels curve radius in pixels
+     * @param sweepRadians angular extent of the curve
+     * @param maxSegments full-detail segment count
+     * @return segment count in [min(4, maxSegments), maxSegments]
+     */
+    public int curveSegments(double radiusPixels, double sweepRadians, int maxSegments) {
+        if (!enabled) {
+            return maxSegments;
+        }
+        double length = Math.abs(radiusPixels * sweepRadians);
+        int segments = (int) Math.ceil(length / (PIXELS_PER_CURVE_SEGMENT * detailBias));
+        return Math.max(Math.min(4, maxSegments), Math.min(maxSegments, segments));
+    }
+
+    public boolean isEnabled() {
+        return enabled;
+    }
+
+    /**
+     * Enables or disables LOD reduction for all layers using this policy.
+     */
+    public void setEnabled(boolean enabled) {
+        this.enabled = enabled;
+    }
+
+    public double getHysteresis() {
+        return hysteresis;
+    }
+
+    /**
+     * Sets the hysteresis margin as a fraction of each threshold.
+     *
+     * @param hysteresis margin in [0, 0.5]
+     */
+    public void setHysteresis(double hysteresis) {
+        this.hysteresis = Math.max(0, Math.min(0.5, hysteresis));
+    }
+
+    public double getDetailBias() {
+        return detailBias;
+    }
+
+    /**
+     * Sets the multiplier applied to every threshold.
+     *
+     * @param detailBias positive factor; 1 uses the tables as written
+     */
+    public void setDetailBias(double detailBias) {
+        if (detailBias <= 0) {
+            throw new IllegalArgumentException("Detail bias must be positive: " + detailBias);
+        }
+        this.detailBias = detailBias;
+    }
+
+    @Override
+    public String toString() {
+        return String.format("LodPolicy[enabled=%b, hysteresis=%.2f, bias=%.2f]",
+                enabled, hysteresis, detailBias);
+    }
+}
@@ -0,0 +1,120 @@
+package com.apokalypsix.chartx.core.render.lod;
+
+/**
+ * Tracks the current detail level of one layer instance.
+ *
+ * <p>Each frame the layer passes its pixel densities to {@link #update};
+ * the selector picks the most detailed level of its {@link LodTable} that
+ * qualifies. Hysteresis from the owning {@link LodPolicy} keeps the level
+ * stable near a threshold: moving to a more detailed level requires
+ * clearing its thresholds by the hysteresis margin, while the current level
+ * is kept until density drops the same margin below its thresholds.
+ *
+ * <p>Selectors are cheap and not thread-safe; create one per layer with
+ * {@link LodPolicy#createSelector(LodTable)}.
+ *
+ * @param <L> the layer's level enum
+ */
+public final class LodSelector<L extends Enum<L>> {
+
+    private final LodPolicy policy;
+    private LodTable<L> table;
+    private int current;
+    private boolean changed;
+
+    LodSelector(LodPolicy policy, LodTable<L> table) {
+        this.policy = policy;
+        this.table = table;
+    }
+
+    /**
+     * Selects the level for the given horizontal density.
+     *
+     * @param pixelsPerBar horizontal density
+     * @return the selected level
+     */
+    public L update(double pixelsPerBar) {
+        return update(pixelsPerBar, -1);
+    }
+
+    /**
+     * Selects the level for the given metrics and tick size.
+     *
+     * @param metrics the frame's pixel densities
+     * @param tickSize price tick size, or 0 to ignore vertical density
+     * @return the selected level
+     */
+    public L update(LodMetrics metrics, double tickSize) {
+        return update(metrics.getPixelsPerBar(),
+                tickSize > 0 ? metrics.getPixelsPerTick(tickSize) : -1);
+    }
+
+    /**
+     * Selects the level for the given horizontal and vertical densities.
+     *
+     * @param pixelsPerBar horizontal density
+     * @param pixelsPerTick vertical density, or a negative value if unknown
+     * @return the selected level
+     */
+    public L update(double pixelsPerBar, double pixelsPerTick) {
+        int selected;
+        if (!policy.isEnabled()) {
+            selected = 0;
+        } else {
+            double bias = policy.getDetailBias();
+            double hysteresis = policy.getHysteresis();
+            selected = table.size() - 1;
+            for (int i = 0; i < table.size() - 1; i++) {
+                double scale = bias;
+                if (i < current) {
+                    scale *= 1 + hysteresis;
+                } else if (i == current) {
+                    scale *= 1 - hysteresis;
+                }
+                if (table.qualifies(i, pixelsPerBar, pixelsPerTick, scale)) {
+                    selected = i;
+                    break;
+                }
+            }
+        }
+        changed = selected != current;
+        current = selected;
+        return table.getLevel(selected);
+    }
+
+    /**
+     * Returns the level chosen by the last update.
+     */
+    public L getLevel() {
+        return table.getLevel(current);
+    }
+
+    /**
+     * Returns true if the last update changed the level.
+     */
+    public boolean hasChanged() {
+        return changed;
+    }
+
+    /**
+     * Replaces the level table, e.g. after a threshold setting changed.
+     * The current level is kept if the new table contains it.
+     */
+    public void setTable(LodTable<L> table) {
+        int position = table.indexOf(getLevel());
+        this.table = table;
+        this.current = Math.max(0, position);
+    }
+
+    /**
+     * Returns the level table.
+     */
+    public LodTable<L> getTable() {
+        return table;
+    }
+
+    @Override
+    public String toString() {
+        return "LodSelector[level=" + getLevel() + "]";
+    }
+}
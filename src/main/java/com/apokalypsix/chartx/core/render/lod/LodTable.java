@@ -0,0 +1,159 @@
+package com.apokalypsix.chartx.core.render.lod;
+
+import java.lang.reflect.Array;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Per-layer table of detail levels and the pixel densities each one needs.
+ *
+ * <p>Levels are listed from most to least detailed. A level is eligible when
+ * the horizontal density (pixels per bar) and, if the table uses it, the
+ * vertical density (pixels per tick) meet its minimums. The last level is
+ * the fallback and is used whenever no earlier level qualifies.
+ *
+ * <pre>{@code
+ * LodTable<Detail> table = LodTable.builder(Detail.class)
+ *         .level(Detail.FULL, 3.0)
+ *         .level(Detail.WICKS, 0)
+ *         .build();
+ * }</pre>
+ *
+ * @param <L> the layer's level enum
+ * @see LodSelector
+ */
+public final class LodTable<L extends Enum<L>> {
+
+    private final L[] levels;
+    private final double[] minPixelsPerBar;
+    private final double[] minPixelsPerTick;
+
+    private LodTable(L[] levels, double[] minPixelsPerBar, double[] minPixelsPerTick) {
+        this.levels = levels;
+        this.minPixelsPerBar = minPixelsPerBar;
+        this.minPixelsPerTick = minPixelsPerTick;
+    }
+
+    /**
+     * Starts a table for the given level type.
+     */
+    public static <L extends Enum<L>> Builder<L> builder(Class<L> levelType) {
+        return new Builder<>(levelType);
+    }
+
+    /**
+     * Returns the number of levels.
+     */
+    public int size() {
+        return levels.length;
+    }
+
+    /**
+     * Returns the level at a position (0 = most detailed).
+     */
+    public L getLevel(int position) {
+        return levels[position];
+    }
+
+    /**
+     * Returns the position of a level, or -1 if it is not in the table.
+     */
+    public int indexOf(L level) {
+        for (int i = 0; i < levels.length; i++) {
+            if (levels[i] == level) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Returns the minimum pixels per bar for the level at a position.
+     */
+    public double getMinPixelsPerBar(int position) {
+        return minPixelsPerBar[position];
+    }
+
+    /**
+     * Returns the minimum pixels per tick for the level at a position, 0 if unconstrained.
+     */
+    public double getMinPixelsPerTick(int position) {
+        return minPixelsPerTick[position];
+    }
+
+    /**
+     * Returns true if the level at a position qualifies for the given densities.
+     *
+     * @param position level position
+     * @param pixelsPerBar horizontal density
+     * @param pixelsPerTick vertical density, or a negative value if unknown
+     * @param scale factor applied to both thresholds (hysteresis and bias)
+     */
+    boolean qualifies(int position, double pixelsPerBar, double pixelsPerTick, double scale) {
+        if (pixelsPerBar < minPixelsPerBar[position] * scale) {
+            return false;
+        }
+        return pixelsPerTick < 0 || pixelsPerTick >= minPixelsPerTick[position] * scale;
+    }
+
+    @Override
+    public String toString() {
+        return "LodTable" + Arrays.toString(levels);
+    }
+
+    /**
+     * Builds a {@link LodTable}.
+     *
+     * @param <L> the layer's level enum
+     */
+    public static final class Builder<L extends Enum<L>> {
+
+        private final Class<L> levelType;
+        private final List<L> levels = new ArrayList<>();
+        private final List<double[]> thresholds = new ArrayList<>();
+
+        private Builder(Class<L> levelType) {
+            this.levelType = levelType;
+        }
+
+        /**
+         * Adds the next (less detailed) level with a horizontal threshold only.
+         */
+        public Builder<L> level(L level, double minPixelsPerBar) {
+            return level(level, minPixelsPerBar, 0);
+        }
+
+        /**
+         * Adds the next (less detailed) level with horizontal and vertical thresholds.
+         */
+        public Builder<L> level(L level, double minPixelsPerBar, double minPixelsPerTick) {
+            if (levels.contains(level)) {
+                throw new IllegalArgumentException("Duplicate LOD level: " + level);
+            }
+            levels.add(level);
+            thresholds.add(new double[] {minPixelsPerBar, minPixelsPerTick});
+            return this;
+        }
+
+        /**
+         * Builds the table.
+         *
+         * @throws IllegalStateException if no levels were added
+         */
+        public LodTable<L> build() {
+            if (levels.isEmpty()) {
+                throw new IllegalStateException("LOD table needs at least one level");
+            }
+            @SuppressWarnings("unchecked")
+            L[] levelArray = levels.toArray((L[]) Array.newInstance(levelType, 0));
+            double[] minBar = new double[levelArray.length];
+            double[] minTick = new double[levelArray.length];
+            for (int i = 0; i < levelArray.length; i++) {
+                minBar[i] = thresholds.get(i)[0];
+                minTick[i] = thresholds.get(i)[1];
+            }
+            return new LodTable<>(levelArray, minBar, minTick);
+        }
+    }
+}
@@ -0,0 +1,322 @@
+package com.apokalypsix.chartx.core.render.model;
+
+import java.awt.Color;
+import java.util.List;
+import java.util.concurrent.CopyOnWriteArrayList;
+
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import com.apokalypsix.chartx.chart.axis.Viewport;
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.finance.indicator.AnchoredVwap;
+import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+import com.apokalypsix.chartx.core.data.VwapSums;
+import com.apokalypsix.chartx.core.render.gl.GLResourceManager;
+import com.apokalypsix.chartx.core.render.api.Buffer;
+import com.apokalypsix.chartx.core.render.api.BufferDescriptor;
+import com.apokalypsix.chartx.core.render.api.DrawMode;
+import com.apokalypsix.chartx.core.render.api.ResourceManager;
+import com.apokalypsix.chartx.core.render.api.Shader;
+import com.apokalypsix.chartx.core.render.util.VertexArena;
+import com.jogamp.opengl.GL2ES2;
+
+/**
+ * Render layer drawing any number of anchored VWAPs and their bands using the
+ * abstracted rendering API.
+ *
+ * <p>Only the visible bars are evaluated, each in O(1) from the data's
+ * {@link VwapSums}, so adding anchors or dragging one never re-accumulates
+ * from the anchor. All lines of all anchors are written into one vertex
+ * array and drawn with a single call. Lines break where a resetting VWAP
+ * starts a new period.
+ */
+public class AnchoredVwapLayerV2 extends AbstractRenderLayer {
+
+    private static final Logger log = LoggerFactory.getLogger(AnchoredVwapLayerV2.class);
+
+    /** Z-order for anchored VWAPs (with indicator overlays, below drawings) */
+    public static final int Z_ORDER = 450;
+
+    // Floats per vertex: x, y, r, g, b, a
+    private static final int FLOATS_PER_VERTEX = 6;
+
+    // Band lines are drawn with this fraction of the VWAP line's alpha
+    private static final float BAND_ALPHA = 0.6f;
+
+    // V2 API resources
+    private Buffer lineBuffer;
+    private Shader defaultShader;
+    private boolean v2Initialized = false;
+
+    // Data
+    private OhlcData data;
+    private final List<AnchoredVwap> anchors = new CopyOnWriteArrayList<>();
+
+    private float lineWidth = 1.5f;
+
+    // Anchor bar per visible bar, reused across frames (render thread only)
+    private int[] anchorIdx = new int[0];
+
+    /**
+     * Creates an empty anchored VWAP layer.
+     */
+    public AnchoredVwapLayerV2() {
+        super(Z_ORDER);
+    }
+
+    /**
+     * Sets the OHLC data the VWAPs are computed on.
+     * Repaints automatically.
+     */
+    public void setData(OhlcData data) {
+        this.data = data;
+        markDirty();
+        requestRepaint();
+    }
+
+    /**
+     * Returns the current data.
+     */
+    public OhlcData getData() {
+        return data;
+    }
+
+    /**
+     * Adds an anchored VWAP.
+     * Repaints automatically.
+     */
+    public void addAnchor(AnchoredVwap anchor) {
+        anchors.add(anchor);
+        markDirty();
+        requestRepaint();
+    }
+
+    /**
+     * Removes an anchored VWAP.
+     * Repaints automatically.
+     *
+     * @return true if the anchor was found and removed
+     */
+    public boolean removeAnchor(AnchoredVwap anchor) {
+        boolean removed = anchors.remove(anchor);
+        if (removed) {
+            markDirty();
+            requestRepaint();
+        }
+        return removed;
+    }
+
+    /**
+     * Returns the anchored VWAPs.
+     */
+    public List<AnchoredVwap> getAnchors() {
+        return anchors;
+    }
+
+    /**
+     * Moves a fixed anchor, e.g. while its handle is dragged.
+     * Repaints automatically.
+     */
+    public void moveAnchor(AnchoredVwap anchor, long anchorTime) {
+        anchor.setAnchorTime(anchorTime);
+        markDirty();
+        requestRepaint();
+    }
+
+    /**
+     * Sets the line width in pixels.
+     * Repaints automatically.
+     */
+    public void setLineWidth(float lineWidth) {
+        this.lineWidth = Math.max(0.5f, lineWidth);
+        markDirty();
+        requestRepaint();
+    }
+
+    @Override
+    protected void doInitialize(GL2ES2 gl, GLResourceManager resources) {
+        // V2 resources are initialized lazily when first rendered with a valid RenderContext
+        log.debug("AnchoredVwapLayerV2 GL initialized (v2 resources will init on first render)");
+    }
+
+    /**
+     * Initializes V2 resources using the abstracted API.
+     */
+    private void initializeV2(RenderContext ctx) {
+        ResourceManager resources = ctx.getResourceManager();
+
+        int initialCapacity = 1024 * 2 * FLOATS_PER_VERTEX;
+        lineBuffer = resources.getOrCreateBuffer("vwap.anchored",
+                BufferDescriptor.positionColor2D(initialCapacity));
+
+        defaultShader = resources.getShader(ResourceManager.SHADER_DEFAULT);
+
+        v2Initialized = true;
+        log.debug("AnchoredVwapLayerV2 V2 resources initialized");
+    }
+
+    @Override
+    public void render(RenderContext ctx) {
+        if (!ctx.hasAbstractedAPI()) {
+            log.warn("AnchoredVwapLayerV2 requires abstracted API - skipping render");
+            return;
+        }
+
+        if (!v2Initialized) {
+            initializeV2(ctx);
+        }
+
+        if (data == null || data.size() == 0 || anchors.isEmpty()) {
+            return;
+        }
+
+        if (defaultShader == null || !defaultShader.isValid()) {
+            return;
+        }
+
+        renderLines(ctx);
+    }
+
+    private void renderLines(RenderContext ctx) {
+        Viewport viewport = ctx.getViewport();
+        CoordinateSystem coords = ctx.getCoordinatesForData(data);
+
+        int firstIdx = data.indexAtOrAfter(viewport.getStartTime());
+        int lastIdx = data.indexAtOrBefore(viewport.getEndTime());
+        if (firstIdx < 0 || lastIdx < 0 || firstIdx > lastIdx) {
+            return;
+        }
+
+        // Include one bar on each side so lines run to the edges
+        if (firstIdx > 0) firstIdx--;
+        if (lastIdx < data.size() - 1) lastIdx++;
+        int count = lastIdx - firstIdx + 1;
+        if (count < 2) {
+            return;
+        }
+
+        int lineCount = 0;
+        for (AnchoredVwap anchor : anchors) {
+            if (anchor.isVisible()) {
+                lineCount += 1 + 2 * anchor.getBandCount();
+            }
+        }
+        if (lineCount == 0) {
+            return;
+        }
+
+        VertexArena arena = ctx.getVertexArena();
+        float[] vertices = arena.acquire(lineCount * (count - 1) * 2 * FLOATS_PER_VERTEX);
+        float[] screenXs = arena.acquire(count);
+        float[] vwap = arena.acquire(count);
+        float[] stdDev = arena.acquire(count);
+        float[] band = arena.acquire(count);
+        float[] screenYs = arena.acquire(count);
+        if (anchorIdx.length < count) {
+            anchorIdx = new int[count + count / 2];
+        }
+        int[] anchorIdx = this.anchorIdx;
+        try {
+            coords.xValueToScreenX(data.getTimestampsArray(), screenXs, firstIdx, count);
+
+            int floatCount = 0;
+            for (AnchoredVwap anchor : anchors) {
+                if (!anchor.isVisible()) {
+                    continue;
+                }
+                anchor.evaluate(data, firstIdx, lastIdx, vwap, stdDev, anchorIdx);
+
+                Color color = anchor.getColor();
+                float r = color.getRed() / 255f;
+                float g = color.getGreen() / 255f;
+                float b = color.getBlue() / 255f;
+                float a = color.getAlpha() / 255f;
+
+                coords.yValueToScreenY(vwap, screenYs, 0, count);
+                floatCount = addPolyline(vertices, floatCount, screenXs, screenYs, anchorIdx, count,
+                        r, g, b, a);
+
+                for (int k = 0; k < anchor.getBandCount(); k++) {
+                    float m = (float) anchor.getBandMultiplier(k);
+                    for (int side = -1; side <= 1; side += 2) {
+                        for (int i = 0; i < count; i++) {
+                            band[i] = vwap[i] + side * m * stdDev[i];
+                        }
+                        coords.yValueToScreenY(band, screenYs, 0, count);
+                        floatCount = addPolyline(vertices, floatCount, screenXs, screenYs, anchorIdx, count,
+                                r, g, b, a * BAND_ALPHA);
+                    }
+                }
+            }
+            if (floatCount == 0) {
+                return;
+            }
+
+            defaultShader.bind();
+            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+            ctx.getDevice().setLineWidth(lineWidth);
+
+            lineBuffer.upload(vertices, 0, floatCount);
+            lineBuffer.draw(DrawMode.LINES);
+
+            defaultShader.unbind();
+        } finally {
+            arena.release(screenYs);
+            arena.release(band);
+            arena.release(stdDev);
+            arena.release(vwap);
+            arena.release(screenXs);
+            arena.release(vertices);
+        }
+    }
+
+    /**
+     * Appends line segments between consecutive valid points that share an
+     * anchor, so periods and gaps are not bridged.
+     */
+    private static int addPolyline(float[] vertices, int index, float[] xs, float[] ys, int[] anchorIdx,
+                                   int count, float r, float g, float b, float a) {
+        for (int i = 1; i < count; i++) {
+            if (Float.isNaN(ys[i - 1]) || Float.isNaN(ys[i]) || anchorIdx[i] != anchorIdx[i - 1]) {
+                continue;
+            }
+            index = addVertex(vertices, index, xs[i - 1], ys[i - 1], r, g, b, a);
+            index = addVertex(vertices, index, xs[i], ys[i], r, g, b, a);
+        }
+        return index;
+    }
+
+    private static int addVertex(float[] vertices, int index, float x, float y,
+                                 float r, float g, float b, float a) {
+        vertices[index++] = x;
+        vertices[index++] = y;
+        vertices[index++] = r;
+        vertices[index++] = g;
+        vertices[index++] = b;
+        vertices[index++] = a;
+        return index;
+    }
+
+    @Override
+    protected void doDispose(GL2ES2 gl) {
+        // V2 resources are managed by ResourceManager
+        v2Initialized = false;
+    }
+
+    /**
+     * Disposes V2 resources.
+     * Call this when the RenderContext is available during cleanup.
+     */
+    public void disposeV2(RenderContext ctx) {
+        if (v2Initialized && ctx.hasAbstractedAPI()) {
+            ResourceManager resources = ctx.getResourceManager();
+            if (resources != null) {
+                resources.disposeBuffer("vwap.anchored");
+            }
+            lineBuffer = null;
+            defaultShader = null;
+            v2Initialized = false;
+        }
+    }
+}
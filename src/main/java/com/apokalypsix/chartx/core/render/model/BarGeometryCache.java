@@ -0,0 +1,222 @@
+package com.apokalypsix.chartx.core.render.model;
+
+import java.util.Arrays;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.chart.data.DataListener;
+
+/**
+ * Per-bar geometry cache for layers that draw many cells per bar, such as
+ * footprint and TPO profiles.
+ *
+ * <p>Each bar index holds one or more channels of fixed-size float records.
+ * Records are written in data space (prices and bar-relative x coefficients),
+ * so they stay valid across pans and zooms; the owning layer only maps them
+ * to screen coordinates each frame. A per-bar metric (e.g. the largest level
+ * volume) can be stored alongside so visible-range maxima don't require
+ * walking the levels again.
+ *
+ * <p>Entries are invalidated through a data listener: updates invalidate from
+ * the updated index onwards, an update with a negative index (a style change
+ * on the series) or a clear invalidates everything. Bulk loads, which do not
+ * notify listeners, are detected through {@link Data#getLoadCount()} and
+ * invalidate everything as well. The last index is treated as the forming bar
+ * and is rebuilt on every {@link #sync}, since live bars are often mutated in
+ * place. Layers call {@link #invalidateAll()} when one of their own style
+ * properties changes.
+ */
+public class BarGeometryCache {
+
+    private final int channelCount;
+
+    private float[][][] records = new float[0][][];
+    private int[][] floatCounts = new int[0][];
+    private float[] metrics = new float[0];
+    private boolean[] valid = new boolean[0];
+
+    private volatile Data<?> data;
+
+    // Lowest index changed since the last sync; lowered atomically by listener threads
+    private final AtomicInteger dirtyFromIndex = new AtomicInteger(Integer.MAX_VALUE);
+
+    // Load count of the data when its changes were last synced
+    private int loadCount;
+
+    private final DataListener dataListener = new DataListener() {
+        @Override
+        public void onDataAppended(Data<?> data, int newIndex) {
+            // The previous forming bar is now closed; pick up its final state
+            markDirty(Math.max(0, newIndex - 1));
+        }
+
+        @Override
+        public void onDataUpdated(Data<?> data, int index) {
+            markDirty(Math.max(0, index));
+        }
+
+        @Override
+        public void onDataCleared(Data<?> data) {
+            markDirty(0);
+        }
+    };
+
+    /**
+     * Creates a cache with the given number of record channels per bar.
+     *
+     * @param channelCount number of independent record lists per bar
+     */
+    public BarGeometryCache(int channelCount) {
+        this.channelCount = channelCount;
+    }
+
+    /**
+     * Starts tracking the given data, discarding all cached geometry.
+     *
+     * @param data the data to track, or null to stop tracking
+     */
+    public void attach(Data<?> data) {
+        if (this.data == data) {
+            return;
+        }
+        detach();
+        this.data = data;
+        if (data != null) {
+            loadCount = data.getLoadCount();
+            data.addListener(dataListener);
+        }
+        invalidateAll();
+    }
+
+    /**
+     * Stops tracking the current data.
+     */
+    public void detach() {
+        if (data != null) {
+            data.removeListener(dataListener);
+            data = null;
+        }
+    }
+
+    /**
+     * Invalidates every cached bar.
+     */
+    public void invalidateAll() {
+        markDirty(0);
+    }
+
+    /**
+     * Applies pending invalidations. Call once per frame before reading.
+     *
+     * @param size current number of bars in the data
+     */
+    public void sync(int size) {
+        ensureCapacity(size);
+
+        int dirtyFrom = dirtyFromIndex.getAndSet(Integer.MAX_VALUE);
+        Data<?> current = data;
+        if (current != null && current.getLoadCount() != loadCount) {
+            // Bulk loads don't notify listeners
+            loadCount = current.getLoadCount();
+            dirtyFrom = 0;
+        }
+        if (dirtyFrom < valid.length) {
+            Arrays.fill(valid, dirtyFrom, valid.length, false);
+        }
+        if (size > 0) {
+            valid[size - 1] = false;
+        }
+    }
+
+    /**
+     * Returns true if the bar's geometry is cached and current.
+     */
+    public boolean isValid(int index) {
+        return valid[index];
+    }
+
+    /**
+     * Stores a channel's records for a bar, reusing the previous array when it fits.
+     *
+     * @param index bar index
+     * @param channel channel index
+     * @param src source records
+     * @param floatCount number of floats to copy from {@code src}
+     */
+    public void store(int index, int channel, float[] src, int floatCount) {
+        float[][] channels = records[index];
+        if (channels == null) {
+            channels = new float[channelCount][];
+            records[index] = channels;
+            floatCounts[index] = new int[channelCount];
+        }
+        float[] dst = channels[channel];
+        if (dst == null || dst.length < floatCount) {
+            dst = new float[floatCount];
+            channels[channel] = dst;
+        }
+        System.arraycopy(src, 0, dst, 0, floatCount);
+        floatCounts[index][channel] = floatCount;
+    }
+
+    /**
+     * Marks a bar as built, storing its per-bar metric.
+     *
+     * @param index bar index
+     * @param metric layer-defined summary value for the bar
+     */
+    public void markValid(int index, float metric) {
+        metrics[index] = metric;
+        valid[index] = true;
+    }
+
+    /**
+     * Returns the records of a channel. Only the first
+     * {@link #getFloatCount} floats are meaningful.
+     */
+    public float[] getRecords(int index, int channel) {
+        float[][] channels = records[index];
+        return channels != null ? channels[channel] : null;
+    }
+
+    /**
+     * Returns the number of floats stored for a channel.
+     */
+    public int getFloatCount(int index, int channel) {
+        int[] counts = floatCounts[index];
+        return counts != null ? counts[channel] : 0;
+    }
+
+    /**
+     * Returns the per-bar metric stored by {@link #markValid}.
+     */
+    public float getMetric(int index) {
+        return metrics[index];
+    }
+
+    /**
+     * Releases all cached geometry and stops tracking the data.
+     */
+    public void dispose() {
+        detach();
+        records = new float[0][][];
+        floatCounts = new int[0][];
+        metrics = new float[0];
+        valid = new boolean[0];
+        dirtyFromIndex.set(Integer.MAX_VALUE);
+    }
+
+    private void markDirty(int index) {
+        dirtyFromIndex.accumulateAndGet(index, Math::min);
+    }
+
+    private void ensureCapacity(int size) {
+        if (size > valid.length) {
+            int newCapacity = Math.max(size, valid.length + (valid.length >> 1));
+            records = Arrays.copyOf(records, newCapacity);
+            floatCounts = Arrays.copyOf(floatCounts, newCapacity);
+            metrics = Arrays.copyOf(metrics, newCapacity);
+            valid = Arrays.copyOf(valid, newCapacity);
+        }
+    }
+}
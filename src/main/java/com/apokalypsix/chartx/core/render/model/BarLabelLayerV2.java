@@ -11,6 +11,9 @@ import com.apokalypsix.chartx.chart.data.OhlcData;
 import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
 import com.apokalypsix.chartx.core.render.gl.GLResourceManager;
 import com.apokalypsix.chartx.core.render.gl.TextRenderer;
+import com.apokalypsix.chartx.core.render.lod.LodPolicy;
+import com.apokalypsix.chartx.core.render.lod.LodSelector;
+import com.apokalypsix.chartx.core.render.lod.LodTable;
 import com.jogamp.opengl.GL2ES2;
 
 /**
@@ -29,7 +32,10 @@ import com.jogamp.opengl.GL2ES2;
  * </ul>
  *
  * <p>Labels are only rendered when bars are wide enough to be readable,
- * preventing visual clutter when zoomed out.
+ * preventing visual clutter when zoomed out. Between the minimum bar width
+ * and a quarter of it, labels are thinned to every n-th bar (by index, so
+ * they don't jump while panning) instead of disappearing at once. The level
+ * is chosen through the shared {@link LodPolicy}.
  */
 public class BarLabelLayerV2 extends AbstractRenderLayer {
 
@@ -88,6 +94,21 @@ public class BarLabelLayerV2 extends AbstractRenderLayer {
         Color getColor(int index, OHLCBar bar);
     }
 
+    /**
+     * Detail levels, most detailed first.
+     */
+    public enum Detail {
+        /** A label on every bar */
+        ALL,
+        /** A label on every n-th bar so labels keep the minimum spacing */
+        THINNED,
+        /** No labels */
+        HIDDEN
+    }
+
+    /** Largest stride used when thinning labels */
+    private static final int MAX_LABEL_STRIDE = 4;
+
     // Configuration
     private OhlcData data;
     private LabelProvider labelProvider;
@@ -105,6 +126,9 @@ public class BarLabelLayerV2 extends AbstractRenderLayer {
     // Reusable bar instance
     private final OHLCBar reusableBar = new OHLCBar();
 
+    private final LodSelector<Detail> lod =
+            LodPolicy.getDefault().createSelector(createLodTable(minBarWidth));
+
     /**
      * Creates a bar label layer.
      */
@@ -184,6 +208,15 @@ public class BarLabelLayerV2 extends AbstractRenderLayer {
      */
     public void setMinBarWidth(double width) {
         this.minBarWidth = width;
+        lod.setTable(createLodTable(width));
+    }
+
+    private static LodTable<Detail> createLodTable(double minBarWidth) {
+        return LodTable.builder(Detail.class)
+                .level(Detail.ALL, minBarWidth)
+                .level(Detail.THINNED, minBarWidth / MAX_LABEL_STRIDE)
+                .level(Detail.HIDDEN, 0)
+                .build();
     }
 
     // ========== Common Label Providers ==========
@@ -273,9 +306,13 @@ public class BarLabelLayerV2 extends AbstractRenderLayer {
 
         // Check if bars are wide enough to show labels
         double barWidth = coords.getPixelWidth(barDuration);
-        if (barWidth < minBarWidth) {
+        Detail detail = lod.update(barWidth);
+        if (detail == Detail.HIDDEN) {
             return;  // Too zoomed out, skip labels
         }
+        int stride = detail == Detail.THINNED && barWidth > 0
+                ? Math.min(MAX_LABEL_STRIDE, (int) Math.ceil(minBarWidth / barWidth))
+                : 1;
 
         // Get visible range
         int firstVisible = ctx.getFirstVisibleIndex();
@@ -293,7 +330,8 @@ public class BarLabelLayerV2 extends AbstractRenderLayer {
 
         try {
             // Render labels for visible bars
-            for (int i = firstVisible; i <= lastVisible && i < data.size(); i++) {
+            int first = firstVisible + Math.floorMod(-firstVisible, stride);
+            for (int i = first; i <= lastVisible && i < data.size(); i += stride) {
                 data.getBar(i, reusableBar);
 
                 // Get label text
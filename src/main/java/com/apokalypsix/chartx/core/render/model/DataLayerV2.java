@@ -42,6 +42,9 @@ public class DataLayerV2 extends AbstractRenderLayer {
     private boolean heikinAshiDirty = true;
     private final DataListener haInvalidationListener;
 
+    // Data the candles were built from in prepare(), consumed by render()
+    private OhlcData preparedData;
+
     // V2 initialization tracking
     private boolean v2Initialized = false;
 
@@ -165,8 +168,29 @@ public class DataLayerV2 extends AbstractRenderLayer {
         log.debug("DataLayerV2 GL initialized (v2 renderer will init on first render)");
     }
 
+    @Override
+    public boolean hasPreparePhase() {
+        return true;
+    }
+
+    /**
+     * Resolves the effective data (computing Heikin-Ashi bars if needed) and
+     * builds the candle vertices.
+     */
+    @Override
+    public void prepare(RenderContext ctx) {
+        OhlcData effectiveData = getEffectiveData();
+        if (effectiveData != null && !effectiveData.isEmpty()) {
+            candlestickRenderer.prepare(ctx, effectiveData);
+        }
+        preparedData = effectiveData;
+    }
+
     @Override
     public void render(RenderContext ctx) {
+        OhlcData effectiveData = preparedData != null ? preparedData : getEffectiveData();
+        preparedData = null;
+
         // Check if abstracted API is available
         if (!ctx.hasAbstractedAPI()) {
             log.warn("DataLayerV2 requires abstracted API - skipping render");
@@ -180,7 +204,6 @@ public class DataLayerV2 extends AbstractRenderLayer {
             log.debug("CandlestickRendererV2 initialized");
         }
 
-        OhlcData effectiveData = getEffectiveData();
         if (effectiveData != null && !effectiveData.isEmpty()) {
             candlestickRenderer.render(ctx, effectiveData);
         }
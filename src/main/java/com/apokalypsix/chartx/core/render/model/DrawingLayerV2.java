@@ -2,7 +2,10 @@ package com.apokalypsix.chartx.core.render.model;
 
 import java.awt.Color;
 import java.util.ArrayList;
+import java.util.Collection;
+import java.util.HashSet;
 import java.util.List;
+import java.util.Set;
 
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
@@ -44,6 +47,7 @@ import com.apokalypsix.chartx.core.render.api.BufferDescriptor;
 import com.apokalypsix.chartx.core.render.api.DrawMode;
 import com.apokalypsix.chartx.core.render.api.ResourceManager;
 import com.apokalypsix.chartx.core.render.api.Shader;
+import com.apokalypsix.chartx.core.render.lod.LodPolicy;
 import com.jogamp.opengl.GL2ES2;
 
 /**
@@ -54,6 +58,9 @@ import com.jogamp.opengl.GL2ES2;
  *
  * <p>Supports rendering of various drawing types including trend lines, horizontal/vertical
  * lines, Fibonacci retracements, rectangles, ellipses, and other drawing tools.
+ *
+ * <p>Curves (ellipses, arcs, Fibonacci arcs) are tessellated with a segment
+ * count that follows their on-screen size via {@link LodPolicy#curveSegments}.
  */
 public class DrawingLayerV2 extends AbstractRenderLayer {
 
@@ -64,6 +71,12 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
 
     private final List<Drawing> drawings = new ArrayList<>();
 
+    // Membership index for drawings, so adds don't scan the list
+    private final Set<Drawing> drawingSet = new HashSet<>();
+
+    // Batches at most this size are removed by scanning from the end of the list
+    private static final int TAIL_REMOVE_LIMIT = 16;
+
     // V2 API resources
     private Buffer lineBuffer;      // For lines and outlined shapes (triangles for thick lines)
     private Buffer handleBuffer;    // For selection handles
@@ -128,7 +141,7 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
      * Repaints automatically.
      */
     public void addDrawing(Drawing drawing) {
-        if (!drawings.contains(drawing)) {
+        if (drawingSet.add(drawing)) {
             drawings.add(drawing);
             markDirty();
             requestRepaint();
@@ -143,7 +156,7 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
     public void addAllDrawings(List<Drawing> drawingsToAdd) {
         boolean added = false;
         for (Drawing drawing : drawingsToAdd) {
-            if (!drawings.contains(drawing)) {
+            if (drawingSet.add(drawing)) {
                 drawings.add(drawing);
                 added = true;
             }
@@ -159,7 +172,8 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
      * Repaints automatically.
      */
     public void removeDrawing(Drawing drawing) {
-        if (drawings.remove(drawing)) {
+        if (drawingSet.remove(drawing)) {
+            drawings.remove(drawing);
             markDirty();
             requestRepaint();
         }
@@ -171,6 +185,7 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
      */
     public void removeDrawing(String id) {
         if (drawings.removeIf(d -> d.getId().equals(id))) {
+            drawingSet.removeIf(d -> d.getId().equals(id));
             markDirty();
             requestRepaint();
         }
@@ -183,6 +198,54 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
     public void clearDrawings() {
         if (!drawings.isEmpty()) {
             drawings.clear();
+            drawingSet.clear();
+            markDirty();
+            requestRepaint();
+        }
+    }
+
+    /**
+     * Applies a batch of changes in place (single repaint).
+     *
+     * <p>Meant for generated annotations that change with live data: the
+     * removed drawings are usually the most recent ones, so small batches
+     * are located from the end of the list instead of rebuilding it.
+     * Updated drawings were modified by their owner and only need a repaint.
+     *
+     * @param added drawings to add
+     * @param updated drawings that were modified in place
+     * @param removed drawings to remove
+     */
+    public void applyChanges(Collection<? extends Drawing> added,
+                             Collection<? extends Drawing> updated,
+                             Collection<? extends Drawing> removed) {
+        boolean changed = !updated.isEmpty();
+
+        if (!removed.isEmpty()) {
+            if (removed.size() <= TAIL_REMOVE_LIMIT) {
+                for (Drawing drawing : removed) {
+                    if (drawingSet.remove(drawing)) {
+                        drawings.remove(drawings.lastIndexOf(drawing));
+                        changed = true;
+                    }
+                }
+            } else {
+                Set<Drawing> toRemove = new HashSet<>(removed);
+                if (drawings.removeIf(toRemove::contains)) {
+                    drawingSet.removeAll(toRemove);
+                    changed = true;
+                }
+            }
+        }
+
+        for (Drawing drawing : added) {
+            if (drawingSet.add(drawing)) {
+                drawings.add(drawing);
+                changed = true;
+            }
+        }
+
+        if (changed) {
             markDirty();
             requestRepaint();
         }
@@ -574,7 +637,7 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
         float rx = Math.abs(x2 - x1) / 2;
         float ry = Math.abs(y2 - y1) / 2;
 
-        int segments = 32;
+        int segments = LodPolicy.getDefault().curveSegments(Math.max(rx, ry), 2 * Math.PI, 32);
 
         // Draw fill if enabled
         if (ellipse.isFilled()) {
@@ -1070,8 +1133,6 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
         float cy = (float) coords.yValueToScreenY(fibArc.getEnd().price());
         double baseRadius = fibArc.getBaseRadius(coords);
 
-        int segments = 24;
-
         for (int i = 0; i < levels.length; i++) {
             Color levelColor = fibArc.getLevelColor(i);
             float r = levelColor.getRed() / 255f;
@@ -1080,6 +1141,7 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
             float a = fibArc.getOpacity();
 
             float radius = (float) (baseRadius * levels[i]);
+            int segments = LodPolicy.getDefault().curveSegments(radius, Math.PI, 24);
 
             // Draw semicircle
             for (int j = 0; j < segments; j++) {
@@ -1194,7 +1256,7 @@ public class DrawingLayerV2 extends AbstractRenderLayer {
         double startAngle = baseAngle + arc.getStartAngle();
         double arcExtent = arc.getArcExtent();
 
-        int segments = 24;
+        int segments = LodPolicy.getDefault().curveSegments(radius, arcExtent, 24);
         for (int i = 0; i < segments; i++) {
             double angle1 = startAngle + arcExtent * i / segments;
             double angle2 = startAngle + arcExtent * (i + 1) / segments;
@@ -35,6 +35,11 @@ import com.jogamp.opengl.GL2ES2;
  *
  * <p>This is the V2 version that uses backend-agnostic rendering interfaces
  * instead of direct GL calls.
+ *
+ * <p>Cell and imbalance geometry is cached per bar in data space (see
+ * {@link BarGeometryCache}). Closed bars are built once; only the forming bar
+ * is rebuilt every frame, and a style change rebuilds everything. Each frame
+ * then only maps the cached records to screen coordinates.
  */
 public class FootprintLayerV2 extends AbstractRenderLayer {
 
@@ -69,12 +74,26 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
     // Floats per vertex: x, y, r, g, b, a
     private static final int FLOATS_PER_VERTEX = 6;
 
+    // Cached records: u1, v1, u2, v2, price, r, g, b, a
+    // Screen x = barCenterX + u * halfBar + v * (halfBar / maxVolume)
+    private static final int FLOATS_PER_RECORD = 9;
+    private static final int CHANNEL_VOLUME = 0;
+    private static final int CHANNEL_IMBALANCE = 1;
+
+    private final BarGeometryCache geometryCache = new BarGeometryCache(2);
+    private float[] recordScratch = new float[64 * FLOATS_PER_RECORD];
+
     // Reusable vertex arrays (avoid allocation in render loop)
     private float[] volumeVertices;
     private float[] imbalanceVertices;
     private int volumeCapacity;
     private int imbalanceCapacity;
 
+    // Float counts built by prepare() for the following render()
+    private int volumeFloatCount;
+    private int imbalanceFloatCount;
+    private boolean prepared;
+
     // Configuration
     private DisplayMode displayMode = DisplayMode.BID_ASK;
     private boolean highlightImbalances = true;
@@ -124,6 +143,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
      */
     public void setSeries(FootprintSeries series) {
         this.series = series;
+        geometryCache.attach(series);
         markDirty();
         requestRepaint();
     }
@@ -144,7 +164,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
      */
     public void setDisplayMode(DisplayMode mode) {
         this.displayMode = mode;
-        markDirty();
+        invalidateGeometry();
     }
 
     /**
@@ -161,7 +181,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
      */
     public void setHighlightImbalances(boolean highlight) {
         this.highlightImbalances = highlight;
-        markDirty();
+        invalidateGeometry();
     }
 
     /**
@@ -178,7 +198,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
      */
     public void setImbalanceThreshold(float threshold) {
         this.imbalanceThreshold = threshold;
-        markDirty();
+        invalidateGeometry();
     }
 
     /**
@@ -195,7 +215,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
      */
     public void setShowPOC(boolean show) {
         this.showPOC = show;
-        markDirty();
+        invalidateGeometry();
     }
 
     /**
@@ -209,7 +229,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
 
     public void setBidColor(Color color) {
         this.bidColor = color;
-        markDirty();
+        invalidateGeometry();
     }
 
     public Color getBidColor() {
@@ -218,7 +238,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
 
     public void setAskColor(Color color) {
         this.askColor = color;
-        markDirty();
+        invalidateGeometry();
     }
 
     public Color getAskColor() {
@@ -227,7 +247,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
 
     public void setNeutralColor(Color color) {
         this.neutralColor = color;
-        markDirty();
+        invalidateGeometry();
     }
 
     public Color getNeutralColor() {
@@ -236,7 +256,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
 
     public void setPocColor(Color color) {
         this.pocColor = color;
-        markDirty();
+        invalidateGeometry();
     }
 
     public Color getPocColor() {
@@ -245,7 +265,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
 
     public void setBuyImbalanceColor(Color color) {
         this.buyImbalanceColor = color;
-        markDirty();
+        invalidateGeometry();
     }
 
     public Color getBuyImbalanceColor() {
@@ -254,7 +274,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
 
     public void setSellImbalanceColor(Color color) {
         this.sellImbalanceColor = color;
-        markDirty();
+        invalidateGeometry();
     }
 
     public Color getSellImbalanceColor() {
@@ -292,29 +312,25 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
     }
 
     @Override
-    public void render(RenderContext ctx) {
-        // Check if abstracted API is available
-        if (!ctx.hasAbstractedAPI()) {
-            log.warn("FootprintLayerV2 requires abstracted API - skipping render");
-            return;
-        }
+    public boolean hasPreparePhase() {
+        return true;
+    }
+
+    /**
+     * Brings the per-bar geometry of the visible bars up to date and maps it
+     * to screen-space quads.
+     */
+    @Override
+    public void prepare(RenderContext ctx) {
+        volumeFloatCount = 0;
+        imbalanceFloatCount = 0;
+        prepared = true;
 
         // Skip if no series
         if (series == null || series.isEmpty()) {
             return;
         }
 
-        // Initialize V2 resources if needed
-        if (!v2Initialized) {
-            initializeV2(ctx);
-        }
-
-        // Check shader validity
-        if (defaultShader == null || !defaultShader.isValid()) {
-            log.warn("FootprintLayerV2 default shader not available");
-            return;
-        }
-
         // Get coordinate system for this series
         CoordinateSystem coords = ctx.getCoordinatesForData(series);
 
@@ -326,225 +342,228 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
             return;
         }
 
-        RenderDevice device = ctx.getDevice();
+        // Bring per-bar geometry up to date and find max volume for scaling
+        FootprintBar[] bars = series.getBarsArray();
+        geometryCache.sync(series.size());
+        float maxVolume = 0;
+        for (int i = firstIdx; i <= lastIdx; i++) {
+            ensureGeometry(i, bars[i]);
+            maxVolume = Math.max(maxVolume, geometryCache.getMetric(i));
+        }
+
+        float halfBar = (float) ctx.getBarWidth() * 0.9f / 2;
 
-        // Render imbalance backgrounds first (with alpha blending)
         if (highlightImbalances) {
-            renderImbalanceHighlights(ctx, coords, firstIdx, lastIdx, device);
+            ensureImbalanceCapacity(countRecords(firstIdx, lastIdx, CHANNEL_IMBALANCE));
+            imbalanceFloatCount = buildQuads(coords, firstIdx, lastIdx, CHANNEL_IMBALANCE,
+                    imbalanceVertices, halfBar, 0);
         }
 
-        // Render volume bars
-        renderVolumeBars(ctx, coords, firstIdx, lastIdx);
+        if (maxVolume > 0) {
+            ensureVolumeCapacity(countRecords(firstIdx, lastIdx, CHANNEL_VOLUME));
+            volumeFloatCount = buildQuads(coords, firstIdx, lastIdx, CHANNEL_VOLUME,
+                    volumeVertices, halfBar, halfBar / maxVolume);
+        }
     }
 
-    private void renderVolumeBars(RenderContext ctx, CoordinateSystem coords,
-                                   int firstIdx, int lastIdx) {
-        // Estimate capacity needed
-        int estimatedLevels = 0;
-        FootprintBar[] bars = series.getBarsArray();
-        for (int i = firstIdx; i <= lastIdx; i++) {
-            if (bars[i] != null) {
-                estimatedLevels += bars[i].getLevelCount();
-            }
+    @Override
+    public void render(RenderContext ctx) {
+        // Check if abstracted API is available
+        if (!ctx.hasAbstractedAPI()) {
+            log.warn("FootprintLayerV2 requires abstracted API - skipping render");
+            return;
         }
-        ensureVolumeCapacity(estimatedLevels);
 
-        long[] timestamps = series.getTimestampsArray();
-        float tickSize = series.getTickSize();
+        if (!prepared) {
+            // Not prepared this frame (e.g. rendered outside the pipeline)
+            prepare(ctx);
+        }
+        prepared = false;
 
-        int floatIdx = 0;
+        if (volumeFloatCount == 0 && imbalanceFloatCount == 0) {
+            return;
+        }
 
-        // Find max volume for scaling
-        float maxVolume = findMaxVolume(firstIdx, lastIdx);
-        if (maxVolume <= 0) return;
+        // Initialize V2 resources if needed
+        if (!v2Initialized) {
+            initializeV2(ctx);
+        }
 
-        for (int i = firstIdx; i <= lastIdx; i++) {
-            FootprintBar bar = bars[i];
-            if (bar == null || bar.getLevelCount() == 0) continue;
+        // Check shader validity
+        if (defaultShader == null || !defaultShader.isValid()) {
+            log.warn("FootprintLayerV2 default shader not available");
+            return;
+        }
 
-            float barCenterX = (float) coords.xValueToScreenX(timestamps[i]);
-            float barWidth = (float) ctx.getBarWidth() * 0.9f;
-            float halfBar = barWidth / 2;
-
-            FootprintLevel[] levels = bar.getLevelsArray();
-            int pocIdx = bar.getPOCIndex();
-
-            for (int lvl = 0; lvl < levels.length; lvl++) {
-                FootprintLevel level = levels[lvl];
-
-                float priceY = (float) coords.yValueToScreenY(level.getPrice());
-                float tickHeight = (float) Math.abs(
-                        coords.yValueToScreenY(level.getPrice() + tickSize) -
-                        coords.yValueToScreenY(level.getPrice()));
-
-                // Ensure minimum visible height
-                tickHeight = Math.max(tickHeight, 2.0f);
-
-                switch (displayMode) {
-                    case DELTA -> {
-                        // Single bar showing delta direction
-                        float delta = level.getDelta();
-                        float width = Math.abs(delta) / maxVolume * halfBar;
-                        Color color = delta > 0 ? askColor : bidColor;
-
-                        if (delta > 0) {
-                            // Ask (buy) - right side
-                            floatIdx = addQuad(volumeVertices, floatIdx,
-                                    barCenterX, priceY - tickHeight / 2,
-                                    barCenterX + width, priceY + tickHeight / 2,
-                                    color);
-                        } else if (delta < 0) {
-                            // Bid (sell) - left side
-                            floatIdx = addQuad(volumeVertices, floatIdx,
-                                    barCenterX - width, priceY - tickHeight / 2,
-                                    barCenterX, priceY + tickHeight / 2,
-                                    color);
-                        }
-                    }
-                    case VOLUME -> {
-                        // Total volume bar centered
-                        float totalVol = level.getTotalVolume();
-                        float width = totalVol / maxVolume * halfBar;
-                        float delta = level.getDelta();
-                        Color color = delta > 0 ? askColor : (delta < 0 ? bidColor : neutralColor);
-
-                        floatIdx = addQuad(volumeVertices, floatIdx,
-                                barCenterX - width / 2, priceY - tickHeight / 2,
-                                barCenterX + width / 2, priceY + tickHeight / 2,
-                                color);
-                    }
-                    case PROFILE -> {
-                        // Mini profile - single bar showing total volume
-                        float totalVol = level.getTotalVolume();
-                        float width = totalVol / maxVolume * barWidth;
-
-                        // Color gradient based on position in bar
-                        float ratio = (float) lvl / Math.max(1, levels.length - 1);
-                        Color color = blendColors(bidColor, askColor, ratio);
-
-                        floatIdx = addQuad(volumeVertices, floatIdx,
-                                barCenterX - halfBar, priceY - tickHeight / 2,
-                                barCenterX - halfBar + width, priceY + tickHeight / 2,
-                                color);
-                    }
-                    case BID_ASK -> {
-                        // Bid bar (left side)
-                        float bidWidth = level.getBidVolume() / maxVolume * halfBar;
-                        if (bidWidth > 0) {
-                            floatIdx = addQuad(volumeVertices, floatIdx,
-                                    barCenterX - bidWidth, priceY - tickHeight / 2,
-                                    barCenterX, priceY + tickHeight / 2,
-                                    bidColor);
-                        }
-
-                        // Ask bar (right side)
-                        float askWidth = level.getAskVolume() / maxVolume * halfBar;
-                        if (askWidth > 0) {
-                            floatIdx = addQuad(volumeVertices, floatIdx,
-                                    barCenterX, priceY - tickHeight / 2,
-                                    barCenterX + askWidth, priceY + tickHeight / 2,
-                                    askColor);
-                        }
-                    }
-                }
+        RenderDevice device = ctx.getDevice();
 
-                // POC highlight
-                if (showPOC && lvl == pocIdx) {
-                    floatIdx = addQuad(volumeVertices, floatIdx,
-                            barCenterX - halfBar, priceY - tickHeight / 2,
-                            barCenterX + halfBar, priceY + tickHeight / 2,
-                            pocColor, 0.3f);
-                }
-            }
-        }
+        defaultShader.bind();
+        defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
-        // Upload and draw
-        if (floatIdx > 0) {
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+        // Render imbalance backgrounds first (with alpha blending)
+        if (imbalanceFloatCount > 0) {
+            device.setBlendMode(BlendMode.ALPHA);
+            imbalanceBuffer.upload(imbalanceVertices, 0, imbalanceFloatCount);
+            imbalanceBuffer.draw(DrawMode.TRIANGLES);
+            device.setBlendMode(BlendMode.NONE);
+        }
 
-            volumeBuffer.upload(volumeVertices, 0, floatIdx);
+        // Render volume bars
+        if (volumeFloatCount > 0) {
+            volumeBuffer.upload(volumeVertices, 0, volumeFloatCount);
             volumeBuffer.draw(DrawMode.TRIANGLES);
-
-            defaultShader.unbind();
         }
-    }
 
-    private void renderImbalanceHighlights(RenderContext ctx, CoordinateSystem coords,
-                                            int firstIdx, int lastIdx, RenderDevice device) {
-        int estimatedImbalances = (lastIdx - firstIdx + 1) * 5;
-        ensureImbalanceCapacity(estimatedImbalances);
+        defaultShader.unbind();
+    }
 
-        FootprintBar[] bars = series.getBarsArray();
+    /**
+     * Maps the cached records of one channel for the visible bars to
+     * screen-space quads.
+     *
+     * @return the number of floats written
+     */
+    private int buildQuads(CoordinateSystem coords, int firstIdx, int lastIdx, int channel,
+                           float[] vertices, float halfBar, float volumeScale) {
         long[] timestamps = series.getTimestampsArray();
         float tickSize = series.getTickSize();
 
         int floatIdx = 0;
-
         for (int i = firstIdx; i <= lastIdx; i++) {
-            FootprintBar bar = bars[i];
-            if (bar == null) continue;
-
-            List<Imbalance> imbalances = bar.getImbalances(imbalanceThreshold);
-            if (imbalances.isEmpty()) continue;
+            int floatCount = geometryCache.getFloatCount(i, channel);
+            if (floatCount == 0) continue;
 
             float barCenterX = (float) coords.xValueToScreenX(timestamps[i]);
-            float barWidth = (float) ctx.getBarWidth() * 0.9f;
-            float halfBar = barWidth / 2;
+            floatIdx = emitRecords(geometryCache.getRecords(i, channel), floatCount,
+                    vertices, floatIdx, coords, barCenterX, halfBar, volumeScale, tickSize);
+        }
+        return floatIdx;
+    }
 
-            for (Imbalance imbalance : imbalances) {
-                float priceY = (float) coords.yValueToScreenY(imbalance.getPrice());
-                float tickHeight = (float) Math.abs(
-                        coords.yValueToScreenY(imbalance.getPrice() + tickSize) -
-                        coords.yValueToScreenY(imbalance.getPrice()));
+    // ========== Geometry cache ==========
 
-                // Ensure minimum visible height
-                tickHeight = Math.max(tickHeight, 2.0f);
+    /**
+     * Builds the cached records for a bar if they are missing or stale.
+     */
+    private void ensureGeometry(int index, FootprintBar bar) {
+        if (geometryCache.isValid(index)) {
+            return;
+        }
+        if (bar == null || bar.getLevelCount() == 0) {
+            geometryCache.store(index, CHANNEL_VOLUME, recordScratch, 0);
+            geometryCache.store(index, CHANNEL_IMBALANCE, recordScratch, 0);
+            geometryCache.markValid(index, 0);
+            return;
+        }
 
-                Color color = imbalance.isBuyImbalance() ? buyImbalanceColor : sellImbalanceColor;
+        FootprintLevel[] levels = bar.getLevelsArray();
+        int pocIdx = bar.getPOCIndex();
+        float maxVolume = 0;
+
+        // Up to bid + ask + POC per level
+        ensureRecordScratch(levels.length * 3);
+        int n = 0;
+
+        for (int lvl = 0; lvl < levels.length; lvl++) {
+            FootprintLevel level = levels[lvl];
+            float price = level.getPrice();
+            float totalVol = level.getTotalVolume();
+            maxVolume = Math.max(maxVolume, totalVol);
+
+            switch (displayMode) {
+                case DELTA -> {
+                    // Single bar showing delta direction: ask (buy) right, bid (sell) left
+                    float delta = level.getDelta();
+                    if (delta > 0) {
+                        n = addRecord(recordScratch, n, 0, 0, 0, delta, price, askColor);
+                    } else if (delta < 0) {
+                        n = addRecord(recordScratch, n, 0, delta, 0, 0, price, bidColor);
+                    }
+                }
+                case VOLUME -> {
+                    // Total volume bar centered
+                    float delta = level.getDelta();
+                    Color color = delta > 0 ? askColor : (delta < 0 ? bidColor : neutralColor);
+                    n = addRecord(recordScratch, n, 0, -totalVol / 2, 0, totalVol / 2, price, color);
+                }
+                case PROFILE -> {
+                    // Mini profile starting at the bar's left edge, full bar width at max volume
+                    float ratio = (float) lvl / Math.max(1, levels.length - 1);
+                    Color color = blendColors(bidColor, askColor, ratio);
+                    n = addRecord(recordScratch, n, -1, 0, -1, totalVol * 2, price, color);
+                }
+                case BID_ASK -> {
+                    // Bid bar (left side)
+                    if (level.getBidVolume() > 0) {
+                        n = addRecord(recordScratch, n, 0, -level.getBidVolume(), 0, 0, price, bidColor);
+                    }
+                    // Ask bar (right side)
+                    if (level.getAskVolume() > 0) {
+                        n = addRecord(recordScratch, n, 0, 0, 0, level.getAskVolume(), price, askColor);
+                    }
+                }
+            }
 
-                floatIdx = addQuad(imbalanceVertices, floatIdx,
-                        barCenterX - halfBar, priceY - tickHeight / 2,
-                        barCenterX + halfBar, priceY + tickHeight / 2,
-                        color);
+            // POC highlight
+            if (showPOC && lvl == pocIdx) {
+                n = addRecord(recordScratch, n, -1, 0, 1, 0, price, pocColor, 0.3f);
             }
         }
+        geometryCache.store(index, CHANNEL_VOLUME, recordScratch, n);
 
-        if (floatIdx > 0) {
-            // Enable alpha blending for semi-transparent highlights
-            device.setBlendMode(BlendMode.ALPHA);
-
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-            imbalanceBuffer.upload(imbalanceVertices, 0, floatIdx);
-            imbalanceBuffer.draw(DrawMode.TRIANGLES);
+        n = 0;
+        if (highlightImbalances) {
+            List<Imbalance> imbalances = bar.getImbalances(imbalanceThreshold);
+            ensureRecordScratch(imbalances.size());
+            for (Imbalance imbalance : imbalances) {
+                Color color = imbalance.isBuyImbalance() ? buyImbalanceColor : sellImbalanceColor;
+                n = addRecord(recordScratch, n, -1, 0, 1, 0, imbalance.getPrice(), color);
+            }
+        }
+        geometryCache.store(index, CHANNEL_IMBALANCE, recordScratch, n);
 
-            defaultShader.unbind();
+        geometryCache.markValid(index, maxVolume);
+    }
 
-            // Restore default blend mode
-            device.setBlendMode(BlendMode.NONE);
+    /**
+     * Maps cached records of one bar to screen-space quads.
+     */
+    private int emitRecords(float[] records, int floatCount, float[] vertices, int index,
+                            CoordinateSystem coords, float barCenterX, float halfBar,
+                            float volumeScale, float tickSize) {
+        for (int r = 0; r < floatCount; r += FLOATS_PER_RECORD) {
+            float x1 = barCenterX + records[r] * halfBar + records[r + 1] * volumeScale;
+            float x2 = barCenterX + records[r + 2] * halfBar + records[r + 3] * volumeScale;
+
+            float price = records[r + 4];
+            float priceY = (float) coords.yValueToScreenY(price);
+            float tickHeight = Math.abs((float) coords.yValueToScreenY(price + tickSize) - priceY);
+
+            // Ensure minimum visible height
+            tickHeight = Math.max(tickHeight, 2.0f);
+
+            index = addQuad(vertices, index,
+                    x1, priceY - tickHeight / 2, x2, priceY + tickHeight / 2,
+                    records[r + 5], records[r + 6], records[r + 7], records[r + 8]);
         }
+        return index;
     }
 
-    // ========== Helper methods ==========
-
-    private float findMaxVolume(int firstIdx, int lastIdx) {
-        float max = 0;
-        FootprintBar[] bars = series.getBarsArray();
-
+    private int countRecords(int firstIdx, int lastIdx, int channel) {
+        int count = 0;
         for (int i = firstIdx; i <= lastIdx; i++) {
-            FootprintBar bar = bars[i];
-            if (bar == null) continue;
-
-            for (FootprintLevel level : bar.getLevelsArray()) {
-                float vol = level.getTotalVolume();
-                if (vol > max) max = vol;
-            }
+            count += geometryCache.getFloatCount(i, channel);
         }
-        return max;
+        return count / FLOATS_PER_RECORD;
     }
 
+    private void invalidateGeometry() {
+        geometryCache.invalidateAll();
+        markDirty();
+    }
+
+    // ========== Helper methods ==========
+
     private int findFirstVisibleIndex(FootprintSeries series, RenderContext ctx) {
         long startTime = ctx.getViewport().getStartTime();
         return series.indexAtOrAfter(startTime);
@@ -555,17 +574,28 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
         return series.indexAtOrBefore(endTime);
     }
 
-    private int addQuad(float[] vertices, int index,
-                        float x1, float y1, float x2, float y2, Color color) {
-        return addQuad(vertices, index, x1, y1, x2, y2, color, color.getAlpha() / 255f);
+    private int addRecord(float[] records, int index, float u1, float v1, float u2, float v2,
+                          float price, Color color) {
+        return addRecord(records, index, u1, v1, u2, v2, price, color, color.getAlpha() / 255f);
     }
 
-    private int addQuad(float[] vertices, int index,
-                        float x1, float y1, float x2, float y2, Color color, float alpha) {
-        float r = color.getRed() / 255f;
-        float g = color.getGreen() / 255f;
-        float b = color.getBlue() / 255f;
+    private int addRecord(float[] records, int index, float u1, float v1, float u2, float v2,
+                          float price, Color color, float alpha) {
+        records[index++] = u1;
+        records[index++] = v1;
+        records[index++] = u2;
+        records[index++] = v2;
+        records[index++] = price;
+        records[index++] = color.getRed() / 255f;
+        records[index++] = color.getGreen() / 255f;
+        records[index++] = color.getBlue() / 255f;
+        records[index++] = alpha;
+        return index;
+    }
 
+    private int addQuad(float[] vertices, int index,
+                        float x1, float y1, float x2, float y2,
+                        float r, float g, float b, float alpha) {
         // Triangle 1: top-left, top-right, bottom-right
         index = addVertex(vertices, index, x1, y1, r, g, b, alpha);
         index = addVertex(vertices, index, x2, y1, r, g, b, alpha);
@@ -590,13 +620,12 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
         return index;
     }
 
-    private void ensureVolumeCapacity(int levelCount) {
-        // Each level may have up to 2 quads (bid + ask) + 1 POC quad = 3 quads
+    private void ensureVolumeCapacity(int quadCount) {
         // Each quad = 6 vertices * FLOATS_PER_VERTEX floats
-        int required = levelCount * 3 * 6 * FLOATS_PER_VERTEX;
+        int required = quadCount * 6 * FLOATS_PER_VERTEX;
         if (required > volumeVertices.length) {
-            volumeCapacity = levelCount + levelCount / 2;
-            volumeVertices = new float[volumeCapacity * 3 * 6 * FLOATS_PER_VERTEX];
+            volumeCapacity = quadCount + quadCount / 2;
+            volumeVertices = new float[volumeCapacity * 6 * FLOATS_PER_VERTEX];
         }
     }
 
@@ -608,6 +637,13 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
         }
     }
 
+    private void ensureRecordScratch(int recordCount) {
+        int required = recordCount * FLOATS_PER_RECORD;
+        if (required > recordScratch.length) {
+            recordScratch = new float[required + required / 2];
+        }
+    }
+
     private Color blendColors(Color c1, Color c2, float ratio) {
         float inv = 1.0f - ratio;
         int r = (int) (c1.getRed() * inv + c2.getRed() * ratio);
@@ -620,6 +656,7 @@ public class FootprintLayerV2 extends AbstractRenderLayer {
     @Override
     protected void doDispose(GL2ES2 gl) {
         // V2 resources are managed by ResourceManager
+        geometryCache.dispose();
         v2Initialized = false;
     }
 
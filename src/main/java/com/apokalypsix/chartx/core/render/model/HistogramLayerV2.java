@@ -47,6 +47,10 @@ public class HistogramLayerV2 extends AbstractRenderLayer {
     private float[] barVertices;
     private int vertexCapacity;
 
+    // Float count built by prepare() for the following render()
+    private int barFloatCount;
+    private boolean prepared;
+
     // Data
     private HistogramData data;
 
@@ -182,30 +186,22 @@ public class HistogramLayerV2 extends AbstractRenderLayer {
     }
 
     @Override
-    public void render(RenderContext ctx) {
-        // Check if abstracted API is available
-        if (!ctx.hasAbstractedAPI()) {
-            log.warn("HistogramLayerV2 requires abstracted API - skipping render");
-            return;
-        }
+    public boolean hasPreparePhase() {
+        return true;
+    }
 
-        // Initialize V2 resources if needed
-        if (!v2Initialized) {
-            initializeV2(ctx);
-        }
+    /**
+     * Builds the bar vertices of the visible range.
+     */
+    @Override
+    public void prepare(RenderContext ctx) {
+        barFloatCount = 0;
+        prepared = true;
 
         if (data == null || data.size() == 0) {
             return;
         }
 
-        if (defaultShader == null || !defaultShader.isValid()) {
-            return;
-        }
-
-        renderHistogramBars(ctx);
-    }
-
-    private void renderHistogramBars(RenderContext ctx) {
         Viewport viewport = ctx.getViewport();
         CoordinateSystem coords = ctx.getCoordinatesForData(data);
 
@@ -227,10 +223,33 @@ public class HistogramLayerV2 extends AbstractRenderLayer {
         double actualWidth = barWidth * barWidthRatio;
         double halfWidth = actualWidth / 2.0;
 
-        // Build vertex data
-        int floatCount = buildBarVertices(coords, firstIdx, lastIdx, halfWidth);
+        barFloatCount = buildBarVertices(coords, firstIdx, lastIdx, halfWidth);
+    }
+
+    @Override
+    public void render(RenderContext ctx) {
+        // Check if abstracted API is available
+        if (!ctx.hasAbstractedAPI()) {
+            log.warn("HistogramLayerV2 requires abstracted API - skipping render");
+            return;
+        }
+
+        if (!prepared) {
+            // Not prepared this frame (e.g. rendered outside the pipeline)
+            prepare(ctx);
+        }
+        prepared = false;
+
+        // Initialize V2 resources if needed
+        if (!v2Initialized) {
+            initializeV2(ctx);
+        }
 
-        if (floatCount == 0) {
+        if (barFloatCount == 0) {
+            return;
+        }
+
+        if (defaultShader == null || !defaultShader.isValid()) {
             return;
         }
 
@@ -238,7 +257,7 @@ public class HistogramLayerV2 extends AbstractRenderLayer {
         defaultShader.bind();
         defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
-        barBuffer.upload(barVertices, 0, floatCount);
+        barBuffer.upload(barVertices, 0, barFloatCount);
         barBuffer.draw(DrawMode.TRIANGLES);
 
         defaultShader.unbind();
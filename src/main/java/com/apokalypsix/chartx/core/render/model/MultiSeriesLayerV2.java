@@ -189,10 +189,23 @@ public class MultiSeriesLayerV2 extends AbstractRenderLayer {
      * @return minimum value, or Double.NaN if no valid data
      */
     public double getMinValue(int startIdx, int endIdx) {
+        return getMinValue(startIdx, endIdx, Long.MIN_VALUE);
+    }
+
+    /**
+     * Calculates the minimum Y value across all visible series in the given
+     * index range, as drawn in a viewport starting at the given time.
+     *
+     * @param startIdx start index
+     * @param endIdx end index
+     * @param viewportStart the viewport start time, or {@code Long.MIN_VALUE} if unknown
+     * @return minimum value, or Double.NaN if no valid data
+     */
+    public double getMinValue(int startIdx, int endIdx, long viewportStart) {
         double min = Double.NaN;
         for (RenderableSeries<?, ?> series : seriesList) {
             if (series.isVisible()) {
-                double seriesMin = series.getMinValue(startIdx, endIdx);
+                double seriesMin = series.getMinValue(startIdx, endIdx, viewportStart);
                 if (!Double.isNaN(seriesMin)) {
                     if (Double.isNaN(min) || seriesMin < min) {
                         min = seriesMin;
@@ -211,10 +224,23 @@ public class MultiSeriesLayerV2 extends AbstractRenderLayer {
      * @return maximum value, or Double.NaN if no valid data
      */
     public double getMaxValue(int startIdx, int endIdx) {
+        return getMaxValue(startIdx, endIdx, Long.MIN_VALUE);
+    }
+
+    /**
+     * Calculates the maximum Y value across all visible series in the given
+     * index range, as drawn in a viewport starting at the given time.
+     *
+     * @param startIdx start index
+     * @param endIdx end index
+     * @param viewportStart the viewport start time, or {@code Long.MIN_VALUE} if unknown
+     * @return maximum value, or Double.NaN if no valid data
+     */
+    public double getMaxValue(int startIdx, int endIdx, long viewportStart) {
         double max = Double.NaN;
         for (RenderableSeries<?, ?> series : seriesList) {
             if (series.isVisible()) {
-                double seriesMax = series.getMaxValue(startIdx, endIdx);
+                double seriesMax = series.getMaxValue(startIdx, endIdx, viewportStart);
                 if (!Double.isNaN(seriesMax)) {
                     if (Double.isNaN(max) || seriesMax > max) {
                         max = seriesMax;
@@ -11,6 +11,7 @@ import com.apokalypsix.chartx.chart.data.OHLCBar;
 import com.apokalypsix.chartx.chart.data.OhlcData;
 import com.apokalypsix.chartx.chart.data.Timeframe;
 import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+import com.apokalypsix.chartx.core.data.SharedDataCache;
 import com.apokalypsix.chartx.core.data.TimeframeAggregator;
 import com.apokalypsix.chartx.core.render.gl.GLResourceManager;
 import com.apokalypsix.chartx.core.render.api.BlendMode;
@@ -69,6 +70,7 @@ public class MultiTimeframeOverlayLayerV2 extends AbstractRenderLayer {
     // Source and aggregated data
     private OhlcData sourceData;
     private OhlcData htfData;
+    private SharedDataCache.Lease<OhlcData> htfLease;  // Shared with other charts on the same source
     private Timeframe htfTimeframe = Timeframe.M5;
     private boolean htfDirty = true;
 
@@ -128,7 +130,6 @@ public class MultiTimeframeOverlayLayerV2 extends AbstractRenderLayer {
 
             @Override
             public void onDataCleared(Data<?> data) {
-                htfData = null;
                 htfDirty = true;
                 markDirty();
             }
@@ -145,6 +146,7 @@ public class MultiTimeframeOverlayLayerV2 extends AbstractRenderLayer {
             this.sourceData.removeListener(aggregationListener);
         }
 
+        releaseHTFData();
         this.sourceData = data;
         this.htfDirty = true;
 
@@ -167,6 +169,7 @@ public class MultiTimeframeOverlayLayerV2 extends AbstractRenderLayer {
      */
     public void setHTFTimeframe(Timeframe timeframe) {
         if (this.htfTimeframe != timeframe) {
+            releaseHTFData();
             this.htfTimeframe = timeframe;
             this.htfDirty = true;
             markDirty();
@@ -392,6 +395,7 @@ public class MultiTimeframeOverlayLayerV2 extends AbstractRenderLayer {
         if (sourceData != null) {
             sourceData.removeListener(aggregationListener);
         }
+        releaseHTFData();
     }
 
     /**
@@ -427,10 +431,22 @@ public class MultiTimeframeOverlayLayerV2 extends AbstractRenderLayer {
             return;
         }
 
-        htfData = TimeframeAggregator.aggregate(sourceData, htfTimeframe);
+        // The shared series is updated incrementally by the cache itself
+        if (htfLease == null) {
+            htfLease = TimeframeAggregator.aggregateShared(sourceData, htfTimeframe);
+        }
+        htfData = htfLease.get();
         htfDirty = false;
     }
 
+    private void releaseHTFData() {
+        if (htfLease != null) {
+            htfLease.release();
+            htfLease = null;
+        }
+        htfData = null;
+    }
+
     private void buildVertices(RenderContext ctx, CoordinateSystem coords) {
         bodyVertexCount = 0;
         wickVertexCount = 0;
@@ -3,6 +3,7 @@ package com.apokalypsix.chartx.core.render.model;
 import java.awt.Color;
 import java.util.ArrayList;
 import java.util.List;
+import java.util.concurrent.ForkJoinTask;
 
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
@@ -19,6 +20,7 @@ import com.apokalypsix.chartx.core.render.api.DrawMode;
 import com.apokalypsix.chartx.core.render.api.RenderDevice;
 import com.apokalypsix.chartx.core.render.api.ResourceManager;
 import com.apokalypsix.chartx.core.render.api.Shader;
+import com.apokalypsix.chartx.core.render.util.VertexArena;
 import com.jogamp.opengl.GL2ES2;
 
 /**
@@ -49,6 +51,11 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
         public final XyData data;
         public final LineSeriesOptions options;
 
+        // Segment vertices acquired from the frame arena in prepare();
+        // floatCount < 0 until prepared this frame
+        private float[] vertices;
+        private int floatCount = -1;
+
         public LineOverlay(XyData data, LineSeriesOptions options) {
             this.data = data;
             this.options = options != null ? options : new LineSeriesOptions();
@@ -71,6 +78,9 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
     private final List<LineOverlay> lineOverlays = new ArrayList<>();
     private final List<ScatterOverlay> scatterOverlays = new ArrayList<>();
 
+    // Line overlays built in the current prepare phase
+    private final List<LineOverlay> preparedLines = new ArrayList<>();
+
     // V2 API resources
     private Buffer lineBuffer;
     private Buffer areaBuffer;
@@ -78,11 +88,6 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
     private Shader defaultShader;
     private boolean v2Initialized = false;
 
-    // Vertex data arrays (reused across frames to minimize allocation)
-    private float[] lineVertices;
-    private float[] areaVertices;
-    private float[] scatterVertices;
-
     // Floats per vertex: x, y, r, g, b, a
     private static final int FLOATS_PER_VERTEX = 6;
 
@@ -97,9 +102,6 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
 
     public OverlayLayerV2() {
         super(Z_ORDER);
-        lineVertices = new float[INITIAL_LINE_CAPACITY * FLOATS_PER_VERTEX];
-        areaVertices = new float[INITIAL_AREA_CAPACITY * FLOATS_PER_VERTEX];
-        scatterVertices = new float[INITIAL_SCATTER_CAPACITY * FLOATS_PER_VERTEX];
     }
 
     // ========== Overlay Management ==========
@@ -220,27 +222,69 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
     // ========== Rendering ==========
 
     @Override
-    public void render(RenderContext ctx) {
-        // Check if abstracted API is available
-        if (!ctx.hasAbstractedAPI()) {
-            log.warn("OverlayLayerV2 requires abstracted API - skipping render");
-            return;
-        }
+    public boolean hasPreparePhase() {
+        return true;
+    }
 
-        // Initialize V2 resources if needed
-        if (!v2Initialized) {
-            initializeV2(ctx);
+    /**
+     * Builds the segment vertices of all visible plain line overlays, one
+     * fork/join task per series when called from the pipeline's pool.
+     */
+    @Override
+    public void prepare(RenderContext ctx) {
+        // Arrays of a frame that was never rendered were reclaimed by the arena reset
+        for (LineOverlay overlay : preparedLines) {
+            overlay.vertices = null;
+            overlay.floatCount = -1;
+        }
+        preparedLines.clear();
+        for (LineOverlay overlay : lineOverlays) {
+            if (overlay.options.isVisible() && overlay.data.size() > 0
+                    && overlay.options.getDisplayMode() == LineSeriesOptions.DisplayMode.LINE) {
+                preparedLines.add(overlay);
+            }
         }
 
-        if (defaultShader == null || !defaultShader.isValid()) {
-            return;
+        if (preparedLines.size() > 1 && ForkJoinTask.inForkJoinPool()) {
+            ForkJoinTask<?>[] tasks = new ForkJoinTask<?>[preparedLines.size()];
+            for (int i = 0; i < tasks.length; i++) {
+                LineOverlay overlay = preparedLines.get(i);
+                tasks[i] = ForkJoinTask.adapt(() -> buildLineVertices(ctx, overlay));
+            }
+            ForkJoinTask.invokeAll(tasks);
+        } else {
+            for (LineOverlay overlay : preparedLines) {
+                buildLineVertices(ctx, overlay);
+            }
         }
+    }
 
-        // Render line series overlays
-        renderLineOverlays(ctx);
+    @Override
+    public void render(RenderContext ctx) {
+        try {
+            // Check if abstracted API is available
+            if (!ctx.hasAbstractedAPI()) {
+                log.warn("OverlayLayerV2 requires abstracted API - skipping render");
+                return;
+            }
 
-        // Render scatter series overlays
-        renderScatterOverlays(ctx);
+            // Initialize V2 resources if needed
+            if (!v2Initialized) {
+                initializeV2(ctx);
+            }
+
+            if (defaultShader == null || !defaultShader.isValid()) {
+                return;
+            }
+
+            // Render line series overlays
+            renderLineOverlays(ctx);
+
+            // Render scatter series overlays
+            renderScatterOverlays(ctx);
+        } finally {
+            releasePreparedLines(ctx);
+        }
     }
 
     /**
@@ -273,6 +317,59 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
      * Renders a line overlay as connected line segments.
      */
     private void renderLineData(RenderContext ctx, LineOverlay overlay) {
+        if (overlay.floatCount < 0) {
+            // Not prepared this frame (e.g. added after the prepare phase)
+            buildLineVertices(ctx, overlay);
+        }
+        int floatCount = overlay.floatCount;
+        float[] vertices = overlay.vertices;
+        overlay.floatCount = -1;
+        overlay.vertices = null;
+
+        try {
+            if (floatCount <= 0) {
+                return;
+            }
+
+            // Set line width
+            RenderDevice device = ctx.getDevice();
+            device.setLineWidth(overlay.options.getLineWidth());
+
+            defaultShader.bind();
+            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+
+            lineBuffer.upload(vertices, 0, floatCount);
+            lineBuffer.draw(DrawMode.LINES);
+
+            defaultShader.unbind();
+        } finally {
+            ctx.getVertexArena().release(vertices);
+        }
+    }
+
+    /**
+     * Releases the vertices of prepared overlays that were not drawn, e.g.
+     * because the layer skipped rendering, so a later frame never uploads
+     * arrays the arena has handed out again.
+     */
+    private void releasePreparedLines(RenderContext ctx) {
+        for (LineOverlay overlay : preparedLines) {
+            ctx.getVertexArena().release(overlay.vertices);
+            overlay.vertices = null;
+            overlay.floatCount = -1;
+        }
+        preparedLines.clear();
+    }
+
+    /**
+     * Builds the segment vertices of a line overlay into an arena array.
+     * Touches no state shared with other overlays, so overlays can be built
+     * concurrently.
+     */
+    private void buildLineVertices(RenderContext ctx, LineOverlay overlay) {
+        overlay.floatCount = 0;
+        overlay.vertices = null;
+
         Viewport viewport = ctx.getViewport();
         CoordinateSystem coords = ctx.getCoordinatesForData(overlay.data);
 
@@ -298,9 +395,10 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
         float b = color.getBlue() / 255f;
         float a = overlay.options.getOpacity();
 
-        // Ensure capacity for line vertices (2 vertices per segment)
-        int maxSegments = endIdx - startIdx;
-        ensureLineCapacity(maxSegments * 2);
+        // Line vertices (2 vertices per segment), released after upload
+        int requiredFloats = (endIdx - startIdx) * 2 * FLOATS_PER_VERTEX;
+        float[] vertices = ctx.getVertexArena().acquire(requiredFloats);
+        overlay.vertices = vertices;
 
         int floatIndex = 0;
         float prevX = Float.NaN;
@@ -321,8 +419,8 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
 
             if (hasPrevious) {
                 // Add line segment from previous to current
-                floatIndex = addColoredVertex(lineVertices, floatIndex, prevX, prevY, r, g, b, a);
-                floatIndex = addColoredVertex(lineVertices, floatIndex, x, y, r, g, b, a);
+                floatIndex = addColoredVertex(vertices, floatIndex, prevX, prevY, r, g, b, a);
+                floatIndex = addColoredVertex(vertices, floatIndex, x, y, r, g, b, a);
             }
 
             prevX = x;
@@ -330,21 +428,7 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
             hasPrevious = true;
         }
 
-        if (floatIndex == 0) {
-            return;
-        }
-
-        // Set line width
-        RenderDevice device = ctx.getDevice();
-        device.setLineWidth(overlay.options.getLineWidth());
-
-        defaultShader.bind();
-        defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-        lineBuffer.upload(lineVertices, 0, floatIndex);
-        lineBuffer.draw(DrawMode.LINES);
-
-        defaultShader.unbind();
+        overlay.floatCount = floatIndex;
     }
 
     /**
@@ -387,55 +471,59 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
         // Baseline Y position
         float baselineY = (float) coords.yValueToScreenY(overlay.options.getBaseline());
 
-        // Ensure capacity for area triangles (2 triangles per segment = 6 vertices)
+        // Area triangles (2 triangles per segment = 6 vertices), released after upload
         int maxSegments = endIdx - startIdx;
-        ensureAreaCapacity(maxSegments * 6);
-
-        int areaFloatIndex = 0;
-
-        float prevX = Float.NaN;
-        float prevY = Float.NaN;
-        boolean hasPrevious = false;
-
-        for (int i = startIdx; i <= endIdx; i++) {
-            float value = values[i];
-
-            // Skip NaN values
-            if (Float.isNaN(value)) {
-                hasPrevious = false;
-                continue;
-            }
-
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float y = (float) coords.yValueToScreenY(value);
-
-            if (hasPrevious) {
-                // Create quad as two triangles for filled area
-                // Triangle 1: prevX,prevY -> prevX,baseline -> x,baseline
-                areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, prevX, prevY, fr, fg, fb, fa);
-                areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, prevX, baselineY, fr, fg, fb, fa);
-                areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, x, baselineY, fr, fg, fb, fa);
-
-                // Triangle 2: prevX,prevY -> x,baseline -> x,y
-                areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, prevX, prevY, fr, fg, fb, fa);
-                areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, x, baselineY, fr, fg, fb, fa);
-                areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, x, y, fr, fg, fb, fa);
+        VertexArena arena = ctx.getVertexArena();
+        float[] areaVertices = arena.acquire(maxSegments * 6 * FLOATS_PER_VERTEX);
+        try {
+            int areaFloatIndex = 0;
+
+            float prevX = Float.NaN;
+            float prevY = Float.NaN;
+            boolean hasPrevious = false;
+
+            for (int i = startIdx; i <= endIdx; i++) {
+                float value = values[i];
+
+                // Skip NaN values
+                if (Float.isNaN(value)) {
+                    hasPrevious = false;
+                    continue;
+                }
+
+                float x = (float) coords.xValueToScreenX(timestamps[i]);
+                float y = (float) coords.yValueToScreenY(value);
+
+                if (hasPrevious) {
+                    // Create quad as two triangles for filled area
+                    // Triangle 1: prevX,prevY -> prevX,baseline -> x,baseline
+                    areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, prevX, prevY, fr, fg, fb, fa);
+                    areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, prevX, baselineY, fr, fg, fb, fa);
+                    areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, x, baselineY, fr, fg, fb, fa);
+
+                    // Triangle 2: prevX,prevY -> x,baseline -> x,y
+                    areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, prevX, prevY, fr, fg, fb, fa);
+                    areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, x, baselineY, fr, fg, fb, fa);
+                    areaFloatIndex = addColoredVertex(areaVertices, areaFloatIndex, x, y, fr, fg, fb, fa);
+                }
+
+                prevX = x;
+                prevY = y;
+                hasPrevious = true;
             }
 
-            prevX = x;
-            prevY = y;
-            hasPrevious = true;
-        }
-
-        // Draw filled area
-        if (areaFloatIndex > 0) {
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+            // Draw filled area
+            if (areaFloatIndex > 0) {
+                defaultShader.bind();
+                defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
-            areaBuffer.upload(areaVertices, 0, areaFloatIndex);
-            areaBuffer.draw(DrawMode.TRIANGLES);
+                areaBuffer.upload(areaVertices, 0, areaFloatIndex);
+                areaBuffer.draw(DrawMode.TRIANGLES);
 
-            defaultShader.unbind();
+                defaultShader.unbind();
+            }
+        } finally {
+            arena.release(areaVertices);
         }
 
         // Draw line on top of area if enabled
@@ -453,48 +541,52 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
                                          int startIdx, int endIdx,
                                          float r, float g, float b, float a) {
         int maxSegments = endIdx - startIdx;
-        ensureLineCapacity(maxSegments * 2);
-
-        int floatIndex = 0;
-        float prevX = Float.NaN;
-        float prevY = Float.NaN;
-        boolean hasPrevious = false;
-
-        for (int i = startIdx; i <= endIdx; i++) {
-            float value = values[i];
-
-            if (Float.isNaN(value)) {
-                hasPrevious = false;
-                continue;
+        VertexArena arena = ctx.getVertexArena();
+        float[] lineVertices = arena.acquire(maxSegments * 2 * FLOATS_PER_VERTEX);
+        try {
+            int floatIndex = 0;
+            float prevX = Float.NaN;
+            float prevY = Float.NaN;
+            boolean hasPrevious = false;
+
+            for (int i = startIdx; i <= endIdx; i++) {
+                float value = values[i];
+
+                if (Float.isNaN(value)) {
+                    hasPrevious = false;
+                    continue;
+                }
+
+                float x = (float) coords.xValueToScreenX(timestamps[i]);
+                float y = (float) coords.yValueToScreenY(value);
+
+                if (hasPrevious) {
+                    floatIndex = addColoredVertex(lineVertices, floatIndex, prevX, prevY, r, g, b, a);
+                    floatIndex = addColoredVertex(lineVertices, floatIndex, x, y, r, g, b, a);
+                }
+
+                prevX = x;
+                prevY = y;
+                hasPrevious = true;
             }
 
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float y = (float) coords.yValueToScreenY(value);
-
-            if (hasPrevious) {
-                floatIndex = addColoredVertex(lineVertices, floatIndex, prevX, prevY, r, g, b, a);
-                floatIndex = addColoredVertex(lineVertices, floatIndex, x, y, r, g, b, a);
+            if (floatIndex == 0) {
+                return;
             }
 
-            prevX = x;
-            prevY = y;
-            hasPrevious = true;
-        }
-
-        if (floatIndex == 0) {
-            return;
-        }
+            RenderDevice device = ctx.getDevice();
+            device.setLineWidth(overlay.options.getLineWidth());
 
-        RenderDevice device = ctx.getDevice();
-        device.setLineWidth(overlay.options.getLineWidth());
-
-        defaultShader.bind();
-        defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+            defaultShader.bind();
+            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
-        lineBuffer.upload(lineVertices, 0, floatIndex);
-        lineBuffer.draw(DrawMode.LINES);
+            lineBuffer.upload(lineVertices, 0, floatIndex);
+            lineBuffer.draw(DrawMode.LINES);
 
-        defaultShader.unbind();
+            defaultShader.unbind();
+        } finally {
+            arena.release(lineVertices);
+        }
     }
 
     /**
@@ -527,48 +619,52 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
 
         // Step lines need 2 segments per data point (horizontal + vertical)
         int maxSegments = (endIdx - startIdx) * 2;
-        ensureLineCapacity(maxSegments * 2);
-
-        int floatIndex = 0;
-        float prevX = Float.NaN;
-        float prevY = Float.NaN;
-        boolean hasPrevious = false;
-
-        for (int i = startIdx; i <= endIdx; i++) {
-            float value = values[i];
-
-            if (Float.isNaN(value)) {
-                hasPrevious = false;
-                continue;
+        VertexArena arena = ctx.getVertexArena();
+        float[] lineVertices = arena.acquire(maxSegments * 2 * FLOATS_PER_VERTEX);
+        try {
+            int floatIndex = 0;
+            float prevX = Float.NaN;
+            float prevY = Float.NaN;
+            boolean hasPrevious = false;
+
+            for (int i = startIdx; i <= endIdx; i++) {
+                float value = values[i];
+
+                if (Float.isNaN(value)) {
+                    hasPrevious = false;
+                    continue;
+                }
+
+                float x = (float) coords.xValueToScreenX(timestamps[i]);
+                float y = (float) coords.yValueToScreenY(value);
+
+                if (hasPrevious) {
+                    floatIndex = addStepSegments(lineVertices, floatIndex,
+                            prevX, prevY, x, y, mode, r, g, b, a);
+                }
+
+                prevX = x;
+                prevY = y;
+                hasPrevious = true;
             }
 
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float y = (float) coords.yValueToScreenY(value);
-
-            if (hasPrevious) {
-                floatIndex = addStepSegments(lineVertices, floatIndex,
-                        prevX, prevY, x, y, mode, r, g, b, a);
+            if (floatIndex == 0) {
+                return;
             }
 
-            prevX = x;
-            prevY = y;
-            hasPrevious = true;
-        }
+            RenderDevice device = ctx.getDevice();
+            device.setLineWidth(overlay.options.getLineWidth());
 
-        if (floatIndex == 0) {
-            return;
-        }
-
-        RenderDevice device = ctx.getDevice();
-        device.setLineWidth(overlay.options.getLineWidth());
-
-        defaultShader.bind();
-        defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+            defaultShader.bind();
+            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
-        lineBuffer.upload(lineVertices, 0, floatIndex);
-        lineBuffer.draw(DrawMode.LINES);
+            lineBuffer.upload(lineVertices, 0, floatIndex);
+            lineBuffer.draw(DrawMode.LINES);
 
-        defaultShader.unbind();
+            defaultShader.unbind();
+        } finally {
+            arena.release(lineVertices);
+        }
     }
 
     /**
@@ -656,36 +752,40 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
         float b = color.getBlue() / 255f;
         float a = overlay.options.getOpacity();
 
-        // Ensure capacity for scatter marker triangles
+        // Scatter marker triangles, released after upload
         int pointCount = endIdx - startIdx + 1;
-        ensureScatterCapacity(pointCount * VERTICES_PER_MARKER);
+        VertexArena arena = ctx.getVertexArena();
+        float[] scatterVertices = arena.acquire(pointCount * VERTICES_PER_MARKER * FLOATS_PER_VERTEX);
+        try {
+            int floatIndex = 0;
 
-        int floatIndex = 0;
+            for (int i = startIdx; i <= endIdx; i++) {
+                float value = values[i];
 
-        for (int i = startIdx; i <= endIdx; i++) {
-            float value = values[i];
+                if (Float.isNaN(value)) {
+                    continue;
+                }
 
-            if (Float.isNaN(value)) {
-                continue;
-            }
+                float x = (float) coords.xValueToScreenX(timestamps[i]);
+                float y = (float) coords.yValueToScreenY(value);
 
-            float x = (float) coords.xValueToScreenX(timestamps[i]);
-            float y = (float) coords.yValueToScreenY(value);
-
-            floatIndex = addMarkerGeometry(scatterVertices, floatIndex, x, y, size, shape, r, g, b, a);
-        }
+                floatIndex = addMarkerGeometry(scatterVertices, floatIndex, x, y, size, shape, r, g, b, a);
+            }
 
-        if (floatIndex == 0) {
-            return;
-        }
+            if (floatIndex == 0) {
+                return;
+            }
 
-        defaultShader.bind();
-        defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+            defaultShader.bind();
+            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
-        scatterBuffer.upload(scatterVertices, 0, floatIndex);
-        scatterBuffer.draw(DrawMode.TRIANGLES);
+            scatterBuffer.upload(scatterVertices, 0, floatIndex);
+            scatterBuffer.draw(DrawMode.TRIANGLES);
 
-        defaultShader.unbind();
+            defaultShader.unbind();
+        } finally {
+            arena.release(scatterVertices);
+        }
     }
 
     /**
@@ -890,29 +990,6 @@ public class OverlayLayerV2 extends AbstractRenderLayer {
         return index;
     }
 
-    // ========== Capacity Management ==========
-
-    private void ensureLineCapacity(int vertexCount) {
-        int requiredFloats = vertexCount * FLOATS_PER_VERTEX;
-        if (requiredFloats > lineVertices.length) {
-            lineVertices = new float[requiredFloats + requiredFloats / 2];
-        }
-    }
-
-    private void ensureAreaCapacity(int vertexCount) {
-        int requiredFloats = vertexCount * FLOATS_PER_VERTEX;
-        if (requiredFloats > areaVertices.length) {
-            areaVertices = new float[requiredFloats + requiredFloats / 2];
-        }
-    }
-
-    private void ensureScatterCapacity(int vertexCount) {
-        int requiredFloats = vertexCount * FLOATS_PER_VERTEX;
-        if (requiredFloats > scatterVertices.length) {
-            scatterVertices = new float[requiredFloats + requiredFloats / 2];
-        }
-    }
-
     // ========== Disposal ==========
 
     @Override
@@ -0,0 +1,340 @@
+package com.apokalypsix.chartx.core.render.model;
+
+import java.awt.Color;
+import java.util.EnumMap;
+import java.util.Map;
+
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import com.apokalypsix.chartx.chart.axis.Viewport;
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+import com.apokalypsix.chartx.core.data.CandlePatternIndex;
+import com.apokalypsix.chartx.core.data.CandlePatternIndex.Bias;
+import com.apokalypsix.chartx.core.data.CandlePatternIndex.Pattern;
+import com.apokalypsix.chartx.core.render.gl.GLResourceManager;
+import com.apokalypsix.chartx.core.render.api.Buffer;
+import com.apokalypsix.chartx.core.render.api.BufferDescriptor;
+import com.apokalypsix.chartx.core.render.api.DrawMode;
+import com.apokalypsix.chartx.core.render.api.ResourceManager;
+import com.apokalypsix.chartx.core.render.api.Shader;
+import com.apokalypsix.chartx.core.render.util.VertexArena;
+import com.jogamp.opengl.GL2ES2;
+
+/**
+ * Render layer marking candlestick pattern hits using the abstracted rendering API.
+ *
+ * <p>Hits are read straight from the bitsets of the data's
+ * {@link CandlePatternIndex}; no annotation object is created per hit. All
+ * visible markers of all enabled patterns are written into one vertex array
+ * and drawn with a single call. Bullish patterns are marked with an upward
+ * triangle below the low, bearish patterns with a downward triangle above the
+ * high and neutral patterns with a diamond above the high.
+ *
+ * <p>When zoomed out, at most one marker per pattern is drawn per pixel
+ * column.
+ */
+public class PatternMarkerLayerV2 extends AbstractRenderLayer {
+
+    private static final Logger log = LoggerFactory.getLogger(PatternMarkerLayerV2.class);
+
+    /** Z-order for pattern markers (above drawings, below annotations) */
+    public static final int Z_ORDER = 650;
+
+    // Floats per vertex: x, y, r, g, b, a
+    private static final int FLOATS_PER_VERTEX = 6;
+    // Vertices per marker (diamond = 2 triangles)
+    private static final int VERTICES_PER_MARKER = 6;
+
+    private static final Pattern[] PATTERNS = Pattern.values();
+
+    // V2 API resources
+    private Buffer markerBuffer;
+    private Shader defaultShader;
+    private boolean v2Initialized = false;
+
+    // Data
+    private OhlcData data;
+
+    // Marker styling
+    private final Map<Pattern, Color> colors = new EnumMap<>(Pattern.class);
+    private final Map<Pattern, Boolean> enabled = new EnumMap<>(Pattern.class);
+    private float markerSize = 8f;
+    private float offset = 4f;
+
+    /**
+     * Creates a pattern marker layer showing all patterns.
+     */
+    public PatternMarkerLayerV2() {
+        super(Z_ORDER);
+        for (Pattern pattern : PATTERNS) {
+            enabled.put(pattern, Boolean.TRUE);
+            colors.put(pattern, defaultColor(pattern.getBias()));
+        }
+    }
+
+    private static Color defaultColor(Bias bias) {
+        switch (bias) {
+            case BULLISH:
+                return new Color(38, 166, 91);
+            case BEARISH:
+                return new Color(214, 69, 65);
+            default:
+                return new Color(240, 180, 40);
+        }
+    }
+
+    /**
+     * Sets the OHLC data to scan.
+     * Repaints automatically.
+     */
+    public void setData(OhlcData data) {
+        this.data = data;
+        markDirty();
+        requestRepaint();
+    }
+
+    /**
+     * Returns the current data.
+     */
+    public OhlcData getData() {
+        return data;
+    }
+
+    /**
+     * Shows or hides the markers of a pattern.
+     * Repaints automatically.
+     */
+    public void setPatternEnabled(Pattern pattern, boolean visible) {
+        enabled.put(pattern, visible);
+        markDirty();
+        requestRepaint();
+    }
+
+    /**
+     * Returns true if markers of the pattern are shown.
+     */
+    public boolean isPatternEnabled(Pattern pattern) {
+        return enabled.get(pattern);
+    }
+
+    /**
+     * Sets the marker color of a pattern.
+     * Repaints automatically.
+     */
+    public void setPatternColor(Pattern pattern, Color color) {
+        colors.put(pattern, color);
+        markDirty();
+        requestRepaint();
+    }
+
+    /**
+     * Returns the marker color of a pattern.
+     */
+    public Color getPatternColor(Pattern pattern) {
+        return colors.get(pattern);
+    }
+
+    /**
+     * Sets the marker size in pixels.
+     * Repaints automatically.
+     */
+    public void setMarkerSize(float size) {
+        this.markerSize = Math.max(2f, size);
+        markDirty();
+        requestRepaint();
+    }
+
+    /**
+     * Sets the gap between the bar and its marker in pixels.
+     * Repaints automatically.
+     */
+    public void setOffset(float offset) {
+        this.offset = Math.max(0f, offset);
+        markDirty();
+        requestRepaint();
+    }
+
+    @Override
+    protected void doInitialize(GL2ES2 gl, GLResourceManager resources) {
+        // V2 resources are initialized lazily when first rendered with a valid RenderContext
+        log.debug("PatternMarkerLayerV2 GL initialized (v2 resources will init on first render)");
+    }
+
+    /**
+     * Initializes V2 resources using the abstracted API.
+     */
+    private void initializeV2(RenderContext ctx) {
+        ResourceManager resources = ctx.getResourceManager();
+
+        int initialCapacity = 256 * VERTICES_PER_MARKER * FLOATS_PER_VERTEX;
+        markerBuffer = resources.getOrCreateBuffer("patterns.markers",
+                BufferDescriptor.positionColor2D(initialCapacity));
+
+        defaultShader = resources.getShader(ResourceManager.SHADER_DEFAULT);
+
+        v2Initialized = true;
+        log.debug("PatternMarkerLayerV2 V2 resources initialized");
+    }
+
+    @Override
+    public void render(RenderContext ctx) {
+        if (!ctx.hasAbstractedAPI()) {
+            log.warn("PatternMarkerLayerV2 requires abstracted API - skipping render");
+            return;
+        }
+
+        if (!v2Initialized) {
+            initializeV2(ctx);
+        }
+
+        if (data == null || data.size() == 0) {
+            return;
+        }
+
+        if (defaultShader == null || !defaultShader.isValid()) {
+            return;
+        }
+
+        renderMarkers(ctx);
+    }
+
+    private void renderMarkers(RenderContext ctx) {
+        Viewport viewport = ctx.getViewport();
+        CoordinateSystem coords = ctx.getCoordinatesForData(data);
+
+        int firstIdx = data.indexAtOrAfter(viewport.getStartTime());
+        int lastIdx = data.indexAtOrBefore(viewport.getEndTime());
+        if (firstIdx < 0 || lastIdx < 0 || firstIdx > lastIdx) {
+            return;
+        }
+
+        CandlePatternIndex patterns = data.getPatterns();
+        patterns.ensure(lastIdx + 1);
+
+        // Upper bound of markers: hits per pattern, capped by one per pixel column
+        int columns = viewport.getWidth() + 2;
+        int markerCount = 0;
+        for (Pattern pattern : PATTERNS) {
+            if (enabled.get(pattern)) {
+                markerCount += Math.min(columns, patterns.countHits(pattern, firstIdx, lastIdx + 1));
+            }
+        }
+        if (markerCount == 0) {
+            return;
+        }
+
+        VertexArena arena = ctx.getVertexArena();
+        float[] vertices = arena.acquire(markerCount * VERTICES_PER_MARKER * FLOATS_PER_VERTEX);
+        try {
+            int floatCount = 0;
+            for (Pattern pattern : PATTERNS) {
+                if (enabled.get(pattern)) {
+                    floatCount = buildPatternVertices(vertices, floatCount, patterns, pattern,
+                            coords, firstIdx, lastIdx + 1);
+                }
+            }
+            if (floatCount == 0) {
+                return;
+            }
+
+            defaultShader.bind();
+            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+
+            markerBuffer.upload(vertices, 0, floatCount);
+            markerBuffer.draw(DrawMode.TRIANGLES);
+
+            defaultShader.unbind();
+        } finally {
+            arena.release(vertices);
+        }
+    }
+
+    private int buildPatternVertices(float[] vertices, int floatIndex, CandlePatternIndex patterns,
+                                     Pattern pattern, CoordinateSystem coords, int from, int to) {
+        long[] timestamps = data.getTimestampsArray();
+        float[] high = data.getHighArray();
+        float[] low = data.getLowArray();
+
+        Color color = colors.get(pattern);
+        float r = color.getRed() / 255f;
+        float g = color.getGreen() / 255f;
+        float b = color.getBlue() / 255f;
+        float a = color.getAlpha() / 255f;
+
+        Bias bias = pattern.getBias();
+        float half = markerSize / 2f;
+        int lastColumn = Integer.MIN_VALUE;
+
+        for (int i = patterns.nextHit(pattern, from, to); i >= 0; i = patterns.nextHit(pattern, i + 1, to)) {
+            float x = (float) coords.xValueToScreenX(timestamps[i]);
+            int column = (int) x;
+            if (column == lastColumn) {
+                continue;
+            }
+            if (floatIndex + VERTICES_PER_MARKER * FLOATS_PER_VERTEX > vertices.length) {
+                break;
+            }
+            lastColumn = column;
+
+            if (bias == Bias.BULLISH) {
+                // Triangle pointing up, below the low
+                float top = (float) coords.yValueToScreenY(low[i]) + offset;
+                floatIndex = addVertex(vertices, floatIndex, x, top, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x - half, top + markerSize, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x + half, top + markerSize, r, g, b, a);
+            } else if (bias == Bias.BEARISH) {
+                // Triangle pointing down, above the high
+                float bottom = (float) coords.yValueToScreenY(high[i]) - offset;
+                floatIndex = addVertex(vertices, floatIndex, x, bottom, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x + half, bottom - markerSize, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x - half, bottom - markerSize, r, g, b, a);
+            } else {
+                // Diamond above the high
+                float bottom = (float) coords.yValueToScreenY(high[i]) - offset;
+                float cy = bottom - half;
+                floatIndex = addVertex(vertices, floatIndex, x, bottom, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x + half, cy, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x, bottom - markerSize, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x, bottom, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x, bottom - markerSize, r, g, b, a);
+                floatIndex = addVertex(vertices, floatIndex, x - half, cy, r, g, b, a);
+            }
+        }
+        return floatIndex;
+    }
+
+    private static int addVertex(float[] vertices, int index, float x, float y,
+                                 float r, float g, float b, float a) {
+        vertices[index++] = x;
+        vertices[index++] = y;
+        vertices[index++] = r;
+        vertices[index++] = g;
+        vertices[index++] = b;
+        vertices[index++] = a;
+        return index;
+    }
+
+    @Override
+    protected void doDispose(GL2ES2 gl) {
+        // V2 resources are managed by ResourceManager
+        v2Initialized = false;
+    }
+
+    /**
+     * Disposes V2 resources.
+     * Call this when the RenderContext is available during cleanup.
+     */
+    public void disposeV2(RenderContext ctx) {
+        if (v2Initialized && ctx.hasAbstractedAPI()) {
+            ResourceManager resources = ctx.getResourceManager();
+            if (resources != null) {
+                resources.disposeBuffer("patterns.markers");
+            }
+            markerBuffer = null;
+            defaultShader = null;
+            v2Initialized = false;
+        }
+    }
+}
@@ -2,12 +2,19 @@ package com.apokalypsix.chartx.core.render.model;
 
 import java.awt.Color;
 import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.LinkedHashSet;
 import java.util.List;
+import java.util.Set;
+import java.util.function.Predicate;
+import java.util.function.ToDoubleFunction;
 
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
 import com.apokalypsix.chartx.chart.axis.Viewport;
+import com.apokalypsix.chartx.chart.axis.scale.AxisScale;
 import com.apokalypsix.chartx.chart.overlay.region.PriceRangeRegion;
 import com.apokalypsix.chartx.chart.overlay.region.TimeRangeRegion;
 import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
@@ -28,6 +35,15 @@ import com.jogamp.opengl.GL2ES2;
  * <p>Time range regions are rendered as filled rectangles spanning the full chart height.
  * Price range regions are rendered as filled rectangles spanning the full chart width.
  * Both support optional borders and are rendered behind the main chart data.
+ *
+ * <p>Regions are kept in interval indices sorted by start (time) and by
+ * minimum price, with a running maximum of the end/maximum price. The visible
+ * window is found by binary search, so a chart with thousands of session
+ * regions only pays for the ones on screen. Built geometry is reused while
+ * the viewport, the axis mapping and the regions are unchanged; in-place
+ * edits to a region are
+ * picked up through {@link TimeRangeRegion#getModificationCount()} and
+ * {@link PriceRangeRegion#getModificationCount()}.
  */
 public class RegionLayerV2 extends AbstractRenderLayer {
 
@@ -36,8 +52,29 @@ public class RegionLayerV2 extends AbstractRenderLayer {
     /** Z-order for region layer (renders early, behind most content) */
     public static final int Z_ORDER = 50;
 
-    private final List<TimeRangeRegion> timeRegions = new ArrayList<>();
-    private final List<PriceRangeRegion> priceRegions = new ArrayList<>();
+    // Insertion-ordered; regions compare by ID
+    private final Set<TimeRangeRegion> timeRegions = new LinkedHashSet<>();
+    private final Set<PriceRangeRegion> priceRegions = new LinkedHashSet<>();
+
+    // Sorted interval indices, rebuilt when the region sets or any region changes
+    private final IntervalIndex<TimeRangeRegion> timeIndex = new IntervalIndex<>();
+    private final IntervalIndex<PriceRangeRegion> priceIndex = new IntervalIndex<>();
+    private long indexVersion = -1;
+
+    // Geometry of the last build, reused while the viewport and axis mapping are unchanged
+    private boolean geometryValid;
+    private int fillFloatCount;
+    private int borderFloatCount;
+    private long cachedStartTime;
+    private long cachedEndTime;
+    private double cachedMinPrice;
+    private double cachedMaxPrice;
+    private int cachedWidth;
+    private int cachedHeight;
+    private long cachedInsets;
+    private AxisScale cachedScale;
+    private double cachedMinPriceY;
+    private double cachedMaxPriceY;
 
     // V2 API resources
     private Buffer fillBuffer;
@@ -101,10 +138,8 @@ public class RegionLayerV2 extends AbstractRenderLayer {
      * Adds a time range region to this layer.
      */
     public void addRegion(TimeRangeRegion region) {
-        if (!timeRegions.contains(region)) {
-            timeRegions.add(region);
-            markDirty();
-            requestRepaint();
+        if (timeRegions.add(region)) {
+            regionsChanged();
         }
     }
 
@@ -112,16 +147,8 @@ public class RegionLayerV2 extends AbstractRenderLayer {
      * Batch add multiple time range regions (single repaint at end).
      */
     public void addAllRegions(List<TimeRangeRegion> regions) {
-        boolean added = false;
-        for (TimeRangeRegion region : regions) {
-            if (!timeRegions.contains(region)) {
-                timeRegions.add(region);
-                added = true;
-            }
-        }
-        if (added) {
-            markDirty();
-            requestRepaint();
+        if (timeRegions.addAll(regions)) {
+            regionsChanged();
         }
     }
 
@@ -130,8 +157,7 @@ public class RegionLayerV2 extends AbstractRenderLayer {
      */
     public void removeRegion(TimeRangeRegion region) {
         if (timeRegions.remove(region)) {
-            markDirty();
-            requestRepaint();
+            regionsChanged();
         }
     }
 
@@ -140,8 +166,7 @@ public class RegionLayerV2 extends AbstractRenderLayer {
      */
     public void removeTimeRegion(String id) {
         if (timeRegions.removeIf(r -> r.getId().equals(id))) {
-            markDirty();
-            requestRepaint();
+            regionsChanged();
         }
     }
 
@@ -151,8 +176,7 @@ public class RegionLayerV2 extends AbstractRenderLayer {
     public void clearTimeRegions() {
         if (!timeRegions.isEmpty()) {
             timeRegions.clear();
-            markDirty();
-            requestRepaint();
+            regionsChanged();
         }
     }
 
@@ -165,14 +189,11 @@ public class RegionLayerV2 extends AbstractRenderLayer {
 
     /**
      * Returns the time region at the specified timestamp, if any.
+     * When regions overlap, the one added first wins.
      */
     public TimeRangeRegion getTimeRegionAt(long timestamp) {
-        for (TimeRangeRegion region : timeRegions) {
-            if (region.isVisible() && region.contains(timestamp)) {
-                return region;
-            }
-        }
-        return null;
+        ensureIndices();
+        return timeIndex.findContaining(timestamp, TimeRangeRegion::isVisible);
     }
 
     // ========== Price Region management ==========
@@ -181,10 +202,8 @@ public class RegionLayerV2 extends AbstractRenderLayer {
      * Adds a price range region to this layer.
      */
     public void addPriceRegion(PriceRangeRegion region) {
-        if (!priceRegions.contains(region)) {
-            priceRegions.add(region);
-            markDirty();
-            requestRepaint();
+        if (priceRegions.add(region)) {
+            regionsChanged();
         }
     }
 
@@ -192,16 +211,8 @@ public class RegionLayerV2 extends AbstractRenderLayer {
      * Batch add multiple price range regions (single repaint at end).
      */
     public void addAllPriceRegions(List<PriceRangeRegion> regions) {
-        boolean added = false;
-        for (PriceRangeRegion region : regions) {
-            if (!priceRegions.contains(region)) {
-                priceRegions.add(region);
-                added = true;
-            }
-        }
-        if (added) {
-            markDirty();
-            requestRepaint();
+        if (priceRegions.addAll(regions)) {
+            regionsChanged();
         }
     }
 
@@ -210,8 +221,7 @@ public class RegionLayerV2 extends AbstractRenderLayer {
      */
     public void removePriceRegion(PriceRangeRegion region) {
         if (priceRegions.remove(region)) {
-            markDirty();
-            requestRepaint();
+            regionsChanged();
         }
     }
 
@@ -220,8 +230,7 @@ public class RegionLayerV2 extends AbstractRenderLayer {
      */
     public void removePriceRegion(String id) {
         if (priceRegions.removeIf(r -> r.getId().equals(id))) {
-            markDirty();
-            requestRepaint();
+            regionsChanged();
         }
     }
 
@@ -231,8 +240,7 @@ public class RegionLayerV2 extends AbstractRenderLayer {
     public void clearPriceRegions() {
         if (!priceRegions.isEmpty()) {
             priceRegions.clear();
-            markDirty();
-            requestRepaint();
+            regionsChanged();
         }
     }
 
@@ -245,14 +253,11 @@ public class RegionLayerV2 extends AbstractRenderLayer {
 
     /**
      * Returns the price region at the specified price, if any.
+     * When regions overlap, the one added first wins.
      */
     public PriceRangeRegion getPriceRegionAt(double price) {
-        for (PriceRangeRegion region : priceRegions) {
-            if (region.isVisible() && region.contains(price)) {
-                return region;
-            }
-        }
-        return null;
+        ensureIndices();
+        return priceIndex.findContaining(price, PriceRangeRegion::isVisible);
     }
 
     // ========== Combined operations ==========
@@ -264,8 +269,7 @@ public class RegionLayerV2 extends AbstractRenderLayer {
         if (!timeRegions.isEmpty() || !priceRegions.isEmpty()) {
             timeRegions.clear();
             priceRegions.clear();
-            markDirty();
-            requestRepaint();
+            regionsChanged();
         }
     }
 
@@ -323,28 +327,15 @@ public class RegionLayerV2 extends AbstractRenderLayer {
         Viewport viewport = ctx.getViewport();
         CoordinateSystem coords = ctx.getCoordinates();
 
-        // Filter visible regions
-        List<TimeRangeRegion> visibleTimeRegions = getVisibleTimeRegions(viewport);
-        List<PriceRangeRegion> visiblePriceRegions = getVisiblePriceRegions(viewport);
+        ensureIndices();
+        if (!isGeometryCurrent(coords, viewport)) {
+            buildGeometry(coords, viewport);
+        }
 
-        if (visibleTimeRegions.isEmpty() && visiblePriceRegions.isEmpty()) {
+        if (fillFloatCount == 0 && borderFloatCount == 0) {
             return;
         }
 
-        // Ensure capacity
-        int totalRegions = visibleTimeRegions.size() + visiblePriceRegions.size();
-        ensureCapacity(totalRegions);
-
-        // Build vertex data for both region types
-        int fillFloatCount = 0;
-        int borderFloatCount = 0;
-
-        fillFloatCount = buildTimeRegionFillVertices(visibleTimeRegions, coords, viewport, fillFloatCount);
-        fillFloatCount = buildPriceRegionFillVertices(visiblePriceRegions, coords, viewport, fillFloatCount);
-
-        borderFloatCount = buildTimeRegionBorderVertices(visibleTimeRegions, coords, viewport, borderFloatCount);
-        borderFloatCount = buildPriceRegionBorderVertices(visiblePriceRegions, coords, viewport, borderFloatCount);
-
         // Get shader
         if (defaultShader == null || !defaultShader.isValid()) {
             return;
@@ -368,158 +359,116 @@ public class RegionLayerV2 extends AbstractRenderLayer {
         defaultShader.unbind();
     }
 
-    private List<TimeRangeRegion> getVisibleTimeRegions(Viewport viewport) {
-        List<TimeRangeRegion> visible = new ArrayList<>();
-        long startTime = viewport.getStartTime();
-        long endTime = viewport.getEndTime();
+    /**
+     * Records a structural change to the region sets.
+     */
+    private void regionsChanged() {
+        indexVersion = -1;
+        markDirty();
+        requestRepaint();
+    }
 
-        for (TimeRangeRegion region : timeRegions) {
-            if (region.isVisible() && region.overlaps(startTime, endTime)) {
-                visible.add(region);
-            }
+    /**
+     * Rebuilds the interval indices if regions were added, removed or edited
+     * in place since the last build.
+     */
+    private void ensureIndices() {
+        long modCount = TimeRangeRegion.getModificationCount() + PriceRangeRegion.getModificationCount();
+        if (indexVersion == modCount) {
+            return;
         }
-        return visible;
+        timeIndex.rebuild(timeRegions, TimeRangeRegion::getStartTime, TimeRangeRegion::getEndTime);
+        priceIndex.rebuild(priceRegions, PriceRangeRegion::getMinPrice, PriceRangeRegion::getMaxPrice);
+        indexVersion = modCount;
+        geometryValid = false;
     }
 
-    private List<PriceRangeRegion> getVisiblePriceRegions(Viewport viewport) {
-        List<PriceRangeRegion> visible = new ArrayList<>();
+    /**
+     * Returns true if the last build is still valid. Besides the viewport,
+     * the Y mapping is compared through the axis scale and the screen
+     * positions of the viewport's price range, which change when the Y axis
+     * is auto-ranged or rescaled independently of the viewport.
+     */
+    private boolean isGeometryCurrent(CoordinateSystem coords, Viewport viewport) {
+        return geometryValid
+                && cachedScale == coords.getYAxisScale()
+                && cachedMinPriceY == coords.yValueToScreenY(viewport.getMinPrice())
+                && cachedMaxPriceY == coords.yValueToScreenY(viewport.getMaxPrice())
+                && cachedStartTime == viewport.getStartTime()
+                && cachedEndTime == viewport.getEndTime()
+                && cachedMinPrice == viewport.getMinPrice()
+                && cachedMaxPrice == viewport.getMaxPrice()
+                && cachedWidth == viewport.getWidth()
+                && cachedHeight == viewport.getHeight()
+                && cachedInsets == packInsets(viewport);
+    }
+
+    private void buildGeometry(CoordinateSystem coords, Viewport viewport) {
+        long startTime = viewport.getStartTime();
+        long endTime = viewport.getEndTime();
         double minPrice = viewport.getMinPrice();
         double maxPrice = viewport.getMaxPrice();
 
-        for (PriceRangeRegion region : priceRegions) {
-            if (region.isVisible() && region.overlaps(minPrice, maxPrice)) {
-                visible.add(region);
-            }
-        }
-        return visible;
-    }
-
-    private int buildTimeRegionFillVertices(List<TimeRangeRegion> visibleRegions,
-                                             CoordinateSystem coords, Viewport viewport, int floatIndex) {
-        int chartTop = viewport.getTopInset();
-        int chartBottom = viewport.getHeight() - viewport.getBottomInset();
-
-        for (TimeRangeRegion region : visibleRegions) {
-            Color fillColor = region.getFillColor();
-            if (fillColor == null) {
-                continue;
-            }
+        // Only regions inside these windows can intersect the viewport
+        int timeFrom = timeIndex.windowStart(startTime);
+        int timeTo = timeIndex.windowEnd(endTime);
+        int priceFrom = priceIndex.windowStart(minPrice);
+        int priceTo = priceIndex.windowEnd(maxPrice);
 
-            float left = (float) coords.xValueToScreenX(region.getStartTime());
-            float right = (float) coords.xValueToScreenX(region.getEndTime());
-
-            // Clamp to visible area
-            left = Math.max(left, viewport.getLeftInset());
-            right = Math.min(right, viewport.getWidth() - viewport.getRightInset());
+        ensureCapacity(Math.max(0, timeTo - timeFrom) + Math.max(0, priceTo - priceFrom));
 
-            if (left >= right) {
-                continue;
-            }
-
-            float r = fillColor.getRed() / 255f;
-            float g = fillColor.getGreen() / 255f;
-            float b = fillColor.getBlue() / 255f;
-            float a = fillColor.getAlpha() / 255f;
-
-            // Triangle 1: top-left, bottom-left, bottom-right
-            floatIndex = addVertex(fillVertices, floatIndex, left, chartTop, r, g, b, a);
-            floatIndex = addVertex(fillVertices, floatIndex, left, chartBottom, r, g, b, a);
-            floatIndex = addVertex(fillVertices, floatIndex, right, chartBottom, r, g, b, a);
-
-            // Triangle 2: top-left, bottom-right, top-right
-            floatIndex = addVertex(fillVertices, floatIndex, left, chartTop, r, g, b, a);
-            floatIndex = addVertex(fillVertices, floatIndex, right, chartBottom, r, g, b, a);
-            floatIndex = addVertex(fillVertices, floatIndex, right, chartTop, r, g, b, a);
-        }
-
-        return floatIndex;
-    }
-
-    private int buildPriceRegionFillVertices(List<PriceRangeRegion> visibleRegions,
-                                              CoordinateSystem coords, Viewport viewport, int floatIndex) {
         int chartLeft = viewport.getLeftInset();
         int chartRight = viewport.getWidth() - viewport.getRightInset();
-
-        for (PriceRangeRegion region : visibleRegions) {
-            Color fillColor = region.getFillColor();
-            if (fillColor == null) {
-                continue;
-            }
-
-            // Note: Y axis is inverted (higher price = lower screen Y)
-            float top = (float) coords.yValueToScreenY(region.getMaxPrice());
-            float bottom = (float) coords.yValueToScreenY(region.getMinPrice());
-
-            // Clamp to visible area
-            top = Math.max(top, viewport.getTopInset());
-            bottom = Math.min(bottom, viewport.getHeight() - viewport.getBottomInset());
-
-            if (top >= bottom) {
-                continue;
-            }
-
-            float r = fillColor.getRed() / 255f;
-            float g = fillColor.getGreen() / 255f;
-            float b = fillColor.getBlue() / 255f;
-            float a = fillColor.getAlpha() / 255f;
-
-            // Triangle 1: top-left, bottom-left, bottom-right
-            floatIndex = addVertex(fillVertices, floatIndex, chartLeft, top, r, g, b, a);
-            floatIndex = addVertex(fillVertices, floatIndex, chartLeft, bottom, r, g, b, a);
-            floatIndex = addVertex(fillVertices, floatIndex, chartRight, bottom, r, g, b, a);
-
-            // Triangle 2: top-left, bottom-right, top-right
-            floatIndex = addVertex(fillVertices, floatIndex, chartLeft, top, r, g, b, a);
-            floatIndex = addVertex(fillVertices, floatIndex, chartRight, bottom, r, g, b, a);
-            floatIndex = addVertex(fillVertices, floatIndex, chartRight, top, r, g, b, a);
-        }
-
-        return floatIndex;
-    }
-
-    private int buildTimeRegionBorderVertices(List<TimeRangeRegion> visibleRegions,
-                                               CoordinateSystem coords, Viewport viewport, int floatIndex) {
         int chartTop = viewport.getTopInset();
         int chartBottom = viewport.getHeight() - viewport.getBottomInset();
 
-        for (TimeRangeRegion region : visibleRegions) {
-            Color borderColor = region.getBorderColor();
-            if (borderColor == null) {
+        int fillIndex = 0;
+        int borderIndex = 0;
+
+        for (int i = timeFrom; i < timeTo; i++) {
+            TimeRangeRegion region = timeIndex.get(i);
+            if (!region.isVisible() || !timeIndex.overlaps(i, startTime, endTime)) {
                 continue;
             }
 
             float left = (float) coords.xValueToScreenX(region.getStartTime());
             float right = (float) coords.xValueToScreenX(region.getEndTime());
 
-            float r = borderColor.getRed() / 255f;
-            float g = borderColor.getGreen() / 255f;
-            float b = borderColor.getBlue() / 255f;
-            float a = borderColor.getAlpha() / 255f;
-
-            // Left vertical line (if visible)
-            if (left >= viewport.getLeftInset() && left <= viewport.getWidth() - viewport.getRightInset()) {
-                floatIndex = addVertex(borderVertices, floatIndex, left, chartTop, r, g, b, a);
-                floatIndex = addVertex(borderVertices, floatIndex, left, chartBottom, r, g, b, a);
+            Color fillColor = region.getFillColor();
+            if (fillColor != null) {
+                // Clamp to visible area
+                float fillLeft = Math.max(left, chartLeft);
+                float fillRight = Math.min(right, chartRight);
+                if (fillLeft < fillRight) {
+                    fillIndex = addQuad(fillVertices, fillIndex,
+                            fillLeft, chartTop, fillRight, chartBottom, fillColor);
+                }
             }
 
-            // Right vertical line (if visible)
-            if (right >= viewport.getLeftInset() && right <= viewport.getWidth() - viewport.getRightInset()) {
-                floatIndex = addVertex(borderVertices, floatIndex, right, chartTop, r, g, b, a);
-                floatIndex = addVertex(borderVertices, floatIndex, right, chartBottom, r, g, b, a);
+            Color borderColor = region.getBorderColor();
+            if (borderColor != null) {
+                float r = borderColor.getRed() / 255f;
+                float g = borderColor.getGreen() / 255f;
+                float b = borderColor.getBlue() / 255f;
+                float a = borderColor.getAlpha() / 255f;
+
+                // Left vertical line (if visible)
+                if (left >= chartLeft && left <= chartRight) {
+                    borderIndex = addVertex(borderVertices, borderIndex, left, chartTop, r, g, b, a);
+                    borderIndex = addVertex(borderVertices, borderIndex, left, chartBottom, r, g, b, a);
+                }
+
+                // Right vertical line (if visible)
+                if (right >= chartLeft && right <= chartRight) {
+                    borderIndex = addVertex(borderVertices, borderIndex, right, chartTop, r, g, b, a);
+                    borderIndex = addVertex(borderVertices, borderIndex, right, chartBottom, r, g, b, a);
+                }
             }
         }
 
-        return floatIndex;
-    }
-
-    private int buildPriceRegionBorderVertices(List<PriceRangeRegion> visibleRegions,
-                                                CoordinateSystem coords, Viewport viewport, int floatIndex) {
-        int chartLeft = viewport.getLeftInset();
-        int chartRight = viewport.getWidth() - viewport.getRightInset();
-
-        for (PriceRangeRegion region : visibleRegions) {
-            Color borderColor = region.getBorderColor();
-            if (borderColor == null) {
+        for (int i = priceFrom; i < priceTo; i++) {
+            PriceRangeRegion region = priceIndex.get(i);
+            if (!region.isVisible() || !priceIndex.overlaps(i, minPrice, maxPrice)) {
                 continue;
             }
 
@@ -527,25 +476,78 @@ public class RegionLayerV2 extends AbstractRenderLayer {
             float top = (float) coords.yValueToScreenY(region.getMaxPrice());
             float bottom = (float) coords.yValueToScreenY(region.getMinPrice());
 
-            float r = borderColor.getRed() / 255f;
-            float g = borderColor.getGreen() / 255f;
-            float b = borderColor.getBlue() / 255f;
-            float a = borderColor.getAlpha() / 255f;
-
-            // Top horizontal line (if visible)
-            if (top >= viewport.getTopInset() && top <= viewport.getHeight() - viewport.getBottomInset()) {
-                floatIndex = addVertex(borderVertices, floatIndex, chartLeft, top, r, g, b, a);
-                floatIndex = addVertex(borderVertices, floatIndex, chartRight, top, r, g, b, a);
+            Color fillColor = region.getFillColor();
+            if (fillColor != null) {
+                // Clamp to visible area
+                float fillTop = Math.max(top, chartTop);
+                float fillBottom = Math.min(bottom, chartBottom);
+                if (fillTop < fillBottom) {
+                    fillIndex = addQuad(fillVertices, fillIndex,
+                            chartLeft, fillTop, chartRight, fillBottom, fillColor);
+                }
             }
 
-            // Bottom horizontal line (if visible)
-            if (bottom >= viewport.getTopInset() && bottom <= viewport.getHeight() - viewport.getBottomInset()) {
-                floatIndex = addVertex(borderVertices, floatIndex, chartLeft, bottom, r, g, b, a);
-                floatIndex = addVertex(borderVertices, floatIndex, chartRight, bottom, r, g, b, a);
+            Color borderColor = region.getBorderColor();
+            if (borderColor != null) {
+                float r = borderColor.getRed() / 255f;
+                float g = borderColor.getGreen() / 255f;
+                float b = borderColor.getBlue() / 255f;
+                float a = borderColor.getAlpha() / 255f;
+
+                // Top horizontal line (if visible)
+                if (top >= chartTop && top <= chartBottom) {
+                    borderIndex = addVertex(borderVertices, borderIndex, chartLeft, top, r, g, b, a);
+                    borderIndex = addVertex(borderVertices, borderIndex, chartRight, top, r, g, b, a);
+                }
+
+                // Bottom horizontal line (if visible)
+                if (bottom >= chartTop && bottom <= chartBottom) {
+                    borderIndex = addVertex(borderVertices, borderIndex, chartLeft, bottom, r, g, b, a);
+                    borderIndex = addVertex(borderVertices, borderIndex, chartRight, bottom, r, g, b, a);
+                }
             }
         }
 
-        return floatIndex;
+        fillFloatCount = fillIndex;
+        borderFloatCount = borderIndex;
+
+        cachedStartTime = startTime;
+        cachedEndTime = endTime;
+        cachedMinPrice = minPrice;
+        cachedMaxPrice = maxPrice;
+        cachedWidth = viewport.getWidth();
+        cachedHeight = viewport.getHeight();
+        cachedInsets = packInsets(viewport);
+        cachedScale = coords.getYAxisScale();
+        cachedMinPriceY = coords.yValueToScreenY(minPrice);
+        cachedMaxPriceY = coords.yValueToScreenY(maxPrice);
+        geometryValid = true;
+    }
+
+    private static long packInsets(Viewport viewport) {
+        return ((long) (viewport.getLeftInset() & 0xFFFF) << 48)
+                | ((long) (viewport.getRightInset() & 0xFFFF) << 32)
+                | ((long) (viewport.getTopInset() & 0xFFFF) << 16)
+                | (viewport.getBottomInset() & 0xFFFF);
+    }
+
+    private int addQuad(float[] vertices, int index, float left, float top,
+                        float right, float bottom, Color color) {
+        float r = color.getRed() / 255f;
+        float g = color.getGreen() / 255f;
+        float b = color.getBlue() / 255f;
+        float a = color.getAlpha() / 255f;
+
+        // Triangle 1: top-left, bottom-left, bottom-right
+        index = addVertex(vertices, index, left, top, r, g, b, a);
+        index = addVertex(vertices, index, left, bottom, r, g, b, a);
+        index = addVertex(vertices, index, right, bottom, r, g, b, a);
+
+        // Triangle 2: top-left, bottom-right, top-right
+        index = addVertex(vertices, index, left, top, r, g, b, a);
+        index = addVertex(vertices, index, right, bottom, r, g, b, a);
+        index = addVertex(vertices, index, right, top, r, g, b, a);
+        return index;
     }
 
     private int addVertex(float[] vertices, int index, float x, float y,
@@ -578,6 +580,7 @@ public class RegionLayerV2 extends AbstractRenderLayer {
     protected void doDispose(GL2ES2 gl) {
         // V2 resources are managed by ResourceManager
         v2Initialized = false;
+        geometryValid = false;
     }
 
     /**
@@ -597,4 +600,121 @@ public class RegionLayerV2 extends AbstractRenderLayer {
             v2Initialized = false;
         }
     }
+
+    // ========== Interval index ==========
+
+    /**
+     * Intervals sorted by their low bound, with a running maximum of the high
+     * bound so the first interval that can reach a given value is found by
+     * binary search.
+     */
+    private static final class IntervalIndex<T> {
+
+        private Object[] items = new Object[0];
+        private double[] lows = new double[0];
+        private double[] highs = new double[0];
+        private double[] maxHighs = new double[0];
+        // Insertion position of each interval, for first-added tie breaking
+        private int[] ordinals = new int[0];
+        private int size;
+
+        void rebuild(Collection<T> source, ToDoubleFunction<T> low, ToDoubleFunction<T> high) {
+            Object[] unsorted = source.toArray();
+            size = unsorted.length;
+
+            double[] unsortedLows = new double[size];
+            Integer[] order = new Integer[size];
+            for (int i = 0; i < size; i++) {
+                @SuppressWarnings("unchecked")
+                T item = (T) unsorted[i];
+                unsortedLows[i] = low.applyAsDouble(item);
+                order[i] = i;
+            }
+            Arrays.sort(order, (a, b) -> Double.compare(unsortedLows[a], unsortedLows[b]));
+
+            if (items.length < size) {
+                items = new Object[size];
+                lows = new double[size];
+                highs = new double[size];
+                maxHighs = new double[size];
+                ordinals = new int[size];
+            }
+
+            double runningMax = Double.NEGATIVE_INFINITY;
+            for (int i = 0; i < size; i++) {
+                int src = order[i];
+                @SuppressWarnings("unchecked")
+                T item = (T) unsorted[src];
+                items[i] = item;
+                lows[i] = unsortedLows[src];
+                highs[i] = high.applyAsDouble(item);
+                ordinals[i] = src;
+                runningMax = Math.max(runningMax, highs[i]);
+                maxHighs[i] = runningMax;
+            }
+            Arrays.fill(items, size, items.length, null);
+        }
+
+        /**
+         * Returns the first position whose interval could end after {@code low}.
+         */
+        int windowStart(double low) {
+            return firstAbove(maxHighs, low, false);
+        }
+
+        /**
+         * Returns the end (exclusive) of the positions starting before {@code high}.
+         */
+        int windowEnd(double high) {
+            return firstAbove(lows, high, true);
+        }
+
+        /**
+         * Returns true if the interval at a window position overlaps (low, high).
+         */
+        boolean overlaps(int position, double low, double high) {
+            return lows[position] < high && highs[position] > low;
+        }
+
+        @SuppressWarnings("unchecked")
+        T get(int position) {
+            return (T) items[position];
+        }
+
+        /**
+         * Returns the earliest-added accepted interval containing the value.
+         */
+        T findContaining(double value, Predicate<T> accept) {
+            int from = firstAbove(maxHighs, value, true);
+            int to = firstAbove(lows, value, false);
+            T found = null;
+            int foundOrdinal = Integer.MAX_VALUE;
+            for (int i = from; i < to; i++) {
+                if (highs[i] >= value && ordinals[i] < foundOrdinal && accept.test(get(i))) {
+                    found = get(i);
+                    foundOrdinal = ordinals[i];
+                }
+            }
+            return found;
+        }
+
+        /**
+         * First index in a non-decreasing array whose value is greater than
+         * {@code value} (or greater or equal when {@code inclusive}).
+         */
+        private int firstAbove(double[] sorted, double value, boolean inclusive) {
+            int lo = 0;
+            int hi = size;
+            while (lo < hi) {
+                int mid = (lo + hi) >>> 1;
+                boolean above = inclusive ? sorted[mid] >= value : sorted[mid] > value;
+                if (above) {
+                    hi = mid;
+                } else {
+                    lo = mid + 1;
+                }
+            }
+            return lo;
+        }
+    }
 }
@@ -9,6 +9,7 @@ import com.apokalypsix.chartx.core.coordinate.YAxisManager;
 import com.apokalypsix.chartx.core.render.gl.GLResourceManager;
 import com.apokalypsix.chartx.core.render.api.RenderDevice;
 import com.apokalypsix.chartx.core.render.api.ResourceManager;
+import com.apokalypsix.chartx.core.render.util.VertexArena;
 import com.jogamp.opengl.GL2ES2;
 
 /**
@@ -55,6 +56,9 @@ public class RenderContext {
     // Category axis for categorical charts
     private CategoryAxis categoryAxis;
 
+    // Vertex scratch memory shared by all layers of the frame
+    private VertexArena vertexArena;
+
     /**
      * Creates a render context for the current frame.
      *
@@ -257,6 +261,28 @@ public class RenderContext {
         return scaleFactor;
     }
 
+    // ========== Vertex memory ==========
+
+    /**
+     * Sets the arena layers acquire vertex scratch arrays from.
+     *
+     * @param arena the pipeline's arena
+     */
+    public synchronized void setVertexArena(VertexArena arena) {
+        this.vertexArena = arena;
+    }
+
+    /**
+     * Returns the arena for vertex scratch arrays. A context not created by a
+     * pipeline gets its own arena, which lives only as long as the context.
+     */
+    public synchronized VertexArena getVertexArena() {
+        if (vertexArena == null) {
+            vertexArena = new VertexArena();
+        }
+        return vertexArena;
+    }
+
     // ========== Category axis ==========
 
     /**
@@ -43,6 +43,27 @@ public interface RenderLayer {
      */
     void render(RenderContext ctx);
 
+    /**
+     * Returns true if this layer builds its geometry in {@link #prepare}.
+     */
+    default boolean hasPreparePhase() {
+        return false;
+    }
+
+    /**
+     * Builds this layer's vertex data for the frame before any layer renders.
+     *
+     * <p>The pipeline may call this on a worker thread, concurrently with the
+     * prepare phase of other layers. Implementations must only read frame
+     * state (viewport, coordinates, data) and write arrays owned by the layer;
+     * buffer uploads, shader binds and draws belong in {@link #render}, which
+     * is always called afterwards on the render thread in z-order.
+     *
+     * @param ctx the render context for this frame
+     */
+    default void prepare(RenderContext ctx) {
+    }
+
     /**
      * Returns true if this layer needs to be redrawn.
      */
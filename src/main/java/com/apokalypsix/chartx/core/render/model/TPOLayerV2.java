@@ -1,6 +1,7 @@
 package com.apokalypsix.chartx.core.render.model;
 
 import java.awt.Color;
+import java.util.Arrays;
 import java.util.List;
 
 import org.slf4j.Logger;
@@ -41,6 +42,12 @@ import com.jogamp.opengl.GL2ES2;
  * <p>Currently renders BLOCKS mode. Text letters (A, B, C...) are rendered
  * separately and not included in this V2 layer.
  *
+ * <h2>Geometry Caching</h2>
+ * <p>TPO blocks and single-print highlights are cached per profile in data
+ * space (see {@link BarGeometryCache}). Completed sessions are built once;
+ * only the forming session is rebuilt every frame, and a style change on the
+ * series or layer rebuilds everything.
+ *
  * <h2>Overlay Mode</h2>
  * <p>When overlay mode is enabled, TPO renders on top of candlesticks with
  * semi-transparency, allowing both chart types to be visible simultaneously.
@@ -66,12 +73,26 @@ public class TPOLayerV2 extends AbstractRenderLayer {
     private Shader defaultShader;
     private boolean v2Initialized = false;
 
+    // Cached records: u1, v1, u2, v2, price, r, g, b, a
+    // Screen x = profileStartX + u * profileWidth + v * blockGap
+    private static final int FLOATS_PER_RECORD = 9;
+    private static final int CHANNEL_BLOCKS = 0;
+    private static final int CHANNEL_SINGLE_PRINTS = 1;
+
+    private final BarGeometryCache geometryCache = new BarGeometryCache(2);
+    private float[] recordScratch = new float[256 * FLOATS_PER_RECORD];
+
     // Reusable arrays for vertex data (avoid allocation during render)
     private float[] blockVertices;
     private float[] highlightVertices;
     private int blockCapacity;
     private int highlightCapacity;
 
+    // Float counts built by prepare() for the following render()
+    private int highlightFloatCount;
+    private int blockFloatCount;
+    private boolean prepared;
+
     // Data
     private TPOSeries series;
 
@@ -126,6 +147,7 @@ public class TPOLayerV2 extends AbstractRenderLayer {
      */
     public void setSeries(TPOSeries series) {
         this.series = series;
+        geometryCache.attach(series);
         updateZOrderFromSeries();
         markDirty();
         requestRepaint();
@@ -231,6 +253,7 @@ public class TPOLayerV2 extends AbstractRenderLayer {
      */
     public void setPeriodColors(Color[] colors) {
         this.periodColors = colors;
+        geometryCache.invalidateAll();
         markDirty();
     }
 
@@ -334,26 +357,24 @@ public class TPOLayerV2 extends AbstractRenderLayer {
     }
 
     @Override
-    public void render(RenderContext ctx) {
-        // Check if abstracted API is available
-        if (!ctx.hasAbstractedAPI()) {
-            log.warn("TPOLayerV2 requires abstracted API - skipping render");
-            return;
-        }
+    public boolean hasPreparePhase() {
+        return true;
+    }
 
-        // Initialize V2 resources if needed
-        if (!v2Initialized) {
-            initializeV2(ctx);
-        }
+    /**
+     * Brings the per-profile geometry of the visible profiles up to date and
+     * builds the highlight and block vertices.
+     */
+    @Override
+    public void prepare(RenderContext ctx) {
+        highlightFloatCount = 0;
+        blockFloatCount = 0;
+        prepared = true;
 
         if (series == null || series.isEmpty()) {
             return;
         }
 
-        if (defaultShader == null || !defaultShader.isValid()) {
-            return;
-        }
-
         Viewport viewport = ctx.getViewport();
         CoordinateSystem coords = ctx.getCoordinatesForData(series);
 
@@ -365,135 +386,126 @@ public class TPOLayerV2 extends AbstractRenderLayer {
             return;
         }
 
-        RenderDevice device = ctx.getDevice();
+        // Bring per-profile geometry up to date
+        TPOProfile[] profiles = series.getProfilesArray();
+        geometryCache.sync(series.size());
+        for (int i = firstIdx; i <= lastIdx; i++) {
+            ensureGeometry(i, profiles[i]);
+        }
 
-        // Render backgrounds and highlights first (behind blocks)
+        // Backgrounds and highlights share one blended draw, in this order
+        int floatIdx = 0;
         if (series.isShowValueArea()) {
-            renderValueAreaBackgrounds(ctx, coords, firstIdx, lastIdx, device);
+            floatIdx = buildValueAreaBackgrounds(coords, firstIdx, lastIdx, floatIdx);
         }
 
         // Note: Initial Balance is now shown as white-colored blocks, not as a background
 
         if (series.isHighlightSinglePrints()) {
-            renderSinglePrints(ctx, coords, firstIdx, lastIdx, device);
+            floatIdx = buildSinglePrints(coords, firstIdx, lastIdx, floatIdx);
         }
 
         if (series.isShowPOC()) {
-            renderPOCHighlights(ctx, coords, firstIdx, lastIdx, device);
+            floatIdx = buildPOCHighlights(coords, firstIdx, lastIdx, floatIdx);
         }
 
-        // Render VAH/VAL lines
         if (series.isShowVAH() || series.isShowVAL()) {
-            renderVAHVALLines(ctx, coords, firstIdx, lastIdx, device);
+            floatIdx = buildVAHVALLines(coords, firstIdx, lastIdx, floatIdx);
         }
+        highlightFloatCount = floatIdx;
 
-        // Render TPO blocks
-        renderBlocks(ctx, coords, firstIdx, lastIdx, device);
+        blockFloatCount = buildBlocks(coords, firstIdx, lastIdx);
     }
 
-    private void renderBlocks(RenderContext ctx, CoordinateSystem coords,
-                               int firstIdx, int lastIdx, RenderDevice device) {
-        // Estimate capacity needed
-        int estimatedBlocks = 0;
-        TPOProfile[] profiles = series.getProfilesArray();
-        for (int i = firstIdx; i <= lastIdx; i++) {
-            if (profiles[i] != null) {
-                estimatedBlocks += profiles[i].getLevelCount() * profiles[i].getPeriodCount();
-            }
+    @Override
+    public void render(RenderContext ctx) {
+        // Check if abstracted API is available
+        if (!ctx.hasAbstractedAPI()) {
+            log.warn("TPOLayerV2 requires abstracted API - skipping render");
+            return;
         }
-        ensureBlockCapacity(estimatedBlocks);
 
-        long[] sessionStarts = series.getSessionStartsArray();
-        float tickSize = series.getTickSize();
+        if (!prepared) {
+            // Not prepared this frame (e.g. rendered outside the pipeline)
+            prepare(ctx);
+        }
+        prepared = false;
 
-        int floatIdx = 0;
+        // Initialize V2 resources if needed
+        if (!v2Initialized) {
+            initializeV2(ctx);
+        }
 
-        for (int profileIdx = firstIdx; profileIdx <= lastIdx; profileIdx++) {
-            TPOProfile profile = profiles[profileIdx];
-            if (profile == null) continue;
+        if (highlightFloatCount == 0 && blockFloatCount == 0) {
+            return;
+        }
 
-            // Calculate profile X position
-            float profileStartX = (float) coords.xValueToScreenX(sessionStarts[profileIdx]);
-            float profileWidth = (float) coords.xValueToScreenX(profile.getSessionEnd()) - profileStartX;
-
-            // Distribute blocks across profile width
-            int periodCount = profile.getPeriodCount();
-            float effectiveBlockWidth = (profileWidth - blockGap * periodCount) / periodCount;
-
-            List<Float> priceLevels = profile.getPriceLevels();
-
-            for (float price : priceLevels) {
-                float priceY = (float) coords.yValueToScreenY(price);
-                float tickHeight = (float) Math.abs(coords.yValueToScreenY(price + tickSize) -
-                        coords.yValueToScreenY(price));
-
-                long tpoMask = profile.getTPOMaskAt(price);
-
-                // Draw block for each period that touched this price
-                float blockX = profileStartX + blockGap;
-                int ibPeriodCount = profile.getIBPeriods();
-                boolean showIB = series.isShowInitialBalance();
-                boolean showPOC = series.isShowPOC();
-                float opacity = series.getOpacity();
-                Color ibColor = series.getIBColor();
-                Color pocColor = series.getPocColor();
-                for (int period = 0; period < periodCount; period++) {
-                    if ((tpoMask & (1L << period)) != 0) {
-                        Color color = periodColors[period % periodColors.length];
-
-                        // Initial Balance periods get IB color
-                        if (showIB && period < ibPeriodCount) {
-                            color = ibColor;
-                        }
-                        // POC overrides IB color
-                        else if (showPOC && Math.abs(price - profile.getPOC()) < tickSize / 2) {
-                            color = pocColor;
-                        }
-
-                        float x1 = blockX;
-                        float x2 = blockX + effectiveBlockWidth;
-                        float y1 = priceY - tickHeight / 2 + 0.5f;
-                        float y2 = priceY + tickHeight / 2 - 0.5f;
-
-                        floatIdx = addQuad(blockVertices, floatIdx, x1, y1, x2, y2,
-                                color.getRed() / 255f, color.getGreen() / 255f,
-                                color.getBlue() / 255f, opacity);
-                    }
-                    blockX += effectiveBlockWidth + blockGap;
-                }
-            }
+        if (defaultShader == null || !defaultShader.isValid()) {
+            return;
         }
 
-        float opacity = series.getOpacity();
-        if (floatIdx > 0) {
-            // Enable blending if opacity < 1
-            if (opacity < 1.0f) {
+        RenderDevice device = ctx.getDevice();
+
+        defaultShader.bind();
+        defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+
+        // Render backgrounds and highlights first (behind blocks)
+        if (highlightFloatCount > 0) {
+            device.setBlendMode(BlendMode.ALPHA);
+            highlightBuffer.upload(highlightVertices, 0, highlightFloatCount);
+            highlightBuffer.draw(DrawMode.TRIANGLES);
+            device.setBlendMode(BlendMode.NONE);
+        }
+
+        // Render TPO blocks, blended if opacity < 1
+        if (blockFloatCount > 0) {
+            boolean blend = series.getOpacity() < 1.0f;
+            if (blend) {
                 device.setBlendMode(BlendMode.ALPHA);
             }
 
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-            blockBuffer.upload(blockVertices, 0, floatIdx);
+            blockBuffer.upload(blockVertices, 0, blockFloatCount);
             blockBuffer.draw(DrawMode.TRIANGLES);
 
-            defaultShader.unbind();
-
-            if (opacity < 1.0f) {
+            if (blend) {
                 device.setBlendMode(BlendMode.NONE);
             }
         }
+
+        defaultShader.unbind();
     }
 
-    private void renderValueAreaBackgrounds(RenderContext ctx, CoordinateSystem coords,
-                                             int firstIdx, int lastIdx, RenderDevice device) {
-        ensureHighlightCapacity(lastIdx - firstIdx + 1);
+    private int buildBlocks(CoordinateSystem coords, int firstIdx, int lastIdx) {
+        ensureBlockCapacity(countRecords(firstIdx, lastIdx, CHANNEL_BLOCKS));
 
         TPOProfile[] profiles = series.getProfilesArray();
         long[] sessionStarts = series.getSessionStartsArray();
+        float tickSize = series.getTickSize();
 
         int floatIdx = 0;
 
+        for (int profileIdx = firstIdx; profileIdx <= lastIdx; profileIdx++) {
+            int floatCount = geometryCache.getFloatCount(profileIdx, CHANNEL_BLOCKS);
+            if (floatCount == 0) continue;
+
+            // Calculate profile X position
+            float profileStartX = (float) coords.xValueToScreenX(sessionStarts[profileIdx]);
+            float profileWidth = (float) coords.xValueToScreenX(
+                    profiles[profileIdx].getSessionEnd()) - profileStartX;
+
+            floatIdx = emitRecords(geometryCache.getRecords(profileIdx, CHANNEL_BLOCKS), floatCount,
+                    blockVertices, floatIdx, coords, profileStartX, profileWidth, tickSize, 0.5f);
+        }
+        return floatIdx;
+    }
+
+    private int buildValueAreaBackgrounds(CoordinateSystem coords, int firstIdx, int lastIdx,
+                                          int floatIdx) {
+        ensureHighlightCapacity(floatIdx, lastIdx - firstIdx + 1);
+
+        TPOProfile[] profiles = series.getProfilesArray();
+        long[] sessionStarts = series.getSessionStartsArray();
+
         for (int profileIdx = firstIdx; profileIdx <= lastIdx; profileIdx++) {
             TPOProfile profile = profiles[profileIdx];
             if (profile == null) continue;
@@ -512,29 +524,16 @@ public class TPOLayerV2 extends AbstractRenderLayer {
                     vaColor.getRed() / 255f, vaColor.getGreen() / 255f,
                     vaColor.getBlue() / 255f, vaColor.getAlpha() / 255f);
         }
-
-        if (floatIdx > 0) {
-            device.setBlendMode(BlendMode.ALPHA);
-
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-            highlightBuffer.upload(highlightVertices, 0, floatIdx);
-            highlightBuffer.draw(DrawMode.TRIANGLES);
-
-            defaultShader.unbind();
-            device.setBlendMode(BlendMode.NONE);
-        }
+        return floatIdx;
     }
 
-    private void renderPOCHighlights(RenderContext ctx, CoordinateSystem coords,
-                                      int firstIdx, int lastIdx, RenderDevice device) {
+    private int buildPOCHighlights(CoordinateSystem coords, int firstIdx, int lastIdx, int floatIdx) {
+        ensureHighlightCapacity(floatIdx, lastIdx - firstIdx + 1);
+
         TPOProfile[] profiles = series.getProfilesArray();
         long[] sessionStarts = series.getSessionStartsArray();
         float tickSize = series.getTickSize();
 
-        int floatIdx = 0;
-
         for (int profileIdx = firstIdx; profileIdx <= lastIdx; profileIdx++) {
             TPOProfile profile = profiles[profileIdx];
             if (profile == null) continue;
@@ -554,89 +553,36 @@ public class TPOLayerV2 extends AbstractRenderLayer {
                     pocColor.getRed() / 255f, pocColor.getGreen() / 255f,
                     pocColor.getBlue() / 255f, pocColor.getAlpha() / 255f * 0.3f);
         }
-
-        if (floatIdx > 0) {
-            device.setBlendMode(BlendMode.ALPHA);
-
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-            highlightBuffer.upload(highlightVertices, 0, floatIdx);
-            highlightBuffer.draw(DrawMode.TRIANGLES);
-
-            defaultShader.unbind();
-            device.setBlendMode(BlendMode.NONE);
-        }
+        return floatIdx;
     }
 
-    private void renderSinglePrints(RenderContext ctx, CoordinateSystem coords,
-                                     int firstIdx, int lastIdx, RenderDevice device) {
+    private int buildSinglePrints(CoordinateSystem coords, int firstIdx, int lastIdx, int floatIdx) {
         TPOProfile[] profiles = series.getProfilesArray();
         long[] sessionStarts = series.getSessionStartsArray();
         float tickSize = series.getTickSize();
 
-        // Estimate single prints count for capacity
-        int estimatedSingles = 0;
-        for (int i = firstIdx; i <= lastIdx; i++) {
-            if (profiles[i] != null) {
-                estimatedSingles += profiles[i].getSinglePrints().size();
-            }
-        }
-        ensureHighlightCapacity(estimatedSingles);
-
-        int floatIdx = 0;
+        ensureHighlightCapacity(floatIdx, countRecords(firstIdx, lastIdx, CHANNEL_SINGLE_PRINTS));
 
         for (int profileIdx = firstIdx; profileIdx <= lastIdx; profileIdx++) {
-            TPOProfile profile = profiles[profileIdx];
-            if (profile == null) continue;
-
-            List<Float> singles = profile.getSinglePrints();
-            if (singles.isEmpty()) continue;
+            int floatCount = geometryCache.getFloatCount(profileIdx, CHANNEL_SINGLE_PRINTS);
+            if (floatCount == 0) continue;
 
             float x1 = (float) coords.xValueToScreenX(sessionStarts[profileIdx]);
-            float x2 = (float) coords.xValueToScreenX(profile.getSessionEnd());
+            float x2 = (float) coords.xValueToScreenX(profiles[profileIdx].getSessionEnd());
 
-            Color spColor = series.getSinglePrintColor();
-            for (float price : singles) {
-                float priceY = (float) coords.yValueToScreenY(price);
-                float tickHeight = (float) Math.abs(coords.yValueToScreenY(price + tickSize) -
-                        coords.yValueToScreenY(price));
-
-                floatIdx = addQuad(highlightVertices, floatIdx,
-                        x1, priceY - tickHeight / 2, x2, priceY + tickHeight / 2,
-                        spColor.getRed() / 255f, spColor.getGreen() / 255f,
-                        spColor.getBlue() / 255f, spColor.getAlpha() / 255f);
-            }
-        }
-
-        if (floatIdx > 0) {
-            device.setBlendMode(BlendMode.ALPHA);
-
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-            highlightBuffer.upload(highlightVertices, 0, floatIdx);
-            highlightBuffer.draw(DrawMode.TRIANGLES);
-
-            defaultShader.unbind();
-            device.setBlendMode(BlendMode.NONE);
+            floatIdx = emitRecords(geometryCache.getRecords(profileIdx, CHANNEL_SINGLE_PRINTS),
+                    floatCount, highlightVertices, floatIdx, coords, x1, x2 - x1, tickSize, 0);
         }
+        return floatIdx;
     }
 
-    private void renderVAHVALLines(RenderContext ctx, CoordinateSystem coords,
-                                    int firstIdx, int lastIdx, RenderDevice device) {
+    private int buildVAHVALLines(CoordinateSystem coords, int firstIdx, int lastIdx, int floatIdx) {
         TPOProfile[] profiles = series.getProfilesArray();
         long[] sessionStarts = series.getSessionStartsArray();
 
         boolean showVAH = series.isShowVAH();
         boolean showVAL = series.isShowVAL();
 
-        // Estimate capacity: 2 lines per profile, potentially many segments for dashed lines
-        int estimatedSegments = (lastIdx - firstIdx + 1) * 50; // Allow for dashed lines
-        ensureHighlightCapacity(estimatedSegments);
-
-        int floatIdx = 0;
-
         for (int profileIdx = firstIdx; profileIdx <= lastIdx; profileIdx++) {
             TPOProfile profile = profiles[profileIdx];
             if (profile == null) continue;
@@ -647,45 +593,52 @@ public class TPOLayerV2 extends AbstractRenderLayer {
             float x1 = (float) coords.xValueToScreenX(sessionStarts[profileIdx]);
             float x2 = (float) coords.xValueToScreenX(profile.getSessionEnd());
 
-            // Render VAH line
+            // VAH line
             if (showVAH && !Float.isNaN(vah)) {
                 float y = (float) coords.yValueToScreenY(vah);
                 Color color = series.getVahColor();
-                TPOSeries.LineType lineType = series.getVahLineType();
+                float[] dashPattern = series.getVahLineType().getDashPattern();
                 float thickness = series.getVahLineThickness().getWidth();
 
+                ensureHighlightCapacity(floatIdx, lineQuadCount(x1, x2, dashPattern));
                 floatIdx = addLine(highlightVertices, floatIdx, x1, y, x2, y, thickness,
                         color.getRed() / 255f, color.getGreen() / 255f,
                         color.getBlue() / 255f, color.getAlpha() / 255f,
-                        lineType.getDashPattern());
+                        dashPattern);
             }
 
-            // Render VAL line
+            // VAL line
             if (showVAL && !Float.isNaN(val)) {
                 float y = (float) coords.yValueToScreenY(val);
                 Color color = series.getValColor();
-                TPOSeries.LineType lineType = series.getValLineType();
+                float[] dashPattern = series.getValLineType().getDashPattern();
                 float thickness = series.getValLineThickness().getWidth();
 
+                ensureHighlightCapacity(floatIdx, lineQuadCount(x1, x2, dashPattern));
                 floatIdx = addLine(highlightVertices, floatIdx, x1, y, x2, y, thickness,
                         color.getRed() / 255f, color.getGreen() / 255f,
                         color.getBlue() / 255f, color.getAlpha() / 255f,
-                        lineType.getDashPattern());
+                        dashPattern);
             }
         }
+        return floatIdx;
+    }
 
-        if (floatIdx > 0) {
-            device.setBlendMode(BlendMode.ALPHA);
-
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-            highlightBuffer.upload(highlightVertices, 0, floatIdx);
-            highlightBuffer.draw(DrawMode.TRIANGLES);
-
-            defaultShader.unbind();
-            device.setBlendMode(BlendMode.NONE);
+    /**
+     * Returns an upper bound on the quads {@link #addLine} emits for a line.
+     */
+    private static int lineQuadCount(float x1, float x2, float[] dashPattern) {
+        if (dashPattern == null) {
+            return 1;
         }
+        float minDash = Float.MAX_VALUE;
+        for (float d : dashPattern) {
+            minDash = Math.min(minDash, d);
+        }
+        if (!(minDash > 0)) {
+            return 1;
+        }
+        return (int) Math.ceil(Math.max(0, x2 - x1) / minDash) + 1;
     }
 
     /**
@@ -729,6 +682,128 @@ public class TPOLayerV2 extends AbstractRenderLayer {
         return index;
     }
 
+    // ========== Geometry cache ==========
+
+    /**
+     * Builds the cached block and single-print records for a profile if they
+     * are missing or stale.
+     */
+    private void ensureGeometry(int index, TPOProfile profile) {
+        if (geometryCache.isValid(index)) {
+            return;
+        }
+        int periodCount = profile != null ? profile.getPeriodCount() : 0;
+        if (periodCount == 0) {
+            geometryCache.store(index, CHANNEL_BLOCKS, recordScratch, 0);
+            geometryCache.store(index, CHANNEL_SINGLE_PRINTS, recordScratch, 0);
+            geometryCache.markValid(index, 0);
+            return;
+        }
+
+        float tickSize = series.getTickSize();
+        int ibPeriodCount = profile.getIBPeriods();
+        boolean showIB = series.isShowInitialBalance();
+        boolean showPOC = series.isShowPOC();
+        float opacity = series.getOpacity();
+        Color ibColor = series.getIBColor();
+        Color pocColor = series.getPocColor();
+        float poc = profile.getPOC();
+
+        List<Float> priceLevels = profile.getPriceLevels();
+        ensureRecordScratch(priceLevels.size() * periodCount);
+        int n = 0;
+
+        // Blocks are laid out in equal period slots; each slot starts one gap in
+        for (float price : priceLevels) {
+            long tpoMask = profile.getTPOMaskAt(price);
+
+            for (int period = 0; period < periodCount; period++) {
+                if ((tpoMask & (1L << period)) == 0) continue;
+
+                Color color = periodColors[period % periodColors.length];
+
+                // Initial Balance periods get IB color
+                if (showIB && period < ibPeriodCount) {
+                    color = ibColor;
+                }
+                // POC overrides IB color
+                else if (showPOC && Math.abs(price - poc) < tickSize / 2) {
+                    color = pocColor;
+                }
+
+                n = addRecord(recordScratch, n,
+                        (float) period / periodCount, 1,
+                        (float) (period + 1) / periodCount, 0,
+                        price, color, opacity);
+            }
+        }
+        geometryCache.store(index, CHANNEL_BLOCKS, recordScratch, n);
+
+        n = 0;
+        if (series.isHighlightSinglePrints()) {
+            List<Float> singles = profile.getSinglePrints();
+            ensureRecordScratch(singles.size());
+            Color spColor = series.getSinglePrintColor();
+            for (float price : singles) {
+                n = addRecord(recordScratch, n, 0, 0, 1, 0, price, spColor, spColor.getAlpha() / 255f);
+            }
+        }
+        geometryCache.store(index, CHANNEL_SINGLE_PRINTS, recordScratch, n);
+
+        geometryCache.markValid(index, 0);
+    }
+
+    /**
+     * Maps cached records of one profile to screen-space quads, shrinking each
+     * quad vertically by {@code inset} pixels on both sides.
+     */
+    private int emitRecords(float[] records, int floatCount, float[] vertices, int index,
+                            CoordinateSystem coords, float profileStartX, float profileWidth,
+                            float tickSize, float inset) {
+        for (int r = 0; r < floatCount; r += FLOATS_PER_RECORD) {
+            float x1 = profileStartX + records[r] * profileWidth + records[r + 1] * blockGap;
+            float x2 = profileStartX + records[r + 2] * profileWidth + records[r + 3] * blockGap;
+
+            float price = records[r + 4];
+            float priceY = (float) coords.yValueToScreenY(price);
+            float tickHeight = Math.abs((float) coords.yValueToScreenY(price + tickSize) - priceY);
+
+            index = addQuad(vertices, index,
+                    x1, priceY - tickHeight / 2 + inset, x2, priceY + tickHeight / 2 - inset,
+                    records[r + 5], records[r + 6], records[r + 7], records[r + 8]);
+        }
+        return index;
+    }
+
+    private int countRecords(int firstIdx, int lastIdx, int channel) {
+        int count = 0;
+        for (int i = firstIdx; i <= lastIdx; i++) {
+            count += geometryCache.getFloatCount(i, channel);
+        }
+        return count / FLOATS_PER_RECORD;
+    }
+
+    private int addRecord(float[] records, int index, float u1, float v1, float u2, float v2,
+                          float price, Color color, float alpha) {
+        records[index++] = u1;
+        records[index++] = v1;
+        records[index++] = u2;
+        records[index++] = v2;
+        records[index++] = price;
+        records[index++] = color.getRed() / 255f;
+        records[index++] = color.getGreen() / 255f;
+        records[index++] = color.getBlue() / 255f;
+        records[index++] = alpha;
+        return index;
+    }
+
+    private void ensureRecordScratch(int recordCount) {
+        int required = recordCount * FLOATS_PER_RECORD;
+        if (required > recordScratch.length) {
+            recordScratch = new float[required + required / 2];
+        }
+    }
+
     private int findFirstVisibleIndex(Viewport viewport) {
         long startTime = viewport.getStartTime();
         int idx = series.indexAtOrBefore(startTime);
@@ -782,17 +857,24 @@ public class TPOLayerV2 extends AbstractRenderLayer {
         }
     }
 
-    private void ensureHighlightCapacity(int highlightCount) {
-        int required = highlightCount * VERTICES_PER_BLOCK * FLOATS_PER_VERTEX * 3; // Multiple highlight types
+    /**
+     * Grows the highlight array, keeping its first {@code usedFloats} floats,
+     * so that {@code quadCount} more quads fit.
+     */
+    private void ensureHighlightCapacity(int usedFloats, int quadCount) {
+        int required = usedFloats + quadCount * VERTICES_PER_BLOCK * FLOATS_PER_VERTEX;
         if (required > highlightVertices.length) {
-            highlightCapacity = highlightCount * 3 + highlightCount;
-            highlightVertices = new float[highlightCapacity * VERTICES_PER_BLOCK * FLOATS_PER_VERTEX];
+            highlightCapacity = (required + required / 2) / (VERTICES_PER_BLOCK * FLOATS_PER_VERTEX) + 1;
+            highlightVertices = Arrays.copyOf(highlightVertices,
+                    highlightCapacity * VERTICES_PER_BLOCK * FLOATS_PER_VERTEX);
         }
     }
+    }
 
     @Override
     protected void doDispose(GL2ES2 gl) {
         // V2 resources are managed by ResourceManager
+        geometryCache.dispose();
         v2Initialized = false;
     }
 
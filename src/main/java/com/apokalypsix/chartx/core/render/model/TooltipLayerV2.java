@@ -55,6 +55,10 @@ public class TooltipLayerV2 extends AbstractRenderLayer {
     private final SimpleDateFormat timeFormat = new SimpleDateFormat("HH:mm:ss");
     private final Date reusableDate = new Date();
 
+    // Last formatted timestamp; the tooltip is redrawn every frame while hovering one bar
+    private long formattedTimestamp = Long.MIN_VALUE;
+    private String formattedTimestampText;
+
     public TooltipLayerV2() {
         super(Z_ORDER);
         timeFormat.setTimeZone(TimeZone.getDefault());
@@ -145,8 +149,7 @@ public class TooltipLayerV2 extends AbstractRenderLayer {
 
         // Add timestamp row if enabled
         if (config.isShowTimestamp() && data.getTimestamp() > 0) {
-            reusableDate.setTime(data.getTimestamp());
-            String timeStr = timeFormat.format(reusableDate);
+            String timeStr = formatTimestamp(data.getTimestamp());
             maxWidth = Math.max(maxWidth, textRenderer.getTextWidth(timeStr));
             totalHeight += fontSize + rowSpacing;
         }
@@ -178,6 +181,15 @@ public class TooltipLayerV2 extends AbstractRenderLayer {
         return new float[]{maxWidth + padding * 2, totalHeight};
     }
 
+    private String formatTimestamp(long timestamp) {
+        if (timestamp != formattedTimestamp || formattedTimestampText == null) {
+            reusableDate.setTime(timestamp);
+            formattedTimestampText = timeFormat.format(reusableDate);
+            formattedTimestamp = timestamp;
+        }
+        return formattedTimestampText;
+    }
+
     private float calculateTooltipX(float tooltipWidth, int viewportWidth, Viewport viewport, float scaleFactor) {
         // Scale offset for HiDPI
         float offsetX = config.getOffsetX() * scaleFactor;
@@ -316,8 +328,7 @@ public class TooltipLayerV2 extends AbstractRenderLayer {
 
             // Draw timestamp
             if (config.isShowTimestamp() && data.getTimestamp() > 0) {
-                reusableDate.setTime(data.getTimestamp());
-                String timeStr = timeFormat.format(reusableDate);
+                String timeStr = formatTimestamp(data.getTimestamp());
                 textRenderer.drawText(timeStr, x, textY, labelColor);
                 textY += fontSize + rowSpacing;
             }
@@ -376,6 +387,7 @@ public class TooltipLayerV2 extends AbstractRenderLayer {
         if (config != null) {
             timeFormat.applyPattern(config.getTimestampFormat());
         }
+        formattedTimestampText = null;
         markDirty();
     }
 
@@ -14,6 +14,10 @@ import com.apokalypsix.chartx.core.render.api.BufferDescriptor;
 import com.apokalypsix.chartx.core.render.api.DrawMode;
 import com.apokalypsix.chartx.core.render.api.ResourceManager;
 import com.apokalypsix.chartx.core.render.api.Shader;
+import com.apokalypsix.chartx.core.render.lod.LodMetrics;
+import com.apokalypsix.chartx.core.render.lod.LodPolicy;
+import com.apokalypsix.chartx.core.render.lod.LodSelector;
+import com.apokalypsix.chartx.core.render.lod.LodTable;
 import com.jogamp.opengl.GL2ES2;
 
 /**
@@ -32,6 +36,11 @@ import com.jogamp.opengl.GL2ES2;
  *
  * <p>The profile can be positioned on either side of the chart and supports
  * multiple display modes (total volume, delta, buy/sell split).
+ *
+ * <p>When a price tick is thinner than {@value #MIN_ROW_PIXELS} pixels the
+ * layer switches to {@link Detail#MERGED} through the shared {@link LodPolicy}
+ * and buckets adjacent levels into rows of that height, so the number of
+ * bars drawn follows the chart height rather than the number of levels.
  */
 public class VolumeProfileLayerV2 extends AbstractRenderLayer {
 
@@ -65,6 +74,27 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
         RIGHT
     }
 
+    /**
+     * Detail levels, most detailed first.
+     */
+    public enum Detail {
+        /** One bar per price level */
+        LEVELS,
+        /** Adjacent levels bucketed into rows at least MIN_ROW_PIXELS tall */
+        MERGED
+    }
+
+    /** Minimum row height in pixels before levels are merged */
+    public static final double MIN_ROW_PIXELS = 2.0;
+
+    private static final LodTable<Detail> LOD_TABLE = LodTable.builder(Detail.class)
+            .level(Detail.LEVELS, 0, MIN_ROW_PIXELS)
+            .level(Detail.MERGED, 0)
+            .build();
+
+    private final LodSelector<Detail> lod = LodPolicy.getDefault().createSelector(LOD_TABLE);
+    private final LodMetrics lodMetrics = new LodMetrics();
+
     // Configuration
     private VolumeProfileSeries series;
     private DisplayMode displayMode = DisplayMode.BUY_SELL;
@@ -92,6 +122,11 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
     private float[] valueAreaVertices;
     private int barVertexCapacity;
 
+    // Float counts built by prepare() for the following render()
+    private int valueAreaFloatCount;
+    private int barFloatCount;
+    private boolean prepared;
+
     /**
      * Creates a volume profile layer.
      */
@@ -143,6 +178,32 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
         log.debug("VolumeProfileLayerV2 V2 resources initialized");
     }
 
+    @Override
+    public boolean hasPreparePhase() {
+        return true;
+    }
+
+    /**
+     * Builds the value area and volume bar vertices.
+     */
+    @Override
+    public void prepare(RenderContext ctx) {
+        valueAreaFloatCount = 0;
+        barFloatCount = 0;
+        prepared = true;
+
+        if (series == null || series.getLevelCount() == 0) {
+            return;
+        }
+
+        CoordinateSystem coords = ctx.getCoordinatesForData(series);
+
+        if (showValueArea) {
+            valueAreaFloatCount = buildValueArea(ctx, coords);
+        }
+        barFloatCount = buildVolumeBars(ctx, coords);
+    }
+
     @Override
     public void render(RenderContext ctx) {
         // Check if abstracted API is available
@@ -151,12 +212,18 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
             return;
         }
 
+        if (!prepared) {
+            // Not prepared this frame (e.g. rendered outside the pipeline)
+            prepare(ctx);
+        }
+        prepared = false;
+
         // Initialize V2 resources if needed
         if (!v2Initialized) {
             initializeV2(ctx);
         }
 
-        if (series == null || series.getLevelCount() == 0) {
+        if (valueAreaFloatCount == 0 && barFloatCount == 0) {
             return;
         }
 
@@ -164,21 +231,28 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
             return;
         }
 
-        CoordinateSystem coords = ctx.getCoordinatesForData(series);
+        defaultShader.bind();
+        defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
         // Render value area background first
-        if (showValueArea) {
-            renderValueArea(ctx, coords);
+        if (valueAreaFloatCount > 0) {
+            valueAreaBuffer.upload(valueAreaVertices, 0, valueAreaFloatCount);
+            valueAreaBuffer.draw(DrawMode.TRIANGLES);
         }
 
         // Render volume bars
-        renderVolumeBars(ctx, coords);
+        if (barFloatCount > 0) {
+            barBuffer.upload(barVertices, 0, barFloatCount);
+            barBuffer.draw(DrawMode.TRIANGLES);
+        }
+
+        defaultShader.unbind();
     }
 
-    private void renderVolumeBars(RenderContext ctx, CoordinateSystem coords) {
+    private int buildVolumeBars(RenderContext ctx, CoordinateSystem coords) {
         int levelCount = series.getLevelCount();
         if (levelCount == 0) {
-            return;
+            return 0;
         }
 
         // Ensure capacity
@@ -194,42 +268,76 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
                 ? chartWidth * widthPercentage
                 : widthPixels;
 
-        // Determine the maximum volume for scaling
+        // Bucket adjacent price levels into rows when ticks are thinner than a readable row
+        float tickSize = series.getTickSize();
+        int levelsPerRow = 1;
+        if (lod.update(lodMetrics.update(ctx, coords), tickSize) == Detail.MERGED) {
+            double pixelsPerTick = lodMetrics.getPixelsPerTick(tickSize);
+            levelsPerRow = pixelsPerTick > 0
+                    ? (int) Math.ceil(MIN_ROW_PIXELS / pixelsPerTick)
+                    : levelCount;
+        }
+        float rowSpan = tickSize * levelsPerRow;
+
+        float[] priceLevels = series.getPriceLevelsArray();
+        float[] buyVolumes = series.getBuyVolumeArray();
+        float[] sellVolumes = series.getSellVolumeArray();
+        float basePrice = priceLevels[0];
+
+        // Determine the maximum row volume for scaling
         float maxVolume = 0;
+        float rowVolume = 0;
+        long rowBucket = Long.MIN_VALUE;
         for (int i = 0; i < levelCount; i++) {
-            float vol = series.getTotalVolumeAt(i);
-            if (vol > maxVolume) {
-                maxVolume = vol;
+            long bucket = levelsPerRow == 1 ? i : (long) Math.floor((priceLevels[i] - basePrice) / rowSpan);
+            if (bucket != rowBucket) {
+                rowBucket = bucket;
+                rowVolume = 0;
+            }
+            rowVolume += buyVolumes[i] + sellVolumes[i];
+            if (rowVolume > maxVolume) {
+                maxVolume = rowVolume;
             }
         }
 
         if (maxVolume <= 0) {
-            return;
+            return 0;
         }
 
         // Calculate bar height from tick size
-        float tickSize = series.getTickSize();
         float priceTop = series.getPriceAt(0);
         float priceBottom = series.getPriceAt(0) + tickSize;
         double screenTop = coords.yValueToScreenY(priceTop);
         double screenBottom = coords.yValueToScreenY(priceBottom);
-        float barHeight = (float) Math.abs(screenBottom - screenTop) * 0.9f;
+        float barHeight = (float) Math.abs(screenBottom - screenTop) * 0.9f * levelsPerRow;
         float halfHeight = barHeight / 2;
 
         int pocIndex = series.getPOCIndex();
         float opacity = series.getOpacity();
 
         int floatIndex = 0;
-        float[] priceLevels = series.getPriceLevelsArray();
-        float[] buyVolumes = series.getBuyVolumeArray();
-        float[] sellVolumes = series.getSellVolumeArray();
 
-        for (int i = 0; i < levelCount; i++) {
-            float price = priceLevels[i];
-            float buyVol = buyVolumes[i];
-            float sellVol = sellVolumes[i];
-            float totalVol = buyVol + sellVol;
+        for (int rowStart = 0; rowStart < levelCount; ) {
+            // Accumulate the levels of this row
+            long bucket = levelsPerRow == 1 ? rowStart
+                    : (long) Math.floor((priceLevels[rowStart] - basePrice) / rowSpan);
+            float buyVol = 0;
+            float sellVol = 0;
+            boolean containsPOC = false;
+            int rowEnd = rowStart;
+            do {
+                buyVol += buyVolumes[rowEnd];
+                sellVol += sellVolumes[rowEnd];
+                containsPOC |= rowEnd == pocIndex;
+                rowEnd++;
+            } while (levelsPerRow > 1 && rowEnd < levelCount
+                    && (long) Math.floor((priceLevels[rowEnd] - basePrice) / rowSpan) == bucket);
+
+            float price = levelsPerRow == 1 ? priceLevels[rowStart]
+                    : basePrice + bucket * rowSpan + (rowSpan - tickSize) / 2;
+            rowStart = rowEnd;
 
+            float totalVol = buyVol + sellVol;
             if (totalVol <= 0) {
                 continue;
             }
@@ -287,8 +395,8 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
                 }
             } else {
                 // Single color based on mode
-                Color color = getBarColor(i);
-                if (showPOC && i == pocIndex) {
+                Color color = getBarColor(buyVol, sellVol);
+                if (showPOC && containsPOC) {
                     color = series.getPocColor();
                 }
                 floatIndex = addBar(barVertices, floatIndex, barLeft, barRight, top, bottom,
@@ -296,23 +404,15 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
             }
         }
 
-        if (floatIndex > 0) {
-            defaultShader.bind();
-            defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-            barBuffer.upload(barVertices, 0, floatIndex);
-            barBuffer.draw(DrawMode.TRIANGLES);
-
-            defaultShader.unbind();
-        }
+        return floatIndex;
     }
 
-    private void renderValueArea(RenderContext ctx, CoordinateSystem coords) {
+    private int buildValueArea(RenderContext ctx, CoordinateSystem coords) {
         int valIndex = series.getVALIndex();
         int vahIndex = series.getVAHIndex();
 
         if (valIndex < 0 || vahIndex < 0) {
-            return;
+            return 0;
         }
 
         float valPrice = series.getValueAreaLow();
@@ -358,28 +458,13 @@ public class VolumeProfileLayerV2 extends AbstractRenderLayer {
         idx = addVertex(valueAreaVertices, idx, left, top, r, g, b, a);
         idx = addVertex(valueAreaVertices, idx, right, bottom, r, g, b, a);
         idx = addVertex(valueAreaVertices, idx, right, top, r, g, b, a);
-
-        defaultShader.bind();
-        defaultShader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
-
-        valueAreaBuffer.upload(valueAreaVertices, 0, idx);
-        valueAreaBuffer.draw(DrawMode.TRIANGLES);
-
-        defaultShader.unbind();
+        return idx;
     }
 
-    private Color getBarColor(int levelIndex) {
+    private Color getBarColor(float buyVol, float sellVol) {
         return switch (displayMode) {
             case TOTAL -> series.getBuyColor();
-            case DELTA -> {
-                float delta = series.getDeltaAt(levelIndex);
-                yield delta >= 0 ? series.getBuyColor() : series.getSellColor();
-            }
-            case BUY_SELL -> {
-                float buyVol = series.getBuyVolumeAt(levelIndex);
-                float sellVol = series.getSellVolumeAt(levelIndex);
-                yield buyVol >= sellVol ? series.getBuyColor() : series.getSellColor();
-            }
+            case DELTA, BUY_SELL -> buyVol >= sellVol ? series.getBuyColor() : series.getSellColor();
         };
     }
 
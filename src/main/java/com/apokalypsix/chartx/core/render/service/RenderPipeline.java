@@ -12,6 +12,7 @@ import com.apokalypsix.chartx.core.render.backend.opengl.GLRenderDevice;
 import com.apokalypsix.chartx.core.render.gl.GLResourceManager;
 import com.apokalypsix.chartx.core.render.model.RenderContext;
 import com.apokalypsix.chartx.core.render.model.RenderLayer;
+import com.apokalypsix.chartx.core.render.util.VertexArena;
 import com.apokalypsix.chartx.core.data.model.FootprintSeries;
 import com.apokalypsix.chartx.core.data.model.TPOSeries;
 import com.apokalypsix.chartx.chart.data.HistogramData;
@@ -30,6 +31,9 @@ import java.awt.Color;
 import java.util.ArrayList;
 import java.util.Comparator;
 import java.util.List;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.ForkJoinTask;
+import java.util.concurrent.locks.Lock;
 
 /**
  * Main rendering pipeline that orchestrates layer-based rendering.
@@ -76,6 +80,20 @@ public class RenderPipeline implements GLEventListener {
 
     private boolean initialized = false;
 
+    // Prepare phase: layers build vertex data in parallel before the serial draw pass
+    private boolean parallelPrepare = true;
+    private final List<RenderLayer> preparingLayers = new ArrayList<>();
+
+    // Vertex scratch memory for all layers, reset at the start of each frame
+    private final VertexArena vertexArena = new VertexArena();
+
+    // Frame built by prepareWithDevice and drawn by drawPreparedFrame
+    private RenderContext preparedContext;
+    private final List<RenderLayer> frameLayers = new ArrayList<>();
+
+    // Held while layers without a prepare phase draw, when rendering off the EDT
+    private volatile Lock stateLock;
+
     // Abstracted rendering API (optional, for v2 renderers)
     private boolean useAbstractedAPI = false;
     private RenderDevice renderDevice;
@@ -319,6 +337,45 @@ public class RenderPipeline implements GLEventListener {
         return scaleFactor;
     }
 
+    /**
+     * Sets whether layers with a prepare phase build their vertex data in
+     * parallel on the common fork/join pool. When disabled, prepare runs
+     * serially on the render thread.
+     *
+     * @param parallel true to prepare layers in parallel
+     */
+    public void setParallelPrepare(boolean parallel) {
+        this.parallelPrepare = parallel;
+    }
+
+    /**
+     * Returns true if layers are prepared in parallel.
+     */
+    public boolean isParallelPrepare() {
+        return parallelPrepare;
+    }
+
+    /**
+     * Sets the lock guarding chart state while frames are drawn on a render
+     * thread, or null when rendering on the EDT.
+     *
+     * <p>{@link #drawPreparedFrame()} runs without the lock, except around
+     * layers that have no prepare phase and therefore still read chart state
+     * while drawing.
+     *
+     * @param stateLock the lock, or null
+     */
+    public void setStateLock(Lock stateLock) {
+        this.stateLock = stateLock;
+    }
+
+    /**
+     * Returns the arena layers of this pipeline acquire vertex arrays from.
+     */
+    public VertexArena getVertexArena() {
+        return vertexArena;
+    }
+
     /**
      * Sets the background color.
      */
@@ -509,6 +566,7 @@ public class RenderPipeline implements GLEventListener {
         gl.glClear(GL.GL_COLOR_BUFFER_BIT);
 
         // Create render context for this frame
+        vertexArena.reset();
         RenderContext ctx = createRenderContext(gl);
 
         // Auto-scale each axis to its associated series
@@ -520,7 +578,8 @@ public class RenderPipeline implements GLEventListener {
         legacyCoordinates.invalidateCache();
         legacyCoordinates.updateCache();
 
-        // Render each visible layer
+        // Build vertex data, then upload and draw each visible layer in z-order
+        prepareLayers(ctx);
         for (RenderLayer layer : layers) {
             if (layer.isVisible()) {
                 layer.render(ctx);
@@ -622,6 +681,49 @@ public class RenderPipeline implements GLEventListener {
         log.debug("Viewport resized to {}x{}", width, height);
     }
 
+    /**
+     * Runs the prepare phase of all visible layers that have one.
+     *
+     * <p>Frame state (viewport, axis ranges, coordinate caches) is final at
+     * this point, and every axis transform was warmed by
+     * {@link MultiAxisCoordinateSystem#updateCache}, so layers can read it
+     * from any thread. A failing layer is
+     * logged and skipped; its render call falls back to building inline.
+     */
+    private void prepareLayers(RenderContext ctx) {
+        preparingLayers.clear();
+        for (RenderLayer layer : layers) {
+            if (layer.isVisible() && layer.hasPreparePhase()) {
+                preparingLayers.add(layer);
+            }
+        }
+        if (preparingLayers.isEmpty()) {
+            return;
+        }
+
+        if (!parallelPrepare) {
+            for (RenderLayer layer : preparingLayers) {
+                prepareLayer(layer, ctx);
+            }
+            return;
+        }
+
+        ForkJoinTask<?>[] tasks = new ForkJoinTask<?>[preparingLayers.size()];
+        for (int i = 0; i < tasks.length; i++) {
+            RenderLayer layer = preparingLayers.get(i);
+            tasks[i] = ForkJoinTask.adapt(() -> prepareLayer(layer, ctx));
+        }
+        ForkJoinPool.commonPool().invoke(ForkJoinTask.adapt(() -> ForkJoinTask.invokeAll(tasks)));
+    }
+
+    private static void prepareLayer(RenderLayer layer, RenderContext ctx) {
+        try {
+            layer.prepare(ctx);
+        } catch (RuntimeException e) {
+            log.error("Prepare failed for {}", layer.getClass().getSimpleName(), e);
+        }
+    }
+
     /**
      * Creates the render context for the current frame.
      */
@@ -630,6 +732,7 @@ public class RenderPipeline implements GLEventListener {
         ctx.setBarDuration(barDuration);
         ctx.setScaleFactor(scaleFactor);
         ctx.setCategoryAxis(categoryAxis);
+        ctx.setVertexArena(vertexArena);
 
         // Add abstracted API components if enabled
         if (useAbstractedAPI) {
@@ -666,6 +769,26 @@ public class RenderPipeline implements GLEventListener {
      */
     public void renderWithDevice(RenderDevice device, ResourceManager resourceManager,
                                   int width, int height) {
+        prepareWithDevice(device, resourceManager, width, height);
+        drawPreparedFrame();
+    }
+
+    /**
+     * Runs the part of a frame that reads chart state: viewport and axis
+     * updates, auto-scaling and the prepare phase of all layers.
+     *
+     * <p>When rendering on a render thread this is the only part that needs
+     * the chart state lock. Follow with {@link #drawPreparedFrame()}.
+     *
+     * @param device the render device to use
+     * @param resourceManager the resource manager for the device
+     * @param width the viewport width
+     * @param height the viewport height
+     */
+    public void prepareWithDevice(RenderDevice device, ResourceManager resourceManager,
+                                  int width, int height) {
+        preparedContext = null;
+        frameLayers.clear();
         if (device == null || !device.isInitialized()) {
             log.warn("Cannot render: device is null or not initialized");
             return;
@@ -686,13 +809,8 @@ public class RenderPipeline implements GLEventListener {
         coordinates.updateCache();
         legacyCoordinates.updateCache();
 
-        // Clear background using abstracted API
-        float r = backgroundColor.getRed() / 255f;
-        float g = backgroundColor.getGreen() / 255f;
-        float b = backgroundColor.getBlue() / 255f;
-        device.clearScreen(r, g, b, 1.0f);
-
         // Create render context for this frame (without GL)
+        vertexArena.reset();
         RenderContext ctx = createRenderContextForDevice(device, resourceManager);
 
         // Auto-scale each axis to its associated series
@@ -704,13 +822,52 @@ public class RenderPipeline implements GLEventListener {
         legacyCoordinates.invalidateCache();
         legacyCoordinates.updateCache();
 
-        // Render each visible layer
+        // Build vertex data; the layer list is fixed for the draw pass
+        prepareLayers(ctx);
         for (RenderLayer layer : layers) {
             if (layer.isVisible()) {
+                frameLayers.add(layer);
+            }
+        }
+        preparedContext = ctx;
+    }
+
+    /**
+     * Uploads and draws the frame built by the last
+     * {@link #prepareWithDevice} call, each layer in z-order.
+     *
+     * <p>Layers with a prepare phase only upload what they built, so they
+     * draw without the state lock. Layers without one draw with the lock
+     * held (see {@link #setStateLock}); they may see state changed since the
+     * prepare phase, and the change that caused it requests the next frame.
+     */
+    public void drawPreparedFrame() {
+        RenderContext ctx = preparedContext;
+        if (ctx == null) {
+            return;
+        }
+        preparedContext = null;
+
+        float r = backgroundColor.getRed() / 255f;
+        float g = backgroundColor.getGreen() / 255f;
+        float b = backgroundColor.getBlue() / 255f;
+        ctx.getDevice().clearScreen(r, g, b, 1.0f);
+
+        Lock lock = stateLock;
+        for (RenderLayer layer : frameLayers) {
+            if (lock == null || layer.hasPreparePhase()) {
                 layer.render(ctx);
-                layer.markClean();
+            } else {
+                lock.lock();
+                try {
+                    layer.render(ctx);
+                } finally {
+                    lock.unlock();
+                }
             }
+            layer.markClean();
         }
+        frameLayers.clear();
     }
 
     /**
@@ -722,6 +879,7 @@ public class RenderPipeline implements GLEventListener {
         ctx.setBarDuration(barDuration);
         ctx.setScaleFactor(scaleFactor);
         ctx.setCategoryAxis(categoryAxis);
+        ctx.setVertexArena(vertexArena);
         ctx.setDevice(device);
         ctx.setResourceManager(resourceManager);
 
@@ -6,7 +6,12 @@ import com.apokalypsix.chartx.core.render.model.ColoredCandleRule;
 import com.apokalypsix.chartx.core.render.model.OHLCColorRule;
 import com.apokalypsix.chartx.core.render.model.RenderContext;
 import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.core.data.OhlcPyramid;
 import com.apokalypsix.chartx.core.render.api.*;
+import com.apokalypsix.chartx.core.render.lod.LodPolicy;
+import com.apokalypsix.chartx.core.render.lod.LodSelector;
+import com.apokalypsix.chartx.core.render.lod.LodTable;
+import com.apokalypsix.chartx.core.render.util.VertexArena;
 
 import java.awt.Color;
 
@@ -23,9 +28,47 @@ import java.awt.Color;
  *   <li>{@link ChartStyle#COLORED_CANDLE} - Custom coloring rules</li>
  *   <li>{@link ChartStyle#HEIKIN_ASHI} - Smoothed candles</li>
  * </ul>
+ *
+ * <p>When bars are only a pixel or two wide, bodies and ticks are no longer
+ * distinguishable; the renderer then switches to {@link Detail#WICKS_ONLY}
+ * through the shared {@link LodPolicy} and draws one direction-colored
+ * high-low line per bar. Once there is more than one bar per pixel it
+ * switches to {@link Detail#AGGREGATED}: all bars falling into a pixel column
+ * are merged into one synthetic candle (first open, highest high, lowest low,
+ * last close, colored by net direction), with the high and low taken from
+ * the data's {@link OhlcPyramid}. Output is then bounded by the chart width
+ * rather than the number of visible bars. Merged candles keep the chart
+ * style: {@link ChartStyle#COLORED_CANDLE} applies the color rule to the
+ * last bar of each column, and {@link ChartStyle#HOLLOW_CANDLE} outlines
+ * rising columns.
  */
 public class CandlestickRendererV2 {
 
+    /**
+     * Detail levels, most detailed first.
+     */
+    public enum Detail {
+        /** Bodies and wicks, or OHLC ticks */
+        FULL,
+        /** Narrow bars: a single high-low line per bar in the candle color */
+        WICKS_ONLY,
+        /** Several bars per pixel: one merged candle per pixel column */
+        AGGREGATED
+    }
+
+    private static final LodTable<Detail> LOD_TABLE = LodTable.builder(Detail.class)
+            .level(Detail.FULL, 2.0)
+            .level(Detail.WICKS_ONLY, 1.0)
+            .level(Detail.AGGREGATED, 0)
+            .build();
+
+    // Reusable high/low result of pyramid queries and aggregated
+    // body, wick and outline float counts
+    private final float[] rangeHighLow = new float[2];
+    private final int[] aggregatedFloatCounts = new int[3];
+
+    private final LodSelector<Detail> lod = LodPolicy.getDefault().createSelector(LOD_TABLE);
+
     // Colors
     private Color bullishColor = new Color(38, 166, 91);   // Green
     private Color bearishColor = new Color(214, 69, 65);   // Red
@@ -43,15 +86,19 @@ public class CandlestickRendererV2 {
     private Buffer tickBuffer;
     private Shader shader;
 
-    // Vertex arrays
+    // Vertex arrays, acquired from the frame's arena in prepare() and
+    // released once render() has uploaded them
     private float[] bodyVertices;
     private float[] wickVertices;
     private float[] tickVertices;
-    private int bodyVertexCapacity;
-    private int wickVertexCapacity;
-    private int tickVertexCapacity;
     private int hollowOutlineFloatCount;
 
+    // Float counts of the prepared frame; bodyFloatCount < 0 until prepared
+    private int bodyFloatCount = -1;
+    private int wickFloatCount;
+    private int tickFloatCount;
+    private boolean wicksFirst;
+
     // Initialization tracking
     protected boolean initialized = false;
 
@@ -84,46 +131,69 @@ public class CandlestickRendererV2 {
         // Get shader
         shader = resources.getShader(ResourceManager.SHADER_DEFAULT);
 
-        // Pre-allocate vertex arrays
-        bodyVertexCapacity = 256;
-        wickVertexCapacity = 256;
-        tickVertexCapacity = 256;
-        bodyVertices = new float[bodyVertexCapacity * BODY_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR];
-        wickVertices = new float[wickVertexCapacity * WICK_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR];
-        tickVertices = new float[tickVertexCapacity * TICK_VERTICES_PER_BAR * FLOATS_PER_VERTEX_COLOR];
-
         initialized = true;
     }
 
-    public void render(RenderContext ctx, OhlcData data) {
+    /**
+     * Builds the vertices of the visible bars into arena arrays for the next
+     * {@link #render} call.
+     *
+     * <p>Only reads frame state and writes this renderer's arrays, so it may
+     * run on a worker thread of the pipeline's prepare phase.
+     */
+    public void prepare(RenderContext ctx, OhlcData data) {
+        // Arrays left over from an unrendered frame were reclaimed by the arena reset
+        bodyVertices = null;
+        wickVertices = null;
+        tickVertices = null;
+        bodyFloatCount = 0;
+        wickFloatCount = 0;
+        tickFloatCount = 0;
+        wicksFirst = false;
+
         if (data == null || data.isEmpty() || !ctx.hasVisibleData()) {
             return;
         }
 
+        Detail detail = lod.update(ctx.getBarWidth());
+        if (detail == Detail.AGGREGATED) {
+            prepareAggregated(ctx, data);
+            return;
+        }
+        if (detail == Detail.WICKS_ONLY) {
+            prepareWicksOnly(ctx, data);
+            return;
+        }
+
         switch (chartStyle) {
-            case CANDLESTICK, HEIKIN_ASHI -> renderCandlesticks(ctx, data);
-            case OHLC_BAR -> renderOHLCBars(ctx, data);
-            case HOLLOW_CANDLE -> renderHollowCandles(ctx, data);
-            case COLORED_CANDLE -> renderColoredCandles(ctx, data);
+            case CANDLESTICK, HEIKIN_ASHI -> prepareCandlesticks(ctx, data);
+            case OHLC_BAR -> prepareOHLCBars(ctx, data);
+            case HOLLOW_CANDLE -> prepareHollowCandles(ctx, data);
+            case COLORED_CANDLE -> prepareColoredCandles(ctx, data);
         }
     }
 
-    private void renderCandlesticks(RenderContext ctx, OhlcData data) {
-        RenderDevice device = ctx.getDevice();
-        CoordinateSystem coords = ctx.getCoordinatesForData(data);
-
-        int firstIdx = ctx.getFirstVisibleIndex();
-        int lastIdx = ctx.getLastVisibleIndex();
-        int visibleCount = lastIdx - firstIdx + 1;
-
-        ensureCapacity(visibleCount);
-
-        double barWidth = ctx.getBarWidth();
-        double halfBodyWidth = barWidth * bodyWidthRatio / 2.0;
-
-        int bodyFloatCount = buildBodyVertices(data, coords, firstIdx, lastIdx, halfBodyWidth);
-        int wickFloatCount = buildWickVertices(data, coords, firstIdx, lastIdx);
+    /**
+     * Uploads and draws the vertices built by {@link #prepare}, building
+     * them first if this frame has not been prepared.
+     */
+    public void render(RenderContext ctx, OhlcData data) {
+        VertexArena arena = ctx.getVertexArena();
+        try {
+            if (bodyFloatCount < 0) {
+                prepare(ctx, data);
+            }
+            draw(ctx);
+        } finally {
+            releaseVertices(arena);
+            bodyFloatCount = -1;
+        }
+    }
 
+    private void draw(RenderContext ctx) {
+        if (bodyFloatCount + wickFloatCount + tickFloatCount == 0) {
+            return;
+        }
         if (shader == null || !shader.isValid()) {
             return;
         }
@@ -131,135 +201,252 @@ public class CandlestickRendererV2 {
         shader.bind();
         shader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
 
+        if (wicksFirst) {
+            drawWicks();
+        }
+
         if (bodyFloatCount > 0) {
             bodyBuffer.upload(bodyVertices, 0, bodyFloatCount);
             bodyBuffer.draw(DrawMode.TRIANGLES);
         }
 
+        if (!wicksFirst) {
+            drawWicks();
+        }
+
+        // OHLC ticks or hollow outlines
+        if (tickFloatCount > 0) {
+            tickBuffer.upload(tickVertices, 0, tickFloatCount);
+            tickBuffer.draw(DrawMode.LINES);
+        }
+
+        shader.unbind();
+    }
+
+    private void drawWicks() {
         if (wickFloatCount > 0) {
             wickBuffer.upload(wickVertices, 0, wickFloatCount);
             wickBuffer.draw(DrawMode.LINES);
         }
-
-        shader.unbind();
     }
 
-    private void renderOHLCBars(RenderContext ctx, OhlcData data) {
-        RenderDevice device = ctx.getDevice();
+    private void prepareCandlesticks(RenderContext ctx, OhlcData data) {
         CoordinateSystem coords = ctx.getCoordinatesForData(data);
 
         int firstIdx = ctx.getFirstVisibleIndex();
         int lastIdx = ctx.getLastVisibleIndex();
         int visibleCount = lastIdx - firstIdx + 1;
 
-        ensureCapacity(visibleCount);
+        acquireVertices(ctx.getVertexArena(), visibleCount, TICK_VERTICES_PER_BAR);
 
         double barWidth = ctx.getBarWidth();
-        double bodyWidth = barWidth * bodyWidthRatio;
-        double tickWidth = bodyWidth * tickWidthRatio;
+        double halfBodyWidth = barWidth * bodyWidthRatio / 2.0;
 
-        int wickFloatCount = buildOHLCWickVertices(data, coords, firstIdx, lastIdx);
-        int tickFloatCount = buildOHLCTickVertices(data, coords, firstIdx, lastIdx, tickWidth);
+        bodyFloatCount = buildBodyVertices(data, coords, firstIdx, lastIdx, halfBodyWidth);
+        wickFloatCount = buildWickVertices(data, coords, firstIdx, lastIdx);
+    }
 
-        if (shader == null || !shader.isValid()) {
-            return;
-        }
+    private void prepareOHLCBars(RenderContext ctx, OhlcData data) {
+        CoordinateSystem coords = ctx.getCoordinatesForData(data);
 
-        shader.bind();
-        shader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+        int firstIdx = ctx.getFirstVisibleIndex();
+        int lastIdx = ctx.getLastVisibleIndex();
+        int visibleCount = lastIdx - firstIdx + 1;
 
-        if (wickFloatCount > 0) {
-            wickBuffer.upload(wickVertices, 0, wickFloatCount);
-            wickBuffer.draw(DrawMode.LINES);
-        }
+        acquireVertices(ctx.getVertexArena(), visibleCount, TICK_VERTICES_PER_BAR);
 
-        if (tickFloatCount > 0) {
-            tickBuffer.upload(tickVertices, 0, tickFloatCount);
-            tickBuffer.draw(DrawMode.LINES);
-        }
+        double barWidth = ctx.getBarWidth();
+        double bodyWidth = barWidth * bodyWidthRatio;
+        double tickWidth = bodyWidth * tickWidthRatio;
 
-        shader.unbind();
+        wickFloatCount = buildOHLCWickVertices(data, coords, firstIdx, lastIdx);
+        tickFloatCount = buildOHLCTickVertices(data, coords, firstIdx, lastIdx, tickWidth);
+        wicksFirst = true;
     }
 
-    private void renderHollowCandles(RenderContext ctx, OhlcData data) {
+    private void prepareHollowCandles(RenderContext ctx, OhlcData data) {
         CoordinateSystem coords = ctx.getCoordinatesForData(data);
 
         int firstIdx = ctx.getFirstVisibleIndex();
         int lastIdx = ctx.getLastVisibleIndex();
         int visibleCount = lastIdx - firstIdx + 1;
 
-        ensureHollowCapacity(visibleCount);
+        acquireVertices(ctx.getVertexArena(), visibleCount, OUTLINE_VERTICES_PER_CANDLE);
 
         double barWidth = ctx.getBarWidth();
         double halfBodyWidth = barWidth * bodyWidthRatio / 2.0;
 
-        int bodyFloatCount = buildHollowBodyVertices(data, coords, firstIdx, lastIdx, halfBodyWidth);
-        int wickFloatCount = buildWickVertices(data, coords, firstIdx, lastIdx);
-
-        if (shader == null || !shader.isValid()) {
-            return;
-        }
+        // Wicks first, then filled bearish bodies, then bullish outlines
+        bodyFloatCount = buildHollowBodyVertices(data, coords, firstIdx, lastIdx, halfBodyWidth);
+        wickFloatCount = buildWickVertices(data, coords, firstIdx, lastIdx);
+        tickFloatCount = hollowOutlineFloatCount;
+        wicksFirst = true;
+    }
 
-        shader.bind();
-        shader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+    private void prepareColoredCandles(RenderContext ctx, OhlcData data) {
+        CoordinateSystem coords = ctx.getCoordinatesForData(data);
 
-        // Draw wicks first
-        if (wickFloatCount > 0) {
-            wickBuffer.upload(wickVertices, 0, wickFloatCount);
-            wickBuffer.draw(DrawMode.LINES);
-        }
+        int firstIdx = ctx.getFirstVisibleIndex();
+        int lastIdx = ctx.getLastVisibleIndex();
+        int visibleCount = lastIdx - firstIdx + 1;
 
-        // Draw filled bodies (bearish)
-        if (bodyFloatCount > 0) {
-            bodyBuffer.upload(bodyVertices, 0, bodyFloatCount);
-            bodyBuffer.draw(DrawMode.TRIANGLES);
-        }
+        acquireVertices(ctx.getVertexArena(), visibleCount, TICK_VERTICES_PER_BAR);
 
-        // Draw hollow outlines (bullish)
-        if (hollowOutlineFloatCount > 0) {
-            tickBuffer.upload(tickVertices, 0, hollowOutlineFloatCount);
-            tickBuffer.draw(DrawMode.LINES);
-        }
+        double barWidth = ctx.getBarWidth();
+        double halfBodyWidth = barWidth * bodyWidthRatio / 2.0;
 
-        shader.unbind();
+        bodyFloatCount = buildColoredBodyVertices(data, coords, firstIdx, lastIdx, halfBodyWidth);
+        wickFloatCount = buildColoredWickVertices(data, coords, firstIdx, lastIdx);
     }
 
-    private void renderColoredCandles(RenderContext ctx, OhlcData data) {
+    private void prepareWicksOnly(RenderContext ctx, OhlcData data) {
         CoordinateSystem coords = ctx.getCoordinatesForData(data);
 
         int firstIdx = ctx.getFirstVisibleIndex();
         int lastIdx = ctx.getLastVisibleIndex();
-        int visibleCount = lastIdx - firstIdx + 1;
 
-        ensureCapacity(visibleCount);
+        acquireVertices(ctx.getVertexArena(), lastIdx - firstIdx + 1, TICK_VERTICES_PER_BAR);
 
-        double barWidth = ctx.getBarWidth();
-        double halfBodyWidth = barWidth * bodyWidthRatio / 2.0;
+        wickFloatCount = chartStyle == ChartStyle.COLORED_CANDLE
+                ? buildColoredWickVertices(data, coords, firstIdx, lastIdx)
+                : buildOHLCWickVertices(data, coords, firstIdx, lastIdx);
+    }
+
+    private void prepareAggregated(RenderContext ctx, OhlcData data) {
+        CoordinateSystem coords = ctx.getCoordinatesForData(data);
+
+        int firstIdx = ctx.getFirstVisibleIndex();
+        int lastIdx = ctx.getLastVisibleIndex();
 
-        int bodyFloatCount = buildColoredBodyVertices(data, coords, firstIdx, lastIdx, halfBodyWidth);
-        int wickFloatCount = buildColoredWickVertices(data, coords, firstIdx, lastIdx);
+        OhlcPyramid pyramid = data.getPyramid();
+        pyramid.ensure(lastIdx + 1);
 
-        if (shader == null || !shader.isValid()) {
+        long[] timestamps = data.getTimestampsArray();
+        int firstColumn = (int) Math.floor(coords.xValueToScreenX(timestamps[firstIdx]));
+        int lastColumn = (int) Math.floor(coords.xValueToScreenX(timestamps[lastIdx]));
+        if (lastColumn < firstColumn) {
             return;
         }
 
-        shader.bind();
-        shader.setUniformMatrix4("uProjection", ctx.getProjectionMatrix());
+        acquireVertices(ctx.getVertexArena(), lastColumn - firstColumn + 1, OUTLINE_VERTICES_PER_CANDLE);
 
-        if (bodyFloatCount > 0) {
-            bodyBuffer.upload(bodyVertices, 0, bodyFloatCount);
-            bodyBuffer.draw(DrawMode.TRIANGLES);
-        }
+        int[] floatCounts = buildAggregatedVertices(data, coords, pyramid,
+                firstIdx, lastIdx, firstColumn, lastColumn);
+        bodyFloatCount = floatCounts[0];
+        wickFloatCount = floatCounts[1];
+        tickFloatCount = floatCounts[2];
+        wicksFirst = true;
+    }
 
-        if (wickFloatCount > 0) {
-            wickBuffer.upload(wickVertices, 0, wickFloatCount);
-            wickBuffer.draw(DrawMode.LINES);
+    // ========== Vertex Building Methods ==========
+
+    /**
+     * Builds one merged candle per pixel column: a one-pixel body from the
+     * first open to the last close and a high-low line, both in the column's
+     * color. Rising columns of hollow candles get an outline instead of a
+     * filled body.
+     *
+     * @return body, wick and outline float counts
+     */
+    private int[] buildAggregatedVertices(OhlcData data, CoordinateSystem coords, OhlcPyramid pyramid,
+                                           int firstIdx, int lastIdx, int firstColumn, int lastColumn) {
+        int bodyIndex = 0;
+        int wickIndex = 0;
+        int outlineIndex = 0;
+        boolean hollowStyle = chartStyle == ChartStyle.HOLLOW_CANDLE;
+        long[] timestamps = data.getTimestampsArray();
+        float[] opens = data.getOpenArray();
+        float[] closes = data.getCloseArray();
+
+        int start = firstIdx;
+        for (int column = firstColumn; column <= lastColumn && start <= lastIdx; column++) {
+            // Bars whose x falls in [column, column + 1)
+            long edge = coords.screenXToXValue(column + 1);
+            int end = lastIndexBefore(timestamps, start, lastIdx, edge);
+            if (end < start) {
+                continue;
+            }
+
+            pyramid.queryRange(start, end, rangeHighLow);
+            float open = opens[start];
+            float close = closes[end];
+
+            boolean bullish = close >= open;
+            Color color = aggregatedColor(data, end, bullish);
+            float r = color.getRed() / 255f;
+            float g = color.getGreen() / 255f;
+            float b = color.getBlue() / 255f;
+            float a = 1.0f;
+
+            float x = column + 0.5f;
+            float highY = (float) coords.yValueToScreenY(rangeHighLow[0]);
+            float lowY = (float) coords.yValueToScreenY(rangeHighLow[1]);
+            wickIndex = addVertex(wickVertices, wickIndex, x, highY, r, g, b, a);
+            wickIndex = addVertex(wickVertices, wickIndex, x, lowY, r, g, b, a);
+
+            float top = (float) coords.yValueToScreenY(Math.max(open, close));
+            float bottom = (float) coords.yValueToScreenY(Math.min(open, close));
+            float left = column;
+            float right = column + 1;
+            if (hollowStyle && bullish) {
+                outlineIndex = addVertex(tickVertices, outlineIndex, left, top, r, g, b, a);
+                outlineIndex = addVertex(tickVertices, outlineIndex, right, top, r, g, b, a);
+                outlineIndex = addVertex(tickVertices, outlineIndex, left, bottom, r, g, b, a);
+                outlineIndex = addVertex(tickVertices, outlineIndex, right, bottom, r, g, b, a);
+                outlineIndex = addVertex(tickVertices, outlineIndex, left, top, r, g, b, a);
+                outlineIndex = addVertex(tickVertices, outlineIndex, left, bottom, r, g, b, a);
+                outlineIndex = addVertex(tickVertices, outlineIndex, right, top, r, g, b, a);
+                outlineIndex = addVertex(tickVertices, outlineIndex, right, bottom, r, g, b, a);
+            } else if (Math.abs(top - bottom) >= 1.0f) {
+                bodyIndex = addVertex(bodyVertices, bodyIndex, left, top, r, g, b, a);
+                bodyIndex = addVertex(bodyVertices, bodyIndex, left, bottom, r, g, b, a);
+                bodyIndex = addVertex(bodyVertices, bodyIndex, right, bottom, r, g, b, a);
+
+                bodyIndex = addVertex(bodyVertices, bodyIndex, left, top, r, g, b, a);
+                bodyIndex = addVertex(bodyVertices, bodyIndex, right, bottom, r, g, b, a);
+                bodyIndex = addVertex(bodyVertices, bodyIndex, right, top, r, g, b, a);
+            }
+
+            start = end + 1;
         }
 
-        shader.unbind();
+        aggregatedFloatCounts[0] = bodyIndex;
+        aggregatedFloatCounts[1] = wickIndex;
+        aggregatedFloatCounts[2] = outlineIndex;
+        return aggregatedFloatCounts;
     }
 
-    // ========== Vertex Building Methods ==========
+    /**
+     * Returns the color of a merged candle. Custom color rules are applied to
+     * the column's last bar, whose close is the merged close; otherwise the
+     * net direction decides.
+     */
+    private Color aggregatedColor(OhlcData data, int lastBar, boolean bullish) {
+        if (chartStyle == ChartStyle.COLORED_CANDLE && colorRule != ColoredCandleRule.CLOSE_VS_OPEN) {
+            return colorRule.getColor(data, lastBar, bullishColor, bearishColor);
+        }
+        return bullish ? bullishColor : bearishColor;
+    }
+
+    /**
+     * Returns the last index in [from, to] whose timestamp is before {@code edge},
+     * or {@code from - 1} if there is none.
+     */
+    private static int lastIndexBefore(long[] timestamps, int from, int to, long edge) {
+        int lo = from;
+        int hi = to;
+        int result = from - 1;
+        while (lo <= hi) {
+            int mid = (lo + hi) >>> 1;
+            if (timestamps[mid] < edge) {
+                result = mid;
+                lo = mid + 1;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        return result;
+    }
 
     private int buildBodyVertices(OhlcData data, CoordinateSystem coords,
                                    int firstIdx, int lastIdx, double halfBodyWidth) {
@@ -540,37 +727,31 @@ public class CandlestickRendererV2 {
         return floatIndex;
     }
 
-    // ========== Capacity Management ==========
-
-    private void ensureCapacity(int candleCount) {
-        int requiredBodyFloats = candleCount * BODY_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR;
-        int requiredWickFloats = candleCount * WICK_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR;
-        int requiredTickFloats = candleCount * TICK_VERTICES_PER_BAR * FLOATS_PER_VERTEX_COLOR;
-
-        if (requiredBodyFloats > bodyVertices.length) {
-            bodyVertexCapacity = candleCount + candleCount / 2;
-            bodyVertices = new float[bodyVertexCapacity * BODY_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR];
-        }
+    // ========== Vertex Memory ==========
 
-        if (requiredWickFloats > wickVertices.length) {
-            wickVertexCapacity = candleCount + candleCount / 2;
-            wickVertices = new float[wickVertexCapacity * WICK_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR];
-        }
-
-        if (requiredTickFloats > tickVertices.length) {
-            tickVertexCapacity = candleCount + candleCount / 2;
-            tickVertices = new float[tickVertexCapacity * TICK_VERTICES_PER_BAR * FLOATS_PER_VERTEX_COLOR];
-        }
+    /**
+     * Acquires vertex arrays for the given number of candles from the arena.
+     *
+     * @param tickVerticesPerCandle vertices per candle in the tick array
+     *        (ticks for OHLC bars, outlines for hollow candles)
+     */
+    private void acquireVertices(VertexArena arena, int candleCount, int tickVerticesPerCandle) {
+        releaseVertices(arena);
+        bodyVertices = arena.acquire(candleCount * BODY_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR);
+        wickVertices = arena.acquire(candleCount * WICK_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR);
+        tickVertices = arena.acquire(candleCount * tickVerticesPerCandle * FLOATS_PER_VERTEX_COLOR);
     }
 
-    private void ensureHollowCapacity(int candleCount) {
-        ensureCapacity(candleCount);
-
-        int requiredOutlineFloats = candleCount * OUTLINE_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR;
-        if (requiredOutlineFloats > tickVertices.length) {
-            tickVertexCapacity = candleCount + candleCount / 2;
-            tickVertices = new float[tickVertexCapacity * OUTLINE_VERTICES_PER_CANDLE * FLOATS_PER_VERTEX_COLOR];
-        }
+    /**
+     * Returns the vertex arrays to the arena once they have been uploaded.
+     */
+    private void releaseVertices(VertexArena arena) {
+        arena.release(bodyVertices);
+        arena.release(wickVertices);
+        arena.release(tickVertices);
+        bodyVertices = null;
+        wickVertices = null;
+        tickVertices = null;
     }
 
     public void dispose(RenderContext ctx) {
@@ -610,6 +791,9 @@ public class CandlestickRendererV2 {
     public void setTickWidthRatio(float ratio) { this.tickWidthRatio = Math.max(0.1f, Math.min(1.0f, ratio)); }
     public float getTickWidthRatio() { return tickWidthRatio; }
 
+    /** Returns the detail level chosen for the last rendered frame. */
+    public Detail getDetail() { return lod.getLevel(); }
+
     // ========== Helper Methods ==========
 
     /**
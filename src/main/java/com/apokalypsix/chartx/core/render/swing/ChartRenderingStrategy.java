@@ -1,5 +1,7 @@
 package com.apokalypsix.chartx.core.render.swing;
 
+import java.util.concurrent.locks.Lock;
+
 import javax.swing.*;
 
 import com.apokalypsix.chartx.core.render.service.RenderPipeline;
@@ -68,4 +70,28 @@ public interface ChartRenderingStrategy {
      * Returns the name of this rendering backend for display purposes.
      */
     String getBackendName();
+
+    /**
+     * Returns true if this strategy can render on a dedicated thread
+     * instead of the Swing EDT.
+     */
+    default boolean supportsRenderThread() {
+        return false;
+    }
+
+    /**
+     * Enables or disables rendering on a dedicated thread.
+     *
+     * <p>While enabled, frames are rendered off the EDT and the EDT only
+     * presents the last finished frame. {@code stateLock} is held while a
+     * frame reads chart state; drawing what was prepared runs unlocked. Code that
+     * mutates chart state (modifiers, layer setters) must hold the same lock.
+     * Strategies that do not {@link #supportsRenderThread() support} this
+     * ignore the call and keep rendering on the EDT.
+     *
+     * @param enabled true to render on a dedicated thread
+     * @param stateLock lock guarding chart state during a frame
+     */
+    default void setRenderThreadEnabled(boolean enabled, Lock stateLock) {
+    }
 }
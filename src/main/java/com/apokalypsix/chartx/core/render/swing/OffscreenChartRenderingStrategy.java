@@ -10,6 +10,7 @@ import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
 import javax.swing.*;
+import java.util.concurrent.locks.Lock;
 
 /**
  * Offscreen rendering strategy for non-OpenGL backends (Vulkan, Metal, DX12).
@@ -70,7 +71,22 @@ public class OffscreenChartRenderingStrategy implements ChartRenderingStrategy {
 
             // Create the render panel
             renderPanel = new OffscreenRenderPanel(device);
-            renderPanel.setRenderCallback(this::renderFrame);
+            renderPanel.setRenderCallback(new OffscreenRenderPanel.RenderCallback() {
+                @Override
+                public boolean hasPreparePhase() {
+                    return true;
+                }
+
+                @Override
+                public void prepare(RenderDevice device, int width, int height) {
+                    prepareFrame(device, width, height);
+                }
+
+                @Override
+                public void render(RenderDevice device, int width, int height) {
+                    renderFrame();
+                }
+            });
 
             initialized = true;
             log.info("OffscreenChartRenderingStrategy initialized with {} backend", backend);
@@ -82,15 +98,24 @@ public class OffscreenChartRenderingStrategy implements ChartRenderingStrategy {
     }
 
     /**
-     * Callback invoked by OffscreenRenderPanel to render a frame.
+     * Reads chart state and builds the frame; runs with the state lock held
+     * on the render thread.
      */
-    private void renderFrame(RenderDevice device, int width, int height) {
+    private void prepareFrame(RenderDevice device, int width, int height) {
         if (pipeline == null || !initialized) {
             return;
         }
+        pipeline.prepareWithDevice(device, resourceManager, width, height);
+    }
 
-        // Use the pipeline's non-GL rendering method
-        pipeline.renderWithDevice(device, resourceManager, width, height);
+    /**
+     * Draws the frame built by {@link #prepareFrame}.
+     */
+    private void renderFrame() {
+        if (pipeline == null || !initialized) {
+            return;
+        }
+        pipeline.drawPreparedFrame();
     }
 
     @Override
@@ -110,10 +135,33 @@ public class OffscreenChartRenderingStrategy implements ChartRenderingStrategy {
         return initialized;
     }
 
+    @Override
+    public boolean supportsRenderThread() {
+        return true;
+    }
+
+    @Override
+    public void setRenderThreadEnabled(boolean enabled, Lock stateLock) {
+        if (renderPanel == null) {
+            return;
+        }
+        if (enabled) {
+            pipeline.setStateLock(stateLock);
+            renderPanel.startRenderThread(stateLock);
+        } else {
+            renderPanel.stopRenderThread();
+            pipeline.setStateLock(null);
+        }
+    }
+
     @Override
     public void dispose() {
         initialized = false;
 
+        if (renderPanel != null) {
+            renderPanel.stopRenderThread();
+        }
+
         if (resourceManager != null) {
             resourceManager.dispose();
             resourceManager = null;
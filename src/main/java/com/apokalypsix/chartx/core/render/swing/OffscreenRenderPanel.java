@@ -9,6 +9,7 @@ import java.awt.*;
 import java.awt.image.BufferedImage;
 import java.awt.image.DataBufferInt;
 import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.locks.Lock;
 
 /**
  * Universal Swing panel for offscreen rendering with any RenderDevice.
@@ -27,6 +28,13 @@ import java.util.concurrent.atomic.AtomicBoolean;
  *
  * <p>This class consolidates the common pattern from VkSwingPanel,
  * MetalSwingPanel, and DX12SwingPanel into a single reusable component.
+ *
+ * <p>By default frames are rendered inside {@code paintComponent} on the EDT.
+ * With {@link #startRenderThread(Lock)} they are rendered on a dedicated
+ * {@link RenderThread}; the EDT only draws the last completed image, so a
+ * slow frame never delays input handling. Three images rotate between the
+ * render thread and the EDT, so the image being drawn is never the one
+ * being rendered into.
  */
 public class OffscreenRenderPanel extends JPanel {
 
@@ -42,6 +50,18 @@ public class OffscreenRenderPanel extends JPanel {
     private int lastWidth = -1;
     private int lastHeight = -1;
 
+    // Threaded mode: the render thread owns backBuffer/pixelBuffer and
+    // publishes finished frames through frontBuffer. The EDT marks the image
+    // it draws as paintingBuffer; spareBuffer is the third image.
+    private volatile RenderThread renderThread;
+    private Lock stateLock;
+    private final Object frameLock = new Object();
+    private BufferedImage frontBuffer;
+    private BufferedImage paintingBuffer;
+    private BufferedImage spareBuffer;
+    private volatile int requestedWidth;
+    private volatile int requestedHeight;
+
     /**
      * Callback interface for custom rendering.
      */
@@ -50,11 +70,33 @@ public class OffscreenRenderPanel extends JPanel {
         /**
          * Called to render the frame content.
          *
+         * <p>On the render thread this runs with the state lock held, unless
+         * the callback {@link #hasPreparePhase() has a prepare phase}.
+         *
          * @param device the render device
          * @param width frame width
          * @param height frame height
          */
         void render(RenderDevice device, int width, int height);
+
+        /**
+         * Returns true if this callback reads all chart state in
+         * {@link #prepare}, so {@link #render} can run without the state lock.
+         */
+        default boolean hasPreparePhase() {
+            return false;
+        }
+
+        /**
+         * Called before {@link #render} to read chart state for the frame. On
+         * the render thread this is the only call made with the state lock held.
+         *
+         * @param device the render device
+         * @param width frame width
+         * @param height frame height
+         */
+        default void prepare(RenderDevice device, int width, int height) {
+        }
     }
 
     /**
@@ -83,9 +125,136 @@ public class OffscreenRenderPanel extends JPanel {
      */
     public void requestRender() {
         renderRequested.set(true);
+        RenderThread thread = renderThread;
+        if (thread != null) {
+            thread.requestFrame();
+        } else {
+            repaint();
+        }
+    }
+
+    /**
+     * Moves rendering to a dedicated thread.
+     *
+     * <p>Each frame reads chart state with {@code stateLock} held: only the
+     * callback's prepare phase when it has one, otherwise its whole render
+     * call. Drawing and the pixel readback of a prepared frame run unlocked.
+     *
+     * @param stateLock lock guarding the state read by the render callback
+     */
+    public synchronized void startRenderThread(Lock stateLock) {
+        if (renderThread != null) {
+            return;
+        }
+        this.stateLock = stateLock;
+        requestedWidth = getWidth();
+        requestedHeight = getHeight();
+        renderThread = new RenderThread("chartx-render-" + device.getBackendType(), this::renderThreadFrame);
+        renderThread.start();
+        renderThread.requestFrame();
+    }
+
+    /**
+     * Stops the render thread and returns to rendering on the EDT.
+     */
+    public void stopRenderThread() {
+        RenderThread thread;
+        synchronized (this) {
+            thread = renderThread;
+            renderThread = null;
+        }
+        if (thread != null) {
+            thread.stop();
+        }
+        synchronized (frameLock) {
+            frontBuffer = null;
+            spareBuffer = null;
+        }
+        // The EDT path allocates its own buffers on the next paint
+        lastWidth = -1;
+        lastHeight = -1;
         repaint();
     }
 
+    /**
+     * Returns true if frames are rendered on a dedicated thread.
+     */
+    public boolean isRenderThreadRunning() {
+        return renderThread != null;
+    }
+
+    private void renderThreadFrame() {
+        int width = requestedWidth;
+        int height = requestedHeight;
+        if (width <= 0 || height <= 0 || !device.isInitialized()) {
+            return;
+        }
+
+        if (width != lastWidth || height != lastHeight) {
+            resizeBuffers(width, height);
+            lastWidth = width;
+            lastHeight = height;
+        }
+
+        RenderCallback callback = renderCallback;
+        device.beginFrame();
+        if (callback != null) {
+            boolean prepared = callback.hasPreparePhase();
+            Lock lock = stateLock;
+            if (lock != null) {
+                lock.lock();
+            }
+            try {
+                if (prepared) {
+                    callback.prepare(device, width, height);
+                } else {
+                    callback.render(device, width, height);
+                }
+            } finally {
+                if (lock != null) {
+                    lock.unlock();
+                }
+            }
+            if (prepared) {
+                callback.render(device, width, height);
+            }
+        }
+        device.endFrame();
+        device.readFramePixels(pixelBuffer);
+
+        publishFrame(width, height);
+        renderRequested.set(false);
+        repaint();
+    }
+
+    /**
+     * Hands the finished back buffer to the EDT and picks the image for the
+     * next frame: the previous front image, or the spare one if the EDT is
+     * still drawing the previous front image.
+     */
+    private void publishFrame(int width, int height) {
+        BufferedImage next;
+        synchronized (frameLock) {
+            BufferedImage previous = frontBuffer;
+            frontBuffer = backBuffer;
+            if (previous != null && previous == paintingBuffer) {
+                next = spareBuffer;
+                spareBuffer = previous;
+            } else {
+                next = previous;
+            }
+        }
+
+        if (next != null && next.getWidth() == width && next.getHeight() == height) {
+            backBuffer = next;
+            pixelBuffer = ((DataBufferInt) next.getRaster().getDataBuffer()).getData();
+        } else {
+            backBuffer = null;
+            lastWidth = -1;
+            lastHeight = -1;
+        }
+    }
+
     @Override
     protected void paintComponent(Graphics g) {
         super.paintComponent(g);
@@ -97,6 +266,31 @@ public class OffscreenRenderPanel extends JPanel {
             return;
         }
 
+        RenderThread thread = renderThread;
+        if (thread != null) {
+            // Present the last finished frame; request a new one on resize
+            if (width != requestedWidth || height != requestedHeight) {
+                requestedWidth = width;
+                requestedHeight = height;
+                thread.requestFrame();
+            }
+            BufferedImage frame;
+            synchronized (frameLock) {
+                frame = frontBuffer;
+                paintingBuffer = frame;
+            }
+            try {
+                if (frame != null) {
+                    g.drawImage(frame, 0, 0, null);
+                }
+            } finally {
+                synchronized (frameLock) {
+                    paintingBuffer = null;
+                }
+            }
+            return;
+        }
+
         // Check if device is ready
         if (!device.isInitialized()) {
             drawNotInitializedMessage(g, width, height);
@@ -155,8 +349,12 @@ public class OffscreenRenderPanel extends JPanel {
         device.beginFrame();
 
         // Call render callback if set
-        if (renderCallback != null) {
-            renderCallback.render(device, width, height);
+        RenderCallback callback = renderCallback;
+        if (callback != null) {
+            if (callback.hasPreparePhase()) {
+                callback.prepare(device, width, height);
+            }
+            callback.render(device, width, height);
         }
 
         // End frame
@@ -0,0 +1,126 @@
+package com.apokalypsix.chartx.core.render.swing;
+
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.locks.LockSupport;
+
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+/**
+ * Dedicated per-surface thread that renders frames on request.
+ *
+ * <p>Frame requests are coalesced: any number of {@link #requestFrame()}
+ * calls made while a frame is being rendered result in exactly one further
+ * frame, which then sees the latest state. Input handlers on the EDT therefore
+ * only update chart state and request a frame; they never wait for rendering
+ * to finish.
+ */
+public class RenderThread {
+
+    private static final Logger log = LoggerFactory.getLogger(RenderThread.class);
+
+    private final String name;
+    private final Runnable frameTask;
+
+    private final AtomicBoolean frameRequested = new AtomicBoolean(false);
+    private volatile boolean running;
+    private volatile Thread thread;
+
+    /**
+     * Creates a render thread.
+     *
+     * @param name the thread name
+     * @param frameTask renders one frame; called only on the render thread
+     */
+    public RenderThread(String name, Runnable frameTask) {
+        this.name = name;
+        this.frameTask = frameTask;
+    }
+
+    /**
+     * Starts the thread. Has no effect if already running.
+     */
+    public synchronized void start() {
+        if (running) {
+            return;
+        }
+        running = true;
+        thread = new Thread(this::run, name);
+        thread.setDaemon(true);
+        thread.start();
+    }
+
+    /**
+     * Requests a frame. Safe to call from any thread.
+     */
+    public void requestFrame() {
+        frameRequested.set(true);
+        Thread t = thread;
+        if (t != null) {
+            LockSupport.unpark(t);
+        }
+    }
+
+    /**
+     * Stops the thread and waits until it has exited, so the caller may
+     * release resources the frame task uses. Returns immediately when called
+     * from the render thread itself.
+     */
+    public void stop() {
+        Thread t;
+        synchronized (this) {
+            if (!running) {
+                return;
+            }
+            running = false;
+            t = thread;
+            thread = null;
+        }
+        LockSupport.unpark(t);
+        if (t == Thread.currentThread()) {
+            return;
+        }
+        boolean interrupted = false;
+        while (t.isAlive()) {
+            try {
+                t.join();
+            } catch (InterruptedException e) {
+                // Keep waiting; the frame task may still be using the device
+                interrupted = true;
+            }
+        }
+        if (interrupted) {
+            Thread.currentThread().interrupt();
+        }
+    }
+
+    /**
+     * Returns true if the thread is running.
+     */
+    public boolean isRunning() {
+        return running;
+    }
+
+    /**
+     * Returns true if called from this render thread.
+     */
+    public boolean isRenderThread() {
+        return Thread.currentThread() == thread;
+    }
+
+    private void run() {
+        log.debug("Render thread {} started", name);
+        while (running) {
+            if (!frameRequested.getAndSet(false)) {
+                LockSupport.park(this);
+                continue;
+            }
+            try {
+                frameTask.run();
+            } catch (Exception e) {
+                log.error("Error rendering frame on {}", name, e);
+            }
+        }
+        log.debug("Render thread {} stopped", name);
+    }
+}
@@ -0,0 +1,359 @@
+package com.apokalypsix.chartx.core.render.util;
+
+import com.apokalypsix.chartx.chart.axis.scale.AxisScale;
+import com.apokalypsix.chartx.chart.data.AbstractData;
+import com.apokalypsix.chartx.chart.data.Data;
+import com.apokalypsix.chartx.core.coordinate.CoordinateSystem;
+import com.apokalypsix.chartx.core.data.LazyDataColumns;
+import com.apokalypsix.chartx.core.render.api.Buffer;
+import com.apokalypsix.chartx.core.render.api.BufferDescriptor;
+import com.apokalypsix.chartx.core.render.api.DrawMode;
+import com.apokalypsix.chartx.core.render.api.ResourceManager;
+import com.apokalypsix.chartx.core.render.api.Shader;
+import com.apokalypsix.chartx.core.render.model.RenderContext;
+
+import java.awt.Color;
+import java.util.Arrays;
+import java.util.Objects;
+import java.util.function.Supplier;
+
+/**
+ * Cached GPU mesh of the fill between two value columns, e.g. Bollinger
+ * bands or the Ichimoku cloud.
+ *
+ * <p>The fill is tessellated once in data space: x relative to a per-chunk
+ * origin time and y in the axis scale's linear space (see
+ * {@link AxisScale#toLinearSpace(double)}) relative to a per-chunk origin
+ * value, so large prices keep their float precision. Segments where the
+ * columns cross are split at the crossing, and each part is colored by which
+ * column is on top. The vertices stay in GPU buffers of {@value #CHUNK_SEGMENTS} segments
+ * each. Per frame, the data-to-screen mapping is an affine transform
+ * folded into the projection uniform of each visible chunk, so panning and
+ * zooming cost no CPU tessellation or uploads.
+ *
+ * <p>Chunks are rebuilt lazily when the data changes: appends only rebuild
+ * the last chunk, and updates rebuild from the chunk of the updated index.
+ * Scales that are not linearizable cannot use a cached mesh; check
+ * {@link #supports(AxisScale)} and fall back to per-frame tessellation.
+ */
+public class BandFillMesh extends LazyDataColumns {
+
+    /** Segments per chunk buffer */
+    public static final int CHUNK_SEGMENTS = 4096;
+
+    private static final int FLOATS_PER_VERTEX = 6;
+
+    // Worst case: a crossing splits a segment into two triangles each side
+    private static final int MAX_FLOATS_PER_SEGMENT = 6 * FLOATS_PER_VERTEX;
+
+    private final String name;
+    private final AbstractData<?> data;
+    private final Supplier<float[]> upper;
+    private final Supplier<float[]> lower;
+
+    private Color aboveColor = Color.GRAY;
+    private Color belowColor = Color.GRAY;
+    private AxisScale scale;
+
+    private ResourceManager resources;
+    private Buffer[] buffers = new Buffer[0];
+
+    // Origin time, linear-space origin value and number of segments
+    // tessellated per chunk (-1 = stale)
+    private long[] origins = new long[0];
+    private double[] yOrigins = new double[0];
+    private int[] builtSegments = new int[0];
+
+    private final float[] matrix = new float[16];
+    private final float[] linearProbe = {0f, 1f};
+    private final float[] screenProbe = new float[2];
+
+    /**
+     * Creates a mesh over two columns of the given data.
+     *
+     * @param name prefix of the chunk buffer names, unique per mesh
+     * @param data the data providing timestamps and change notifications
+     * @param upper the column treated as "above"
+     * @param lower the column treated as "below"
+     */
+    public BandFillMesh(String name, AbstractData<?> data, Supplier<float[]> upper, Supplier<float[]> lower) {
+        super(data);
+        this.name = name;
+        this.data = data;
+        this.upper = upper;
+        this.lower = lower;
+    }
+
+    /**
+     * Also rebuilds the mesh when another data object changes, for columns
+     * that live in separate, index-aligned data.
+     */
+    public void track(Data<?> other) {
+        addSource(other);
+    }
+
+    /**
+     * Sets the fill colors where the upper column is above or below the
+     * lower one. Rebuilds the mesh if they change.
+     */
+    public void setColors(Color aboveColor, Color belowColor) {
+        if (!aboveColor.equals(this.aboveColor) || !belowColor.equals(this.belowColor)) {
+            this.aboveColor = aboveColor;
+            this.belowColor = belowColor;
+            invalidate();
+        }
+    }
+
+    /**
+     * Returns true if fills on the given scale can use the cached mesh.
+     */
+    public static boolean supports(AxisScale scale) {
+        return scale.isLinearizable();
+    }
+
+    /**
+     * Draws the fill of points [firstIdx, lastIdx], rebuilding stale chunks.
+     *
+     * @param ctx the render context
+     * @param coords the coordinate system of the fill's axis, whose scale
+     *               must be {@linkplain #supports supported}
+     * @param resources resource manager owning the chunk buffers
+     * @param firstIdx first point index
+     * @param lastIdx last point index
+     */
+    public void draw(RenderContext ctx, CoordinateSystem coords, ResourceManager resources,
+                     int firstIdx, int lastIdx) {
+        int size = data.size();
+        lastIdx = Math.min(lastIdx, size - 1);
+        if (lastIdx <= firstIdx) {
+            return;
+        }
+        this.resources = resources;
+
+        AxisScale axisScale = coords.getYAxisScale();
+        if (!Objects.equals(axisScale, scale)) {
+            scale = axisScale;
+            invalidate();
+        }
+        ensure(size);
+
+        Shader shader = resources.getShader(ResourceManager.SHADER_DEFAULT);
+        if (shader == null || !shader.isValid()) {
+            return;
+        }
+
+        // Per-frame affine constants of the linear-space Y mapping
+        coords.linearSpaceToScreenY(linearProbe, screenProbe, 0, 2);
+        double by = screenProbe[0];
+        double ay = screenProbe[1] - screenProbe[0];
+
+        int firstChunk = firstIdx / CHUNK_SEGMENTS;
+        int lastChunk = (lastIdx - 1) / CHUNK_SEGMENTS;
+        ensureChunks(lastChunk + 1);
+
+        shader.bind();
+        for (int c = firstChunk; c <= lastChunk; c++) {
+            int segments = Math.min(CHUNK_SEGMENTS, size - 1 - c * CHUNK_SEGMENTS);
+            if (builtSegments[c] != segments) {
+                build(ctx, c, segments);
+            }
+            Buffer buffer = buffers[c];
+            if (buffer == null || buffer.getVertexCount() == 0) {
+                continue;
+            }
+
+            // Chunk x is in milliseconds after its origin, y relative to its origin value
+            double bx = coords.xValueToScreenX(origins[c]);
+            double ax = coords.getPixelWidth(1);
+            composeProjection(ctx.getProjectionMatrix(), ax, bx, ay, by + ay * yOrigins[c]);
+            shader.setUniformMatrix4("uProjection", matrix);
+            buffer.draw(DrawMode.TRIANGLES);
+        }
+        shader.unbind();
+    }
+
+    /**
+     * Releases the chunk buffers and stops tracking the data.
+     */
+    @Override
+    public void dispose() {
+        super.dispose();
+        if (resources != null) {
+            for (int c = 0; c < buffers.length; c++) {
+                if (buffers[c] != null) {
+                    resources.disposeBuffer(bufferName(c));
+                }
+            }
+        }
+        buffers = new Buffer[0];
+        origins = new long[0];
+        yOrigins = new double[0];
+        builtSegments = new int[0];
+    }
+
+    // ========== Tessellation ==========
+
+    private void build(RenderContext ctx, int chunk, int segments) {
+        int first = chunk * CHUNK_SEGMENTS;
+        long[] timestamps = data.getXValuesArray();
+        float[] up = upper.get();
+        float[] lo = lower.get();
+        long origin = timestamps[first];
+        double yOrigin = yOrigin(up, lo, first, first + segments);
+
+        VertexArena arena = ctx.getVertexArena();
+        float[] vertices = arena.acquire(segments * MAX_FLOATS_PER_SEGMENT);
+        try {
+            int n = tessellate(vertices, timestamps, up, lo, first, segments, origin, yOrigin);
+
+            Buffer buffer = buffers[chunk];
+            if (buffer == null) {
+                buffer = resources.getOrCreateBuffer(bufferName(chunk),
+                        BufferDescriptor.positionColor2D(Math.max(n, FLOATS_PER_VERTEX * 6)));
+                buffers[chunk] = buffer;
+            }
+            if (n > 0) {
+                buffer.upload(vertices, 0, n);
+            } else {
+                buffer.setVertexCount(0);
+            }
+        } finally {
+            arena.release(vertices);
+        }
+
+        origins[chunk] = origin;
+        yOrigins[chunk] = yOrigin;
+        builtSegments[chunk] = segments;
+    }
+
+    /**
+     * Writes the triangles of segments [first, first + segments) and returns
+     * the number of floats written.
+     */
+    private int tessellate(float[] vertices, long[] timestamps, float[] up, float[] lo,
+                           int first, int segments, long origin, double yOrigin) {
+        float ar = aboveColor.getRed() / 255f, ag = aboveColor.getGreen() / 255f,
+                ab = aboveColor.getBlue() / 255f, aa = aboveColor.getAlpha() / 255f;
+        float br = belowColor.getRed() / 255f, bg = belowColor.getGreen() / 255f,
+                bb = belowColor.getBlue() / 255f, ba = belowColor.getAlpha() / 255f;
+
+        int n = 0;
+        float x0 = 0;
+        float u0 = linear(up[first], yOrigin);
+        float l0 = linear(lo[first], yOrigin);
+        for (int i = first; i < first + segments; i++) {
+            float x1 = (float) (timestamps[i + 1] - origin);
+            float u1 = linear(up[i + 1], yOrigin);
+            float l1 = linear(lo[i + 1], yOrigin);
+
+            // NaN in either column breaks the fill
+            if (!Float.isNaN(u0 + l0 + u1 + l1)) {
+                float d0 = u0 - l0;
+                float d1 = u1 - l1;
+                if ((d0 >= 0) == (d1 >= 0) || d0 == 0 || d1 == 0) {
+                    boolean above = d0 + d1 >= 0;
+                    float r = above ? ar : br, g = above ? ag : bg, b = above ? ab : bb, a = above ? aa : ba;
+                    n = put(vertices, n, x0, u0, r, g, b, a);
+                    n = put(vertices, n, x0, l0, r, g, b, a);
+                    n = put(vertices, n, x1, u1, r, g, b, a);
+                    n = put(vertices, n, x1, u1, r, g, b, a);
+                    n = put(vertices, n, x0, l0, r, g, b, a);
+                    n = put(vertices, n, x1, l1, r, g, b, a);
+                } else {
+                    // Split at the crossing; each side takes its own color
+                    float t = d0 / (d0 - d1);
+                    float xc = x0 + t * (x1 - x0);
+                    float yc = u0 + t * (u1 - u0);
+                    boolean above = d0 > 0;
+                    float r = above ? ar : br, g = above ? ag : bg, b = above ? ab : bb, a = above ? aa : ba;
+                    n = put(vertices, n, x0, u0, r, g, b, a);
+                    n = put(vertices, n, x0, l0, r, g, b, a);
+                    n = put(vertices, n, xc, yc, r, g, b, a);
+                    r = above ? br : ar;
+                    g = above ? bg : ag;
+                    b = above ? bb : ab;
+                    a = above ? ba : aa;
+                    n = put(vertices, n, xc, yc, r, g, b, a);
+                    n = put(vertices, n, x1, u1, r, g, b, a);
+                    n = put(vertices, n, x1, l1, r, g, b, a);
+                }
+            }
+            x0 = x1;
+            u0 = u1;
+            l0 = l1;
+        }
+        return n;
+    }
+
+    /**
+     * Returns the linear-space value of the first valid point of points
+     * [first, last], or 0 if there is none.
+     */
+    private double yOrigin(float[] up, float[] lo, int first, int last) {
+        for (int i = first; i <= last; i++) {
+            if (!Float.isNaN(up[i])) {
+                return scale.toLinearSpace(up[i]);
+            }
+            if (!Float.isNaN(lo[i])) {
+                return scale.toLinearSpace(lo[i]);
+            }
+        }
+        return 0;
+    }
+
+    private float linear(float value, double yOrigin) {
+        return (float) (scale.toLinearSpace(value) - yOrigin);
+    }
+
+    private static int put(float[] v, int n, float x, float y, float r, float g, float b, float a) {
+        v[n] = x;
+        v[n + 1] = y;
+        v[n + 2] = r;
+        v[n + 3] = g;
+        v[n + 4] = b;
+        v[n + 5] = a;
+        return n + FLOATS_PER_VERTEX;
+    }
+
+    /**
+     * Writes projection x (screenX = ax * x + bx, screenY = ay * y + by)
+     * into the column-major uniform matrix.
+     */
+    private void composeProjection(float[] projection, double ax, double bx, double ay, double by) {
+        for (int r = 0; r < 4; r++) {
+            matrix[r] = (float) (projection[r] * ax);
+            matrix[4 + r] = (float) (projection[4 + r] * ay);
+            matrix[8 + r] = projection[8 + r];
+            matrix[12 + r] = (float) (projection[r] * bx + projection[4 + r] * by + projection[12 + r]);
+        }
+    }
+
+    // ========== Chunk bookkeeping ==========
+
+    /**
+     * Marks every chunk touching a segment at or after {@code from} stale;
+     * the chunks themselves are rebuilt when drawn.
+     */
+    @Override
+    protected void rebuild(int from, int to) {
+        int firstStale = Math.max(0, from - 1) / CHUNK_SEGMENTS;
+        for (int c = firstStale; c < builtSegments.length; c++) {
+            builtSegments[c] = -1;
+        }
+    }
+
+    private void ensureChunks(int count) {
+        if (count > buffers.length) {
+            int old = buffers.length;
+            buffers = Arrays.copyOf(buffers, count);
+            origins = Arrays.copyOf(origins, count);
+            yOrigins = Arrays.copyOf(yOrigins, count);
+            builtSegments = Arrays.copyOf(builtSegments, count);
+            Arrays.fill(builtSegments, old, count, -1);
+        }
+    }
+
+    private String bufferName(int chunk) {
+        return name + "_" + chunk;
+    }
+}
@@ -27,6 +27,9 @@ public class ColorMap {
     private int[] lut;
     private int lutSize;
 
+    /** Modification version, for caches of mapped colors */
+    private long version;
+
     // ========== Pre-built Color Maps ==========
 
     /**
@@ -154,8 +157,11 @@ public class ColorMap {
      * Sets the value range for mapping.
      */
     public ColorMap valueRange(float min, float max) {
-        this.minValue = min;
-        this.maxValue = max;
+        if (min != minValue || max != maxValue) {
+            this.minValue = min;
+            this.maxValue = max;
+            version++;
+        }
         return this;
     }
 
@@ -177,10 +183,32 @@ public class ColorMap {
                     ((int) (rgba[1] * 255) << 8) |
                     ((int) (rgba[2] * 255));
         }
+        version++;
 
         return this;
     }
 
+    /**
+     * Returns the modification version, incremented whenever the mapping
+     * changes.
+     *
+     * <p>Callers that modify the stop arrays passed to the constructor must
+     * call {@link #markModified()} afterwards.
+     */
+    public long getVersion() {
+        return version;
+    }
+
+    /**
+     * Marks the mapping as modified after direct stop array writes.
+     * Drops the lookup table, which no longer matches the stops.
+     */
+    public void markModified() {
+        lut = null;
+        lutSize = 0;
+        version++;
+    }
+
     // ========== Color Mapping ==========
 
     /**
@@ -0,0 +1,147 @@
+package com.apokalypsix.chartx.core.render.util;
+
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Frame-scoped pool of vertex scratch arrays shared by all layers of a pipeline.
+ *
+ * <p>Renderers used to keep their own growable vertex arrays sized to their
+ * peak visible count, so every series instance held its own copy for its whole
+ * lifetime. With the arena, a renderer acquires arrays while building a draw
+ * call and releases them once uploaded; the next layer or series reuses the
+ * same memory. Retained memory is therefore bounded by the arrays in use at
+ * the same time within one frame, not by the number of series.
+ *
+ * <p>Arrays come in power-of-two size classes. {@link #reset()} is called by
+ * the pipeline at the start of every frame: arrays a layer failed to release
+ * are reclaimed, and size classes that stayed above their recent peak usage
+ * for {@link #TRIM_FRAMES} frames are trimmed, so a one-off zoom-out does not
+ * pin its memory forever.
+ *
+ * <p>All methods are thread-safe so layers can acquire arrays from the
+ * parallel prepare phase.
+ */
+public final class VertexArena {
+
+    /** Smallest size class, in floats */
+    private static final int MIN_CLASS_BITS = 10;
+
+    /** Largest size class, in floats (2^30) */
+    private static final int MAX_CLASS_BITS = 30;
+
+    /** Frames a size class keeps arrays beyond its recent peak usage */
+    public static final int TRIM_FRAMES = 120;
+
+    private final SizeClass[] classes = new SizeClass[MAX_CLASS_BITS + 1];
+    private final List<float[]> outstanding = new ArrayList<>();
+
+    /**
+     * Returns an array of at least {@code minFloats} floats. Contents are undefined.
+     *
+     * @param minFloats minimum length
+     * @return an array owned by the caller until {@link #release}d or the next reset
+     */
+    public synchronized float[] acquire(int minFloats) {
+        int bits = classBits(minFloats);
+        SizeClass sizeClass = classes[bits];
+        if (sizeClass == null) {
+            sizeClass = new SizeClass();
+            classes[bits] = sizeClass;
+        }
+
+        float[] array = sizeClass.free.pollFirst();
+        if (array == null) {
+            array = new float[1 << bits];
+        }
+        sizeClass.inUse++;
+        sizeClass.framePeak = Math.max(sizeClass.framePeak, sizeClass.inUse);
+        outstanding.add(array);
+        return array;
+    }
+
+    /**
+     * Returns an array to the arena. Releasing null or an array that is not
+     * outstanding has no effect.
+     *
+     * @param array the array to release
+     */
+    public synchronized void release(float[] array) {
+        if (array == null) {
+            return;
+        }
+        // Most recently acquired arrays are released first
+        for (int i = outstanding.size() - 1; i >= 0; i--) {
+            if (outstanding.get(i) == array) {
+                outstanding.remove(i);
+                returnToClass(array);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Starts a new frame: reclaims unreleased arrays and trims idle memory.
+     */
+    public synchronized void reset() {
+        for (float[] array : outstanding) {
+            returnToClass(array);
+        }
+        outstanding.clear();
+
+        for (SizeClass sizeClass : classes) {
+            if (sizeClass == null) {
+                continue;
+            }
+            sizeClass.recentPeak = Math.max(sizeClass.recentPeak, sizeClass.framePeak);
+            sizeClass.framePeak = 0;
+            if (++sizeClass.framesSinceTrim >= TRIM_FRAMES) {
+                while (sizeClass.free.size() > sizeClass.recentPeak) {
+                    sizeClass.free.pollLast();
+                }
+                sizeClass.recentPeak = 0;
+                sizeClass.framesSinceTrim = 0;
+            }
+        }
+    }
+
+    /**
+     * Returns the number of bytes held by the arena, in use or free.
+     */
+    public synchronized long getRetainedBytes() {
+        long bytes = 0;
+        for (int bits = 0; bits < classes.length; bits++) {
+            SizeClass sizeClass = classes[bits];
+            if (sizeClass != null) {
+                bytes += (long) (sizeClass.free.size() + sizeClass.inUse) * (4L << bits);
+            }
+        }
+        return bytes;
+    }
+
+    private void returnToClass(float[] array) {
+        SizeClass sizeClass = classes[Integer.numberOfTrailingZeros(array.length)];
+        sizeClass.inUse--;
+        sizeClass.free.addFirst(array);
+    }
+
+    private static int classBits(int minFloats) {
+        if (minFloats <= 1 << MIN_CLASS_BITS) {
+            return MIN_CLASS_BITS;
+        }
+        int bits = 32 - Integer.numberOfLeadingZeros(minFloats - 1);
+        if (bits > MAX_CLASS_BITS) {
+            throw new IllegalArgumentException("Vertex array too large: " + minFloats + " floats");
+        }
+        return bits;
+    }
+
+    private static final class SizeClass {
+        final ArrayDeque<float[]> free = new ArrayDeque<>();
+        int inUse;
+        int framePeak;
+        int recentPeak;
+        int framesSinceTrim;
+    }
+}
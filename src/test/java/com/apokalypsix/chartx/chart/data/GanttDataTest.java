@@ -0,0 +1,163 @@
+package com.apokalypsix.chartx.chart.data;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Random;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.GanttData.Task;
+
+/**
+ * Unit tests for GanttData.
+ *
+ * <p>Validates the row index against brute-force scans of the task list.
+ */
+class GanttDataTest {
+
+    @Test
+    void getTasksInRange_matchesScanIncludingUnassignedTasks() {
+        Random random = new Random(11);
+        GanttData data = randomSchedule(random, 300);
+        // Leave some tasks without a row
+        for (int i = 0; i < 20; i++) {
+            long start = random.nextInt(10_000);
+            data.addTask("u" + i, "Unassigned " + i, start, start + random.nextInt(500));
+        }
+
+        for (int q = 0; q < 50; q++) {
+            long start = random.nextInt(10_000);
+            long end = start + random.nextInt(2_000);
+            assertEquals(scanRange(data, start, end), data.getTasksInRange(start, end));
+        }
+    }
+
+    @Test
+    void getTasksInWindow_matchesScanPerRow() {
+        Random random = new Random(5);
+        GanttData data = randomSchedule(random, 500);
+
+        for (int q = 0; q < 50; q++) {
+            long start = random.nextInt(10_000);
+            long end = start + random.nextInt(2_000);
+            int firstRow = random.nextInt(10);
+            int lastRow = firstRow + random.nextInt(10);
+
+            List<Task> window = new ArrayList<>();
+            data.getTasksInWindow(start, end, firstRow, lastRow, window);
+
+            List<Task> expected = new ArrayList<>();
+            for (Task task : scanRange(data, start, end)) {
+                if (task.getRow() >= firstRow && task.getRow() <= lastRow) {
+                    expected.add(task);
+                }
+            }
+            assertEquals(expected.size(), window.size());
+            assertTrue(window.containsAll(expected));
+        }
+    }
+
+    @Test
+    void findTaskAt_returnsFirstAddedOverlappingTask() {
+        GanttData data = new GanttData("g", "Gantt");
+        Task late = new Task("late", "Late", 50, 150);
+        late.setRow(0);
+        Task early = new Task("early", "Early", 0, 200);
+        early.setRow(0);
+        data.addTask(late);
+        data.addTask(early);
+
+        assertSame(late, data.findTaskAt(100, 0));
+        assertSame(early, data.findTaskAt(10, 0));
+        assertNull(data.findTaskAt(300, 0));
+    }
+
+    @Test
+    void autoAssignRows_packsAddedTasksWithoutOverlapOrMilestoneRow() {
+        Random random = new Random(2);
+        GanttData data = new GanttData("g", "Gantt");
+        for (int i = 0; i < 100; i++) {
+            long start = random.nextInt(10_000);
+            data.addTask("t" + i, "Task " + i, start, start + 1 + random.nextInt(500));
+        }
+        GanttData.Milestone milestone = data.addMilestone("m", "Release", 5_000);
+        data.autoAssignRows();
+        int milestoneRow = milestone.getRow();
+
+        for (int i = 0; i < 100; i++) {
+            long start = random.nextInt(10_000);
+            Task task = data.addTask("n" + i, "New " + i, start, start + 1 + random.nextInt(500));
+            assertNotEquals(milestoneRow, task.getRow(), "task packed into the milestone row");
+        }
+
+        for (int row = 0; row < data.getRowCount(); row++) {
+            List<Task> rowTasks = data.getTasksAtRow(row);
+            rowTasks.sort((a, b) -> Long.compare(a.getStartTime(), b.getStartTime()));
+            for (int i = 1; i < rowTasks.size(); i++) {
+                assertTrue(rowTasks.get(i).getStartTime() >= rowTasks.get(i - 1).getEndTime(),
+                        "overlapping tasks in row " + row);
+            }
+        }
+    }
+
+    @Test
+    void setRowAndRemoveTask_updatePackedRows() {
+        GanttData data = new GanttData("g", "Gantt");
+        Task first = data.addTask("a", "A", 0, 1_000);
+        Task second = data.addTask("b", "B", 0, 1_000);
+        data.autoAssignRows();
+        assertEquals(0, first.getRow());
+        assertEquals(1, second.getRow());
+
+        // Row 1 is empty once its task moves, so the next task is packed there
+        second.setRow(5);
+        Task third = data.addTask("c", "C", 10, 500);
+        assertEquals(1, third.getRow());
+
+        // Row 0 is free again once its task is removed
+        assertTrue(data.removeTask("a"));
+        Task fourth = data.addTask("d", "D", 20, 600);
+        assertEquals(0, fourth.getRow());
+    }
+
+    @Test
+    void getTasksInWindow_includesUnassignedTasksFromRowMinusOne() {
+        GanttData data = new GanttData("g", "Gantt");
+        Task assigned = new Task("a", "A", 0, 100);
+        assigned.setRow(0);
+        data.addTask(assigned);
+        Task unassigned = data.addTask("u", "U", 50, 150);
+
+        List<Task> window = new ArrayList<>();
+        data.getTasksInWindow(0, 200, -1, 0, window);
+        assertTrue(window.contains(assigned));
+        assertTrue(window.contains(unassigned));
+
+        window.clear();
+        data.getTasksInWindow(0, 200, 0, 0, window);
+        assertEquals(List.of(assigned), window);
+    }
+
+    private static GanttData randomSchedule(Random random, int count) {
+        GanttData data = new GanttData("g", "Gantt");
+        for (int i = 0; i < count; i++) {
+            long start = random.nextInt(10_000);
+            Task task = new Task("t" + i, "Task " + i, start, start + random.nextInt(500));
+            task.setRow(random.nextInt(20));
+            data.addTask(task);
+        }
+        return data;
+    }
+
+    private static List<Task> scanRange(GanttData data, long startTime, long endTime) {
+        List<Task> result = new ArrayList<>();
+        for (Task task : data.getTasks()) {
+            if (task.getEndTime() >= startTime && task.getStartTime() <= endTime) {
+                result.add(task);
+            }
+        }
+        return result;
+    }
+}
@@ -0,0 +1,168 @@
+package com.apokalypsix.chartx.chart.finance.alert;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.util.List;
+import java.util.concurrent.CopyOnWriteArrayList;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.core.data.TestBars;
+
+/**
+ * Unit tests for AlertEngine.
+ *
+ * <p>Evaluation is driven through {@link AlertEngine#evaluatePending()}, which
+ * evaluates a single symbol on the calling thread.
+ */
+class AlertEngineTest {
+
+    private AlertEngine engine;
+    private final List<AlertEvent> alerts = new CopyOnWriteArrayList<>();
+
+    @BeforeEach
+    void setUp() {
+        engine = new AlertEngine();
+        engine.setAutoEvaluate(false);
+        engine.addListener(alerts::add);
+    }
+
+    @AfterEach
+    void tearDown() {
+        engine.dispose();
+    }
+
+    @Test
+    void addSymbol_replaysHistorySilently() {
+        engine.addCondition("above", "close > 150");
+        OhlcData data = createData(100, 200, 100, 200);
+
+        engine.addSymbol("TEST", data);
+        engine.evaluatePending();
+
+        assertTrue(alerts.isEmpty());
+    }
+
+    @Test
+    void changeToTrue_firesOncePerBar() {
+        engine.addCondition("above", "close > 150");
+        OhlcData data = createData(100, 100);
+        engine.addSymbol("TEST", data);
+        engine.evaluatePending();
+
+        appendBar(data, 200);
+        engine.evaluatePending();
+        assertEquals(1, alerts.size());
+        AlertEvent event = alerts.get(0);
+        assertEquals("above", event.condition().getId());
+        assertEquals("TEST", event.symbol());
+        assertEquals(2, event.barIndex());
+        assertEquals(data.getXValue(2), event.timestamp());
+
+        // Updates of the forming bar and bars staying true don't fire again
+        data.updateLast(200, 210, 190, 205, 100);
+        engine.evaluatePending();
+        appendBar(data, 210);
+        engine.evaluatePending();
+        assertEquals(1, alerts.size());
+
+        appendBar(data, 100);
+        appendBar(data, 160);
+        engine.evaluatePending();
+        assertEquals(2, alerts.size());
+        assertEquals(5, alerts.get(1).barIndex());
+    }
+
+    @Test
+    void everyBarTrigger_firesOnEachTrueBar() {
+        engine.addCondition(new AlertCondition("above", "close > 150",
+                AlertCondition.Trigger.EVERY_BAR));
+        OhlcData data = createData(200);
+        engine.addSymbol("TEST", data);
+        engine.evaluatePending();
+
+        appendBar(data, 200);
+        appendBar(data, 100);
+        appendBar(data, 200);
+        engine.evaluatePending();
+
+        assertEquals(2, alerts.size());
+        assertEquals(1, alerts.get(0).barIndex());
+        assertEquals(3, alerts.get(1).barIndex());
+    }
+
+    @Test
+    void bulkLoad_replaysHistorySilently() {
+        engine.addCondition("above", "close > 1000");
+        OhlcData data = createData(100, 100, 100);
+        engine.addSymbol("TEST", data);
+        engine.evaluatePending();
+        appendBar(data, 100);
+        engine.evaluatePending();
+
+        // A longer history that is true throughout; loadFromArrays doesn't notify
+        OhlcData replacement = createData(2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000);
+        TestBars.loadCopy(data, replacement);
+        assertEquals(replacement.size(), data.size());
+
+        appendBar(data, 2000);
+        engine.evaluatePending();
+
+        assertTrue(alerts.isEmpty(), () -> "unexpected alerts " + alerts);
+    }
+
+    @Test
+    void addCondition_replaysHistorySilently() {
+        OhlcData data = createData(200, 200, 200);
+        engine.addSymbol("TEST", data);
+        engine.evaluatePending();
+
+        engine.addCondition("above", "close > 150");
+        engine.evaluatePending();
+        assertTrue(alerts.isEmpty());
+
+        appendBar(data, 100);
+        appendBar(data, 200);
+        engine.evaluatePending();
+        assertEquals(1, alerts.size());
+    }
+
+    @Test
+    void removeSymbol_stopsAlerts() {
+        engine.addCondition("above", "close > 150");
+        OhlcData data = createData(100);
+        engine.addSymbol("TEST", data);
+        engine.evaluatePending();
+
+        engine.removeSymbol("TEST");
+        appendBar(data, 200);
+        engine.evaluatePending();
+
+        assertTrue(alerts.isEmpty());
+    }
+
+    @Test
+    void sharedSubexpressions_areCompiledOnce() {
+        engine.addCondition("a", "close > SMA(close, 20)");
+        engine.addCondition("b", "close < SMA(close, 20)");
+
+        // close, SMA and the two comparisons
+        assertEquals(4, engine.getNodeCount());
+    }
+
+    private static OhlcData createData(float... closes) {
+        OhlcData data = new OhlcData("test", "Test");
+        for (float close : closes) {
+            appendBar(data, close);
+        }
+        return data;
+    }
+
+    private static void appendBar(OhlcData data, float close) {
+        long time = data.isEmpty() ? 0 : data.getXValue(data.size() - 1) + 60_000L;
+        data.append(time, close, close, close, close, 100);
+    }
+}
@@ -0,0 +1,107 @@
+package com.apokalypsix.chartx.chart.finance.alert;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.util.ArrayList;
+import java.util.List;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.EvaluationContext;
+import com.apokalypsix.chartx.core.data.TestBars;
+
+/**
+ * Unit tests for ConditionGraph.
+ *
+ * <p>Validates the incremental graph against direct evaluation of the ASTs.
+ */
+class ConditionGraphTest {
+
+    private static final String[] EXPRESSIONS = {
+            "SMA(close, 20)",
+            "EMA(close, 12) - EMA(close, 26)",
+            "RSI(14)",
+            "ATR(14)",
+            "WMA(hl2, 10)",
+            "STDEV(close, 20)",
+            "HIGHEST(high, 15) - LOWEST(low, 15)",
+            "abs(close - open) / max(high - low, 0.01)",
+            "close > SMA(close, 20) and RSI(14) < 70",
+            "crossAbove(EMA(close, 5), SMA(close, 20))",
+            "not (close >= open) or volume > 500",
+    };
+
+    private final TestBars bars = new TestBars();
+
+    @Test
+    void compile_mergesSharedSubexpressions() {
+        ConditionGraph graph = ConditionGraph.compile(List.of(
+                new AlertCondition("a", "close > SMA(close, 20)"),
+                new AlertCondition("b", "crossAbove(close, SMA(close, 20))")));
+
+        // close, SMA, the comparison and the cross
+        assertEquals(4, graph.getNodeCount());
+        assertNotEquals(graph.getRoot(0), graph.getRoot(1));
+    }
+
+    @Test
+    void evaluate_matchesAstEvaluation() {
+        OhlcData data = bars.createData(300);
+        ConditionGraph graph = compileAll();
+        ConditionGraph.Values values = graph.createValues();
+        EvaluationContext context = new EvaluationContext(data);
+
+        for (int i = 0; i < data.size(); i++) {
+            graph.evaluate(values, context, i);
+            assertRootsMatch(graph, values, context, i);
+        }
+    }
+
+    @Test
+    void evaluate_reevaluatesFormingBar() {
+        OhlcData data = bars.createData(100);
+        ConditionGraph graph = compileAll();
+        ConditionGraph.Values values = graph.createValues();
+
+        EvaluationContext context = new EvaluationContext(data);
+        for (int i = 0; i < data.size(); i++) {
+            graph.evaluate(values, context, i);
+        }
+
+        // Live updates of the last bar evaluate it again from the same state
+        int last = data.size() - 1;
+        for (int update = 0; update < 5; update++) {
+            float close = data.getClose(last) + (bars.random().nextFloat() - 0.5f) * 4;
+            data.updateLast(data.getOpen(last), Math.max(data.getHigh(last), close),
+                    Math.min(data.getLow(last), close), close, data.getVolume(last) + 10);
+            context = new EvaluationContext(data);
+            graph.evaluate(values, context, last);
+            assertRootsMatch(graph, values, context, last);
+        }
+    }
+
+    private static void assertRootsMatch(ConditionGraph graph, ConditionGraph.Values values,
+                                         EvaluationContext context, int index) {
+        List<AlertCondition> conditions = graph.getConditions();
+        for (int c = 0; c < conditions.size(); c++) {
+            AlertCondition condition = conditions.get(c);
+            float expected = condition.getAst().evaluate(context, index);
+            float actual = values.get(graph.getRoot(c), index);
+            String message = condition.getExpression() + " at " + index;
+            if (Float.isNaN(expected)) {
+                assertTrue(Float.isNaN(actual), message);
+            } else {
+                assertEquals(expected, actual, 1e-3f * Math.max(1, Math.abs(expected)), message);
+            }
+        }
+    }
+
+    private static ConditionGraph compileAll() {
+        List<AlertCondition> conditions = new ArrayList<>();
+        for (int i = 0; i < EXPRESSIONS.length; i++) {
+            conditions.add(new AlertCondition("c" + i, EXPRESSIONS[i]));
+        }
+        return ConditionGraph.compile(conditions);
+    }
+}
@@ -0,0 +1,150 @@
+package com.apokalypsix.chartx.chart.finance.indicator;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.data.XyData;
+import com.apokalypsix.chartx.core.data.SharedDataCache;
+
+/**
+ * Unit tests for IndicatorManager output sharing.
+ */
+class IndicatorManagerTest {
+
+    private static final int PERIOD = 3;
+
+    private OhlcData source;
+    private IndicatorManager first;
+    private IndicatorManager second;
+
+    @BeforeEach
+    void setUp() {
+        source = new OhlcData("test", "Test");
+        for (int i = 0; i < 10; i++) {
+            float price = 100 + i;
+            source.append(i * 60_000L, price, price + 1, price - 1, price, 1000);
+        }
+        first = createSharingManager(source);
+        second = createSharingManager(source);
+    }
+
+    @AfterEach
+    void tearDown() {
+        first.setSourceData(null);
+        second.setSourceData(null);
+    }
+
+    @Test
+    void sharedOutputs_followSourceMutations() {
+        IndicatorInstance<?, ?> a = first.addIndicator("sma", Map.of("period", PERIOD));
+        IndicatorInstance<?, ?> b = second.addIndicator("sma", Map.of("period", PERIOD));
+        assertSame(a.getOutputData(), b.getOutputData());
+
+        source.append(10 * 60_000L, 120, 121, 119, 120, 1000);
+        source.updateLast(120, 131, 119, 130, 1500);
+
+        assertMatchesFullRecompute((XyData) a.getOutputData());
+        assertSame(a.getOutputData(), b.getOutputData());
+    }
+
+    @Test
+    void soleHolderRecalculation_keepsCachedOutput() {
+        IndicatorInstance<?, ?> a = first.addIndicator("sma", Map.of("period", PERIOD));
+        Object output = a.getOutputData();
+
+        first.recalculateIndicator(a.getId());
+
+        assertSame(output, a.getOutputData());
+    }
+
+    @Test
+    void staleRecompute_notifiesEveryHolder() {
+        IndicatorInstance<?, ?> a = first.addIndicator("sma", Map.of("period", PERIOD));
+        IndicatorInstance<?, ?> b = second.addIndicator("sma", Map.of("period", PERIOD));
+        Object before = a.getOutputData();
+
+        List<IndicatorInstance<?, ?>> rebound = new ArrayList<>();
+        second.addListener(new RecalculationRecorder(rebound));
+
+        // An edit before the last bar makes the shared entry recompute
+        source.remove(0);
+        Object after = a.getOutputData();
+
+        assertNotSame(before, after);
+        assertSame(after, b.getOutputData());
+        assertEquals(List.of(b), rebound);
+        assertMatchesFullRecompute((XyData) after);
+    }
+
+    @Test
+    void disablingSharing_releasesLeases() {
+        IndicatorInstance<?, ?> a = first.addIndicator("sma", Map.of("period", PERIOD));
+        second.addIndicator("sma", Map.of("period", PERIOD));
+
+        first.setShareOutputs(false);
+        second.setShareOutputs(false);
+
+        assertEquals(0, SharedDataCache.getInstance().size());
+        assertNotNull(a.getOutputData());
+    }
+
+    @Test
+    void disablingSharing_detachesIntoPrivateOutput() {
+        IndicatorInstance<?, ?> a = first.addIndicator("sma", Map.of("period", PERIOD));
+        IndicatorInstance<?, ?> b = second.addIndicator("sma", Map.of("period", PERIOD));
+
+        first.setShareOutputs(false);
+        assertNotSame(a.getOutputData(), b.getOutputData());
+
+        // Each output is now updated exactly once, by its own owner
+        source.append(10 * 60_000L, 120, 121, 119, 120, 1000);
+        assertMatchesFullRecompute((XyData) a.getOutputData());
+        assertMatchesFullRecompute((XyData) b.getOutputData());
+    }
+
+    private void assertMatchesFullRecompute(XyData output) {
+        XyData expected = SMA.calculate(source, PERIOD);
+        assertEquals(expected.size(), output.size());
+        for (int i = 0; i < expected.size(); i++) {
+            assertEquals(expected.getXValue(i), output.getXValue(i), "time at " + i);
+            assertEquals(expected.getValue(i), output.getValue(i), 1e-4f, "value at " + i);
+        }
+    }
+
+    private static IndicatorManager createSharingManager(OhlcData source) {
+        IndicatorManager manager = new IndicatorManager();
+        IndicatorRegistry.registerBuiltInIndicators(manager);
+        manager.setShareOutputs(true);
+        manager.setSourceData(source);
+        return manager;
+    }
+
+    private record RecalculationRecorder(List<IndicatorInstance<?, ?>> recorded)
+            implements IndicatorManager.IndicatorListener {
+
+        @Override
+        public void onIndicatorAdded(IndicatorInstance<?, ?> instance) {
+        }
+
+        @Override
+        public void onIndicatorRemoved(IndicatorInstance<?, ?> instance) {
+        }
+
+        @Override
+        public void onIndicatorEnabledChanged(IndicatorInstance<?, ?> instance, boolean enabled) {
+        }
+
+        @Override
+        public void onIndicatorRecalculated(IndicatorInstance<?, ?> instance) {
+            recorded.add(instance);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+package com.apokalypsix.chartx.chart.finance.indicator.dsl;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.ComparisonNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.CrossNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.ExpressionNode;
+import com.apokalypsix.chartx.chart.finance.indicator.dsl.ast.LogicalNode;
+
+/**
+ * Unit tests for ExpressionParser conditions.
+ */
+class ExpressionParserTest {
+
+    @Test
+    void parseCondition_bindsAndTighterThanOr() {
+        ExpressionNode node = ExpressionParser.parseCondition(
+                "close > 1 and close < 3 or not volume == 0");
+
+        assertEquals("(((close > 1) and (close < 3)) or (not (volume == 0)))",
+                node.toExpressionString());
+    }
+
+    @Test
+    void parseCondition_acceptsSymbolicOperators() {
+        String keywords = ExpressionParser.parseCondition(
+                "not (close >= open) and high != low or low <= 0").toExpressionString();
+        String symbols = ExpressionParser.parseCondition(
+                "!(close >= open) && high != low || low <= 0").toExpressionString();
+
+        assertEquals(keywords, symbols);
+    }
+
+    @Test
+    void parseCondition_arithmeticBindsTighterThanComparison() {
+        ExpressionNode node = ExpressionParser.parseCondition("close - open > 2 * atr(14)");
+
+        assertInstanceOf(ComparisonNode.class, node);
+        assertEquals(ComparisonNode.Operator.GREATER, ((ComparisonNode) node).getOperator());
+    }
+
+    @Test
+    void parseCondition_crossAliases() {
+        ExpressionNode above = ExpressionParser.parseCondition("crossAbove(close, SMA(close, 20))");
+        ExpressionNode over = ExpressionParser.parseCondition("crossover(close, SMA(close, 20))");
+        ExpressionNode under = ExpressionParser.parseCondition("crossUnder(close, 100)");
+
+        assertEquals(above.toExpressionString(), over.toExpressionString());
+        assertEquals(CrossNode.Direction.ABOVE, ((CrossNode) above).getDirection());
+        assertEquals(CrossNode.Direction.BELOW, ((CrossNode) under).getDirection());
+    }
+
+    @Test
+    void parseCondition_rejectsMalformedConditions() {
+        assertThrows(IllegalArgumentException.class,
+                () -> ExpressionParser.parseCondition("crossAbove(close)"));
+        assertThrows(IllegalArgumentException.class,
+                () -> ExpressionParser.parseCondition("close >"));
+        assertThrows(IllegalArgumentException.class,
+                () -> ExpressionParser.parseCondition("close > 1)"));
+        assertThrows(IllegalArgumentException.class,
+                () -> ExpressionParser.parseCondition("close > 1 and"));
+    }
+
+    @Test
+    void evaluate_crossAndComparisonOnBars() {
+        OhlcData data = new OhlcData("test", "Test");
+        float[] closes = {99, 101, 102, 98, 103};
+        for (int i = 0; i < closes.length; i++) {
+            data.append(i * 60_000L, closes[i], closes[i], closes[i], closes[i], 100);
+        }
+        EvaluationContext context = new EvaluationContext(data);
+
+        ExpressionNode cross = ExpressionParser.parseCondition("crossAbove(close, 100)");
+        ExpressionNode above = ExpressionParser.parseCondition("close > 100");
+
+        float[] expectedCross = {Float.NaN, 1, 0, 0, 1};
+        float[] expectedAbove = {0, 1, 1, 0, 1};
+        for (int i = 0; i < closes.length; i++) {
+            assertEquals(expectedCross[i], cross.evaluate(context, i), "cross at " + i);
+            assertEquals(expectedAbove[i], above.evaluate(context, i), "above at " + i);
+        }
+    }
+
+    @Test
+    void logicalOperators_treatNaNAsUnknown() {
+        float nan = Float.NaN;
+
+        assertEquals(0, LogicalNode.apply(LogicalNode.Operator.AND, 0, nan));
+        assertTrue(Float.isNaN(LogicalNode.apply(LogicalNode.Operator.AND, 1, nan)));
+        assertEquals(1, LogicalNode.apply(LogicalNode.Operator.OR, nan, 1));
+        assertTrue(Float.isNaN(LogicalNode.apply(LogicalNode.Operator.OR, 0, nan)));
+        assertTrue(Float.isNaN(LogicalNode.apply(LogicalNode.Operator.NOT, nan, nan)));
+        assertEquals(1, LogicalNode.apply(LogicalNode.Operator.NOT, 0, nan));
+        assertTrue(Float.isNaN(ComparisonNode.apply(ComparisonNode.Operator.LESS, nan, 1)));
+        assertTrue(Float.isNaN(CrossNode.apply(CrossNode.Direction.ABOVE, nan, 0, 1, 0)));
+    }
+}
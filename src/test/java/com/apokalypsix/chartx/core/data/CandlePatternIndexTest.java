@@ -0,0 +1,158 @@
+package com.apokalypsix.chartx.core.data;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.core.data.CandlePatternIndex.Pattern;
+
+/**
+ * Unit tests for CandlePatternIndex.
+ */
+class CandlePatternIndexTest {
+
+    // Long bodies make soldiers, crows and engulfing bars show up
+    private final TestBars bars = new TestBars(6, 4);
+
+    @Test
+    void handBuiltBars_matchExpectedPatterns() {
+        OhlcData data = new OhlcData("test", "Test");
+        data.append(0, 110, 111, 99, 100, 1000);         // bearish
+        data.append(60_000, 99, 112, 98, 111, 1000);     // bullish, engulfs bar 0
+        data.append(120_000, 105, 110, 100, 105.2f, 1000); // doji
+        CandlePatternIndex index = data.getPatterns();
+        index.ensure(data.size());
+
+        assertTrue(index.isHit(Pattern.BULLISH_ENGULFING, 1));
+        assertFalse(index.isHit(Pattern.BULLISH_ENGULFING, 0));
+        assertTrue(index.isHit(Pattern.DOJI, 2));
+        assertFalse(index.isHit(Pattern.DOJI, 1));
+    }
+
+    @Test
+    void bits_matchReferenceAcrossWords() {
+        OhlcData data = bars.createData(300);
+        CandlePatternIndex index = data.getPatterns();
+        index.ensure(data.size());
+
+        assertAllBitsMatch(data, index);
+    }
+
+    @Test
+    void nextHitAndCountHits_matchBitScan() {
+        OhlcData data = bars.createData(200);
+        CandlePatternIndex index = data.getPatterns();
+        index.ensure(data.size());
+
+        for (Pattern pattern : Pattern.values()) {
+            for (int from = 0; from < data.size(); from += 7) {
+                for (int to = from; to <= data.size(); to += 11) {
+                    int expectedNext = -1;
+                    int expectedCount = 0;
+                    for (int i = from; i < to; i++) {
+                        if (index.isHit(pattern, i)) {
+                            if (expectedNext < 0) {
+                                expectedNext = i;
+                            }
+                            expectedCount++;
+                        }
+                    }
+                    String range = pattern + " [" + from + ", " + to + ")";
+                    assertEquals(expectedNext, index.nextHit(pattern, from, to), range);
+                    assertEquals(expectedCount, index.countHits(pattern, from, to), range);
+                }
+            }
+        }
+    }
+
+    @Test
+    void appendAndUpdateLast_reevaluateFormingBar() {
+        OhlcData data = bars.createData(63);
+        CandlePatternIndex index = data.getPatterns();
+        index.ensure(data.size());
+
+        for (int i = 0; i < 70; i++) {
+            bars.appendRandomBar(data);
+            if (i % 4 == 0) {
+                // Turn the forming bar into a doji
+                float mid = (data.getHigh(data.size() - 1) + data.getLow(data.size() - 1)) / 2;
+                data.updateLast(mid, mid + 5, mid - 5, mid, 10);
+            }
+            index.ensure(data.size());
+            assertAllBitsMatch(data, index);
+        }
+    }
+
+    @Test
+    void partialEnsure_thenExtend() {
+        OhlcData data = bars.createData(150);
+        CandlePatternIndex index = data.getPatterns();
+
+        index.ensure(70);
+        for (Pattern pattern : Pattern.values()) {
+            for (int i = 0; i < 70; i++) {
+                assertEquals(reference(data, pattern, i), index.isHit(pattern, i), pattern + " at " + i);
+            }
+        }
+
+        index.ensure(data.size());
+        assertAllBitsMatch(data, index);
+    }
+
+    private static void assertAllBitsMatch(OhlcData data, CandlePatternIndex index) {
+        for (Pattern pattern : Pattern.values()) {
+            for (int i = 0; i < data.size(); i++) {
+                assertEquals(reference(data, pattern, i), index.isHit(pattern, i), pattern + " at " + i);
+            }
+        }
+    }
+
+    /**
+     * Straightforward per-bar evaluation of the pattern definitions.
+     */
+    private static boolean reference(OhlcData data, Pattern pattern, int i) {
+        float o = data.getOpen(i), h = data.getHigh(i), l = data.getLow(i), c = data.getClose(i);
+        float body = Math.abs(c - o);
+        float range = h - l;
+        float upper = h - Math.max(o, c);
+        float lower = Math.min(o, c) - l;
+        boolean small = body <= 0.1f * range;
+
+        switch (pattern) {
+            case DOJI:
+                return range > 0 && small;
+            case HAMMER:
+                return !small && lower >= 2 * body && upper <= 0.5f * body;
+            case SHOOTING_STAR:
+                return !small && upper >= 2 * body && lower <= 0.5f * body;
+            default:
+                break;
+        }
+
+        if (i < 1) {
+            return false;
+        }
+        float o1 = data.getOpen(i - 1), c1 = data.getClose(i - 1);
+        float body1 = Math.abs(c1 - o1);
+        switch (pattern) {
+            case BULLISH_ENGULFING:
+                return c1 < o1 && c > o && o <= c1 && c >= o1 && body > body1;
+            case BEARISH_ENGULFING:
+                return c1 > o1 && c < o && o >= c1 && c <= o1 && body > body1;
+            default:
+                break;
+        }
+
+        if (i < 2) {
+            return false;
+        }
+        float o2 = data.getOpen(i - 2), c2 = data.getClose(i - 2);
+        if (pattern == Pattern.THREE_WHITE_SOLDIERS) {
+            return c2 > o2 && c1 > o1 && c > o && c1 > c2 && c > c1
+                    && o1 > o2 && o1 <= c2 && o > o1 && o <= c1;
+        }
+        return c2 < o2 && c1 < o1 && c < o && c1 < c2 && c < c1
+                && o1 < o2 && o1 >= c2 && o < o1 && o >= c1;
+    }
+}
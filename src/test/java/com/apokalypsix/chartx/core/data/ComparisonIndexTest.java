@@ -0,0 +1,153 @@
+package com.apokalypsix.chartx.core.data;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.util.Random;
+import java.util.TreeSet;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.XyData;
+
+/**
+ * Unit tests for ComparisonIndex.
+ */
+class ComparisonIndexTest {
+
+    private final TestBars bars = new TestBars();
+
+    @Test
+    void timeline_isSortedUnionOfSources() {
+        XyData a = bars.createData(new long[] {0, 2, 4, 6});
+        XyData b = bars.createData(new long[] {1, 2, 5});
+        ComparisonIndex index = new ComparisonIndex(a, b);
+
+        assertTimeline(index, 0, 1, 2, 4, 5, 6);
+
+        // Row of time 2 holds a point of both sources
+        assertEquals(1, index.getSourceIndex(0, 2));
+        assertEquals(1, index.getSourceIndex(1, 2));
+        // Row of time 4: b has a gap, its floor is the point at time 2
+        assertEquals(-1, index.getSourceIndex(1, 3));
+        assertEquals(1, index.getFloorIndex(1, 3));
+        // b starts after row 0
+        assertEquals(-1, index.getFloorIndex(1, 0));
+    }
+
+    @Test
+    void repeatedSourceTimestamps_collapseOntoOneRow() {
+        XyData a = new XyData("a", "A");
+        a.loadFromArrays(new long[] {0, 60, 60, 60, 120}, new float[] {1, 2, 3, 4, 5});
+        XyData b = bars.createData(new long[] {60, 90});
+        ComparisonIndex index = new ComparisonIndex(a, b);
+
+        assertTimeline(index, 0, 60, 90, 120);
+        // The row maps to the last of the repeated points
+        assertEquals(3, index.getSourceIndex(0, 1));
+        assertEquals(3, index.getFloorIndex(0, 2));
+        assertEquals(4, index.getSourceIndex(0, 3));
+        assertEquals(0, index.getSourceIndex(1, 1));
+    }
+
+    @Test
+    void appends_matchFreshIndex() {
+        XyData a = new XyData("a", "A");
+        XyData b = new XyData("b", "B");
+        XyData c = new XyData("c", "C");
+        ComparisonIndex index = new ComparisonIndex(a, b, c);
+
+        long[] times = new long[3];
+        XyData[] sources = {a, b, c};
+        Random random = bars.random();
+        for (int i = 0; i < 300; i++) {
+            // Sources advance unevenly, so appends often land before the newest row
+            int s = random.nextInt(sources.length);
+            times[s] += 1 + random.nextInt(5);
+            sources[s].append(times[s], random.nextFloat() * 100);
+            if (i % 7 == 0) {
+                assertSameAsFresh(index, sources);
+            }
+        }
+        assertSameAsFresh(index, sources);
+    }
+
+    @Test
+    void updateLast_changesValueAsOf() {
+        XyData a = bars.createData(new long[] {0, 1, 2});
+        XyData b = bars.createData(new long[] {0, 2});
+        ComparisonIndex index = new ComparisonIndex(a, b);
+        int modCount = index.getModCount();
+
+        b.updateLast(42);
+
+        assertNotEquals(modCount, index.getModCount());
+        assertEquals(42, index.getValueAsOf(1, 2));
+        assertTimeline(index, 0, 1, 2);
+    }
+
+    @Test
+    void valueAsOf_skipsGapsAndNaN() {
+        XyData a = bars.createData(new long[] {0, 1, 2, 3, 4});
+        XyData b = new XyData("b", "B");
+        b.append(1, Float.NaN);
+        b.append(2, 7);
+        b.append(4, Float.NaN);
+        ComparisonIndex index = new ComparisonIndex(a, b);
+
+        // Before any valid value: the first valid value after the row
+        assertEquals(7, index.getValueAsOf(1, 0));
+        assertEquals(7, index.getValueAsOf(1, 1));
+        // Gap at time 3 and NaN at time 4 fall back to the last valid value
+        assertEquals(7, index.getValueAsOf(1, 3));
+        assertEquals(7, index.getValueAsOf(1, 4));
+        // Rows past the end are clamped
+        assertEquals(7, index.getValueAsOf(1, 100));
+    }
+
+    @Test
+    void bulkLoad_rebuildsTimeline() {
+        XyData a = bars.createData(new long[] {0, 1, 2});
+        XyData b = bars.createData(new long[] {1, 3});
+        ComparisonIndex index = new ComparisonIndex(a, b);
+        assertTimeline(index, 0, 1, 2, 3);
+
+        a.loadFromArrays(new long[] {5, 6}, new float[] {1, 2});
+
+        assertTimeline(index, 1, 3, 5, 6);
+        assertEquals(-1, index.getFloorIndex(0, 1));
+        assertEquals(1, index.getSourceIndex(1, 1));
+    }
+
+    private static void assertSameAsFresh(ComparisonIndex index, XyData[] sources) {
+        ComparisonIndex fresh = new ComparisonIndex(sources);
+        try {
+            TreeSet<Long> union = new TreeSet<>();
+            for (XyData source : sources) {
+                for (int i = 0; i < source.size(); i++) {
+                    union.add(source.getXValue(i));
+                }
+            }
+            assertEquals(union.size(), index.getRowCount());
+            assertEquals(union.size(), fresh.getRowCount());
+
+            int row = 0;
+            for (long time : union) {
+                assertEquals(time, index.getTimestamp(row), "row " + row);
+                for (int s = 0; s < sources.length; s++) {
+                    assertEquals(fresh.getFloorIndex(s, row), index.getFloorIndex(s, row),
+                            "source " + s + " row " + row);
+                }
+                row++;
+            }
+        } finally {
+            fresh.dispose();
+        }
+    }
+
+    private static void assertTimeline(ComparisonIndex index, long... expected) {
+        assertEquals(expected.length, index.getRowCount());
+        for (int row = 0; row < expected.length; row++) {
+            assertEquals(expected[row], index.getTimestamp(row), "row " + row);
+        }
+    }
+}
@@ -0,0 +1,94 @@
+package com.apokalypsix.chartx.core.data;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+
+/**
+ * Unit tests for OhlcPyramid.
+ */
+class OhlcPyramidTest {
+
+    private final TestBars bars = new TestBars();
+
+    @Test
+    void queryRange_matchesScanForAllRanges() {
+        OhlcData data = bars.createData(77);
+        OhlcPyramid pyramid = data.getPyramid();
+        pyramid.ensure(data.size());
+
+        assertAllRangesMatch(data, pyramid);
+    }
+
+    @Test
+    void appendAndUpdateLast_matchScan() {
+        OhlcData data = bars.createData(40);
+        OhlcPyramid pyramid = data.getPyramid();
+        pyramid.ensure(data.size());
+
+        for (int i = 0; i < 25; i++) {
+            bars.appendRandomBar(data);
+            if (i % 3 == 0) {
+                data.updateLast(100, 200 + i, 1 - i, 100, 10);
+            }
+            pyramid.ensure(data.size());
+            assertAllRangesMatch(data, pyramid);
+        }
+    }
+
+    @Test
+    void bulkLoad_rebuildsLevels() {
+        OhlcData data = bars.createData(64);
+        OhlcPyramid pyramid = data.getPyramid();
+        pyramid.ensure(data.size());
+
+        TestBars.loadCopy(data, bars.createData(64));
+        pyramid.ensure(data.size());
+
+        assertAllRangesMatch(data, pyramid);
+    }
+
+    @Test
+    void partialEnsure_thenExtend() {
+        OhlcData data = bars.createData(100);
+        OhlcPyramid pyramid = data.getPyramid();
+
+        pyramid.ensure(37);
+        float[] out = new float[2];
+        pyramid.queryRange(0, 36, out);
+        assertEquals(scanHigh(data, 0, 36), out[0]);
+        assertEquals(scanLow(data, 0, 36), out[1]);
+
+        pyramid.ensure(data.size());
+        assertAllRangesMatch(data, pyramid);
+    }
+
+    private void assertAllRangesMatch(OhlcData data, OhlcPyramid pyramid) {
+        float[] out = new float[2];
+        for (int from = 0; from < data.size(); from++) {
+            for (int to = from; to < data.size(); to++) {
+                pyramid.queryRange(from, to, out);
+                assertEquals(scanHigh(data, from, to), out[0], "high of [" + from + ", " + to + "]");
+                assertEquals(scanLow(data, from, to), out[1], "low of [" + from + ", " + to + "]");
+            }
+        }
+    }
+
+    private static float scanHigh(OhlcData data, int from, int to) {
+        float high = Float.NEGATIVE_INFINITY;
+        for (int i = from; i <= to; i++) {
+            high = Math.max(high, data.getHigh(i));
+        }
+        return high;
+    }
+
+    private static float scanLow(OhlcData data, int from, int to) {
+        float low = Float.POSITIVE_INFINITY;
+        for (int i = from; i <= to; i++) {
+            low = Math.min(low, data.getLow(i));
+        }
+        return low;
+    }
+}
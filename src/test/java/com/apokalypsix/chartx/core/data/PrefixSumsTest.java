@@ -0,0 +1,124 @@
+package com.apokalypsix.chartx.core.data;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.util.Arrays;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.XyData;
+
+/**
+ * Unit tests for PrefixSums.
+ */
+class PrefixSumsTest {
+
+    private final TestBars bars = new TestBars();
+
+    @Test
+    void fit_matchesTwoPassReference() {
+        XyData data = bars.createTrend(200, 100, 0.05f, 2);
+        PrefixSums sums = data.getPrefixSums();
+
+        for (int from = 0; from < data.size(); from += 13) {
+            for (int to = from; to < data.size(); to += 17) {
+                assertFitMatches(data, sums, from, to, 1e-6);
+            }
+        }
+    }
+
+    @Test
+    void fit_shortRangeOnLongTrendingSeries() {
+        // Far from the first value, a short range is a tiny difference of two large prefixes
+        XyData data = bars.createTrend(400_000, 1_000, 0.25f, 0.5f);
+        PrefixSums sums = data.getPrefixSums();
+
+        int to = data.size() - 1;
+        assertFitMatches(data, sums, to - 19, to, 1e-4);
+        assertFitMatches(data, sums, to - 4, to, 1e-4);
+    }
+
+    @Test
+    void fit_skipsNaNGaps() {
+        XyData data = new XyData("test", "Test");
+        float[] values = {1, Float.NaN, 3, 4, Float.NaN, 6};
+        for (int i = 0; i < values.length; i++) {
+            data.append(i * 60_000L, values[i]);
+        }
+
+        PrefixSums.Fit fit = data.getPrefixSums().fit(0, values.length - 1);
+
+        assertEquals(4, fit.count());
+        assertEquals(3.5, fit.mean(), 1e-9);
+        // Valid points lie on y = x + 1
+        assertEquals(1.0, fit.slope(), 1e-9);
+        assertEquals(1.0, fit.valueAt(0), 1e-9);
+        assertEquals(1.0, fit.rSquared(), 1e-9);
+    }
+
+    @Test
+    void updateAndBulkLoad_refreshSums() {
+        XyData data = bars.createTrend(50, 100, 0.1f, 1);
+        PrefixSums sums = data.getPrefixSums();
+        sums.fit(0, data.size() - 1);
+
+        data.updateLast(500);
+        assertFitMatches(data, sums, 40, data.size() - 1, 1e-6);
+
+        XyData replacement = bars.createTrend(30, 20, -0.2f, 1);
+        int n = replacement.size();
+        data.loadFromArrays(Arrays.copyOf(replacement.getXValuesArray(), n),
+                Arrays.copyOf(replacement.getValuesArray(), n));
+        assertFitMatches(data, sums, 0, data.size() - 1, 1e-6);
+    }
+
+    @Test
+    void fit_emptyRange() {
+        XyData data = new XyData("test", "Test");
+        data.append(0, Float.NaN);
+
+        PrefixSums.Fit fit = data.getPrefixSums().fit(0, 0);
+
+        assertEquals(0, fit.count());
+        assertTrue(Double.isNaN(fit.mean()));
+    }
+
+    private static void assertFitMatches(XyData data, PrefixSums sums, int from, int to, double tolerance) {
+        PrefixSums.Fit fit = sums.fit(from, to);
+        String range = "[" + from + ", " + to + "]";
+
+        // Two-pass reference relative to the range itself
+        int n = 0;
+        double meanX = 0, meanY = 0;
+        for (int i = from; i <= to; i++) {
+            double y = data.getValue(i);
+            if (!Double.isNaN(y)) {
+                n++;
+                meanX += i;
+                meanY += y;
+            }
+        }
+        meanX /= n;
+        meanY /= n;
+        double sxx = 0, sxy = 0, syy = 0;
+        for (int i = from; i <= to; i++) {
+            double y = data.getValue(i);
+            if (!Double.isNaN(y)) {
+                sxx += (i - meanX) * (i - meanX);
+                sxy += (i - meanX) * (y - meanY);
+                syy += (y - meanY) * (y - meanY);
+            }
+        }
+        double slope = sxx > 0 ? sxy / sxx : 0;
+
+        assertEquals(n, fit.count(), range);
+        assertClose(meanY, fit.mean(), tolerance, "mean " + range);
+        assertClose(Math.sqrt(syy / n), fit.stdDev(), tolerance, "stdDev " + range);
+        assertClose(slope, fit.slope(), tolerance, "slope " + range);
+        assertClose(meanY + slope * (from - meanX), fit.valueAt(from), tolerance, "intercept " + range);
+    }
+
+    private static void assertClose(double expected, double actual, double tolerance, String message) {
+        assertEquals(expected, actual, tolerance * Math.max(1, Math.abs(expected)), message);
+    }
+}
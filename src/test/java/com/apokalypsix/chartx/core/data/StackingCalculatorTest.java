@@ -0,0 +1,126 @@
+package com.apokalypsix.chartx.core.data;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.util.List;
+import java.util.Random;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.XyData;
+import com.apokalypsix.chartx.core.data.StackingCalculator.StackMode;
+
+/**
+ * Unit tests for StackingCalculator.
+ *
+ * <p>Validates that incrementally maintained columns match a full
+ * recomputation over the same series.
+ */
+class StackingCalculatorTest {
+
+    private static final int INITIAL_SIZE = 200;
+
+    @Test
+    void appendAndUpdateLast_matchFullRecompute() {
+        Random random = new Random(42);
+        List<XyData> series = List.of(
+                randomSeries("a", INITIAL_SIZE, random),
+                randomSeries("b", INITIAL_SIZE, random),
+                randomSeries("c", INITIAL_SIZE, random));
+
+        StackingCalculator incremental = new StackingCalculator();
+        incremental.compute(series, 0, INITIAL_SIZE - 1, StackMode.NORMAL);
+
+        for (int step = 0; step < 50; step++) {
+            for (XyData s : series) {
+                long next = s.getXValue(s.size() - 1) + 1;
+                s.append(next, randomValue(random));
+                s.updateLast(randomValue(random));
+            }
+            int size = series.get(0).size();
+            incremental.compute(series, 0, size - 1, StackMode.NORMAL);
+        }
+
+        assertMatchesFullRecompute(incremental, series, StackMode.NORMAL);
+    }
+
+    @Test
+    void seriesOfDifferentLengths_matchFullRecompute() {
+        Random random = new Random(7);
+        XyData a = randomSeries("a", INITIAL_SIZE, random);
+        XyData b = randomSeries("b", INITIAL_SIZE / 2, random);
+        List<XyData> series = List.of(a, b);
+
+        StackingCalculator incremental = new StackingCalculator();
+        incremental.compute(series, 0, INITIAL_SIZE - 1, StackMode.PERCENT_100);
+
+        // The shorter series catches up without the longest size changing
+        for (int i = b.size(); i < INITIAL_SIZE; i++) {
+            b.append(i, randomValue(random));
+            if (i % 10 == 0) {
+                incremental.compute(series, 0, INITIAL_SIZE - 1, StackMode.PERCENT_100);
+            }
+        }
+        incremental.compute(series, 0, INITIAL_SIZE - 1, StackMode.PERCENT_100);
+
+        assertMatchesFullRecompute(incremental, series, StackMode.PERCENT_100);
+    }
+
+    @Test
+    void bulkLoadWithSameSize_recomputesColumns() {
+        Random random = new Random(3);
+        XyData a = randomSeries("a", INITIAL_SIZE, random);
+        XyData b = randomSeries("b", INITIAL_SIZE, random);
+        List<XyData> series = List.of(a, b);
+
+        StackingCalculator incremental = new StackingCalculator();
+        incremental.compute(series, 0, INITIAL_SIZE - 1, StackMode.NORMAL);
+
+        long[] timestamps = new long[INITIAL_SIZE];
+        float[] values = new float[INITIAL_SIZE];
+        for (int i = 0; i < INITIAL_SIZE; i++) {
+            timestamps[i] = i;
+            values[i] = randomValue(random);
+        }
+        a.loadFromArrays(timestamps, values);
+        incremental.compute(series, 0, INITIAL_SIZE - 1, StackMode.NORMAL);
+
+        assertMatchesFullRecompute(incremental, series, StackMode.NORMAL);
+    }
+
+    private static void assertMatchesFullRecompute(StackingCalculator incremental, List<XyData> series,
+                                                   StackMode mode) {
+        int size = series.get(0).size();
+        StackingCalculator full = new StackingCalculator();
+        full.compute(series, 0, size - 1, mode);
+
+        for (int s = 0; s < series.size(); s++) {
+            for (int d = 0; d < size; d++) {
+                assertEquals(full.getStackedTop(s, d), incremental.getStackedTop(s, d),
+                        "top of series " + s + " at " + d);
+                assertEquals(full.getStackedBaseline(s, d), incremental.getStackedBaseline(s, d),
+                        "baseline of series " + s + " at " + d);
+            }
+        }
+        assertEquals(full.findMinStackedValue(), incremental.findMinStackedValue());
+        assertEquals(full.findMaxStackedValue(), incremental.findMaxStackedValue());
+    }
+
+    private static XyData randomSeries(String id, int size, Random random) {
+        XyData data = new XyData(id, id);
+        for (int i = 0; i < size; i++) {
+            data.append(i, randomValue(random));
+        }
+        return data;
+    }
+
+    private static float randomValue(Random random) {
+        // Mix of positive, negative and missing values
+        int kind = random.nextInt(10);
+        if (kind == 0) {
+            return Float.NaN;
+        }
+        float value = random.nextFloat() * 100f;
+        return kind < 3 ? -value : value;
+    }
+}
@@ -0,0 +1,112 @@
+package com.apokalypsix.chartx.core.data;
+
+import java.util.Arrays;
+import java.util.Random;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.data.XyData;
+
+/**
+ * Seeded random bars and series for data tests.
+ *
+ * <p>Each instance starts from the same seed, so a test sees the same data on
+ * every run. OHLC bars are a random walk: each bar opens within 1 of the
+ * previous close and has a variable volume.
+ */
+public final class TestBars {
+
+    private final Random random = new Random(42);
+    private final float bodyRange;
+    private final float wickRange;
+
+    /**
+     * Creates a generator with bodies of up to 4 and wicks of up to 2.
+     */
+    public TestBars() {
+        this(4, 2);
+    }
+
+    /**
+     * Creates a generator with the given bar proportions.
+     *
+     * @param bodyRange largest distance between open and close
+     * @param wickRange largest wick beyond the body, on either side
+     */
+    public TestBars(float bodyRange, float wickRange) {
+        this.bodyRange = bodyRange;
+        this.wickRange = wickRange;
+    }
+
+    /**
+     * Returns the generator's random source, for test-specific values.
+     */
+    public Random random() {
+        return random;
+    }
+
+    /**
+     * Creates OHLC data of {@code size} one-minute bars starting at time 0.
+     */
+    public OhlcData createData(int size) {
+        OhlcData data = new OhlcData("test", "Test");
+        for (int i = 0; i < size; i++) {
+            appendRandomBar(data);
+        }
+        return data;
+    }
+
+    /**
+     * Appends the next bar of the random walk, one minute after the last bar.
+     */
+    public void appendRandomBar(OhlcData data) {
+        long time = data.isEmpty() ? 0 : data.getXValue(data.size() - 1) + 60_000L;
+        float prev = data.isEmpty() ? 100 : data.getClose(data.size() - 1);
+        float open = prev + (random.nextFloat() - 0.5f) * 2;
+        float close = open + (random.nextFloat() - 0.5f) * bodyRange;
+        float high = Math.max(open, close) + random.nextFloat() * wickRange;
+        float low = Math.min(open, close) - random.nextFloat() * wickRange;
+        data.append(time, open, high, low, close, 100 + random.nextInt(1000));
+    }
+
+    /**
+     * Creates XY data of one-minute points along a noisy linear trend.
+     *
+     * @param start value before the first step
+     * @param trend change per point
+     * @param noise width of the uniform noise around the trend
+     */
+    public XyData createTrend(int size, float start, float trend, float noise) {
+        XyData data = new XyData("test", "Test");
+        float value = start;
+        for (int i = 0; i < size; i++) {
+            value += trend;
+            data.append(i * 60_000L, value + (random.nextFloat() - 0.5f) * noise);
+        }
+        return data;
+    }
+
+    /**
+     * Creates XY data with the given ascending times and random values in [1, 101).
+     */
+    public XyData createData(long[] times) {
+        XyData data = new XyData("test", "Test");
+        for (long time : times) {
+            data.append(time, 1 + random.nextFloat() * 100);
+        }
+        return data;
+    }
+
+    /**
+     * Bulk loads a copy of {@code source} into {@code data}, which does not
+     * notify listeners.
+     */
+    public static void loadCopy(OhlcData data, OhlcData source) {
+        int n = source.size();
+        data.loadFromArrays(Arrays.copyOf(source.getTimestampsArray(), n),
+                Arrays.copyOf(source.getOpenArray(), n),
+                Arrays.copyOf(source.getHighArray(), n),
+                Arrays.copyOf(source.getLowArray(), n),
+                Arrays.copyOf(source.getCloseArray(), n),
+                Arrays.copyOf(source.getVolumeArray(), n));
+    }
+}
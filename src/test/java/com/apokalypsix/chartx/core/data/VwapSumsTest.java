@@ -0,0 +1,129 @@
+package com.apokalypsix.chartx.core.data;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.core.data.VwapSums.Vwap;
+
+/**
+ * Unit tests for VwapSums.
+ */
+class VwapSumsTest {
+
+    private final TestBars bars = new TestBars();
+
+    @Test
+    void vwap_matchesDirectReference() {
+        OhlcData data = bars.createData(300);
+        VwapSums sums = data.getVwapSums();
+
+        for (int anchor = 0; anchor < data.size(); anchor += 11) {
+            for (int index = anchor; index < data.size(); index += 13) {
+                assertVwapMatches(data, sums, anchor, index);
+            }
+        }
+    }
+
+    @Test
+    void fill_matchesVwapPerBar() {
+        OhlcData data = bars.createData(120);
+        VwapSums sums = data.getVwapSums();
+        int anchor = 40;
+        int from = 30;
+        int to = 100;
+        int offset = 5;
+        float[] vwapOut = new float[offset + to - from + 1];
+        float[] stdDevOut = new float[vwapOut.length];
+
+        sums.fill(anchor, from, to, vwapOut, stdDevOut, offset);
+
+        for (int i = from; i <= to; i++) {
+            int k = offset + i - from;
+            if (i < anchor) {
+                assertTrue(Float.isNaN(vwapOut[k]), "before anchor at " + i);
+                assertTrue(Float.isNaN(stdDevOut[k]), "before anchor at " + i);
+            } else {
+                Vwap expected = sums.vwap(anchor, i);
+                assertEquals(expected.vwap(), vwapOut[k], 1e-3, "vwap at " + i);
+                assertEquals(expected.stdDev(), stdDevOut[k], 1e-3, "stdDev at " + i);
+            }
+        }
+        // Output before the offset is untouched
+        assertEquals(0, vwapOut[0]);
+    }
+
+    @Test
+    void barsWithoutVolumeOrPrice_areSkipped() {
+        OhlcData data = new OhlcData("test", "Test");
+        data.append(0, 10, 10, 10, 10, 100);
+        data.append(60_000, 50, 50, 50, 50, 0);
+        data.append(120_000, Float.NaN, Float.NaN, Float.NaN, Float.NaN, 100);
+        data.append(180_000, 20, 20, 20, 20, 300);
+        VwapSums sums = data.getVwapSums();
+
+        Vwap vwap = sums.vwap(0, 3);
+
+        assertEquals(400, vwap.volume(), 1e-9);
+        assertEquals(17.5, vwap.vwap(), 1e-9);
+        // Prices 10 (weight 1/4) and 20 (weight 3/4)
+        assertEquals(Math.sqrt(0.25 * 7.5 * 7.5 + 0.75 * 2.5 * 2.5), vwap.stdDev(), 1e-9);
+        assertEquals(Vwap.EMPTY, sums.vwap(1, 2));
+    }
+
+    @Test
+    void emptyRanges() {
+        OhlcData data = bars.createData(10);
+        VwapSums sums = data.getVwapSums();
+
+        assertEquals(Vwap.EMPTY, sums.vwap(5, 4));
+        assertEquals(Vwap.EMPTY, sums.vwap(20, 30));
+        assertTrue(Double.isNaN(Vwap.EMPTY.band(2)));
+    }
+
+    @Test
+    void appendUpdateAndBulkLoad_refreshSums() {
+        OhlcData data = bars.createData(50);
+        VwapSums sums = data.getVwapSums();
+        sums.vwap(0, data.size() - 1);
+
+        bars.appendRandomBar(data);
+        assertVwapMatches(data, sums, 10, data.size() - 1);
+
+        data.updateLast(200, 210, 190, 205, 5000);
+        assertVwapMatches(data, sums, 10, data.size() - 1);
+        assertVwapMatches(data, sums, data.size() - 1, data.size() - 1);
+
+        TestBars.loadCopy(data, bars.createData(30));
+        assertVwapMatches(data, sums, 0, data.size() - 1);
+        assertVwapMatches(data, sums, 12, 20);
+    }
+
+    private static void assertVwapMatches(OhlcData data, VwapSums sums, int anchor, int index) {
+        String range = "[" + anchor + ", " + index + "]";
+        Vwap vwap = sums.vwap(anchor, index);
+
+        // Two-pass reference
+        double volume = 0, weighted = 0;
+        for (int i = anchor; i <= index; i++) {
+            volume += data.getVolume(i);
+            weighted += typicalPrice(data, i) * data.getVolume(i);
+        }
+        double mean = weighted / volume;
+        double squares = 0;
+        for (int i = anchor; i <= index; i++) {
+            double d = typicalPrice(data, i) - mean;
+            squares += d * d * data.getVolume(i);
+        }
+
+        assertEquals(volume, vwap.volume(), 1e-6 * volume, "volume " + range);
+        assertEquals(mean, vwap.vwap(), 1e-6 * Math.abs(mean), "vwap " + range);
+        assertEquals(Math.sqrt(squares / volume), vwap.stdDev(), 1e-6 * Math.abs(mean), "stdDev " + range);
+        assertEquals(mean + 2 * vwap.stdDev(), vwap.band(2), 1e-6 * Math.abs(mean), "band " + range);
+    }
+
+    private static double typicalPrice(OhlcData data, int i) {
+        return (data.getHigh(i) + data.getLow(i) + data.getClose(i)) / 3.0;
+    }
+}
@@ -0,0 +1,139 @@
+package com.apokalypsix.chartx.core.data.io;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.Channels;
+import java.nio.channels.ReadableByteChannel;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+
+import com.apokalypsix.chartx.chart.data.OhlcData;
+import com.apokalypsix.chartx.chart.data.XyData;
+import com.apokalypsix.chartx.core.data.TestBars;
+
+/**
+ * Unit tests for ArrowIpc.
+ */
+class ArrowIpcTest {
+
+    private final TestBars bars = new TestBars();
+
+    @TempDir
+    Path tempDir;
+
+    @Test
+    void fileRoundTrip_oddRowCountAcrossBatches() throws IOException {
+        // Odd batch lengths need padding after each float32 column
+        OhlcData data = bars.createData(1001);
+        ArrowIpc arrow = new ArrowIpc().batchSize(64);
+        Path path = tempDir.resolve("bars.arrow");
+
+        arrow.writeOhlc(path, data);
+        OhlcData read = arrow.readOhlc(path, "read", "Read");
+
+        assertOhlcEquals(data, read);
+    }
+
+    @Test
+    void streamRoundTrip_oddRowCountAcrossBatches() throws IOException {
+        XyData data = bars.createTrend(333, 50, 0.1f, 10);
+        ArrowIpc arrow = new ArrowIpc().batchSize(50);
+
+        XyData read = arrow.readXy(Channels.newChannel(new ByteArrayInputStream(writeStream(arrow, data))),
+                "read", "Read");
+
+        assertXyEquals(data, read);
+    }
+
+    @Test
+    void emptyData_roundTrips() throws IOException {
+        XyData data = new XyData("empty", "Empty");
+        ArrowIpc arrow = new ArrowIpc();
+        Path path = tempDir.resolve("empty.arrow");
+
+        arrow.writeXy(path, data);
+
+        assertEquals(0, arrow.readXy(path, "read", "Read").size());
+        assertEquals(0, arrow.readXy(Channels.newChannel(new ByteArrayInputStream(writeStream(arrow, data))),
+                "read", "Read").size());
+    }
+
+    @Test
+    void bigEndianSchema_isRejected() {
+        List<FlatBuffers.Table> fields = new ArrayList<>();
+        fields.add(new FlatBuffers.Table()
+                .addOffset(0, "timestamp")
+                .addByte(2, 10)
+                .addOffset(3, new FlatBuffers.Table().addShort(0, 1))
+                .addOffset(5, new ArrayList<FlatBuffers.Table>()));
+        FlatBuffers.Table schema = new FlatBuffers.Table().addShort(0, 1).addOffset(1, fields);
+        byte[] metadata = FlatBuffers.finish(new FlatBuffers.Table()
+                .addShort(0, 4)
+                .addByte(1, 1)
+                .addOffset(2, schema)
+                .addLong(3, 0));
+
+        IOException e = assertThrows(IOException.class,
+                () -> new ArrowIpc().readXy(stream(metadata), "read", "Read"));
+        assertTrue(e.getMessage().contains("Big-endian"), e.getMessage());
+    }
+
+    @Test
+    void offsetsBeyondTheBuffer_areRejected() {
+        // Unsigned values with the top bit set, which read negative as ints
+        byte[] metadata = {(byte) 0xF0, (byte) 0xFF, (byte) 0xFF, (byte) 0xFF, 0, 0, 0, 0};
+        byte[] vector = {0, 0, 0, 0, (byte) 0xF0, (byte) 0xFF, (byte) 0xFF, (byte) 0xFF};
+
+        assertThrows(IndexOutOfBoundsException.class,
+                () -> FlatBuffers.root(FlatBuffers.wrap(metadata), 0));
+        assertThrows(IndexOutOfBoundsException.class,
+                () -> FlatBuffers.vectorLength(FlatBuffers.wrap(vector), 4));
+        assertThrows(IOException.class,
+                () -> new ArrowIpc().readXy(stream(metadata), "read", "Read"));
+    }
+
+    private static byte[] writeStream(ArrowIpc arrow, XyData data) throws IOException {
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        arrow.writeXy(Channels.newChannel(out), data);
+        return out.toByteArray();
+    }
+
+    /**
+     * Wraps one metadata-only message as an Arrow stream.
+     */
+    private static ReadableByteChannel stream(byte[] metadata) {
+        ByteBuffer bytes = ByteBuffer.allocate(8 + metadata.length + 8).order(ByteOrder.LITTLE_ENDIAN);
+        bytes.putInt(0xFFFFFFFF).putInt(metadata.length).put(metadata);
+        bytes.putInt(0xFFFFFFFF).putInt(0);
+        return Channels.newChannel(new ByteArrayInputStream(bytes.array()));
+    }
+
+    private static void assertOhlcEquals(OhlcData expected, OhlcData actual) {
+        assertEquals(expected.size(), actual.size());
+        for (int i = 0; i < expected.size(); i++) {
+            assertEquals(expected.getXValue(i), actual.getXValue(i), "time at " + i);
+            assertEquals(expected.getOpen(i), actual.getOpen(i), "open at " + i);
+            assertEquals(expected.getHigh(i), actual.getHigh(i), "high at " + i);
+            assertEquals(expected.getLow(i), actual.getLow(i), "low at " + i);
+            assertEquals(expected.getClose(i), actual.getClose(i), "close at " + i);
+            assertEquals(expected.getVolume(i), actual.getVolume(i), "volume at " + i);
+        }
+    }
+
+    private static void assertXyEquals(XyData expected, XyData actual) {
+        assertEquals(expected.size(), actual.size());
+        for (int i = 0; i < expected.size(); i++) {
+            assertEquals(expected.getXValue(i), actual.getXValue(i), "time at " + i);
+            assertEquals(expected.getValue(i), actual.getValue(i), "value at " + i);
+        }
+    }
+}
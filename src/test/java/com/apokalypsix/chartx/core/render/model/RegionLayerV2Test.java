@@ -0,0 +1,82 @@
+package com.apokalypsix.chartx.core.render.model;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.awt.Color;
+import java.util.List;
+import java.util.Random;
+
+import org.junit.jupiter.api.Test;
+
+import com.apokalypsix.chartx.chart.overlay.region.PriceRangeRegion;
+import com.apokalypsix.chartx.chart.overlay.region.TimeRangeRegion;
+
+/**
+ * Unit tests for the region lookups of RegionLayerV2.
+ */
+class RegionLayerV2Test {
+
+    private final Random random = new Random(7);
+
+    @Test
+    void timeRegionAt_matchesScanInInsertionOrder() {
+        RegionLayerV2 layer = new RegionLayerV2();
+        for (int i = 0; i < 200; i++) {
+            long start = random.nextInt(10_000);
+            layer.addRegion(new TimeRangeRegion("t" + i, start, start + random.nextInt(500),
+                    Color.GRAY, null, null));
+        }
+        layer.getTimeRegions().get(3).setVisible(false);
+
+        for (long t = -10; t < 10_600; t += 7) {
+            assertSame(scanTime(layer.getTimeRegions(), t), layer.getTimeRegionAt(t), "at " + t);
+        }
+    }
+
+    @Test
+    void priceRegionAt_matchesScanInInsertionOrder() {
+        RegionLayerV2 layer = new RegionLayerV2();
+        for (int i = 0; i < 200; i++) {
+            double min = random.nextDouble() * 1000;
+            layer.addPriceRegion(new PriceRangeRegion("p" + i, min, min + random.nextDouble() * 50,
+                    Color.GRAY, null, null));
+        }
+
+        for (double price = -1; price < 1100; price += 0.73) {
+            assertSame(scanPrice(layer.getPriceRegions(), price), layer.getPriceRegionAt(price),
+                    "at " + price);
+        }
+    }
+
+    @Test
+    void inPlaceEdit_isPickedUp() {
+        RegionLayerV2 layer = new RegionLayerV2();
+        TimeRangeRegion first = new TimeRangeRegion("first", 0, 100, Color.GRAY, null, null);
+        TimeRangeRegion second = new TimeRangeRegion("second", 200, 300, Color.GRAY, null, null);
+        layer.addRegion(first);
+        layer.addRegion(second);
+        assertSame(second, layer.getTimeRegionAt(250));
+
+        first.setTimeRange(240, 260);
+        assertSame(first, layer.getTimeRegionAt(250));
+        assertNull(layer.getTimeRegionAt(50));
+    }
+
+    private static TimeRangeRegion scanTime(List<TimeRangeRegion> regions, long time) {
+        for (TimeRangeRegion region : regions) {
+            if (region.isVisible() && region.contains(time)) {
+                return region;
+            }
+        }
+        return null;
+    }
+
+    private static PriceRangeRegion scanPrice(List<PriceRangeRegion> regions, double price) {
+        for (PriceRangeRegion region : regions) {
+            if (region.isVisible() && region.contains(price)) {
+                return region;
+            }
+        }
+        return null;
+    }
+}